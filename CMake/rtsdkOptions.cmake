@@ -73,6 +73,11 @@ CMAKE_DEPENDENT_OPTION(BUILD_EMA_TRAINING
                                 "Build the Ema Training examples" ON
                                 "BUILD_EMA_EXAMPLES" OFF)
 
+# Counts EMA pool cache hits and shared pool lock hold time, for debugging
+option(BUILD_EMA_POOL_STATISTICS "Collect Ema pool statistics" OFF)
+
+mark_as_advanced(BUILD_EMA_POOL_STATISTICS)
+
 option(BUILD_UNIT_TESTS "Build unit tests" ON)
 
 # The default value of BUILD_EMA_XXXXX is ON 
@@ -0,0 +1,173 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+#include "Access/Impl/EmaPool.h"
+#include "Access/Impl/Thread.h"
+#include <vector>
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+class PooledItem
+{
+public :
+
+	PooledItem() : _inUse( 0 ) {}
+
+	volatile int	_inUse;
+};
+
+typedef Pool< PooledItem > PooledItemPool;
+
+TEST(EmaPoolTest, reuseOnSameThread)
+{
+	PooledItemPool pool( 5 );
+
+	PooledItem* item = pool.getItem();
+	ASSERT_TRUE( item != 0 );
+	ASSERT_EQ( 0, pool.count() );
+
+	pool.returnItem( item );
+	ASSERT_EQ( 1, pool.count() );
+
+	ASSERT_EQ( item, pool.getItem() );
+	ASSERT_EQ( 0, pool.count() );
+
+	pool.returnItem( item );
+}
+
+TEST(EmaPoolTest, overflowToSharedStack)
+{
+	const UInt32 itemCount = 3 * EMA_POOL_THREAD_CACHE_SIZE;
+	PooledItemPool pool( 5 );
+	vector< PooledItem* > items;
+
+	for ( UInt32 i = 0; i < itemCount; ++i )
+		items.push_back( pool.getItem() );
+
+	for ( UInt32 i = 0; i < itemCount; ++i )
+		pool.returnItem( items[i] );
+
+	ASSERT_EQ( itemCount, pool.count() );
+
+	// every item comes back exactly once
+	for ( UInt32 i = 0; i < itemCount; ++i )
+	{
+		PooledItem* item = pool.getItem();
+		ASSERT_EQ( 0, item->_inUse );
+		item->_inUse = 1;
+	}
+
+	ASSERT_EQ( 0, pool.count() );
+
+	for ( UInt32 i = 0; i < itemCount; ++i )
+	{
+		items[i]->_inUse = 0;
+		pool.returnItem( items[i] );
+	}
+
+	pool.clear();
+	ASSERT_EQ( 0, pool.count() );
+}
+
+class PoolUser : public Thread
+{
+public :
+
+	PoolUser( PooledItemPool& pool, UInt32 batchSize, UInt32 rounds ) :
+		_pool( pool ), _batchSize( batchSize ), _rounds( rounds ), _failed( false )
+	{
+	}
+
+	~PoolUser()
+	{
+		wait();
+	}
+
+	void start() { Thread::start(); }
+
+	void wait() { Thread::wait(); }
+
+	bool failed() const { return _failed; }
+
+protected :
+
+	void run()
+	{
+		vector< PooledItem* > items( _batchSize );
+
+		for ( UInt32 round = 0; round < _rounds; ++round )
+		{
+			for ( UInt32 i = 0; i < _batchSize; ++i )
+			{
+				items[i] = _pool.getItem();
+
+				// an item handed to two threads at once would already be marked
+				if ( items[i]->_inUse )
+					_failed = true;
+				items[i]->_inUse = 1;
+			}
+
+			for ( UInt32 i = 0; i < _batchSize; ++i )
+			{
+				items[i]->_inUse = 0;
+				_pool.returnItem( items[i] );
+			}
+		}
+	}
+
+	int runLog( void*, const char*, unsigned int ) { return 0; }
+
+private :
+
+	PooledItemPool&	_pool;
+	UInt32			_batchSize;
+	UInt32			_rounds;
+	bool			_failed;
+};
+
+TEST(EmaPoolTest, threadExitReturnsItems)
+{
+	PooledItemPool pool( 5 );
+
+	PoolUser user( pool, 10, 1 );
+	user.start();
+	user.wait();
+
+	// the thread's cache went back to the shared stack, where this thread can reach it
+	ASSERT_EQ( 10, pool.count() );
+
+	PooledItem* item = pool.getItem();
+	ASSERT_EQ( 9, pool.count() );
+	pool.returnItem( item );
+}
+
+TEST(EmaPoolTest, multipleThreads)
+{
+	const UInt32 threadCount = 4;
+	PooledItemPool pool( 5 );
+	vector< PoolUser* > users;
+
+	// batches larger than a cache, so items keep moving through the shared stack
+	for ( UInt32 i = 0; i < threadCount; ++i )
+		users.push_back( new PoolUser( pool, EMA_POOL_THREAD_CACHE_SIZE + 7, 2000 ) );
+
+	for ( UInt32 i = 0; i < threadCount; ++i )
+		users[i]->start();
+
+	for ( UInt32 i = 0; i < threadCount; ++i )
+	{
+		users[i]->wait();
+		ASSERT_FALSE( users[i]->failed() );
+		delete users[i];
+	}
+
+	ASSERT_GE( pool.count(), EMA_POOL_THREAD_CACHE_SIZE + 7 );
+	ASSERT_LE( pool.count(), threadCount * ( EMA_POOL_THREAD_CACHE_SIZE + 7 ) );
+}
@@ -0,0 +1,395 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+// Encodes: fid not found, UINT, REAL, INT, ASCII, ENUM, FLOAT, DOUBLE, blank REAL, BUFFER
+static void encodeTestFieldList( RsslBuffer& rsslBuf )
+{
+	RsslFieldList rsslFL;
+	RsslEncodeIterator iter;
+	RsslFieldEntry rsslFEntry;
+
+	rsslClearFieldList( &rsslFL );
+	rsslClearEncodeIterator( &iter );
+
+	rsslSetEncodeIteratorRWFVersion( &iter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION );
+	rsslSetEncodeIteratorBuffer( &iter, &rsslBuf );
+	rsslFL.flags = RSSL_FLF_HAS_STANDARD_DATA;
+
+	rsslEncodeFieldListInit( &iter, &rsslFL, 0, 0 );
+
+	rsslClearFieldEntry( &rsslFEntry );
+
+	rsslFEntry.dataType = RSSL_DT_UINT;
+	rsslFEntry.fieldId = -100;
+	RsslUInt64 uint64 = 64;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&uint64 );
+
+	rsslFEntry.dataType = RSSL_DT_UINT;
+	rsslFEntry.fieldId = 1;		// PROD_PERM + UINT
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&uint64 );
+
+	rsslFEntry.dataType = RSSL_DT_REAL;
+	rsslFEntry.fieldId = 6;		// TRDPRC_1  + REAL
+	RsslReal real;
+	real.isBlank = RSSL_FALSE;
+	real.hint = RSSL_RH_EXPONENT_2;
+	real.value = 11;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&real );
+
+	rsslFEntry.dataType = RSSL_DT_INT;
+	rsslFEntry.fieldId = -2;		// INTEGER + INT
+	RsslInt64 int64 = -32;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&int64 );
+
+	rsslFEntry.dataType = RSSL_DT_ASCII_STRING;
+	rsslFEntry.fieldId = 715;		// STORY_ID + ASCII
+	RsslBuffer ascii;
+	ascii.data = const_cast<char*>( "ABCDEF" );
+	ascii.length = 6;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&ascii );
+
+	rsslFEntry.dataType = RSSL_DT_ENUM;
+	rsslFEntry.fieldId = 4;		// RDN_EXCHID + ENUM
+	RsslEnum enumm = 29;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&enumm );
+
+	rsslFEntry.dataType = RSSL_DT_FLOAT;
+	rsslFEntry.fieldId = -9;
+	RsslFloat floatValue = 11.5f;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&floatValue );
+
+	rsslFEntry.dataType = RSSL_DT_DOUBLE;
+	rsslFEntry.fieldId = -10;
+	RsslDouble doubleValue = 22.25;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&doubleValue );
+
+	rsslFEntry.dataType = RSSL_DT_REAL;
+	rsslFEntry.fieldId = 7;		// TRDPRC_2  + REAL
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, 0 );
+
+	rsslFEntry.dataType = RSSL_DT_BUFFER;
+	rsslFEntry.fieldId = -11;		// MY_BUFFER
+	RsslBuffer buffer;
+	buffer.data = const_cast<char*>( "ABCDEFGH" );
+	buffer.length = 8;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&buffer );
+
+	rsslEncodeFieldListComplete( &iter, RSSL_TRUE );
+
+	rsslBuf.length = rsslGetEncodedBufferLength( &iter );
+}
+
+TEST(FieldListViewTest, testViewDecodeAll)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE( loadDictionaryFromFile( &dictionary ) ) << "Failed to load dictionary";
+
+	char data[1000];
+	RsslBuffer rsslBuf;
+	rsslBuf.data = data;
+	rsslBuf.length = sizeof( data );
+
+	encodeTestFieldList( rsslBuf );
+
+	try
+	{
+		FieldList fl;
+		StaticDecoder::setRsslData( &fl, &rsslBuf, RSSL_DT_FIELD_LIST, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary );
+
+		FieldListView view( fl );
+
+		for ( int pass = 0; pass < 2; ++pass )
+		{
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - first entry";
+			EXPECT_EQ( -100, view.getFieldId() );
+			EXPECT_EQ( DataType::ErrorEnum, view.getLoadType() ) << "fid not in dictionary";
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - second entry";
+			EXPECT_EQ( 1, view.getFieldId() );
+			EXPECT_EQ( DataType::UIntEnum, view.getLoadType() );
+			EXPECT_EQ( Data::NoCodeEnum, view.getCode() );
+			EXPECT_EQ( 64, view.getUInt() );
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - third entry";
+			EXPECT_EQ( DataType::RealEnum, view.getLoadType() );
+			EXPECT_EQ( 11, view.getRealMantissa() );
+			EXPECT_EQ( OmmReal::ExponentNeg2Enum, view.getRealMagnitudeType() );
+			EXPECT_DOUBLE_EQ( 0.11, view.getDouble() );
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - fourth entry";
+			EXPECT_EQ( DataType::IntEnum, view.getLoadType() );
+			EXPECT_EQ( -32, view.getInt() );
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - fifth entry";
+			EXPECT_EQ( DataType::AsciiEnum, view.getLoadType() );
+			EXPECT_EQ( 6, view.getRawLength() );
+			EXPECT_EQ( 0, memcmp( view.getRawData(), "ABCDEF", 6 ) );
+			EXPECT_TRUE( view.getRawData() >= data && view.getRawData() < data + rsslBuf.length ) << "ascii is not copied";
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - sixth entry";
+			EXPECT_EQ( DataType::EnumEnum, view.getLoadType() );
+			EXPECT_EQ( 29, view.getEnum() );
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - seventh entry";
+			EXPECT_EQ( DataType::FloatEnum, view.getLoadType() );
+			EXPECT_DOUBLE_EQ( 11.5, view.getDouble() );
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - eighth entry";
+			EXPECT_EQ( DataType::DoubleEnum, view.getLoadType() );
+			EXPECT_DOUBLE_EQ( 22.25, view.getDouble() );
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - ninth entry";
+			EXPECT_EQ( DataType::RealEnum, view.getLoadType() );
+			EXPECT_EQ( Data::BlankEnum, view.getCode() );
+
+			EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - tenth entry";
+			EXPECT_EQ( DataType::BufferEnum, view.getLoadType() );
+			EXPECT_EQ( 8, view.getRawLength() );
+			EXPECT_EQ( 0, memcmp( view.getRawData(), "ABCDEFGH", 8 ) );
+
+			EXPECT_FALSE( view.forth() ) << "FieldListView::forth() - end of field list";
+			EXPECT_FALSE( view.forth() ) << "FieldListView::forth() - stays at end";
+
+			view.reset();
+		}
+
+		// the view does not move the FieldList's own iteration
+		EXPECT_TRUE( fl.forth() );
+		EXPECT_EQ( -100, fl.getEntry().getFieldId() );
+	}
+	catch ( const OmmException& excp )
+	{
+		EXPECT_FALSE( true ) << "FieldListView decode - exception not expected: " << excp;
+	}
+
+	rsslDeleteDataDictionary( &dictionary );
+}
+
+TEST(FieldListViewTest, testViewInvalidUsage)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE( loadDictionaryFromFile( &dictionary ) ) << "Failed to load dictionary";
+
+	char data[1000];
+	RsslBuffer rsslBuf;
+	rsslBuf.data = data;
+	rsslBuf.length = sizeof( data );
+
+	encodeTestFieldList( rsslBuf );
+
+	FieldList fl;
+	StaticDecoder::setRsslData( &fl, &rsslBuf, RSSL_DT_FIELD_LIST, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary );
+
+	FieldListView view( fl );
+
+	view.forth();
+	view.forth();
+
+	try
+	{
+		view.getInt();
+		EXPECT_FALSE( true ) << "FieldListView::getInt() on UInt entry - exception expected";
+	}
+	catch ( const OmmInvalidUsageException& )
+	{
+		EXPECT_TRUE( true ) << "FieldListView::getInt() on UInt entry - exception expected";
+	}
+
+	for ( int i = 0; i < 7; ++i )
+		view.forth();
+
+	try
+	{
+		view.getDouble();
+		EXPECT_FALSE( true ) << "FieldListView::getDouble() on blank entry - exception expected";
+	}
+	catch ( const OmmInvalidUsageException& )
+	{
+		EXPECT_TRUE( true ) << "FieldListView::getDouble() on blank entry - exception expected";
+	}
+
+	try
+	{
+		FieldList encoded;
+		encoded.addUInt( 1, 64 ).complete();
+		view.set( encoded );
+		EXPECT_FALSE( true ) << "FieldListView::set() on FieldList being encoded - exception expected";
+	}
+	catch ( const OmmInvalidUsageException& )
+	{
+		EXPECT_TRUE( true ) << "FieldListView::set() on FieldList being encoded - exception expected";
+	}
+
+	rsslDeleteDataDictionary( &dictionary );
+}
+
+TEST(FieldListViewTest, testViewBlankWithHint)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE( loadDictionaryFromFile( &dictionary ) ) << "Failed to load dictionary";
+
+	char data[1000];
+	RsslBuffer rsslBuf;
+	rsslBuf.data = data;
+	rsslBuf.length = sizeof( data );
+
+	RsslFieldList rsslFL;
+	RsslEncodeIterator iter;
+	RsslFieldEntry rsslFEntry;
+
+	rsslClearFieldList( &rsslFL );
+	rsslClearEncodeIterator( &iter );
+
+	rsslSetEncodeIteratorRWFVersion( &iter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION );
+	rsslSetEncodeIteratorBuffer( &iter, &rsslBuf );
+	rsslFL.flags = RSSL_FLF_HAS_STANDARD_DATA;
+
+	rsslEncodeFieldListInit( &iter, &rsslFL, 0, 0 );
+
+	// blank REAL encoded as a single hint byte with the blank bit set
+	char blankReal = 0x20;
+	rsslClearFieldEntry( &rsslFEntry );
+	rsslFEntry.fieldId = 6;		// TRDPRC_1  + REAL
+	rsslFEntry.encData.data = &blankReal;
+	rsslFEntry.encData.length = 1;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, 0 );
+
+	rsslClearFieldEntry( &rsslFEntry );
+	rsslFEntry.dataType = RSSL_DT_REAL;
+	rsslFEntry.fieldId = 7;		// TRDPRC_2  + REAL
+	RsslReal real;
+	real.isBlank = RSSL_FALSE;
+	real.hint = RSSL_RH_EXPONENT_2;
+	real.value = 11;
+	rsslEncodeFieldEntry( &iter, &rsslFEntry, ( void* )&real );
+
+	rsslEncodeFieldListComplete( &iter, RSSL_TRUE );
+
+	rsslBuf.length = rsslGetEncodedBufferLength( &iter );
+
+	FieldList fl;
+	StaticDecoder::setRsslData( &fl, &rsslBuf, RSSL_DT_FIELD_LIST, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary );
+
+	ASSERT_TRUE( fl.forth() );
+	EXPECT_EQ( Data::BlankEnum, fl.getEntry().getCode() ) << "FieldEntry reports the hint byte as blank";
+
+	FieldListView view( fl );
+
+	EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - first entry";
+	EXPECT_EQ( DataType::RealEnum, view.getLoadType() );
+	EXPECT_EQ( 1, view.getRawLength() );
+	EXPECT_EQ( Data::BlankEnum, view.getCode() ) << "FieldListView::getCode() on blank REAL with hint byte";
+
+	try
+	{
+		view.getDouble();
+		EXPECT_FALSE( true ) << "FieldListView::getDouble() on blank REAL with hint byte - exception expected";
+	}
+	catch ( const OmmInvalidUsageException& )
+	{
+		EXPECT_TRUE( true ) << "FieldListView::getDouble() on blank REAL with hint byte - exception expected";
+	}
+
+	EXPECT_TRUE( view.forth() ) << "FieldListView::forth() - second entry";
+	EXPECT_EQ( Data::NoCodeEnum, view.getCode() );
+	EXPECT_DOUBLE_EQ( 0.11, view.getDouble() );
+
+	EXPECT_FALSE( view.forth() ) << "FieldListView::forth() - end of field list";
+
+	rsslDeleteDataDictionary( &dictionary );
+}
+
+TEST(FieldListViewTest, testPerfViewAgainstFieldEntry)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE( loadDictionaryFromFile( &dictionary ) ) << "Failed to load dictionary";
+
+	char data[1000];
+	RsslBuffer rsslBuf;
+	rsslBuf.data = data;
+	rsslBuf.length = sizeof( data );
+
+	encodeTestFieldList( rsslBuf );
+
+	const int loopCount = 100000;
+	double entrySum = 0, viewSum = 0;
+
+	FieldList fl;
+	StaticDecoder::setRsslData( &fl, &rsslBuf, RSSL_DT_FIELD_LIST, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary );
+
+	TimeValue startTime = GetTime::getNanos();
+
+	for ( int i = 0; i < loopCount; ++i )
+	{
+		fl.reset();
+		while ( fl.forth() )
+		{
+			const FieldEntry& fe = fl.getEntry();
+			if ( fe.getCode() == Data::BlankEnum )
+				continue;
+
+			switch ( fe.getLoadType() )
+			{
+			case DataType::UIntEnum : entrySum += (double)fe.getUInt(); break;
+			case DataType::IntEnum : entrySum += (double)fe.getInt(); break;
+			case DataType::RealEnum : entrySum += fe.getReal().getAsDouble(); break;
+			case DataType::FloatEnum : entrySum += fe.getFloat(); break;
+			case DataType::DoubleEnum : entrySum += fe.getDouble(); break;
+			case DataType::EnumEnum : entrySum += fe.getEnum(); break;
+			case DataType::AsciiEnum : entrySum += fe.getAscii().length(); break;
+			case DataType::BufferEnum : entrySum += fe.getBuffer().length(); break;
+			default : break;
+			}
+		}
+	}
+
+	TimeValue entryTime = GetTime::getNanos() - startTime;
+
+	startTime = GetTime::getNanos();
+
+	for ( int i = 0; i < loopCount; ++i )
+	{
+		FieldListView view( fl );
+		while ( view.forth() )
+		{
+			if ( view.getCode() == Data::BlankEnum )
+				continue;
+
+			switch ( view.getLoadType() )
+			{
+			case DataType::UIntEnum : viewSum += (double)view.getUInt(); break;
+			case DataType::IntEnum : viewSum += (double)view.getInt(); break;
+			case DataType::RealEnum :
+			case DataType::FloatEnum :
+			case DataType::DoubleEnum : viewSum += view.getDouble(); break;
+			case DataType::EnumEnum : viewSum += view.getEnum(); break;
+			case DataType::AsciiEnum :
+			case DataType::BufferEnum : viewSum += view.getRawLength(); break;
+			default : break;
+			}
+		}
+	}
+
+	TimeValue viewTime = GetTime::getNanos() - startTime;
+
+	EXPECT_DOUBLE_EQ( entrySum, viewSum ) << "FieldListView and FieldEntry decode the same values";
+
+	cout << "FieldList::forth()/getEntry(): " << ( (double)entryTime / loopCount ) << " ns per field list, "
+		<< "FieldListView: " << ( (double)viewTime / loopCount ) << " ns per field list" << endl;
+
+	rsslDeleteDataDictionary( &dictionary );
+}
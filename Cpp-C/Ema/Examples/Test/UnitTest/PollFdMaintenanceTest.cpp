@@ -8,13 +8,38 @@
 
 #include "TestUtilities.h"
 #include "Access/Impl/OmmBaseImplMap.h"
+#include "Access/Impl/Pipe.h"
 #include <vector>
 
+#ifdef USING_EPOLL
+#include <unistd.h>
+#endif
+
 using namespace thomsonreuters::ema::access;
 using namespace std;
 
 #ifdef USING_POLL
-class EventFds : public OmmCommonImpl {
+class CommonImplStub : public OmmCommonImpl {
+protected:
+  // all needed because of pure virtual functions
+  ImplementationType getImplType() { return ConsumerEnum; }
+  void handleIue(const EmaString&, Int32) {}
+  void handleIue(const char*, Int32) {}
+  void handleIhe(UInt64, const EmaString&) {}
+  void handleIhe(UInt64, const char*) {}
+  void handleMee(const char*) {}
+  // all dummy ipplementation need to fix warning: [-Wreturn-type] 
+  LoggerConfig& getActiveLoggerConfig() {static LoggerConfig dummyConfig; return dummyConfig;}
+  OmmLoggerClient& getOmmLoggerClient() {static int dummyLoger[10]; return reinterpret_cast<OmmLoggerClient&>(dummyLoger);}
+  ErrorClientHandler& getErrorClientHandler() {static int dummyHeader[10]; return reinterpret_cast<ErrorClientHandler&>(dummyHeader);}
+  bool hasErrorClientHandler() const {return true;}
+  EmaString& getInstanceName() const {static EmaString str; return str;}
+  void msgDispatched(bool value = true) {}
+  Mutex& getUserMutex() {static Mutex mtx; return mtx;}
+  bool isAtExit() {return true;}
+};
+
+class EventFds : public CommonImplStub {
 public:
   EventFds() {
 	_eventFds = new pollfd[2];
@@ -86,27 +111,54 @@ private:
 	  return false;
 	}
   }
-
-  // all needed because of pure virtual functions
-  ImplementationType getImplType() { return ConsumerEnum; }
-  void handleIue(const EmaString&, Int32) {}
-  void handleIue(const char*, Int32) {}
-  void handleIhe(UInt64, const EmaString&) {}
-  void handleIhe(UInt64, const char*) {}
-  void handleMee(const char*) {}
-  // all dummy ipplementation need to fix warning: [-Wreturn-type] 
-  LoggerConfig& getActiveLoggerConfig() {static LoggerConfig dummyConfig; return dummyConfig;}
-  OmmLoggerClient& getOmmLoggerClient() {static int dummyLoger[10]; return reinterpret_cast<OmmLoggerClient&>(dummyLoger);}
-  ErrorClientHandler& getErrorClientHandler() {static int dummyHeader[10]; return reinterpret_cast<ErrorClientHandler&>(dummyHeader);}
-  bool hasErrorClientHandler() const {return true;}
-  EmaString& getInstanceName() const {static EmaString str; return str;}
-  void msgDispatched(bool value = true) {}
-  Mutex& getUserMutex() {static Mutex mtx; return mtx;}
-  bool isAtExit() {return true;}
 };
 
 TEST(PollFdMaintenanceTest, eventFds)
 {
   EventFds eventFds;
 }
+
+#ifdef USING_EPOLL
+class EpollEventFds : public CommonImplStub {
+public:
+  EpollEventFds() {
+	Pipe pipe;
+	char temp[10];
+	epoll_event events[4];
+
+	EXPECT_TRUE(pipe.create());
+	_epollFd = epoll_create1(0);
+	EXPECT_NE(_epollFd, -1);
+	if (!pipe.isInitialized() || _epollFd == -1)
+	  return;
+
+	EXPECT_EQ(addFd(pipe.readFD()), 0);
+	EXPECT_EQ(addFd(pipe.readFD()), 0);	// already there
+	EXPECT_EQ(_eventFdsCount, 0);
+	EXPECT_EQ(epoll_wait(_epollFd, events, 4, 0), 0);
+
+	// several writes are coalesced into one event, cleared by a single read
+	pipe.write("0", 1);
+	pipe.write("0", 1);
+	pipe.write("0", 1);
+	EXPECT_EQ(epoll_wait(_epollFd, events, 4, 0), 1);
+	EXPECT_EQ(events[0].data.fd, pipe.readFD());
+	EXPECT_EQ(pipe.read(temp, 1), 1);
+	EXPECT_EQ(epoll_wait(_epollFd, events, 4, 0), 0);
+	EXPECT_EQ(pipe.read(temp, 1), -1);
+
+	pipe.write("0", 1);
+	removeFd(pipe.readFD());
+	EXPECT_EQ(epoll_wait(_epollFd, events, 4, 0), 0);
+
+	close(_epollFd);
+	_epollFd = -1;
+  }
+};
+
+TEST(PollFdMaintenanceTest, epollEventFds)
+{
+  EpollEventFds eventFds;
+}
+#endif
 #endif
@@ -0,0 +1,187 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|          Copyright (C) 2019-2020 Refinitiv. All rights reserved.          --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+#include "EmaAppClient.h"
+#include "OmmIProviderConfigImpl.h"
+#include "OmmIProviderImpl.h"
+#include "ClientSession.h"
+#include "ServerChannelHandler.h"
+#include "rtr/rsslTransport.h"
+
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+static const UInt32 shardCount = 3;
+
+static void sleepMs(UInt32 milliSeconds)
+{
+#if defined(WIN32)
+	Sleep(milliSeconds);
+#else
+	usleep(milliSeconds * 1000);
+#endif
+}
+
+static RsslChannel* connectClient(const char* port)
+{
+	RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+	RsslInProgInfo inProg = RSSL_INIT_IN_PROG_INFO;
+	RsslError error;
+
+	connectOpts.connectionInfo.unified.address = (char*)"localhost";
+	connectOpts.connectionInfo.unified.serviceName = (char*)port;
+	connectOpts.majorVersion = RSSL_RWF_MAJOR_VERSION;
+	connectOpts.minorVersion = RSSL_RWF_MINOR_VERSION;
+	connectOpts.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+
+	RsslChannel* pChannel = rsslConnect(&connectOpts, &error);
+	if (!pChannel)
+		return 0;
+
+	for (int attempt = 0; attempt < 500 && pChannel->state == RSSL_CH_STATE_INITIALIZING; ++attempt)
+	{
+		if (rsslInitChannel(pChannel, &inProg, &error) < RSSL_RET_SUCCESS)
+			break;
+
+		if (pChannel->state == RSSL_CH_STATE_INITIALIZING)
+			sleepMs(10);
+	}
+
+	if (pChannel->state != RSSL_CH_STATE_ACTIVE)
+	{
+		rsslCloseChannel(pChannel, &error);
+		return 0;
+	}
+
+	return pChannel;
+}
+
+static bool waitForShardSessionCount(OmmIProviderImpl& ommIProviderImpl, UInt32 count)
+{
+	for (int attempt = 0; attempt < 500; ++attempt)
+	{
+		bool done = true;
+
+		for (UInt32 shard = 0; shard < shardCount; ++shard)
+		{
+			if (ommIProviderImpl.getReactorShardSessionCount(shard) != count)
+				done = false;
+		}
+
+		if (done)
+			return true;
+
+		sleepMs(10);
+	}
+
+	return false;
+}
+
+static UInt32 getActiveSessionCount(OmmIProviderImpl& ommIProviderImpl)
+{
+	ommIProviderImpl.getUserMutex().lock();
+	UInt32 count = ommIProviderImpl.getServerChannelHandler().getClientSessionList().size();
+	ommIProviderImpl.getUserMutex().unlock();
+
+	return count;
+}
+
+TEST(ReactorShardTest, clientChannelsSpreadAcrossShards)
+{
+	AppClient appClient;
+	Map outermostMap, innerMap;
+	ElementList elementList;
+
+	elementList.addAscii("DefaultIProvider", "Provider_1");
+	innerMap.addKeyAscii("Provider_1", MapEntry::AddEnum, ElementList()
+		.addAscii("Server", "Server_1")
+		.addUInt("ReactorShardCount", shardCount)
+		.complete())
+		.complete();
+
+	elementList.addMap("IProviderList", innerMap);
+	elementList.complete();
+	innerMap.clear();
+
+	outermostMap.addKeyAscii("IProviderGroup", MapEntry::AddEnum, elementList);
+	elementList.clear();
+
+	innerMap.addKeyAscii("Server_1", MapEntry::AddEnum, ElementList()
+		.addEnum("ServerType", 0)
+		.addAscii("Port", "14060")
+		.complete())
+		.complete();
+
+	elementList.addMap("ServerList", innerMap);
+	elementList.complete();
+	innerMap.clear();
+
+	outermostMap.addKeyAscii("ServerGroup", MapEntry::AddEnum, elementList).complete();
+	elementList.clear();
+
+	try
+	{
+		OmmIProviderImpl ommIProviderImpl(OmmIProviderConfig().config(outermostMap), appClient);
+
+		ASSERT_EQ(ommIProviderImpl.getReactorShardCount(), shardCount);
+
+		RsslChannel* clients[shardCount];
+		RsslError error;
+
+		for (UInt32 index = 0; index < shardCount; ++index)
+		{
+			clients[index] = connectClient("14060");
+			ASSERT_TRUE(clients[index] != 0) << "client " << index << " failed to connect";
+		}
+
+		// Sessions are assigned to the least loaded shard, so each shard takes exactly one.
+		EXPECT_TRUE(waitForShardSessionCount(ommIProviderImpl, 1));
+
+		for (int attempt = 0; attempt < 500 && getActiveSessionCount(ommIProviderImpl) < shardCount; ++attempt)
+			sleepMs(10);
+
+		ommIProviderImpl.getUserMutex().lock();
+
+		const EmaList<ClientSession*>& clientSessionList = ommIProviderImpl.getServerChannelHandler().getClientSessionList();
+		EXPECT_EQ(clientSessionList.size(), shardCount);
+
+		bool shardUsed[shardCount] = { false, false, false };
+
+		for (ClientSession* clientSession = clientSessionList.front(); clientSession; clientSession = clientSession->next())
+		{
+			// The channel is only set once its shard dispatched the ChannelUp event.
+			EXPECT_TRUE(clientSession->getChannel() != 0);
+			if (clientSession->getReactorShard() >= shardCount)
+			{
+				EXPECT_TRUE(false) << "session on unknown shard " << clientSession->getReactorShard();
+				continue;
+			}
+
+			EXPECT_FALSE(shardUsed[clientSession->getReactorShard()]) << "two sessions share shard " << clientSession->getReactorShard();
+			shardUsed[clientSession->getReactorShard()] = true;
+		}
+
+		ommIProviderImpl.getUserMutex().unlock();
+
+		for (UInt32 index = 0; index < shardCount; ++index)
+			rsslCloseChannel(clients[index], &error);
+
+		EXPECT_TRUE(waitForShardSessionCount(ommIProviderImpl, 0));
+	}
+	catch (const OmmException& excp)
+	{
+		EXPECT_TRUE(false) << "Unexpected exception in clientChannelsSpreadAcrossShards(): " << excp.getText().c_str();
+	}
+}
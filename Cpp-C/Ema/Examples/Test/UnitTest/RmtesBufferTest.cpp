@@ -305,3 +305,64 @@ TEST(RmtesBufferTest, testRmtesBufferClear)
 	rmtesBuf2.clear();
 }
 
+
+// News headline in the default RMTES character sets: 7-bit text with Reuters Basic 2 (GR) characters
+static const char newsHeadline[] = "LONDON, Oct 19 (Reuters) - Sterling rose to \xA3" "1.3050 against the dollar, while the euro held at \xA2" "0.9120; dealers said \xA1" "volatility\xA1 stayed low ahead of the Bank of England decision.";
+
+static std::string expectedNewsHeadlineUTF8()
+{
+	std::string expected;
+
+	for ( const char* iter = newsHeadline; *iter; ++iter )
+	{
+		// 0xA1 - 0xA3 map to U+00A1 - U+00A3
+		if ( (unsigned char)*iter >= 0xA1 )
+			expected += (char)0xC2;
+
+		expected += *iter;
+	}
+
+	return expected;
+}
+
+TEST(RmtesBufferTest, testRmtesBufferNewsHeadlineToUTF8)
+{
+	std::string expected( expectedNewsHeadlineUTF8() );
+
+	// start the headline at every offset so that plain text runs end at each position of a block
+	for ( UInt32 offset = 0; offset < 32; ++offset )
+	{
+		RmtesBuffer rmtesBuf;
+
+		const EmaBuffer& utf8Buf = rmtesBuf.apply( newsHeadline + offset, (UInt32)strlen( newsHeadline + offset ) ).getAsUTF8();
+
+		UInt32 expectedOffset = offset;
+		for ( UInt32 i = 0; i < offset; ++i )
+			if ( (unsigned char)newsHeadline[i] >= 0xA1 )
+				++expectedOffset;
+
+		EXPECT_EQ( utf8Buf.length(), expected.size() - expectedOffset ) << "rmtesBuf.apply(newsHeadline).getAsUTF8() return correct length";
+		EXPECT_EQ( memcmp( expected.data() + expectedOffset, utf8Buf.c_buf(), utf8Buf.length() ), 0 ) << "rmtesBuf.apply(newsHeadline).getAsUTF8() decode correctly";
+	}
+}
+
+TEST(RmtesBufferTest, testPerfRmtesBufferNewsHeadlineToUTF8)
+{
+	const int loopCount = 100000;
+	UInt64 totalLength = 0;
+
+	TimeValue startTime = GetTime::getNanos();
+
+	for ( int i = 0; i < loopCount; ++i )
+	{
+		RmtesBuffer rmtesBuf;
+		totalLength += rmtesBuf.apply( newsHeadline, sizeof( newsHeadline ) - 1 ).getAsUTF8().length();
+	}
+
+	TimeValue convertTime = GetTime::getNanos() - startTime;
+
+	EXPECT_EQ( totalLength, (UInt64)loopCount * expectedNewsHeadlineUTF8().size() ) << "every conversion returns the full headline";
+
+	std::cout << "RmtesBuffer::getAsUTF8(): " << ( (double)convertTime / loopCount ) << " ns per headline of "
+		<< ( sizeof( newsHeadline ) - 1 ) << " bytes" << std::endl;
+}
@@ -0,0 +1,217 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+#include "Access/Impl/SlabAllocator.h"
+#include "Access/Impl/TimeOut.h"
+#include <vector>
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+class SmallObject : public SlabAllocated
+{
+public :
+
+	SmallObject( int value ) : _value( value ) {}
+
+	int		_value;
+	char	_padding[100];
+};
+
+class LargeObject : public SlabAllocated
+{
+public :
+
+	char	_data[SLAB_ALLOCATOR_MAX_BLOCK_SIZE];
+};
+
+class ThrowingObject : public SlabAllocated
+{
+public :
+
+	ThrowingObject() { throw 1; }
+
+	char	_data[40];
+};
+
+TEST(SlabAllocatorTest, reusesFreedBlocks)
+{
+	SlabAllocator* slab = SlabAllocator::create( 1024 );
+	SlabAllocator::Statistics statistics;
+
+	SmallObject* first = new ( slab ) SmallObject( 1 );
+	delete first;
+
+	SmallObject* second = new ( slab ) SmallObject( 2 );
+	ASSERT_EQ( first, second );
+	ASSERT_EQ( 2, second->_value );
+
+	slab->getStatistics( statistics );
+	ASSERT_EQ( 2, statistics.allocations );
+	ASSERT_EQ( 1, statistics.chunkAllocations );
+	ASSERT_EQ( 1, statistics.blocksInUse );
+
+	delete second;
+	slab->release();
+}
+
+TEST(SlabAllocatorTest, chunksGrowToMaximum)
+{
+	const UInt32 count = 1000;
+	SlabAllocator* slab = SlabAllocator::create( 64 );
+	SlabAllocator::Statistics statistics;
+	vector< SmallObject* > objects;
+
+	for ( UInt32 i = 0; i < count; ++i )
+		objects.push_back( new ( slab ) SmallObject( i ) );
+
+	for ( UInt32 i = 0; i < count; ++i )
+		ASSERT_EQ( (int)i, objects[i]->_value );
+
+	// 32 + 64 blocks, then chunks of 64 for the remaining 904
+	slab->getStatistics( statistics );
+	ASSERT_EQ( count, statistics.blocksInUse );
+	ASSERT_EQ( 2 + 15, statistics.chunkAllocations );
+
+	for ( UInt32 i = 0; i < count; ++i )
+		delete objects[i];
+
+	slab->getStatistics( statistics );
+	ASSERT_EQ( 0, statistics.blocksInUse );
+
+	slab->release();
+}
+
+TEST(SlabAllocatorTest, heapFallback)
+{
+	SlabAllocator* slab = SlabAllocator::create( 1024 );
+	SlabAllocator::Statistics statistics;
+
+	// too large for a block
+	LargeObject* large = new ( slab ) LargeObject();
+
+	// no allocator
+	SmallObject* plain = new SmallObject( 3 );
+	SmallObject* unslabbed = new ( (SlabAllocator*)0 ) SmallObject( 4 );
+
+	slab->getStatistics( statistics );
+	ASSERT_EQ( 0, statistics.allocations );
+	ASSERT_EQ( 1, statistics.heapAllocations );
+	ASSERT_EQ( 0, statistics.blocksInUse );
+
+	delete large;
+	delete plain;
+	delete unslabbed;
+
+	slab->release();
+}
+
+TEST(SlabAllocatorTest, throwingConstructorFreesBlock)
+{
+	SlabAllocator* slab = SlabAllocator::create( 1024 );
+	SlabAllocator::Statistics statistics;
+
+	try
+	{
+		new ( slab ) ThrowingObject();
+		FAIL() << "constructor did not throw";
+	}
+	catch ( int )
+	{
+	}
+
+	slab->getStatistics( statistics );
+	ASSERT_EQ( 1, statistics.allocations );
+	ASSERT_EQ( 0, statistics.blocksInUse );
+
+	slab->release();
+}
+
+TEST(SlabAllocatorTest, objectsOutliveRelease)
+{
+	SlabAllocator* slab = SlabAllocator::create( 1024 );
+
+	SmallObject* first = new ( slab ) SmallObject( 5 );
+	SmallObject* second = new ( slab ) SmallObject( 6 );
+
+	// the allocator stays alive until both objects are gone
+	slab->release();
+
+	ASSERT_EQ( 5, first->_value );
+	delete first;
+
+	ASSERT_EQ( 6, second->_value );
+	delete second;
+}
+
+// Owns a slab and places its timeouts there, and cleans up the way OmmBaseImpl does
+class SlabOwner : public TimeOutClient
+{
+public :
+
+	SlabOwner( SlabAllocator::Statistics& statisticsAtRelease ) :
+		_pSlab( SlabAllocator::create( 1024 ) ),
+		_statisticsAtRelease( statisticsAtRelease )
+	{
+	}
+
+	~SlabOwner()
+	{
+		TimeOut::deleteAll( *this );
+
+		_pSlab->getStatistics( _statisticsAtRelease );
+		_pSlab->release();
+	}
+
+	SlabAllocator* getSlab() { return _pSlab; }
+
+	TimeOutQueue& getTimeOutList() { return _timeOuts; }
+
+	void installTimeOut() {}
+
+	Mutex& getTimeOutMutex() { return _mutex; }
+
+private :
+
+	SlabAllocator*				_pSlab;
+	SlabAllocator::Statistics&	_statisticsAtRelease;
+	TimeOutQueue				_timeOuts;
+	Mutex						_mutex;
+};
+
+static int timeOutsFired = 0;
+
+static void countFired( void* )
+{
+	++timeOutsFired;
+}
+
+TEST(SlabAllocatorTest, ownerDestroyedWithPendingTimeOuts)
+{
+	SlabAllocator::Statistics statistics;
+	SlabOwner* owner = new SlabOwner( statistics );
+
+	timeOutsFired = 0;
+
+	for ( int i = 0; i < 100; ++i )
+		new ( owner->getSlab() ) TimeOut( *owner, 60000000, countFired, 0, true );
+
+	// one is canceled but not yet purged from the queue
+	TimeOut* canceled = new ( owner->getSlab() ) TimeOut( *owner, 0, countFired, 0, true );
+	ASSERT_TRUE( canceled->isCanceled() );
+
+	owner->getSlab()->getStatistics( statistics );
+	ASSERT_EQ( 101, statistics.blocksInUse );
+
+	delete owner;
+
+	// every pending timeout went back to the slab without running, so the release freed it
+	ASSERT_EQ( 0, statistics.blocksInUse );
+	ASSERT_EQ( 0, timeOutsFired );
+}
@@ -0,0 +1,218 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+#include "Access/Impl/SubmitQueue.h"
+#include "Access/Impl/Thread.h"
+#include <vector>
+
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+static void yieldThread()
+{
+#if defined(WIN32)
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
+static void encodePost( SubmitQueueEntry* pEntry, UInt32 postId, UInt64 handle, const EmaString* pServiceName, UInt32 dataLength = 0 )
+{
+	RsslPostMsg postMsg;
+	vector< char > data( dataLength, 'x' );
+
+	rsslClearPostMsg( &postMsg );
+	postMsg.msgBase.msgClass = RSSL_MC_POST;
+	postMsg.msgBase.streamId = 5;
+	postMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	postMsg.msgBase.containerType = RSSL_DT_OPAQUE;
+	postMsg.flags = RSSL_PSMF_HAS_POST_ID;
+	postMsg.postId = postId;
+	if ( dataLength )
+	{
+		postMsg.msgBase.encDataBody.data = &data[0];
+		postMsg.msgBase.encDataBody.length = dataLength;
+	}
+
+	ASSERT_EQ( RSSL_RET_SUCCESS, pEntry->encode( (RsslMsg*)&postMsg, SubmitQueueEntry::PostMsgEnum, handle, pServiceName ) );
+}
+
+TEST(SubmitQueueTest, encodeAndDecode)
+{
+	SubmitQueue queue;
+	EmaString serviceName( "DIRECT_FEED" );
+	RsslMsg rsslMsg;
+
+	queue.initialize( 2 );
+	ASSERT_TRUE( queue.isEnabled() );
+
+	SubmitQueueEntry* pEntry = queue.getEntry();
+	ASSERT_TRUE( pEntry != 0 );
+
+	// larger than the initial entry buffer, so the entry has to grow it
+	encodePost( pEntry, 7, 1234, &serviceName, 3 * SUBMIT_QUEUE_ENTRY_BUFFER_SIZE );
+
+	queue.push( pEntry );
+	ASSERT_EQ( pEntry, queue.pop() );
+	ASSERT_TRUE( queue.pop() == 0 );
+
+	ASSERT_EQ( SubmitQueueEntry::PostMsgEnum, pEntry->getMsgType() );
+	ASSERT_EQ( 1234, pEntry->getHandle() );
+	ASSERT_TRUE( pEntry->hasServiceName() );
+	ASSERT_STREQ( "DIRECT_FEED", pEntry->getServiceName().c_str() );
+
+	ASSERT_EQ( RSSL_RET_SUCCESS, pEntry->decode( &rsslMsg ) );
+	ASSERT_EQ( RSSL_MC_POST, rsslMsg.msgBase.msgClass );
+	ASSERT_EQ( 5, rsslMsg.msgBase.streamId );
+	ASSERT_EQ( 7, rsslMsg.postMsg.postId );
+	ASSERT_EQ( 3 * SUBMIT_QUEUE_ENTRY_BUFFER_SIZE, rsslMsg.msgBase.encDataBody.length );
+
+	queue.returnEntry( pEntry );
+
+	queue.clear();
+	ASSERT_FALSE( queue.isEnabled() );
+}
+
+TEST(SubmitQueueTest, singleProducerOrder)
+{
+	SubmitQueue queue;
+	RsslMsg rsslMsg;
+
+	queue.initialize( 10 );
+
+	for ( UInt32 i = 0; i < 10; ++i )
+	{
+		SubmitQueueEntry* pEntry = queue.getEntry();
+		ASSERT_TRUE( pEntry != 0 );
+		encodePost( pEntry, i, i, 0 );
+		queue.push( pEntry );
+	}
+
+	// the pool does not grow; an empty pool is reported to the caller
+	ASSERT_TRUE( queue.getEntry() == 0 );
+
+	for ( UInt32 i = 0; i < 10; ++i )
+	{
+		SubmitQueueEntry* pEntry = queue.pop();
+		ASSERT_TRUE( pEntry != 0 );
+		ASSERT_FALSE( pEntry->hasServiceName() );
+		ASSERT_EQ( RSSL_RET_SUCCESS, pEntry->decode( &rsslMsg ) );
+		ASSERT_EQ( i, rsslMsg.postMsg.postId );
+		queue.returnEntry( pEntry );
+	}
+
+	ASSERT_TRUE( queue.pop() == 0 );
+
+	// every entry went back to the pool
+	vector< SubmitQueueEntry* > entries;
+	for ( UInt32 i = 0; i < 10; ++i )
+	{
+		entries.push_back( queue.getEntry() );
+		ASSERT_TRUE( entries.back() != 0 );
+	}
+	ASSERT_TRUE( queue.getEntry() == 0 );
+
+	for ( UInt32 i = 0; i < 10; ++i )
+		queue.returnEntry( entries[i] );
+}
+
+class SubmitQueueProducer : public Thread
+{
+public :
+
+	SubmitQueueProducer( SubmitQueue& queue, UInt64 handle, UInt32 count ) :
+		_queue( queue ), _handle( handle ), _count( count )
+	{
+	}
+
+	~SubmitQueueProducer()
+	{
+		wait();
+	}
+
+	void start() { Thread::start(); }
+
+	void wait() { Thread::wait(); }
+
+protected :
+
+	void run()
+	{
+		for ( UInt32 i = 0; i < _count; ++i )
+		{
+			SubmitQueueEntry* pEntry;
+
+			// wait for the consumer to return an entry when the pool is empty
+			while ( ( pEntry = _queue.getEntry() ) == 0 )
+				yieldThread();
+
+			encodePost( pEntry, i, _handle, 0 );
+			_queue.push( pEntry );
+		}
+	}
+
+	int runLog( void*, const char*, unsigned int ) { return 0; }
+
+private :
+
+	SubmitQueue&	_queue;
+	UInt64			_handle;
+	UInt32			_count;
+};
+
+TEST(SubmitQueueTest, multipleProducers)
+{
+	const UInt32 producerCount = 4;
+	const UInt32 msgCount = 20000;
+	SubmitQueue queue;
+	vector< SubmitQueueProducer* > producers;
+	vector< UInt32 > nextPostId( producerCount, 0 );
+	UInt32 received = 0;
+	RsslMsg rsslMsg;
+
+	// a small pool, so that producers often find it empty and entries are reused concurrently
+	queue.initialize( 8 );
+
+	for ( UInt32 i = 0; i < producerCount; ++i )
+		producers.push_back( new SubmitQueueProducer( queue, i, msgCount ) );
+
+	for ( UInt32 i = 0; i < producerCount; ++i )
+		producers[i]->start();
+
+	// messages from each producer arrive in the order that producer pushed them
+	while ( received < producerCount * msgCount )
+	{
+		SubmitQueueEntry* pEntry = queue.pop();
+		if ( !pEntry )
+		{
+			yieldThread();
+			continue;
+		}
+
+		ASSERT_LT( pEntry->getHandle(), producerCount );
+		ASSERT_EQ( RSSL_RET_SUCCESS, pEntry->decode( &rsslMsg ) );
+		ASSERT_EQ( nextPostId[ (size_t)pEntry->getHandle() ], rsslMsg.postMsg.postId );
+		++nextPostId[ (size_t)pEntry->getHandle() ];
+		++received;
+
+		queue.returnEntry( pEntry );
+	}
+
+	for ( UInt32 i = 0; i < producerCount; ++i )
+		delete producers[i];
+
+	ASSERT_TRUE( queue.pop() == 0 );
+}
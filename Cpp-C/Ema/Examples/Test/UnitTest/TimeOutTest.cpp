@@ -0,0 +1,231 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+#include "Access/Impl/TimeOut.h"
+#include "Access/Impl/EmaList.h"
+#include <vector>
+#include <ctime>
+#include <iostream>
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+class TestTimeOutClient : public TimeOutClient
+{
+public :
+
+	TestTimeOutClient() : _installCount( 0 ) {}
+
+	TimeOutQueue& getTimeOutList() { return _timeOuts; }
+
+	void installTimeOut() { ++_installCount; }
+
+	Mutex& getTimeOutMutex() { return _mutex; }
+
+	UInt32 getInstallCount() const { return _installCount; }
+
+private :
+
+	TimeOutQueue	_timeOuts;
+	Mutex			_mutex;
+	UInt32			_installCount;
+};
+
+static vector< int > firedOrder;
+
+static void recordFired( void* args )
+{
+	firedOrder.push_back( *static_cast< int* >( args ) );
+}
+
+// runs timeouts as they expire until none are left
+static void executeAll( TestTimeOutClient& client )
+{
+	Int64 remaining;
+	while ( TimeOut::getTimeOutInMicroSeconds( client, remaining ) )
+		TimeOut::execute( client );
+}
+
+TEST(TimeOutTest, firesInExpiryOrder)
+{
+	TestTimeOutClient client;
+	int ids[5] = { 0, 1, 2, 3, 4 };
+	Int64 lengths[5] = { 5000, 1000, 3000, 1000, 2000 };
+
+	firedOrder.clear();
+
+	for ( int i = 0; i < 5; ++i )
+		new TimeOut( client, lengths[i], recordFired, &ids[i], true );
+
+	ASSERT_EQ( 5, client.getTimeOutList().size() );
+	ASSERT_EQ( 5, client.getInstallCount() );
+
+	executeAll( client );
+
+	// equal lengths fire in the order they were added
+	ASSERT_EQ( 5, firedOrder.size() );
+	ASSERT_EQ( 1, firedOrder[0] );
+	ASSERT_EQ( 3, firedOrder[1] );
+	ASSERT_EQ( 4, firedOrder[2] );
+	ASSERT_EQ( 2, firedOrder[3] );
+	ASSERT_EQ( 0, firedOrder[4] );
+}
+
+TEST(TimeOutTest, cancel)
+{
+	TestTimeOutClient client;
+	int ids[4] = { 0, 1, 2, 3 };
+	Int64 remaining;
+
+	firedOrder.clear();
+
+	TimeOut* first = new TimeOut( client, 1000, recordFired, &ids[0], true );
+	new TimeOut( client, 2000, recordFired, &ids[1], true );
+	TimeOut* third = new TimeOut( client, 3000, recordFired, &ids[2], true );
+	TimeOut fourth( client, 4000, recordFired, &ids[3], false );
+
+	first->cancel();
+	third->cancel();
+	ASSERT_EQ( 2, client.getTimeOutList().size() );
+
+	fourth.cancel();
+	ASSERT_TRUE( fourth.isCanceled() );
+	ASSERT_EQ( 1, client.getTimeOutList().size() );
+
+	// canceling again is harmless once the timeout has left the queue
+	fourth.cancel();
+	ASSERT_EQ( 1, client.getTimeOutList().size() );
+
+	executeAll( client );
+
+	ASSERT_TRUE( client.getTimeOutList().empty() );
+	ASSERT_FALSE( TimeOut::getTimeOutInMicroSeconds( client, remaining ) );
+	ASSERT_EQ( 1, firedOrder.size() );
+	ASSERT_EQ( 1, firedOrder[0] );
+}
+
+TEST(TimeOutTest, zeroLengthIsCanceled)
+{
+	TestTimeOutClient client;
+	int id = 0;
+	Int64 remaining;
+
+	firedOrder.clear();
+
+	TimeOut* timeOut = new TimeOut( client, 0, recordFired, &id, true );
+	ASSERT_TRUE( timeOut->isCanceled() );
+	ASSERT_EQ( 0, client.getInstallCount() );
+
+	// the canceled timeout is purged rather than reported
+	ASSERT_FALSE( TimeOut::getTimeOutInMicroSeconds( client, remaining ) );
+	ASSERT_TRUE( client.getTimeOutList().empty() );
+	ASSERT_TRUE( firedOrder.empty() );
+}
+
+TEST(TimeOutTest, manyTimeOuts)
+{
+	const int count = 100000;
+	TestTimeOutClient client;
+	vector< TimeOut* > timeOuts;
+	Int64 remaining;
+
+	// registrations far enough in the future that none of them expire during the test
+	for ( int i = 0; i < count; ++i )
+		timeOuts.push_back( new TimeOut( client, 60000000 + ( i * 7919 ) % count, recordFired, 0, false ) );
+
+	ASSERT_EQ( count, (int)client.getTimeOutList().size() );
+
+	for ( int i = 0; i < count; i += 2 )
+		timeOuts[i]->cancel();
+
+	ASSERT_EQ( count / 2, (int)client.getTimeOutList().size() );
+	ASSERT_TRUE( TimeOut::getTimeOutInMicroSeconds( client, remaining ) );
+
+	// the queue hands back the remaining timeouts in expiry order
+	TimeOut* previous = 0;
+	while ( !client.getTimeOutList().empty() )
+	{
+		TimeOut* next = client.getTimeOutList().front();
+		ASSERT_FALSE( next->isCanceled() );
+		if ( previous )
+		{
+			ASSERT_TRUE( *previous < *next );
+		}
+		next->cancel();
+		previous = next;
+	}
+
+	for ( int i = 0; i < count; ++i )
+		delete timeOuts[i];
+}
+
+// node with the layout and ordering of the sorted EmaList the timeouts used to be kept in
+class ListTimeOut : public ListLinks< ListTimeOut >
+{
+public :
+
+	Int64	_timeoutTime;
+
+	bool operator<( const ListTimeOut& rhs ) const { return _timeoutTime <= rhs._timeoutTime; }
+};
+
+static double registerOnList( int count )
+{
+	EmaList< ListTimeOut* > list;
+	vector< ListTimeOut > timeOuts( count );
+
+	clock_t start = clock();
+	for ( int i = 0; i < count; ++i )
+	{
+		timeOuts[i]._timeoutTime = 60000000 + i;
+		list.insert( &timeOuts[i] );
+	}
+	return (double)( clock() - start ) / CLOCKS_PER_SEC;
+}
+
+static double registerOnQueue( int count )
+{
+	TestTimeOutClient client;
+	vector< TimeOut* > timeOuts;
+
+	timeOuts.reserve( count );
+
+	clock_t start = clock();
+	for ( int i = 0; i < count; ++i )
+		timeOuts.push_back( new TimeOut( client, 60000000, recordFired, 0, false ) );
+	double elapsed = (double)( clock() - start ) / CLOCKS_PER_SEC;
+
+	for ( int i = 0; i < count; ++i )
+		delete timeOuts[i];
+
+	return elapsed;
+}
+
+// Registers timeouts of one length, as SingleItem does for request timeouts, which is the
+// worst case for the sorted list.  Not run by default; use --gtest_also_run_disabled_tests.
+TEST(TimeOutTest, DISABLED_registrationBenchmark)
+{
+	const int counts[3] = { 10000, 100000, 500000 };
+
+	for ( int i = 0; i < 3; ++i )
+	{
+		double queueSeconds = registerOnQueue( counts[i] );
+
+		cout << counts[i] << " timeouts: heap " << queueSeconds * 1e9 / counts[i] << " ns per registration";
+
+		// the list takes minutes at 500k
+		if ( counts[i] <= 100000 )
+		{
+			double listSeconds = registerOnList( counts[i] );
+			cout << ", sorted list " << listSeconds * 1e9 / counts[i] << " ns per registration";
+		}
+
+		cout << endl;
+	}
+}
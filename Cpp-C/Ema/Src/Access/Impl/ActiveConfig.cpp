@@ -343,7 +343,10 @@ ActiveConfig::ActiveConfig( const EmaString& defaultServiceName ) :
 	dictionaryConfig(),
 	reissueTokenAttemptLimit(DEFAULT_REISSUE_TOKEN_ATTEMP_LIMIT),
 	reissueTokenAttemptInterval(DEFAULT_REISSUE_TOKEN_ATTEMP_INTERVAL),
-	restRequestTimeOut(DEFAULT_REST_REQUEST_TIMEOUT)
+	restRequestTimeOut(DEFAULT_REST_REQUEST_TIMEOUT),
+	submitQueueSize(DEFAULT_SUBMIT_QUEUE_SIZE),
+	busyPollTimeout(DEFAULT_BUSY_POLL_TIMEOUT),
+	cpuApiThreadBind(DEFAULT_CPU_API_THREAD_BIND)
 {
 }
 
@@ -368,7 +371,10 @@ EmaString ActiveConfig::configTrace()
 		.append("\n\t loginRequestTimeOut : ").append(loginRequestTimeOut)
 		.append("\n\t reissueTokenAttemptLimit : ").append(reissueTokenAttemptLimit)
 		.append("\n\t reissueTokenAttemptInterval : ").append(reissueTokenAttemptInterval)
-		.append("\n\t restRequestTimeOut : ").append(restRequestTimeOut);
+		.append("\n\t restRequestTimeOut : ").append(restRequestTimeOut)
+		.append("\n\t submitQueueSize : ").append(submitQueueSize)
+		.append("\n\t busyPollTimeout : ").append(busyPollTimeout)
+		.append("\n\t cpuApiThreadBind : ").append(cpuApiThreadBind);
 	return traceStr;
 }
 
@@ -394,6 +400,9 @@ void ActiveConfig::clear()
 	obeyOpenWindow = DEFAULT_OBEY_OPEN_WINDOW;
 	postAckTimeout = DEFAULT_POST_ACK_TIMEOUT;
 	maxOutstandingPosts = DEFAULT_MAX_OUTSTANDING_POSTS;
+	submitQueueSize = DEFAULT_SUBMIT_QUEUE_SIZE;
+	busyPollTimeout = DEFAULT_BUSY_POLL_TIMEOUT;
+	cpuApiThreadBind = DEFAULT_CPU_API_THREAD_BIND;
 	reconnectAttemptLimit = DEFAULT_RECONNECT_ATTEMPT_LIMIT;
 	reconnectMinDelay = DEFAULT_RECONNECT_MIN_DELAY;
 	reconnectMaxDelay = DEFAULT_RECONNECT_MAX_DELAY;
@@ -468,6 +477,14 @@ void ActiveConfig::setMaxOutstandingPosts( UInt64 value )
 		maxOutstandingPosts = ( UInt32 )value;
 }
 
+void ActiveConfig::setSubmitQueueSize( UInt64 value )
+{
+	if ( value > RWF_MAX_32 )
+		submitQueueSize = RWF_MAX_32;
+	else
+		submitQueueSize = ( UInt32 )value;
+}
+
 void ActiveConfig::setReconnectAttemptLimit(Int64 value)
 {
 	if (value >= 0)
@@ -538,6 +555,8 @@ ActiveServerConfig::ActiveServerConfig(const EmaString& defaultServiceName) :
 	acceptMessageWithoutQosInRange(DEFAULT_ACCEPT_MSG_WITHOUT_QOS_IN_RANGE),
 	acceptMessageSameKeyButDiffStream(DEFAULT_ACCEPT_MSG_SAMEKEY_BUT_DIFF_STREAM),
 	acceptMessageThatChangesService(DEFAULT_ACCEPT_MSG_THAT_CHANGES_SERVICE),
+	reactorShardCount(DEFAULT_REACTOR_SHARD_COUNT),
+	reactorShardCpuList(DEFAULT_REACTOR_SHARD_CPU_LIST),
 	_defaultServiceName(defaultServiceName),
 	pDirectoryRefreshMsg(0)
 {
@@ -567,6 +586,8 @@ void ActiveServerConfig::clear()
 	acceptMessageWithoutQosInRange = DEFAULT_ACCEPT_MSG_WITHOUT_QOS_IN_RANGE;
 	acceptMessageSameKeyButDiffStream = DEFAULT_ACCEPT_MSG_SAMEKEY_BUT_DIFF_STREAM;
 	acceptMessageThatChangesService = DEFAULT_ACCEPT_MSG_THAT_CHANGES_SERVICE;
+	reactorShardCount = DEFAULT_REACTOR_SHARD_COUNT;
+	reactorShardCpuList = DEFAULT_REACTOR_SHARD_CPU_LIST;
 
 	if (pDirectoryRefreshMsg)
 		delete pDirectoryRefreshMsg;
@@ -582,11 +603,23 @@ EmaString ActiveServerConfig::configTrace()
 		.append("\n\t acceptDirMessageWithoutMinFilters: ").append(acceptDirMessageWithoutMinFilters)
 		.append("\n\t acceptMessageWithoutQosInRange: ").append(acceptMessageWithoutQosInRange)
 		.append("\n\t acceptMessageSameKeyButDiffStream: ").append(acceptMessageSameKeyButDiffStream)
-		.append("\n\t acceptMessageThatChangesService: ").append(acceptMessageThatChangesService);
+		.append("\n\t acceptMessageThatChangesService: ").append(acceptMessageThatChangesService)
+		.append("\n\t reactorShardCount: ").append(reactorShardCount)
+		.append("\n\t reactorShardCpuList: ").append(reactorShardCpuList);
 
 	return traceStr;
 }
 
+void ActiveServerConfig::setReactorShardCount(UInt64 value)
+{
+	if (value == 0)
+		reactorShardCount = 1;
+	else if (value > RWF_MAX_32)
+		reactorShardCount = RWF_MAX_32;
+	else
+		reactorShardCount = (UInt32)value;
+}
+
 ServiceDictionaryConfig*	ActiveServerConfig::getServiceDictionaryConfig(UInt16 serviceId)
 {
 	ServiceDictionaryConfig** serviceDictionaryConfigPtr = _serviceDictionaryConfigHash.find(serviceId);
@@ -70,12 +70,17 @@
 #define DEFAULT_SERVER_PIPE_PORT					    9009
 #define DEFAULT_POST_ACK_TIMEOUT					    15000
 #define DEFAULT_REACTOR_EVENTFD_PORT				    55000
+#define DEFAULT_REACTOR_SHARD_COUNT					    1
+#define DEFAULT_REACTOR_SHARD_CPU_LIST				    EmaString( "" )
 #define DEFAULT_RECONNECT_ATTEMPT_LIMIT				    -1
 #define DEFAULT_RECONNECT_MAX_DELAY					    5000
 #define DEFAULT_RECONNECT_MIN_DELAY					    1000
 #define DEFAULT_REQUEST_TIMEOUT						   15000
 #define DEFAULT_REST_REQUEST_TIMEOUT				   90
 #define DEFAULT_SERVICE_COUNT_HINT					   513
+#define DEFAULT_SUBMIT_QUEUE_SIZE					   0
+#define DEFAULT_BUSY_POLL_TIMEOUT					   0
+#define DEFAULT_CPU_API_THREAD_BIND					   -1
 #define DEFAULT_OBJECT_NAME							   EmaString( "" )
 #define DEFAULT_SSL_CA_STORE						   EmaString( "" )
 #define DEFAULT_TCP_NODELAY							   RSSL_TRUE
@@ -490,6 +495,7 @@ public:
 	void setReconnectMinDelay(Int64 value);
 	void setReconnectMaxDelay(Int64 value);
 	void setRestRequestTimeOut(UInt64 value);
+	void setSubmitQueueSize(UInt64 value);
 
 	ChannelConfig* findChannelConfig( const Channel* pChannel );
 	static bool findChannelConfig( EmaVector< ChannelConfig* >&, const EmaString&, unsigned int& );
@@ -511,6 +517,11 @@ public:
 	Int64			reissueTokenAttemptLimit;
 	Int64			reissueTokenAttemptInterval;
 	UInt32			restRequestTimeOut; // in seconds
+	UInt32			submitQueueSize; // entries pre-allocated for queuing PostMsg and GenericMsg submits; 0 submits on the calling thread.
+									 // Queued messages are sent on the next dispatch pass (in UserDispatch mode, the next dispatch() call);
+									 // submits made from a callback are not queued.
+	Int64			busyPollTimeout; // microseconds the dispatch loop spins without blocking after the last event; 0 always blocks
+	Int64			cpuApiThreadBind; // CPU core the API dispatch thread binds itself to; -1 leaves it unbound
 
 	DictionaryConfig		dictionaryConfig;
 
@@ -558,6 +569,12 @@ public:
 
 	bool                        acceptMessageThatChangesService;
 
+	UInt32						reactorShardCount;		// number of reactors that accepted client channels are spread over
+
+	EmaString					reactorShardCpuList;	// comma separated CPU cores for the reactor shard worker threads
+
+	void						setReactorShardCount(UInt64 value);
+
 	ServiceDictionaryConfig*	getServiceDictionaryConfig(UInt16 serviceId);
 
 	void						addServiceDictionaryConfig(ServiceDictionaryConfig*);
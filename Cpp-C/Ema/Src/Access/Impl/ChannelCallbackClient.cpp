@@ -609,6 +609,8 @@ void ChannelCallbackClient::initialize( RsslRDMLoginRequest* loginRequest, RsslR
 				reactorConnectInfo[i].rsslConnectOptions.connectionInfo.unified.address = ( char* )(static_cast<SocketChannelConfig*>( activeConfigChannelSet[i] )->hostName.c_str());
 				reactorConnectInfo[i].rsslConnectOptions.connectionInfo.unified.serviceName = ( char* )(static_cast<SocketChannelConfig*>( activeConfigChannelSet[i] )->serviceName.c_str());
 				reactorConnectInfo[i].rsslConnectOptions.tcpOpts.tcp_nodelay = static_cast<SocketChannelConfig*>( activeConfigChannelSet[i] )->tcpNodelay;
+				if ( activeConfig.busyPollTimeout > 0 )
+					reactorConnectInfo[i].rsslConnectOptions.tcpOpts.busyPollUsec = activeConfig.busyPollTimeout > RWF_MAX_32 ? RWF_MAX_32 : static_cast<UInt32>( activeConfig.busyPollTimeout );
 				reactorConnectInfo[i].rsslConnectOptions.objectName = ( char* ) (static_cast<SocketChannelConfig*>( activeConfigChannelSet[i] )->objectName.c_str());
 				reactorConnectInfo[i].rsslConnectOptions.connectionInfo.unified.interfaceName = ( char* )(activeConfigChannelSet[i]->interfaceName.c_str());
 				reactorConnectInfo[i].rsslConnectOptions.connectionInfo.unified.unicastServiceName = ( char* ) "";
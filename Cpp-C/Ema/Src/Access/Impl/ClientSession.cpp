@@ -24,7 +24,8 @@ ClientSession::ClientSession(OmmServerBaseImpl* ommServerBaseImpl) :
 	_pOmmServerBaseImpl(ommServerBaseImpl),
 	_removingInCloseAll(false),
 	_isADHSession(false),
-	_loginHandle(0)
+	_loginHandle(0),
+	_reactorShard(ommServerBaseImpl->acquireReactorShard())
 {
 	_streamIdToItemInfoHash.rehash(_pOmmServerBaseImpl->getActiveConfig().itemCountHint);
 
@@ -55,6 +56,8 @@ ClientSession::~ClientSession()
 	{
 		delete _itemInfoVectorList[index];
 	}
+
+	_pOmmServerBaseImpl->releaseReactorShard(_reactorShard);
 }
 
 ClientSession* ClientSession::create(OmmServerBaseImpl* ommServerBaseimpl)
@@ -264,6 +267,11 @@ void ClientSession::setADHSession(bool adhClient)
 	_isADHSession = adhClient;
 }
 
+UInt32 ClientSession::getReactorShard() const
+{
+	return _reactorShard;
+}
+
 Int32 ClientSession::Int32rHasher::operator()(const Int32& value) const
 {
 	return value;
@@ -60,6 +60,8 @@ public:
 
 	void setADHSession(bool adhSession = true);
 
+	UInt32 getReactorShard() const;
+
 	const EmaString& toString() const;
 
 	const EmaList< ItemInfo* >& getItemInfoList();
@@ -154,6 +156,7 @@ private:
 	bool                _removingInCloseAll;
 	bool				_isADHSession;
 	UInt64				_loginHandle;
+	UInt32				_reactorShard;
 };
 
 }
@@ -49,6 +49,7 @@ thomsonreuters::ema::access::EmaString AsciiValues[] = {
 	"Rate",
 	"RdmFieldDictionaryFileName",
 	"RdmFieldDictionaryItemName",
+	"ReactorShardCpuList",
 	"RecvAddress",
 	"RecvPort",
 	"SendAddress",
@@ -80,6 +81,8 @@ thomsonreuters::ema::access::EmaString EnumeratedValues[] = {
 };
 
 thomsonreuters::ema::access::EmaString Int64Values[] = {
+	"BusyPollTimeout",
+	"CpuApiThreadBind",
 	"DictionaryID",
 	"DispatchTimeoutApiThread",
 	"PipePort",
@@ -136,6 +139,7 @@ thomsonreuters::ema::access::EmaString UInt64Values[] = {
 	"OutputBufferSize",
 	"PacketTTL",
 	"PostAckTimeout",
+	"ReactorShardCount",
 	"RecoverUserSubmitSourceDirectory",
 	"RefreshFirstRequired",
 	"RemoveItemsOnDisconnect",
@@ -146,6 +150,7 @@ thomsonreuters::ema::access::EmaString UInt64Values[] = {
 	"ServiceCountHint",
 	"ServiceId",
 	"ServiceState",
+	"SubmitQueueSize",
 	"SupportsOutOfBandSnapshots",
 	"SupportsQoSRange",
 	"SysRecvBufSize",
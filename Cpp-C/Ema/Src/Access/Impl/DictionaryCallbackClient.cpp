@@ -1725,6 +1725,16 @@ bool DictionaryItem::modify( const ReqMsg& reqMsg )
 }
 
 bool DictionaryItem::submit( const PostMsg& )
+{
+	return submitRsslMsg( 0, 0 );
+}
+
+bool DictionaryItem::submit( const GenericMsg& )
+{
+	return submitRsslMsg( (RsslGenericMsg*)0 );
+}
+
+bool DictionaryItem::submitRsslMsg( RsslPostMsg* , const EmaString* )
 {
 	EmaString temp( "Invalid attempt to submit PostMsg on dictionary stream. " );
 	temp.append( "User name='" ).append( _ommBaseImpl .getInstanceName() ).append( "'." );
@@ -1734,7 +1744,7 @@ bool DictionaryItem::submit( const PostMsg& )
 	return false;
 }
 
-bool DictionaryItem::submit( const GenericMsg& )
+bool DictionaryItem::submitRsslMsg( RsslGenericMsg* )
 {
 	EmaString temp( "Invalid attempt to submit GenericMsg on dictionary stream. " );
 	temp.append( "User name='" ).append( _ommBaseImpl .getInstanceName() ).append( "'." );
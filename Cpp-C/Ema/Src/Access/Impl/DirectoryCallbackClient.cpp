@@ -1373,6 +1373,16 @@ bool DirectoryItem::modify( const ReqMsg& reqMsg )
 }
 
 bool DirectoryItem::submit( const PostMsg& )
+{
+	return submitRsslMsg( 0, 0 );
+}
+
+bool DirectoryItem::submit( const GenericMsg& genMsg )
+{
+	return submitRsslMsg( static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() ).getRsslGenericMsg() );
+}
+
+bool DirectoryItem::submitRsslMsg( RsslPostMsg* , const EmaString* )
 {
 	EmaString temp( "Invalid attempt to submit PostMsg on directory stream. " );
 	temp.append( "Instance name='" ).append( _ommBaseImpl .getInstanceName() ).append( "'." );
@@ -1382,9 +1392,9 @@ bool DirectoryItem::submit( const PostMsg& )
 	return false;
 }
 
-bool DirectoryItem::submit( const GenericMsg& genMsg )
+bool DirectoryItem::submitRsslMsg( RsslGenericMsg* pRsslGenericMsg )
 {
-	return submit( static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() ).getRsslGenericMsg() );
+	return submit( pRsslGenericMsg );
 }
 
 bool DirectoryItem::close()
@@ -1588,8 +1598,8 @@ void DirectoryItem::scheduleItemClosedStatus(const ReqMsgEncoder& reqMsgEncoder,
 {
 	if (_closedStatusInfo) return;
 
-	_closedStatusInfo = new ClosedStatusInfo(this, reqMsgEncoder, text);
+	_closedStatusInfo = new ( _ommBaseImpl.getItemSlab() ) ClosedStatusInfo(this, reqMsgEncoder, text);
 
-	new TimeOut(_ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true);
+	new ( _ommBaseImpl.getItemSlab() ) TimeOut(_ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true);
 }
 
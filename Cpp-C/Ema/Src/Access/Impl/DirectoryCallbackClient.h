@@ -279,6 +279,8 @@ public :
 	bool modify( const ReqMsg& );
 	bool submit( const PostMsg& );
 	bool submit( const GenericMsg& );
+	bool submitRsslMsg( RsslPostMsg* , const EmaString* );
+	bool submitRsslMsg( RsslGenericMsg* );
 	bool close();
 	void remove();
 	bool submit( RsslGenericMsg* );
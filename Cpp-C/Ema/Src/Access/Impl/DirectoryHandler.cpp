@@ -573,7 +573,7 @@ void DirectoryHandler::sendDirectoryReject(RsslReactorChannel* reactorChannel, R
 	submitMsgOpts.pRsslMsg = (RsslMsg*)&rsslStatusMsg;
 
 	clearRsslErrorInfo(&rsslErrorInfo);
-	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(reactorChannel), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		if (OmmLoggerClient::ErrorEnum >= _pOmmServerBaseImpl->getActiveConfig().loggerConfig.minLoggerSeverity)
 		{
@@ -777,7 +777,7 @@ void DirectoryHandler::handleDirectoryRequest(RsslReactorChannel* reactorChannel
 	EmaString temp;
 
 	clearRsslErrorInfo(&rsslErrorInfo);
-	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(reactorChannel), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		if (OmmLoggerClient::ErrorEnum >= _pOmmServerBaseImpl->getActiveConfig().loggerConfig.minLoggerSeverity)
 		{
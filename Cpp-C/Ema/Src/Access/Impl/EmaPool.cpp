@@ -8,9 +8,347 @@
 
 #include "GlobalPool.h"
 #include "libxml/parser.h"
+#ifdef EMA_POOL_STATISTICS
+#include "GetTime.h"
+#endif
 
 using namespace thomsonreuters::ema::access;
 
+// A thread cache's counters are changed only by its own thread, without locking, while
+// count() and getStatistics() read them from other threads. These accesses are atomic
+// with relaxed ordering: a reader gets a recent value, not one ordered with the items.
+template< class T >
+static inline T loadCacheCounter( const T& counter )
+{
+#ifdef WIN32
+	return *static_cast< const volatile T* >( &counter );
+#else
+	return __atomic_load_n( &counter, __ATOMIC_RELAXED );
+#endif
+}
+
+template< class T >
+static inline void storeCacheCounter( T& counter, T value )
+{
+#ifdef WIN32
+	*static_cast< volatile T* >( &counter ) = value;
+#else
+	__atomic_store_n( &counter, value, __ATOMIC_RELAXED );
+#endif
+}
+
+ThreadCachedPool::ThreadCachedPool( UInt32 size ) :
+ _cacheKeyCreated( false ),
+ _count( 0 ),
+ _caches( 0 )
+#ifdef EMA_POOL_STATISTICS
+ , _lockCount( 0 ),
+ _lockHoldNanos( 0 ),
+ _lockedAt( 0 ),
+ _releasedHits( 0 ),
+ _releasedMisses( 0 )
+#endif
+{
+	for ( UInt32 idx = 0; idx < size; ++idx )
+		_vector.push_back( 0 );
+
+	// without a key every get and return goes to the shared stack
+#ifdef WIN32
+	_cacheIndex = FlsAlloc( threadExit );
+	_cacheKeyCreated = ( _cacheIndex != FLS_OUT_OF_INDEXES );
+#else
+	_cacheKeyCreated = ( pthread_key_create( &_cacheKey, threadExit ) == 0 );
+#endif
+}
+
+ThreadCachedPool::~ThreadCachedPool()
+{
+	if ( _cacheKeyCreated )
+	{
+		// FlsFree() runs the exit callback for every thread still holding a cache;
+		// pthread_key_delete() does not, so any caches left are freed below
+#ifdef WIN32
+		FlsFree( _cacheIndex );
+#else
+		pthread_key_delete( _cacheKey );
+#endif
+	}
+
+	while ( _caches )
+	{
+		PoolThreadCache* cache = _caches;
+		_caches = cache->_next;
+		delete cache;
+	}
+}
+
+UInt32 ThreadCachedPool::count()
+{
+	_lock.lock();
+
+	UInt32 count = _count;
+
+	for ( PoolThreadCache* cache = _caches; cache; cache = cache->_next )
+		count += loadCacheCounter( cache->_count );
+
+	_lock.unlock();
+
+	return count;
+}
+
+#ifdef EMA_POOL_STATISTICS
+void ThreadCachedPool::getStatistics( PoolStatistics& statistics )
+{
+	_lock.lock();
+
+	statistics.cacheHits = _releasedHits;
+	statistics.cacheMisses = _releasedMisses;
+	statistics.lockCount = _lockCount;
+	statistics.lockHoldNanos = _lockHoldNanos;
+
+	// other threads update their own counters without locking, so these are approximate
+	for ( PoolThreadCache* cache = _caches; cache; cache = cache->_next )
+	{
+		statistics.cacheHits += loadCacheCounter( cache->_hits );
+		statistics.cacheMisses += loadCacheCounter( cache->_misses );
+	}
+
+	_lock.unlock();
+}
+#endif
+
+void ThreadCachedPool::lockShared()
+{
+	_lock.lock();
+
+#ifdef EMA_POOL_STATISTICS
+	++_lockCount;
+	_lockedAt = GetTime::getNanos();
+#endif
+}
+
+void ThreadCachedPool::unlockShared()
+{
+#ifdef EMA_POOL_STATISTICS
+	_lockHoldNanos += GetTime::getNanos() - _lockedAt;
+#endif
+
+	_lock.unlock();
+}
+
+PoolThreadCache* ThreadCachedPool::getThreadCache()
+{
+	if ( !_cacheKeyCreated )
+		return 0;
+
+#ifdef WIN32
+	PoolThreadCache* cache = static_cast< PoolThreadCache* >( FlsGetValue( _cacheIndex ) );
+#else
+	PoolThreadCache* cache = static_cast< PoolThreadCache* >( pthread_getspecific( _cacheKey ) );
+#endif
+
+	if ( cache )
+		return cache;
+
+	cache = new ( std::nothrow ) PoolThreadCache;
+	if ( !cache )
+		return 0;
+
+	cache->_count = 0;
+	cache->_pPool = this;
+	cache->_previous = 0;
+#ifdef EMA_POOL_STATISTICS
+	cache->_hits = 0;
+	cache->_misses = 0;
+#endif
+
+#ifdef WIN32
+	if ( !FlsSetValue( _cacheIndex, cache ) )
+#else
+	if ( pthread_setspecific( _cacheKey, cache ) )
+#endif
+	{
+		delete cache;
+		return 0;
+	}
+
+	_lock.lock();
+
+	cache->_next = _caches;
+	if ( _caches )
+		_caches->_previous = cache;
+	_caches = cache;
+
+	_lock.unlock();
+
+	return cache;
+}
+
+void ThreadCachedPool::releaseThreadCache( PoolThreadCache* cache )
+{
+	lockShared();
+
+	while ( cache->_count )
+	{
+		if ( _count == _vector.capacity() )
+			do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
+
+		_vector[ _count++ ] = cache->_items[ --cache->_count ];
+	}
+
+	if ( cache->_previous )
+		cache->_previous->_next = cache->_next;
+	else
+		_caches = cache->_next;
+
+	if ( cache->_next )
+		cache->_next->_previous = cache->_previous;
+
+#ifdef EMA_POOL_STATISTICS
+	_releasedHits += cache->_hits;
+	_releasedMisses += cache->_misses;
+#endif
+
+	unlockShared();
+
+	delete cache;
+}
+
+#ifdef WIN32
+void WINAPI ThreadCachedPool::threadExit( void* value )
+#else
+void ThreadCachedPool::threadExit( void* value )
+#endif
+{
+	if ( value )
+	{
+		PoolThreadCache* cache = static_cast< PoolThreadCache* >( value );
+		cache->_pPool->releaseThreadCache( cache );
+	}
+}
+
+void* ThreadCachedPool::takeItem()
+{
+	PoolThreadCache* cache = getThreadCache();
+	void* item = 0;
+
+	if ( cache )
+	{
+		UInt32 cached = cache->_count;
+
+		if ( cached )
+		{
+#ifdef EMA_POOL_STATISTICS
+			storeCacheCounter( cache->_hits, cache->_hits + 1 );
+#endif
+			storeCacheCounter( cache->_count, --cached );
+			return cache->_items[ cached ];
+		}
+
+#ifdef EMA_POOL_STATISTICS
+		storeCacheCounter( cache->_misses, cache->_misses + 1 );
+#endif
+
+		lockShared();
+
+		while ( _count && cached < EMA_POOL_THREAD_CACHE_BATCH )
+		{
+			void*& itemRef = _vector[ --_count ];
+			cache->_items[ cached++ ] = itemRef;
+			itemRef = 0;
+		}
+
+		unlockShared();
+
+		if ( cached )
+			item = cache->_items[ --cached ];
+
+		storeCacheCounter( cache->_count, cached );
+
+		return item;
+	}
+
+	lockShared();
+
+	if ( _count )
+	{
+		void*& itemRef = _vector[ --_count ];
+		item = itemRef;
+		itemRef = 0;
+	}
+
+	unlockShared();
+
+	return item;
+}
+
+void ThreadCachedPool::putItem( void* item )
+{
+	PoolThreadCache* cache = getThreadCache();
+
+	if ( cache )
+	{
+		UInt32 cached = cache->_count;
+
+		if ( cached == EMA_POOL_THREAD_CACHE_SIZE )
+		{
+			lockShared();
+
+			for ( UInt32 idx = 0; idx < EMA_POOL_THREAD_CACHE_BATCH; ++idx )
+			{
+				if ( _count == _vector.capacity() )
+					do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
+
+				_vector[ _count++ ] = cache->_items[ --cached ];
+			}
+
+			unlockShared();
+		}
+
+		cache->_items[ cached++ ] = item;
+		storeCacheCounter( cache->_count, cached );
+		return;
+	}
+
+	lockShared();
+
+	if ( _count == _vector.capacity() )
+		do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
+
+	_vector[ _count++ ] = item;
+
+	unlockShared();
+}
+
+void* ThreadCachedPool::removeItem()
+{
+	void* item = 0;
+
+	lockShared();
+
+	if ( _count )
+	{
+		void*& itemRef = _vector[ --_count ];
+		item = itemRef;
+		itemRef = 0;
+	}
+	else
+	{
+		for ( PoolThreadCache* cache = _caches; cache; cache = cache->_next )
+		{
+			if ( cache->_count )
+			{
+				item = cache->_items[ --cache->_count ];
+				break;
+			}
+		}
+	}
+
+	unlockShared();
+
+	return item;
+}
+
 GlobalPool g_pool;
 
 GlobalPool::GlobalPool()
@@ -62,6 +400,9 @@ GlobalPool::~GlobalPool()
 		if ( _fieldListDecoderPool.count() )
 			_fieldListDecoderPool.clear(), needToClear = true;
 
+		if ( _fieldListViewDecoderPool.count() )
+			_fieldListViewDecoderPool.clear(), needToClear = true;
+
 		if ( _elementListDecoderPool.count() )
 			_elementListDecoderPool.clear(), needToClear = true;
 
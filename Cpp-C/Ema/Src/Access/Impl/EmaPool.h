@@ -15,6 +15,10 @@
 
 #include <new>
 
+#ifndef WIN32
+#include <pthread.h>
+#endif
+
 namespace thomsonreuters {
 
 namespace ema {
@@ -45,31 +49,132 @@ O* Factory< O >::create()
 	return 0;
 }
 
-template < class I >
-class EncoderPool 
+// Number of items a thread keeps for itself, and the number it moves to or from the
+// shared stack when its cache is full or empty.
+#define EMA_POOL_THREAD_CACHE_SIZE		32
+#define EMA_POOL_THREAD_CACHE_BATCH		16
+
+class ThreadCachedPool;
+
+// Items held by one thread for one pool; only that thread changes them.
+// Other threads read the counters, through relaxed atomic loads, for statistics.
+class PoolThreadCache
 {
-public :
+private :
 
-	EncoderPool( UInt32 size );
+	friend class ThreadCachedPool;
 
-	virtual ~EncoderPool();
+	void*				_items[EMA_POOL_THREAD_CACHE_SIZE];
+	UInt32				_count;
+	ThreadCachedPool*	_pPool;
+	PoolThreadCache*	_previous;
+	PoolThreadCache*	_next;
+#ifdef EMA_POOL_STATISTICS
+	UInt64				_hits;
+	UInt64				_misses;
+#endif
+};
 
-	void clear();
+#ifdef EMA_POOL_STATISTICS
+struct PoolStatistics
+{
+	UInt64	cacheHits;			// gets served from the calling thread's cache
+	UInt64	cacheMisses;		// gets that had to go to the shared stack
+	UInt64	lockCount;			// times the shared stack lock was taken
+	UInt64	lockHoldNanos;		// total time the shared stack lock was held
+};
+#endif
 
-	I* getItem();
+// Shared stack of pooled items with a cache for each thread in front of it.
+// Gets and returns use the calling thread's cache without locking; the lock is
+// only taken to move a batch of items between a cache and the shared stack.
+// A thread's cached items go back to the shared stack when the thread exits.
+class ThreadCachedPool
+{
+public :
 
-	void returnItem( I* );
+	ThreadCachedPool( UInt32 size );
+
+	virtual ~ThreadCachedPool();
 
+	// Number of items held, in the shared stack and in all caches.
 	UInt32 count();
 
+#ifdef EMA_POOL_STATISTICS
+	void getStatistics( PoolStatistics& );
+#endif
+
+protected :
+
+	// Returns a pooled item, or 0 if the pool is empty.
+	void* takeItem();
+
+	void putItem( void* );
+
+	// Removes any one item, taking it from other threads' caches once the shared stack
+	// is empty. Returns 0 once the pool is empty. Used to clear the pool, so it must not
+	// be called while other threads are using the pool.
+	void* removeItem();
+
 private :
 
+	PoolThreadCache* getThreadCache();
+
+	void lockShared();
+
+	void unlockShared();
+
+	void releaseThreadCache( PoolThreadCache* );
+
+#ifdef WIN32
+	static void WINAPI threadExit( void* );
+
+	DWORD				_cacheIndex;
+#else
+	static void threadExit( void* );
+
+	pthread_key_t		_cacheKey;
+#endif
+	bool				_cacheKeyCreated;
+
 	Mutex				_lock;
 
-	EmaVector< I* >		_vector;
+	EmaVector< void* >	_vector;
 
 	UInt32				_count;
 
+	PoolThreadCache*	_caches;
+
+#ifdef EMA_POOL_STATISTICS
+	UInt64				_lockCount;
+	UInt64				_lockHoldNanos;
+	UInt64				_lockedAt;
+	UInt64				_releasedHits;
+	UInt64				_releasedMisses;
+#endif
+
+	ThreadCachedPool();
+	ThreadCachedPool( const ThreadCachedPool& );
+	ThreadCachedPool& operator=( const ThreadCachedPool& );
+};
+
+template < class I >
+class EncoderPool : public ThreadCachedPool
+{
+public :
+
+	EncoderPool( UInt32 size );
+
+	virtual ~EncoderPool();
+
+	void clear();
+
+	I* getItem();
+
+	void returnItem( I* );
+
+private :
+
 	EncoderPool();
 	EncoderPool( const EncoderPool& );
 	EncoderPool& operator=( const EncoderPool& );
@@ -77,10 +182,8 @@ private :
 
 template< class I >
 EncoderPool< I >::EncoderPool( UInt32 size ) :
- _count( 0 )
+ ThreadCachedPool( size )
 {
-	for ( UInt32 idx = 0; idx < size; ++idx )
-		_vector.push_back( 0 );
 }
 
 template< class I >
@@ -92,50 +195,18 @@ EncoderPool< I >::~EncoderPool()
 template< class I >
 void EncoderPool< I >::clear()
 {
-	_lock.lock();
-
-	if ( !_count )
-	{
-		_lock.unlock();
-		return;
-	}
-
-	for ( UInt32 idx = _vector.size(); idx != 0; --idx )
-	{
-		I* temp = _vector[ idx - 1 ];
-		if ( temp )
-		{
-			Factory< I >::destroy( temp );
-			_vector[ idx - 1 ] = 0;
-		}
-	}
+	void* item;
 
-	_count = 0;
-
-	_lock.unlock();
+	while ( ( item = removeItem() ) != 0 )
+		Factory< I >::destroy( static_cast< I* >( item ) );
 }
 
 template< class I >
 I* EncoderPool< I >::getItem()
 {
-	_lock.lock();
-
-	if ( !_count )
-	{
-		_lock.unlock();
-
-		return Factory< I >::create();
-	}
-
-	I*& itemRef = _vector[ --_count ];
-
-	I* item = itemRef;
+	void* item = takeItem();
 
-	itemRef = 0;
-	
-	_lock.unlock();
-
-	return item;
+	return item ? static_cast< I* >( item ) : Factory< I >::create();
 }
 
 template< class I >
@@ -143,24 +214,11 @@ void EncoderPool< I >::returnItem( I* item )
 {
 	item->clear();
 
-	_lock.lock();
-
-	if ( _count == _vector.capacity() )
-		do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
-
-	_vector[ _count++ ] = item;
-
-	_lock.unlock();
-}
-
-template< class I >
-UInt32 EncoderPool< I >::count()
-{
-	return _count;
+	putItem( item );
 }
 
 template < class I >
-class DecoderPool 
+class DecoderPool : public ThreadCachedPool
 {
 public :
 
@@ -174,16 +232,8 @@ public :
 
 	void returnItem( I* );
 
-	UInt32 count();
-
 private :
 
-	Mutex				_lock;
-
-	EmaVector< I* >		_vector;
-
-	UInt32				_count;
-
 	DecoderPool();
 	DecoderPool( const DecoderPool& );
 	DecoderPool& operator=( const DecoderPool& );
@@ -191,10 +241,8 @@ private :
 
 template< class I >
 DecoderPool< I >::DecoderPool( UInt32 size ) :
- _count( 0 )
+ ThreadCachedPool( size )
 {
-	for ( UInt32 idx = 0; idx < size; ++idx )
-		_vector.push_back( 0 );
 }
 
 template< class I >
@@ -206,75 +254,32 @@ DecoderPool< I >::~DecoderPool()
 template< class I >
 void DecoderPool< I >::clear()
 {
-	_lock.lock();
+	void* item;
 
-	if ( !_count )
+	while ( ( item = removeItem() ) != 0 )
 	{
-		_lock.unlock();
-		return;
+		I* temp = static_cast< I* >( item );
+		temp->setAtExit();
+		Factory< I >::destroy( temp );
 	}
-
-	for ( UInt32 idx = _vector.size(); idx != 0; --idx )
-	{
-		I* temp = _vector[ idx - 1 ];
-		if ( temp )
-		{
-			temp->setAtExit();
-			Factory< I >::destroy( temp );
-			_vector[ idx - 1 ] = 0;
-		}
-	}
-
-	_count = 0;
-
-	_lock.unlock();
 }
 
 template< class I >
 I* DecoderPool< I >::getItem()
 {
-	_lock.lock();
-
-	if ( !_count )
-	{
-		_lock.unlock();
-
-		return Factory< I >::create();
-	}
+	void* item = takeItem();
 
-	I*& itemRef = _vector[ --_count ];
-
-	I* item = itemRef;
-
-	itemRef = 0;
-	
-	_lock.unlock();
-
-	return item;
+	return item ? static_cast< I* >( item ) : Factory< I >::create();
 }
 
 template< class I >
 void DecoderPool< I >::returnItem( I* item )
 {
-	_lock.lock();
-
-	if ( _count == _vector.capacity() )
-		do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
-
-	_vector[ _count++ ] = item;
-
-	_lock.unlock();
-}
-
-template< class I >
-UInt32 DecoderPool< I >::count()
-{
-	return _count;
+	putItem( item );
 }
 
-
 template < class I, class T = I >
-class Pool
+class Pool : public ThreadCachedPool
 {
 public :
 
@@ -288,16 +293,8 @@ public :
 
 	void returnItem( I* );
 
-	UInt32 count();
-
 private :
 
-	Mutex	_lock;
-
-	EmaVector< I* >		_vector;
-
-	UInt32				_count;
-
 	Pool();
 	Pool( const Pool& ); 
 	Pool& operator=( const Pool& );
@@ -305,10 +302,8 @@ private :
 
 template< class I, class T >
 Pool< I, T >::Pool( UInt32 size ) :
- _count( 0 )
+ ThreadCachedPool( size )
 {
-	for ( UInt32 idx = 0; idx < size; ++idx )
-		_vector.push_back( 0 );
 }
 
 template< class I, class T >
@@ -320,67 +315,24 @@ Pool< I, T >::~Pool()
 template< class I, class T >
 void Pool< I, T >::clear()
 {
-	_lock.lock();
-
-	if ( !_count )
-	{
-		_lock.unlock();
-		return;
-	}
-
-	for ( UInt32 idx = _vector.size(); idx != 0; --idx )
-	{
-		I* temp = _vector[ idx - 1 ];
-		if ( temp )
-			Factory< I >::destroy( temp );
-		_vector[ idx - 1 ] = 0;
-	}
+	void* item;
 
-	_count = 0;
-
-	_lock.unlock();
+	while ( ( item = removeItem() ) != 0 )
+		Factory< I >::destroy( static_cast< I* >( item ) );
 }
 
 template< class I, class T >
 I* Pool< I, T >::getItem()
 {
-	_lock.lock();
-
-	if ( !_count )
-	{
-		_lock.unlock();
-
-		return Factory< T >::create();
-	}
-
-	I*& itemRef = _vector[ --_count ];
-
-	I* item = itemRef;
-
-	itemRef = 0;
-	
-	_lock.unlock();
+	void* item = takeItem();
 
-	return item;
+	return item ? static_cast< I* >( item ) : Factory< T >::create();
 }
 
 template< class I, class T >
 void Pool< I, T >::returnItem( I* item )
 {
-	_lock.lock();
-
-	if ( _count == _vector.capacity() )
-		do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() ); 
-
-	_vector[ _count++ ] = item;
-
-	_lock.unlock();
-}
-
-template< class I, class T >
-UInt32 Pool< I, T >::count()
-{
-	return _count;
+	putItem( item );
 }
 
 }
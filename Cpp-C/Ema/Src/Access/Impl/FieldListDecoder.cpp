@@ -849,6 +849,26 @@ const RsslBuffer& FieldListDecoder::getRsslBuffer() const
 	return _rsslFieldListBuffer;
 }
 
+UInt8 FieldListDecoder::getRsslMajVer() const
+{
+	return _rsslMajVer;
+}
+
+UInt8 FieldListDecoder::getRsslMinVer() const
+{
+	return _rsslMinVer;
+}
+
+const RsslDataDictionary* FieldListDecoder::getRsslDictionary() const
+{
+	return _pRsslDictionary;
+}
+
+RsslLocalFieldSetDefDb* FieldListDecoder::getLocalFieldSetDefDb() const
+{
+	return _rsslLocalFLSetDefDb;
+}
+
 OmmError::ErrorCode FieldListDecoder::getErrorCode() const
 {
 	return _errorCode;
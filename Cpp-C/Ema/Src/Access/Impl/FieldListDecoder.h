@@ -73,6 +73,14 @@ public :
 	bool decodingStarted() const;
 
 	const RsslBuffer& getRsslBuffer() const;
+
+	UInt8 getRsslMajVer() const;
+
+	UInt8 getRsslMinVer() const;
+
+	const RsslDataDictionary* getRsslDictionary() const;
+
+	RsslLocalFieldSetDefDb* getLocalFieldSetDefDb() const;
 	
 	void setAtExit();
 
@@ -0,0 +1,126 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "FieldListView.h"
+#include "FieldList.h"
+#include "FieldListDecoder.h"
+#include "FieldListViewDecoder.h"
+#include "ExceptionTranslator.h"
+#include "GlobalPool.h"
+#include "OmmInvalidUsageException.h"
+
+using namespace thomsonreuters::ema::access;
+
+FieldListView::FieldListView() :
+ _pDecoder( g_pool._fieldListViewDecoderPool.getItem() )
+{
+	static const RsslBuffer emptyBuffer = { 0, 0 };
+
+	_pDecoder->setRsslData( RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &emptyBuffer, 0, 0 );
+}
+
+FieldListView::FieldListView( const FieldList& fieldList ) :
+ _pDecoder( g_pool._fieldListViewDecoderPool.getItem() )
+{
+	try
+	{
+		set( fieldList );
+	}
+	catch ( ... )
+	{
+		g_pool._fieldListViewDecoderPool.returnItem( _pDecoder );
+		throw;
+	}
+}
+
+FieldListView::~FieldListView()
+{
+	g_pool._fieldListViewDecoderPool.returnItem( _pDecoder );
+}
+
+FieldListView& FieldListView::set( const FieldList& fieldList )
+{
+	const FieldListDecoder* pFieldListDecoder = fieldList._pDecoder;
+
+	if ( !pFieldListDecoder )
+	{
+		EmaString temp( "Attempt to set FieldListView on a FieldList that was not received." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return *this;
+	}
+
+	_pDecoder->setRsslData( pFieldListDecoder->getRsslMajVer(), pFieldListDecoder->getRsslMinVer(),
+		&pFieldListDecoder->getRsslBuffer(), pFieldListDecoder->getRsslDictionary(), pFieldListDecoder->getLocalFieldSetDefDb() );
+
+	return *this;
+}
+
+bool FieldListView::forth()
+{
+	return !_pDecoder->getNextData();
+}
+
+void FieldListView::reset()
+{
+	_pDecoder->reset();
+}
+
+Int16 FieldListView::getFieldId() const
+{
+	return _pDecoder->getFieldId();
+}
+
+DataType::DataTypeEnum FieldListView::getLoadType() const
+{
+	return _pDecoder->getLoadType();
+}
+
+Data::DataCode FieldListView::getCode() const
+{
+	return _pDecoder->getCode();
+}
+
+Int64 FieldListView::getInt() const
+{
+	return _pDecoder->getInt();
+}
+
+UInt64 FieldListView::getUInt() const
+{
+	return _pDecoder->getUInt();
+}
+
+UInt16 FieldListView::getEnum() const
+{
+	return _pDecoder->getEnum();
+}
+
+double FieldListView::getDouble() const
+{
+	return _pDecoder->getDouble();
+}
+
+Int64 FieldListView::getRealMantissa() const
+{
+	return _pDecoder->getRealMantissa();
+}
+
+OmmReal::MagnitudeType FieldListView::getRealMagnitudeType() const
+{
+	return _pDecoder->getRealMagnitudeType();
+}
+
+const char* FieldListView::getRawData() const
+{
+	return _pDecoder->getRawData();
+}
+
+UInt32 FieldListView::getRawLength() const
+{
+	return _pDecoder->getRawLength();
+}
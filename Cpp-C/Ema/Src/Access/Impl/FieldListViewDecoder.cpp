@@ -0,0 +1,271 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "FieldListViewDecoder.h"
+#include "ExceptionTranslator.h"
+#include "OmmInvalidUsageException.h"
+
+using namespace thomsonreuters::ema::access;
+
+extern const EmaString& getDTypeAsString( DataType::DataTypeEnum );
+
+FieldListViewDecoder::FieldListViewDecoder() :
+ _decodeIter(),
+ _rsslFieldList(),
+ _rsslFieldEntry(),
+ _rsslFieldListBuffer(),
+ _pRsslDictionary( 0 ),
+ _rsslLocalFLSetDefDb( 0 ),
+ _loadType( DataType::ErrorEnum ),
+ _rsslMajVer( RSSL_RWF_MAJOR_VERSION ),
+ _rsslMinVer( RSSL_RWF_MINOR_VERSION ),
+ _atEnd( true )
+{
+}
+
+FieldListViewDecoder::~FieldListViewDecoder()
+{
+}
+
+void FieldListViewDecoder::setAtExit()
+{
+}
+
+void FieldListViewDecoder::setRsslData( UInt8 majVer, UInt8 minVer, const RsslBuffer* rsslBuffer, const RsslDataDictionary* rsslDictionary, RsslLocalFieldSetDefDb* localFlSetDefDb )
+{
+	_rsslMajVer = majVer;
+
+	_rsslMinVer = minVer;
+
+	_rsslFieldListBuffer = *rsslBuffer;
+
+	_pRsslDictionary = rsslDictionary;
+
+	_rsslLocalFLSetDefDb = localFlSetDefDb;
+
+	reset();
+}
+
+void FieldListViewDecoder::reset()
+{
+	_loadType = DataType::ErrorEnum;
+
+	rsslClearFieldEntry( &_rsslFieldEntry );
+
+	rsslClearDecodeIterator( &_decodeIter );
+
+	// a field list that cannot be decoded, or a missing dictionary, has no entries to view
+	_atEnd = !_pRsslDictionary ||
+		rsslSetDecodeIteratorBuffer( &_decodeIter, &_rsslFieldListBuffer ) != RSSL_RET_SUCCESS ||
+		rsslSetDecodeIteratorRWFVersion( &_decodeIter, _rsslMajVer, _rsslMinVer ) != RSSL_RET_SUCCESS ||
+		rsslDecodeFieldList( &_decodeIter, &_rsslFieldList, _rsslLocalFLSetDefDb ) != RSSL_RET_SUCCESS;
+}
+
+bool FieldListViewDecoder::getNextData()
+{
+	if ( _atEnd ) return true;
+
+	switch ( rsslDecodeFieldEntry( &_decodeIter, &_rsslFieldEntry ) )
+	{
+	case RSSL_RET_SUCCESS :
+	{
+		const RsslDictionaryEntry* rsslDictionaryEntry = _pRsslDictionary->entriesArray[_rsslFieldEntry.fieldId];
+
+		_loadType = rsslDictionaryEntry ? static_cast< DataType::DataTypeEnum >( rsslDictionaryEntry->rwfType ) : DataType::ErrorEnum;
+		return false;
+	}
+	case RSSL_RET_END_OF_CONTAINER :
+		_atEnd = true;
+		return true;
+	default :
+		_loadType = DataType::ErrorEnum;
+		return false;
+	}
+}
+
+Int16 FieldListViewDecoder::getFieldId() const
+{
+	return _rsslFieldEntry.fieldId;
+}
+
+DataType::DataTypeEnum FieldListViewDecoder::getLoadType() const
+{
+	return _loadType;
+}
+
+Data::DataCode FieldListViewDecoder::getCode() const
+{
+	if ( !_rsslFieldEntry.encData.length )
+		return Data::BlankEnum;
+
+	// a blank may still have content, e.g. a REAL hint byte or a set defined entry,
+	// so the decoder decides as it does for FieldEntry
+	if ( _loadType == DataType::RealEnum )
+	{
+		RsslReal real;
+		rsslClearReal( &real );
+		return rsslDecodeReal( &_decodeIter, &real ) >= RSSL_RET_SUCCESS && real.isBlank ? Data::BlankEnum : Data::NoCodeEnum;
+	}
+
+	union
+	{
+		RsslInt			intValue;
+		RsslUInt		uintValue;
+		RsslFloat		floatValue;
+		RsslDouble		doubleValue;
+		RsslDateTime	dateTimeValue;
+		RsslQos			qosValue;
+		RsslState		stateValue;
+		RsslEnum		enumValue;
+	} value;
+
+	switch ( _loadType )
+	{
+	case DataType::IntEnum :
+	case DataType::UIntEnum :
+	case DataType::FloatEnum :
+	case DataType::DoubleEnum :
+	case DataType::DateEnum :
+	case DataType::TimeEnum :
+	case DataType::DateTimeEnum :
+	case DataType::QosEnum :
+	case DataType::StateEnum :
+	case DataType::EnumEnum :
+		return rsslDecodePrimitiveType( &_decodeIter, static_cast< RsslPrimitiveType >( _loadType ), &value ) == RSSL_RET_BLANK_DATA ?
+			Data::BlankEnum : Data::NoCodeEnum;
+	default :
+		return Data::NoCodeEnum;
+	}
+}
+
+void FieldListViewDecoder::checkLoadType( DataType::DataTypeEnum dataType, const char* method ) const
+{
+	if ( _loadType != dataType )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( method ).append( "() while actual Entry data type is " ).append( getDTypeAsString( _loadType ) );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+	else if ( !_rsslFieldEntry.encData.length )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( method ).append( "() while entry data is blank." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+}
+
+Int64 FieldListViewDecoder::getInt() const
+{
+	checkLoadType( DataType::IntEnum, "getInt" );
+
+	RsslInt value = 0;
+	checkDecodeResult( rsslDecodeInt( &_decodeIter, &value ), "getInt" );
+	return value;
+}
+
+UInt64 FieldListViewDecoder::getUInt() const
+{
+	checkLoadType( DataType::UIntEnum, "getUInt" );
+
+	RsslUInt value = 0;
+	checkDecodeResult( rsslDecodeUInt( &_decodeIter, &value ), "getUInt" );
+	return value;
+}
+
+UInt16 FieldListViewDecoder::getEnum() const
+{
+	checkLoadType( DataType::EnumEnum, "getEnum" );
+
+	RsslEnum value = 0;
+	checkDecodeResult( rsslDecodeEnum( &_decodeIter, &value ), "getEnum" );
+	return value;
+}
+
+double FieldListViewDecoder::getDouble() const
+{
+	switch ( _loadType )
+	{
+	case DataType::FloatEnum :
+	{
+		checkLoadType( DataType::FloatEnum, "getDouble" );
+
+		RsslFloat value = 0;
+		checkDecodeResult( rsslDecodeFloat( &_decodeIter, &value ), "getDouble" );
+		return value;
+	}
+	case DataType::DoubleEnum :
+	{
+		checkLoadType( DataType::DoubleEnum, "getDouble" );
+
+		RsslDouble value = 0;
+		checkDecodeResult( rsslDecodeDouble( &_decodeIter, &value ), "getDouble" );
+		return value;
+	}
+	default :
+	{
+		RsslReal real;
+		decodeReal( real, "getDouble" );
+
+		double value = 0;
+		rsslRealToDouble( &value, &real );
+		return value;
+	}
+	}
+}
+
+Int64 FieldListViewDecoder::getRealMantissa() const
+{
+	RsslReal real;
+	decodeReal( real, "getRealMantissa" );
+	return real.value;
+}
+
+OmmReal::MagnitudeType FieldListViewDecoder::getRealMagnitudeType() const
+{
+	RsslReal real;
+	decodeReal( real, "getRealMagnitudeType" );
+	return static_cast< OmmReal::MagnitudeType >( real.hint );
+}
+
+void FieldListViewDecoder::decodeReal( RsslReal& real, const char* method ) const
+{
+	checkLoadType( DataType::RealEnum, method );
+
+	rsslClearReal( &real );
+	checkDecodeResult( rsslDecodeReal( &_decodeIter, &real ), method );
+
+	// a one byte blank decodes successfully with only the blank flag set
+	if ( real.isBlank )
+		checkDecodeResult( RSSL_RET_BLANK_DATA, method );
+}
+
+void FieldListViewDecoder::checkDecodeResult( RsslRet retCode, const char* method ) const
+{
+	if ( retCode < RSSL_RET_SUCCESS )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( method ).append( "() while entry data is incomplete." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+	else if ( retCode == RSSL_RET_BLANK_DATA )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( method ).append( "() while entry data is blank." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+}
+
+const char* FieldListViewDecoder::getRawData() const
+{
+	return _rsslFieldEntry.encData.data;
+}
+
+UInt32 FieldListViewDecoder::getRawLength() const
+{
+	return _rsslFieldEntry.encData.length;
+}
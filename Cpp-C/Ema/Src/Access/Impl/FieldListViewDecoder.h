@@ -0,0 +1,117 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __thomsonreuters_ema_access_FieldListViewDecoder_h
+#define __thomsonreuters_ema_access_FieldListViewDecoder_h
+
+#include "Data.h"
+#include "OmmReal.h"
+#include "EmaPool.h"
+#include "rtr/rsslDataDictionary.h"
+#include "rtr/rsslSetData.h"
+
+namespace thomsonreuters {
+
+namespace ema {
+
+namespace access {
+
+// Walks the entries of an encoded field list with a single decode iterator. Unlike
+// FieldListDecoder it has no load pool: scalar values are decoded on request and
+// buffer values are returned in place.
+class FieldListViewDecoder
+{
+public :
+
+	FieldListViewDecoder();
+
+	virtual ~FieldListViewDecoder();
+
+	void setRsslData( UInt8 majVer, UInt8 minVer, const RsslBuffer*, const RsslDataDictionary*, RsslLocalFieldSetDefDb* );
+
+	bool getNextData();
+
+	void reset();
+
+	Int16 getFieldId() const;
+
+	DataType::DataTypeEnum getLoadType() const;
+
+	Data::DataCode getCode() const;
+
+	Int64 getInt() const;
+
+	UInt64 getUInt() const;
+
+	UInt16 getEnum() const;
+
+	double getDouble() const;
+
+	Int64 getRealMantissa() const;
+
+	OmmReal::MagnitudeType getRealMagnitudeType() const;
+
+	const char* getRawData() const;
+
+	UInt32 getRawLength() const;
+
+	void setAtExit();
+
+private :
+
+	void checkLoadType( DataType::DataTypeEnum, const char* method ) const;
+
+	void checkDecodeResult( RsslRet, const char* method ) const;
+
+	void decodeReal( RsslReal&, const char* method ) const;
+
+	mutable RsslDecodeIterator	_decodeIter;
+
+	RsslFieldList				_rsslFieldList;
+
+	RsslFieldEntry				_rsslFieldEntry;
+
+	RsslBuffer					_rsslFieldListBuffer;
+
+	const RsslDataDictionary*	_pRsslDictionary;
+
+	RsslLocalFieldSetDefDb*		_rsslLocalFLSetDefDb;
+
+	DataType::DataTypeEnum		_loadType;
+
+	UInt8						_rsslMajVer;
+
+	UInt8						_rsslMinVer;
+
+	bool						_atEnd;
+
+	FieldListViewDecoder( const FieldListViewDecoder& );
+	FieldListViewDecoder& operator=( const FieldListViewDecoder& );
+};
+
+class FieldListViewDecoderPool : public DecoderPool< FieldListViewDecoder >
+{
+public :
+
+	FieldListViewDecoderPool( unsigned int size = 5 ) : DecoderPool< FieldListViewDecoder >( size ) {};
+
+	virtual ~FieldListViewDecoderPool() {}
+
+private :
+
+	FieldListViewDecoderPool( const FieldListViewDecoderPool& );
+	FieldListViewDecoderPool& operator=( const FieldListViewDecoderPool& );
+};
+
+}
+
+}
+
+}
+
+#endif // __thomsonreuters_ema_access_FieldListViewDecoder_h
@@ -12,6 +12,7 @@
 #include "OmmArrayDecoder.h"
 #include "ElementListDecoder.h"
 #include "FieldListDecoder.h"
+#include "FieldListViewDecoder.h"
 #include "FilterListDecoder.h"
 #include "MapDecoder.h"
 #include "SeriesDecoder.h"
@@ -87,6 +88,7 @@ public :
 	OmmArrayDecoderPool			_arrayDecoderPool;
 	ElementListDecoderPool		_elementListDecoderPool;
 	FieldListDecoderPool		_fieldListDecoderPool;
+	FieldListViewDecoderPool	_fieldListViewDecoderPool;
 	FilterListDecoderPool		_filterListDecoderPool;
 	MapDecoderPool				_mapDecoderPool;
 	VectorDecoderPool			_vectorDecoderPool;
@@ -404,7 +404,7 @@ SingleItem* SingleItem::create( OmmBaseImpl& ommBaseImpl, OmmConsumerClient& omm
 	SingleItem* pItem = 0;
 
 	try {
-		pItem = new SingleItem( ommBaseImpl, ommConsClient, closure, pParentItem );
+		pItem = new ( ommBaseImpl.getItemSlab() ) SingleItem( ommBaseImpl, ommConsClient, closure, pParentItem );
 	}
 	catch( std::bad_alloc& ) {}
 
@@ -506,13 +506,23 @@ bool SingleItem::submit( const PostMsg& postMsg )
 {
 	const PostMsgEncoder& postMsgEncoder = static_cast<const PostMsgEncoder&>( postMsg.getEncoder() );
 
-	if ( postMsgEncoder.hasServiceName() )
+	return submitRsslMsg( postMsgEncoder.getRsslPostMsg(), postMsgEncoder.hasServiceName() ? &postMsgEncoder.getServiceName() : 0 );
+}
+
+bool SingleItem::submit( const GenericMsg& genMsg )
+{
+	return submitRsslMsg( static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() ).getRsslGenericMsg() );
+}
+
+bool SingleItem::submitRsslMsg( RsslPostMsg* pRsslPostMsg, const EmaString* pServiceName )
+{
+	if ( pServiceName )
 	{
-		const Directory* pDirectory = _ommBaseImpl.getDirectoryCallbackClient().getDirectory( postMsgEncoder.getServiceName() );
+		const Directory* pDirectory = _ommBaseImpl.getDirectoryCallbackClient().getDirectory( *pServiceName );
 		if ( !pDirectory )
 		{
 			EmaString temp("Failed to submit PostMsg on item stream. Reason: Service name of '");
-			temp.append(postMsgEncoder.getServiceName()).append("' is not found.");
+			temp.append(*pServiceName).append("' is not found.");
 
 			_ommBaseImpl.handleIue(temp, OmmInvalidUsageException::InvalidArgumentEnum);
 
@@ -525,15 +535,15 @@ bool SingleItem::submit( const PostMsg& postMsg )
 		serviceNameBuffer.data = (char*)serviceName.c_str();
 		serviceNameBuffer.length = serviceName.length();
 
-		return submit( static_cast<const PostMsgEncoder&>( postMsg.getEncoder() ).getRsslPostMsg(), &serviceNameBuffer );
+		return submit( pRsslPostMsg, &serviceNameBuffer );
 	}
 
-	return submit( static_cast<const PostMsgEncoder&>( postMsg.getEncoder() ).getRsslPostMsg(), NULL );
+	return submit( pRsslPostMsg, NULL );
 }
 
-bool SingleItem::submit( const GenericMsg& genMsg )
+bool SingleItem::submitRsslMsg( RsslGenericMsg* pRsslGenericMsg )
 {
-	return submit( static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() ).getRsslGenericMsg() );
+	return submit( pRsslGenericMsg );
 }
 
 void SingleItem::remove()
@@ -824,7 +834,7 @@ NiProviderSingleItem* NiProviderSingleItem::create( OmmBaseImpl& ommBaseImpl, Om
 
 	try
 	{
-		pItem = new NiProviderSingleItem( ommBaseImpl, ommProvClient, &static_cast<OmmNiProviderImpl&>(ommBaseImpl).getItemWatchList(), closure, pParentItem );
+		pItem = new ( ommBaseImpl.getItemSlab() ) NiProviderSingleItem( ommBaseImpl, ommProvClient, &static_cast<OmmNiProviderImpl&>(ommBaseImpl).getItemWatchList(), closure, pParentItem );
 	}
 	catch ( std::bad_alloc& ) {}
 
@@ -1062,7 +1072,7 @@ bool NiProviderSingleItem::submit( RsslRequestMsg* pRsslRequestMsg )
 	if ( requestTimeout > 0 )
 	{
 		cancelReqTimerEvent();
-		_pTimeOut = new TimeOut(_ommBaseImpl, requestTimeout * 1000, ItemWatchList::itemRequestTimeout, this, true); 
+		_pTimeOut = new ( _ommBaseImpl.getItemSlab() ) TimeOut(_ommBaseImpl, requestTimeout * 1000, ItemWatchList::itemRequestTimeout, this, true); 
 		_timeOutExpired = false;
 	}
 
@@ -1117,9 +1127,9 @@ void NiProviderSingleItem::scheduleItemClosedStatus( const ReqMsgEncoder& reqMsg
 {
 	if ( _closedStatusInfo ) return;
 
-	_closedStatusInfo = new ClosedStatusInfo( this, reqMsgEncoder, text );
+	_closedStatusInfo = new ( _ommBaseImpl.getItemSlab() ) ClosedStatusInfo( this, reqMsgEncoder, text );
 
-	new TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
+	new ( _ommBaseImpl.getItemSlab() ) TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
 }
 
 void NiProviderSingleItem::scheduleItemClosedRecoverableStatus(const EmaString& text)
@@ -1128,9 +1138,9 @@ void NiProviderSingleItem::scheduleItemClosedRecoverableStatus(const EmaString&
 
 	cancelReqTimerEvent();
 
-	_closedStatusInfo = new ClosedStatusInfo( this, text );
+	_closedStatusInfo = new ( _ommBaseImpl.getItemSlab() ) ClosedStatusInfo( this, text );
 
-	new TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
+	new ( _ommBaseImpl.getItemSlab() ) TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
 }
 
 IProviderSingleItem* IProviderSingleItem::create( OmmServerBaseImpl& ommServerBaseImpl,  OmmProviderClient& ommProvClient, void* closure, Item* pParentItem )
@@ -1139,7 +1149,7 @@ IProviderSingleItem* IProviderSingleItem::create( OmmServerBaseImpl& ommServerBa
 
 	try
 	{
-		pItem = new IProviderSingleItem(ommServerBaseImpl, ommProvClient, &static_cast<OmmIProviderImpl&>(ommServerBaseImpl).getItemWatchList(), closure, pParentItem);
+		pItem = new ( ommServerBaseImpl.getItemSlab() ) IProviderSingleItem(ommServerBaseImpl, ommProvClient, &static_cast<OmmIProviderImpl&>(ommServerBaseImpl).getItemWatchList(), closure, pParentItem);
 	}
 	catch (std::bad_alloc&) {}
 
@@ -1343,7 +1353,7 @@ bool IProviderSingleItem::submit(RsslRequestMsg* pRsslRequestMsg)
 	submitMsgOpts.majorVersion = getClientSession()->getChannel()->majorVersion;
 	submitMsgOpts.minorVersion = getClientSession()->getChannel()->minorVersion;
 
-	if ((ret = rsslReactorSubmitMsg(_ommServerBaseImpl.getRsslReactor(), getClientSession()->getChannel(),
+	if ((ret = rsslReactorSubmitMsg(_ommServerBaseImpl.getRsslReactor(getClientSession()->getChannel()), getClientSession()->getChannel(),
 		&submitMsgOpts, &rsslErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		if (OmmLoggerClient::ErrorEnum >= _ommServerBaseImpl.getActiveConfig().loggerConfig.minLoggerSeverity)
@@ -1373,7 +1383,7 @@ bool IProviderSingleItem::submit(RsslRequestMsg* pRsslRequestMsg)
 	if ( requestTimeout > 0 )
 	{
 		cancelReqTimerEvent();
-		_pTimeOut = new TimeOut(_ommServerBaseImpl, requestTimeout * 1000, ItemWatchList::itemRequestTimeout, this, true);
+		_pTimeOut = new ( _ommServerBaseImpl.getItemSlab() ) TimeOut(_ommServerBaseImpl, requestTimeout * 1000, ItemWatchList::itemRequestTimeout, this, true);
 		_timeOutExpired = false;
 	}	
 
@@ -1394,7 +1404,7 @@ bool IProviderSingleItem::submit(RsslCloseMsg* pRsslCloseMsg)
 	RsslErrorInfo rsslErrorInfo;
 	clearRsslErrorInfo(&rsslErrorInfo);
 	RsslRet ret;
-	if ((ret = rsslReactorSubmitMsg(_ommServerBaseImpl.getRsslReactor(), getClientSession()->getChannel(),
+	if ((ret = rsslReactorSubmitMsg(_ommServerBaseImpl.getRsslReactor(getClientSession()->getChannel()), getClientSession()->getChannel(),
 		&submitMsgOpts, &rsslErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		if (OmmLoggerClient::ErrorEnum >= _ommServerBaseImpl.getActiveConfig().loggerConfig.minLoggerSeverity)
@@ -1431,9 +1441,9 @@ void IProviderSingleItem::scheduleItemClosedStatus(const ReqMsgEncoder& reqMsgEn
 {
 	if (_closedStatusInfo) return;
 
-	_closedStatusInfo = new ClosedStatusInfo(this, reqMsgEncoder, text);
+	_closedStatusInfo = new ( _ommServerBaseImpl.getItemSlab() ) ClosedStatusInfo(this, reqMsgEncoder, text);
 
-	new TimeOut(_ommServerBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true);
+	new ( _ommServerBaseImpl.getItemSlab() ) TimeOut(_ommServerBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true);
 }
 
 void IProviderSingleItem::scheduleItemClosedRecoverableStatus( const EmaString& text )
@@ -1442,9 +1452,9 @@ void IProviderSingleItem::scheduleItemClosedRecoverableStatus( const EmaString&
 
 	cancelReqTimerEvent();
 
-	_closedStatusInfo = new ClosedStatusInfo(this, text);
+	_closedStatusInfo = new ( _ommServerBaseImpl.getItemSlab() ) ClosedStatusInfo(this, text);
 
-	new TimeOut( _ommServerBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
+	new ( _ommServerBaseImpl.getItemSlab() ) TimeOut( _ommServerBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
 }
 
 void ItemCallbackClient::sendItemClosedStatus( void* pInfo )
@@ -1501,9 +1511,9 @@ void SingleItem::scheduleItemClosedStatus( const ReqMsgEncoder& reqMsgEncoder, c
 {
 	if ( _closedStatusInfo ) return;
 
-	_closedStatusInfo = new ClosedStatusInfo( this, reqMsgEncoder, text );
+	_closedStatusInfo = new ( _ommBaseImpl.getItemSlab() ) ClosedStatusInfo( this, reqMsgEncoder, text );
 
-	new TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
+	new ( _ommBaseImpl.getItemSlab() ) TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
 }
 
 ClosedStatusInfo::ClosedStatusInfo( Item* pItem, const ReqMsgEncoder& reqMsgEncoder, const EmaString& text ) :
@@ -1649,7 +1659,7 @@ BatchItem* BatchItem::create( OmmBaseImpl& ommBaseImpl, OmmConsumerClient& ommCo
 	BatchItem* pItem = 0;
 
 	try {
-		pItem = new BatchItem( ommBaseImpl, ommConsClient, closure );
+		pItem = new ( ommBaseImpl.getItemSlab() ) BatchItem( ommBaseImpl, ommConsClient, closure );
 	}
 	catch( std::bad_alloc& ) {}
 
@@ -1703,6 +1713,16 @@ bool BatchItem::close()
 }
 
 bool BatchItem::submit( const PostMsg& )
+{
+	return submitRsslMsg( 0, 0 );
+}
+
+bool BatchItem::submit( const GenericMsg& )
+{
+	return submitRsslMsg( (RsslGenericMsg*)0 );
+}
+
+bool BatchItem::submitRsslMsg( RsslPostMsg* , const EmaString* )
 {
 	EmaString temp( "Invalid attempt to submit PostMsg on batch stream. " );
 	temp.append( "Instance name='" ).append( _ommBaseImpl .getInstanceName() ).append( "'." );
@@ -1712,7 +1732,7 @@ bool BatchItem::submit( const PostMsg& )
 	return false;
 }
 
-bool BatchItem::submit( const GenericMsg& )
+bool BatchItem::submitRsslMsg( RsslGenericMsg* )
 {
 	EmaString temp( "Invalid attempt to submit GenericMsg on batch stream. " );
 	temp.append( "Instance name='" ).append( _ommBaseImpl .getInstanceName() ).append( "'." );
@@ -1762,7 +1782,7 @@ TunnelItem* TunnelItem::create( OmmBaseImpl& ommBaseImpl, OmmConsumerClient& omm
 	TunnelItem* pItem = 0;
 
 	try {
-		pItem = new TunnelItem( ommBaseImpl, ommConsClient, closure );
+		pItem = new ( ommBaseImpl.getItemSlab() ) TunnelItem( ommBaseImpl, ommConsClient, closure );
 	}
 	catch( std::bad_alloc& ) {}
 
@@ -1821,7 +1841,7 @@ Int32 TunnelItem::getSubItemStreamId()
 
 void TunnelItem::returnSubItemStreamId( Int32 subItemStreamId )
 {
-	StreamId* sId( new StreamId( subItemStreamId ) );
+	StreamId* sId( new ( _ommBaseImpl.getItemSlab() ) StreamId( subItemStreamId ) );
 	returnedSubItemStreamIds.push_back( sId );
 }
 
@@ -1976,9 +1996,9 @@ void TunnelItem::scheduleItemClosedStatus( const TunnelStreamRequest& tunnelStre
 {
 	if ( _closedStatusInfo ) return;
 
-	_closedStatusInfo = new ClosedStatusInfo( this, tunnelStreamRequest, text );
+	_closedStatusInfo = new ( _ommBaseImpl.getItemSlab() ) ClosedStatusInfo( this, tunnelStreamRequest, text );
 
-	new TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
+	new ( _ommBaseImpl.getItemSlab() ) TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
 }
 
 void TunnelItem::rsslTunnelStream( RsslTunnelStream* pRsslTunnelStream )
@@ -2007,6 +2027,16 @@ bool TunnelItem::modify( const ReqMsg& )
 }
 
 bool TunnelItem::submit( const PostMsg& )
+{
+	return submitRsslMsg( 0, 0 );
+}
+
+bool TunnelItem::submit( const GenericMsg& )
+{
+	return submitRsslMsg( (RsslGenericMsg*)0 );
+}
+
+bool TunnelItem::submitRsslMsg( RsslPostMsg* , const EmaString* )
 {
 	EmaString temp( "Invalid attempt to submit PostMsg on tunnel stream." );
 	temp.append( "OmmConsumer name='" ).append( _ommBaseImpl .getInstanceName() ).append( "'." );
@@ -2016,7 +2046,7 @@ bool TunnelItem::submit( const PostMsg& )
 	return false;
 }
 
-bool TunnelItem::submit( const GenericMsg& )
+bool TunnelItem::submitRsslMsg( RsslGenericMsg* )
 {
 	EmaString temp( "Invalid attempt to submit GenericMsg on tunnel stream." );
 	temp.append( "OmmConsumer name='" ).append( _ommBaseImpl .getInstanceName() ).append( "'." );
@@ -2308,7 +2338,7 @@ SubItem* SubItem::create( OmmBaseImpl& ommBaseImpl, OmmConsumerClient& ommConsCl
 	SubItem* pItem = 0;
 
 	try {
-		pItem = new SubItem( ommBaseImpl, ommConsClient, closure, parent );
+		pItem = new ( ommBaseImpl.getItemSlab() ) SubItem( ommBaseImpl, ommConsClient, closure, parent );
 	}
 	catch( std::bad_alloc& ) {}
 
@@ -2347,9 +2377,9 @@ void SubItem::scheduleItemClosedStatus( const ReqMsgEncoder& reqMsgEncoder, cons
 {
 	if ( _closedStatusInfo ) return;
 
-	_closedStatusInfo = new ClosedStatusInfo( this, reqMsgEncoder, text );
+	_closedStatusInfo = new ( _ommBaseImpl.getItemSlab() ) ClosedStatusInfo( this, reqMsgEncoder, text );
 
-	new TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
+	new ( _ommBaseImpl.getItemSlab() ) TimeOut( _ommBaseImpl, 1000, ItemCallbackClient::sendItemClosedStatus, _closedStatusInfo, true );
 }
 
 bool SubItem::open( const ReqMsg& reqMsg )
@@ -2411,22 +2441,28 @@ bool SubItem::modify( const ReqMsg& reqMsg )
 
 bool SubItem::submit( const PostMsg& postMsg )
 {
-	const PostMsgEncoder& postMsgEncoder = static_cast<const PostMsgEncoder&>( postMsg.getEncoder() );
-
-	postMsgEncoder.getRsslPostMsg()->msgBase.streamId = _streamId;
-
-	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)postMsgEncoder.getRsslPostMsg() );
+	return submitRsslMsg( static_cast<const PostMsgEncoder&>( postMsg.getEncoder() ).getRsslPostMsg(), 0 );
 }
 
 bool SubItem::submit( const GenericMsg& genMsg )
 {
-	const GenericMsgEncoder& genMsgEncoder = static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() );
+	return submitRsslMsg( static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() ).getRsslGenericMsg() );
+}
+
+bool SubItem::submitRsslMsg( RsslPostMsg* pRsslPostMsg, const EmaString* )
+{
+	pRsslPostMsg->msgBase.streamId = _streamId;
+
+	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)pRsslPostMsg );
+}
 
-	genMsgEncoder.getRsslGenericMsg()->msgBase.streamId = _streamId;
-	if (genMsgEncoder.getRsslGenericMsg()->msgBase.domainType == 0)
-		genMsgEncoder.getRsslGenericMsg()->msgBase.domainType = _domainType;
+bool SubItem::submitRsslMsg( RsslGenericMsg* pRsslGenericMsg )
+{
+	pRsslGenericMsg->msgBase.streamId = _streamId;
+	if (pRsslGenericMsg->msgBase.domainType == 0)
+		pRsslGenericMsg->msgBase.domainType = _domainType;
 
-	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)genMsgEncoder.getRsslGenericMsg() );
+	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)pRsslGenericMsg );
 }
 
 bool SubItem::close()
@@ -3689,6 +3725,46 @@ void ItemCallbackClient::submit( const GenericMsg& genericMsg, UInt64 handle )
 	((Item*)handle)->submit( genericMsg );
 }
 
+void ItemCallbackClient::submit( RsslPostMsg* pRsslPostMsg, const EmaString* pServiceName, UInt64 handle )
+{
+	if ( !_itemMap.find( handle ) )
+	{
+		EmaString temp( "Attempt to use invalid Handle on submit( const PostMsg& ). " );
+		temp.append( "Instance name='" ).append( _ommCommonImpl.getInstanceName() ).append( "'." );
+		_ommCommonImpl.handleIhe(handle, temp);
+		return;
+	}
+
+	((Item*)handle)->submitRsslMsg( pRsslPostMsg, pServiceName );
+}
+
+void ItemCallbackClient::submit( RsslGenericMsg* pRsslGenericMsg, UInt64 handle )
+{
+	if ( !_itemMap.find( handle ) )
+	{
+		EmaString temp( "Attempt to use invalid Handle on submit( const GenericMsg& ). " );
+		temp.append( "Instance name='" ).append( _ommCommonImpl.getInstanceName() ).append( "'." );
+		_ommCommonImpl.handleIhe(handle, temp);
+		return;
+	}
+
+	((Item*)handle)->submitRsslMsg( pRsslGenericMsg );
+}
+
+RsslMsg* ItemCallbackClient::getRsslMsg( const PostMsg& postMsg, const EmaString*& pServiceName )
+{
+	const PostMsgEncoder& postMsgEncoder = static_cast<const PostMsgEncoder&>( postMsg.getEncoder() );
+
+	pServiceName = postMsgEncoder.hasServiceName() ? &postMsgEncoder.getServiceName() : 0;
+
+	return (RsslMsg*)postMsgEncoder.getRsslPostMsg();
+}
+
+RsslMsg* ItemCallbackClient::getRsslMsg( const GenericMsg& genericMsg )
+{
+	return (RsslMsg*)static_cast<const GenericMsgEncoder&>( genericMsg.getEncoder() ).getRsslGenericMsg();
+}
+
 size_t ItemCallbackClient::UInt64rHasher::operator()( const UInt64& value ) const
 {
 	return value;
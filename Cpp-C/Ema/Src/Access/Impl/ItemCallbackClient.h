@@ -22,6 +22,7 @@
 #include "OmmConsumerEvent.h"
 #include "OmmProviderEvent.h"
 #include "EmaVector.h"
+#include "SlabAllocator.h"
 
 namespace thomsonreuters {
 
@@ -78,7 +79,7 @@ private :
 	ItemList& operator=( const ItemList& );
 };
 
-class Item : public ListLinks< Item >
+class Item : public ListLinks< Item >, public SlabAllocated
 {
 public :
 
@@ -118,6 +119,12 @@ public :
 	virtual bool modify( const ReqMsg& ) = 0;
 	virtual bool submit( const PostMsg& ) { return false; }
 	virtual bool submit( const GenericMsg& ) = 0;
+
+	// submit a PostMsg or GenericMsg given as its RsslMsg, such as one decoded from the submit queue;
+	// pServiceName is the service name set on the PostMsg, if any. Consumer items override these.
+	virtual bool submitRsslMsg( RsslPostMsg* , const EmaString* pServiceName ) { return false; }
+	virtual bool submitRsslMsg( RsslGenericMsg* ) { return false; }
+
 	virtual bool close() = 0;
 	virtual void remove() = 0;
 
@@ -147,7 +154,7 @@ private :
 	Item& operator=( const Item& );
 };
 
-class ClosedStatusInfo
+class ClosedStatusInfo : public SlabAllocated
 {
 public :
 
@@ -295,6 +302,8 @@ public :
 	bool modify( const ReqMsg& );
 	bool submit( const PostMsg& );
 	bool submit( const GenericMsg& );
+	bool submitRsslMsg( RsslPostMsg* , const EmaString* );
+	bool submitRsslMsg( RsslGenericMsg* );
 	bool close();
 	void remove();
 
@@ -416,6 +425,8 @@ public :
 	bool modify( const ReqMsg& );
 	bool submit( const PostMsg& );
 	bool submit( const GenericMsg& );
+	bool submitRsslMsg( RsslPostMsg* , const EmaString* );
+	bool submitRsslMsg( RsslGenericMsg* );
 	bool close();
 
 	bool addBatchItems( UInt32 batchSize );
@@ -459,6 +470,8 @@ public :
 	bool modify( const ReqMsg& );
 	bool submit( const PostMsg& );
 	bool submit( const GenericMsg& );
+	bool submitRsslMsg( RsslPostMsg* , const EmaString* );
+	bool submitRsslMsg( RsslGenericMsg* );
 	bool close();
 	void remove();
 
@@ -507,6 +520,8 @@ public :
 	bool modify( const ReqMsg& );
 	bool submit( const PostMsg& );
 	bool submit( const GenericMsg& );
+	bool submitRsslMsg( RsslPostMsg* , const EmaString* );
+	bool submitRsslMsg( RsslGenericMsg* );
 	bool close();
 	void remove();
 
@@ -553,6 +568,16 @@ public :
 
 	void submit( const GenericMsg& , UInt64 );
 
+	// submit a message decoded from the submit queue
+	void submit( RsslPostMsg* , const EmaString* pServiceName, UInt64 );
+
+	void submit( RsslGenericMsg* , UInt64 );
+
+	// the RsslMsg behind a PostMsg or GenericMsg, for copying it into the submit queue
+	static RsslMsg* getRsslMsg( const PostMsg& , const EmaString*& pServiceName );
+
+	static RsslMsg* getRsslMsg( const GenericMsg& );
+
 	RsslReactorCallbackRet processCallback( RsslReactor* , RsslReactorChannel* , RsslMsgEvent* );
 
 	RsslReactorCallbackRet processCallback( RsslTunnelStream* , RsslTunnelStreamStatusEvent* );
@@ -1719,36 +1719,43 @@ bool LoginItem::submit( const PostMsg& postMsg )
 {
 	const PostMsgEncoder& postMsgEncoder = static_cast<const PostMsgEncoder&>( postMsg.getEncoder() );
 
-	RsslPostMsg* pRsslPostMsg = postMsgEncoder.getRsslPostMsg();
+	return submitRsslMsg( postMsgEncoder.getRsslPostMsg(), postMsgEncoder.hasServiceName() ? &postMsgEncoder.getServiceName() : 0 );
+}
+
+bool LoginItem::submit( const GenericMsg& genMsg )
+{
+	return submitRsslMsg( static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() ).getRsslGenericMsg() );
+}
 
+bool LoginItem::submitRsslMsg( RsslPostMsg* pRsslPostMsg, const EmaString* pServiceName )
+{
 	/* if the PostMsg has the Service Name */
-	if ( postMsgEncoder.hasServiceName() )
+	if ( pServiceName )
 	{
-		const Directory* pDirectory = _ommBaseImpl.getDirectoryCallbackClient().getDirectory(postMsgEncoder.getServiceName());
+		const Directory* pDirectory = _ommBaseImpl.getDirectoryCallbackClient().getDirectory(*pServiceName);
 		if (!pDirectory)
 		{
 			EmaString temp("Failed to submit PostMsg on item stream. Reason: Service name of '");
-			temp.append(postMsgEncoder.getServiceName()).append("' is not found.");
+			temp.append(*pServiceName).append("' is not found.");
 
 			_ommBaseImpl.handleIue(temp, OmmInvalidUsageException::InvalidArgumentEnum);
 
 			return false;
 		}
 
-		const EmaString& serviceName = postMsgEncoder.getServiceName();
 		RsslBuffer serviceNameBuffer;
-		serviceNameBuffer.data = (char*) serviceName.c_str();
-		serviceNameBuffer.length = serviceName.length();
+		serviceNameBuffer.data = (char*) pServiceName->c_str();
+		serviceNameBuffer.length = pServiceName->length();
 			
 		return submit( pRsslPostMsg, &serviceNameBuffer );
 	}
 
-	return submit( static_cast<const PostMsgEncoder&>( postMsg.getEncoder() ).getRsslPostMsg(), NULL );
+	return submit( pRsslPostMsg, NULL );
 }
 
-bool LoginItem::submit( const GenericMsg& genMsg )
+bool LoginItem::submitRsslMsg( RsslGenericMsg* pRsslGenericMsg )
 {
-	return submit( static_cast<const GenericMsgEncoder&>( genMsg.getEncoder() ).getRsslGenericMsg() );
+	return submit( pRsslGenericMsg );
 }
 
 bool LoginItem::submit( RsslRDMLoginRequest* pRsslRequestMsg )
@@ -147,6 +147,8 @@ public :
 	bool modify( const ReqMsg& );
 	bool submit( const PostMsg& );
 	bool submit( const GenericMsg& );
+	bool submitRsslMsg( RsslPostMsg* , const EmaString* );
+	bool submitRsslMsg( RsslGenericMsg* );
 	bool close();
 
 	ItemType getType() const { return Item::LoginItemEnum; }
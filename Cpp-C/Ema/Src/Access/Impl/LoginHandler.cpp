@@ -583,7 +583,7 @@ void LoginHandler::sendLoginReject(RsslReactorChannel* reactorChannel, RsslInt32
 	submitMsgOpts.pRsslMsg = (RsslMsg*)&rsslStatusMsg;
 
 	clearRsslErrorInfo(&rsslErrorInfo);
-	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(reactorChannel), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		if (OmmLoggerClient::ErrorEnum >= _pOmmServerBaseImpl->getActiveConfig().loggerConfig.minLoggerSeverity)
 		{
@@ -737,7 +737,7 @@ void MarketItemHandler::sendRejectMessage(RsslReactorChannel* reactorChannel, Rs
 	submitMsgOpts.pRsslMsg = (RsslMsg*)&_rsslStatusMsg;
 
 	clearRsslErrorInfo(&rsslErrorInfo);
-	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorSubmitMsg(_pOmmServerBaseImpl->getRsslReactor(reactorChannel), reactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		if (OmmLoggerClient::ErrorEnum >= _pOmmServerBaseImpl->getActiveConfig().loggerConfig.minLoggerSeverity)
 		{
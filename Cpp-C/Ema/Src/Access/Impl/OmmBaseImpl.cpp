@@ -22,6 +22,7 @@
 #include "OmmNiProviderImpl.h"
 
 #include "GetTime.h"
+#include "rtr/rsslThread.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -29,6 +30,13 @@
 #include <sys/time.h>
 #endif
 
+#ifdef USING_EPOLL
+#include <unistd.h>
+#include <limits.h>
+
+#define EMA_EPOLL_MAX_EVENTS 16
+#endif
+
 #define	EMA_BIG_STR_BUFF_SIZE (1024*4)
 
 using namespace thomsonreuters::ema::access;
@@ -63,6 +71,7 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig) :
 	_pDirectoryCallbackClient(0),
 	_pDictionaryCallbackClient(0),
 	_pItemCallbackClient(0),
+	_pItemSlab( 0 ),
 	_pLoggerClient(0),
 	_pipe(),
 	_pipeWriteCount( 0 ),
@@ -74,7 +83,9 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig) :
 	_hasConsAdminClient( false ),
 	_pErrorClientHandler( 0 ),
 	_theTimeOuts(),
-	_bApiDispatchThreadStarted(false)
+	_bApiDispatchThreadStarted(false),
+	_reactorDispatching(false),
+	_lastEventTime(0)
 {
 	_adminClosure = 0;
 	clearRsslErrorInfo( &_reactorDispatchErrorInfo );
@@ -95,6 +106,7 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmConsumerClient& adminCli
 	_pDirectoryCallbackClient(0),
 	_pDictionaryCallbackClient(0),
 	_pItemCallbackClient(0),
+	_pItemSlab( 0 ),
 	_pLoggerClient(0),
 	_pipe(),
 	_pipeWriteCount(0),
@@ -106,7 +118,9 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmConsumerClient& adminCli
 	_hasProvAdminClient(false),
 	_pErrorClientHandler(0),
 	_theTimeOuts(),
-	_bApiDispatchThreadStarted(false)
+	_bApiDispatchThreadStarted(false),
+	_reactorDispatching(false),
+	_lastEventTime(0)
 {
 	_adminClosure = adminClosure;
 	
@@ -128,6 +142,7 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmProviderClient& adminCli
 	_pDirectoryCallbackClient(0),
 	_pDictionaryCallbackClient(0),
 	_pItemCallbackClient(0),
+	_pItemSlab( 0 ),
 	_pLoggerClient(0),
 	_pipe(),
 	_pipeWriteCount(0),
@@ -139,7 +154,9 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmProviderClient& adminCli
 	_hasProvAdminClient(true),
 	_pErrorClientHandler(0),
 	_theTimeOuts(),
-	_bApiDispatchThreadStarted(false)
+	_bApiDispatchThreadStarted(false),
+	_reactorDispatching(false),
+	_lastEventTime(0)
 {
 	_adminClosure = adminClosure;
 
@@ -162,6 +179,7 @@ OmmBaseImpl::OmmBaseImpl( ActiveConfig& activeConfig, OmmConsumerErrorClient& cl
 	_pDirectoryCallbackClient( 0 ),
 	_pDictionaryCallbackClient( 0 ),
 	_pItemCallbackClient( 0 ),
+	_pItemSlab( 0 ),
 	_pLoggerClient( 0 ),
 	_pipe(),
 	_pipeWriteCount( 0 ),
@@ -173,7 +191,9 @@ OmmBaseImpl::OmmBaseImpl( ActiveConfig& activeConfig, OmmConsumerErrorClient& cl
 	_hasProvAdminClient( false ),
 	_pErrorClientHandler( 0 ),
 	_theTimeOuts(),
-	_bApiDispatchThreadStarted(false)
+	_bApiDispatchThreadStarted(false),
+	_reactorDispatching(false),
+	_lastEventTime(0)
 {
 	_adminClosure = 0;
 	try
@@ -203,6 +223,7 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmConsumerClient& adminCli
 	_pDirectoryCallbackClient(0),
 	_pDictionaryCallbackClient(0),
 	_pItemCallbackClient(0),
+	_pItemSlab( 0 ),
 	_pLoggerClient(0),
 	_pipe(),
 	_pipeWriteCount(0),
@@ -214,7 +235,9 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmConsumerClient& adminCli
 	_hasProvAdminClient(false),
 	_pErrorClientHandler(0),
 	_theTimeOuts(),
-	_bApiDispatchThreadStarted(false)
+	_bApiDispatchThreadStarted(false),
+	_reactorDispatching(false),
+	_lastEventTime(0)
 {
 	_adminClosure = adminClosure;
 	try
@@ -244,6 +267,7 @@ OmmBaseImpl::OmmBaseImpl( ActiveConfig& activeConfig, OmmProviderErrorClient& cl
 	_pDirectoryCallbackClient( 0 ),
 	_pDictionaryCallbackClient( 0 ),
 	_pItemCallbackClient( 0 ),
+	_pItemSlab( 0 ),
 	_pLoggerClient( 0 ),
 	_pipe(),
 	_pipeWriteCount( 0 ),
@@ -253,7 +277,9 @@ OmmBaseImpl::OmmBaseImpl( ActiveConfig& activeConfig, OmmProviderErrorClient& cl
 	_bEventReceived( false ),
 	_pErrorClientHandler( 0 ),
 	_theTimeOuts(),
-	_bApiDispatchThreadStarted(false)
+	_bApiDispatchThreadStarted(false),
+	_reactorDispatching(false),
+	_lastEventTime(0)
 {
 	_adminClosure = 0;
 	try
@@ -283,6 +309,7 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmProviderClient& adminCli
 	_pDirectoryCallbackClient(0),
 	_pDictionaryCallbackClient(0),
 	_pItemCallbackClient(0),
+	_pItemSlab( 0 ),
 	_pLoggerClient(0),
 	_pipe(),
 	_pipeWriteCount(0),
@@ -294,7 +321,9 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmProviderClient& adminCli
 	_hasProvAdminClient(true),
 	_pErrorClientHandler(0),
 	_theTimeOuts(),
-	_bApiDispatchThreadStarted(false)
+	_bApiDispatchThreadStarted(false),
+	_reactorDispatching(false),
+	_lastEventTime(0)
 {
 	_adminClosure = adminClosure;
 	try
@@ -311,6 +340,12 @@ OmmBaseImpl::OmmBaseImpl(ActiveConfig& activeConfig, OmmProviderClient& adminCli
 
 OmmBaseImpl::~OmmBaseImpl()
 {
+	// pending timeouts may live in the slab, which is only freed once they are gone
+	TimeOut::deleteAll( *this );
+
+	if ( _pItemSlab )
+		_pItemSlab->release();
+
 	if ( _pErrorClientHandler )
 		delete _pErrorClientHandler;
 }
@@ -346,6 +381,10 @@ void OmmBaseImpl::readConfig(EmaConfigImpl* pConfigImpl)
 
 	pConfigImpl->get<Int64>(instanceNodeName + "DispatchTimeoutApiThread", _activeConfig.dispatchTimeoutApiThread);
 
+	pConfigImpl->get<Int64>(instanceNodeName + "BusyPollTimeout", _activeConfig.busyPollTimeout);
+
+	pConfigImpl->get<Int64>(instanceNodeName + "CpuApiThreadBind", _activeConfig.cpuApiThreadBind);
+
 	pConfigImpl->get<Double>(instanceNodeName + "TokenReissueRatio", _activeConfig.tokenReissueRatio);
 
 	if (pConfigImpl->get<UInt64>(instanceNodeName + "CatchUnhandledException", tmp))
@@ -1334,6 +1373,20 @@ void OmmBaseImpl::initialize( EmaConfigImpl* configImpl )
 		FD_SET( _pipe.readFD(), &_exceptFds );
 		FD_SET( _pRsslReactor->eventFd, &_readFds );
 		FD_SET( _pRsslReactor->eventFd, &_exceptFds );
+#elif defined( USING_EPOLL )
+		_epollFd = epoll_create1( EPOLL_CLOEXEC );
+		if ( _epollFd == -1 )
+		{
+			EmaString temp( "Failed to create epoll instance. errno='" );
+			temp.append( errno ).append( "'. " );
+			if ( OmmLoggerClient::ErrorEnum >= _activeConfig.loggerConfig.minLoggerSeverity )
+				_pLoggerClient->log( _activeConfig.instanceName, OmmLoggerClient::ErrorEnum, temp );
+			throwIueException( temp, OmmInvalidUsageException::InternalErrorEnum );
+			return;
+		}
+
+		addFd( _pipe.readFD() );
+		addFd( _pRsslReactor->eventFd );
 #else
 		_eventFdsCapacity = 8;
 		_eventFds = new pollfd[ _eventFdsCapacity ];
@@ -1349,11 +1402,17 @@ void OmmBaseImpl::initialize( EmaConfigImpl* configImpl )
 
 		createDirectoryCallbackClient( _pDirectoryCallbackClient, *this );
 
+		// chunks grow up to a sixteenth of the expected item count
+		if ( !_pItemSlab )
+			_pItemSlab = SlabAllocator::create( _activeConfig.itemCountHint / 16 );
+
 		_pItemCallbackClient = ItemCallbackClient::create( *this );
 		_pItemCallbackClient->initialize();
 
 		if (getImplType() == OmmCommonImpl::ConsumerEnum)
 		{
+			_submitQueue.initialize( _activeConfig.submitQueueSize );
+
 			Dictionary* dictionary = getDictionaryCallbackClient().getDefaultDictionary();
 			RsslReactorJsonConverterOptions jsonConverterOptions;
 			rsslClearReactorJsonConverterOptions(&jsonConverterOptions);
@@ -1513,7 +1572,7 @@ bool OmmBaseImpl::hasErrorClientHandler() const
 	return _pErrorClientHandler != 0 ? true : false;
 }
 
-EmaList< TimeOut* >& OmmBaseImpl::getTimeOutList()
+TimeOutQueue& OmmBaseImpl::getTimeOutList()
 {
 	return _theTimeOuts;
 }
@@ -1528,6 +1587,29 @@ void OmmBaseImpl::installTimeOut()
 	pipeWrite();
 }
 
+#ifdef USING_EPOLL
+// With the eventfd based pipe, wakeups are coalesced without taking _pipeLock:
+// _pipeWriteCount is a flag set by the first writer since the dispatch thread last woke up,
+// and only that writer signals the eventfd. The dispatch thread drains the eventfd before
+// clearing the flag, then dispatches, so work queued by a writer that saw the flag set is not missed.
+bool OmmBaseImpl::isPipeWritten()
+{
+	return ( __sync_fetch_and_or( &_pipeWriteCount, 0 ) > 0 ? true : false );
+}
+
+void OmmBaseImpl::pipeWrite()
+{
+	if ( __sync_fetch_and_or( &_pipeWriteCount, 1 ) == 0 )
+		_pipe.write( "0", 1 );
+}
+
+void OmmBaseImpl::pipeRead()
+{
+	char temp[10];
+	_pipe.read( temp, 1 );
+	__sync_fetch_and_and( &_pipeWriteCount, 0 );
+}
+#else
 bool OmmBaseImpl::isPipeWritten()
 {
 	MutexLocker lock( _pipeLock );
@@ -1553,6 +1635,7 @@ void OmmBaseImpl::pipeRead()
 		_pipe.read( temp, 1 );
 	}
 }
+#endif
 
 void OmmBaseImpl::cleanUp()
 {
@@ -1597,6 +1680,10 @@ void OmmBaseImpl::uninitialize( bool caughtExcep, bool calledFromInit )
 
 	if ( _pRsslReactor )
 	{
+		// messages still queued by user threads are submitted before the login stream closes
+		if ( _submitQueue.isEnabled() )
+			drainSubmitQueue();
+
 		if ( _pLoginCallbackClient && !caughtExcep )
 			rsslReactorDispatchLoop( 10000, _pLoginCallbackClient->sendLoginClose(), _bEventReceived );
 
@@ -1651,6 +1738,8 @@ void OmmBaseImpl::uninitialize( bool caughtExcep, bool calledFromInit )
 #endif
 	_pipe.close();
 
+	_submitQueue.clear();
+
 	OmmLoggerClient::destroy( _pLoggerClient );
 
 	_state = NotInitializedEnum;
@@ -1659,6 +1748,15 @@ void OmmBaseImpl::uninitialize( bool caughtExcep, bool calledFromInit )
 
 #ifdef USING_POLL
 	delete[] _eventFds;
+	_eventFds = 0;
+#endif
+
+#ifdef USING_EPOLL
+	if ( _epollFd != -1 )
+	{
+		::close( _epollFd );
+		_epollFd = -1;
+	}
 #endif
 }
 
@@ -1726,27 +1824,37 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 			return bMsgDispRcvd ? 0 : -1;
 		}
 
+		// After an event, spin on non-blocking waits for busyPollTimeout before going back to blocking ones
+		Int64 waitTimeOut = timeOut;
+		bool busyPolling = false;
+
+		if ( _activeConfig.busyPollTimeout > 0 && timeOut != 0 && startTime - _lastEventTime < _activeConfig.busyPollTimeout )
+		{
+			waitTimeOut = 0;
+			busyPolling = true;
+		}
+
 #if defined( USING_SELECT )
 
 		fd_set useReadFds = _readFds;
 		fd_set useExceptFds = _exceptFds;
 
 		struct timeval selectTime;
-		if ( timeOut > 0 )
+		if ( waitTimeOut > 0 )
 		{
-			selectTime.tv_sec = static_cast<long>( timeOut / 1000000 );
-			selectTime.tv_usec = timeOut % 1000000;
+			selectTime.tv_sec = static_cast<long>( waitTimeOut / 1000000 );
+			selectTime.tv_usec = waitTimeOut % 1000000;
 
 			selectRetCode = select( FD_SETSIZE, &useReadFds, NULL, &useExceptFds, &selectTime );
 		}
-		else if (timeOut == 0)
+		else if (waitTimeOut == 0)
 		{
 			selectTime.tv_sec = 0;
 			selectTime.tv_usec = 0;
 
 			selectRetCode = select(FD_SETSIZE, &useReadFds, NULL, &useExceptFds, &selectTime);
 		}
-		else if ( timeOut < 0 )
+		else if ( waitTimeOut < 0 )
 			selectRetCode = select( FD_SETSIZE, &useReadFds, NULL, &useExceptFds, NULL );
 
 		if ( selectRetCode > 0 && FD_ISSET( _pipe.readFD(), &useReadFds ) )
@@ -1755,24 +1863,59 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 			--selectRetCode;
 		}
 
+#elif defined( USING_EPOLL )
+
+		epoll_event events[EMA_EPOLL_MAX_EVENTS];
+
+		if ( waitTimeOut < 0 )
+			selectRetCode = epoll_wait( _epollFd, events, EMA_EPOLL_MAX_EVENTS, -1 );
+		else if ( waitTimeOut % 1000 == 0 )
+			selectRetCode = epoll_wait( _epollFd, events, EMA_EPOLL_MAX_EVENTS, waitTimeOut / 1000 > INT_MAX ? INT_MAX : static_cast<int>( waitTimeOut / 1000 ) );
+		else
+		{
+			// epoll_wait() only has millisecond resolution; wait on the epoll fd with ppoll() and then collect the events
+			struct timespec ppollTime;
+			pollfd epollEventFd;
+
+			ppollTime.tv_sec = waitTimeOut / static_cast<long long>( 1e6 );
+			ppollTime.tv_nsec = waitTimeOut % static_cast<long long>( 1e6 ) * static_cast<long long>( 1e3 );
+			epollEventFd.fd = _epollFd;
+			epollEventFd.events = POLLIN;
+
+			selectRetCode = ppoll( &epollEventFd, 1, &ppollTime, 0 );
+			if ( selectRetCode > 0 )
+				selectRetCode = epoll_wait( _epollFd, events, EMA_EPOLL_MAX_EVENTS, 0 );
+		}
+
+		if ( selectRetCode > 0 )
+		{
+			for ( Int64 i = 0; i < selectRetCode; ++i )
+				if ( events[i].data.fd == _pipe.readFD() )
+				{
+					pipeRead();
+					--selectRetCode;
+					break;
+				}
+		}
+
 #elif defined( USING_PPOLL )
 
 		struct timespec ppollTime;
 
-		if ( timeOut > 0 )
+		if ( waitTimeOut > 0 )
 		{
-			ppollTime.tv_sec = timeOut / static_cast<long long>( 1e6 );
-			ppollTime.tv_nsec = timeOut % static_cast<long long>( 1e6 ) * static_cast<long long>( 1e3 );
+			ppollTime.tv_sec = waitTimeOut / static_cast<long long>( 1e6 );
+			ppollTime.tv_nsec = waitTimeOut % static_cast<long long>( 1e6 ) * static_cast<long long>( 1e3 );
 			selectRetCode = ppoll( _eventFds, _eventFdsCount, &ppollTime, 0 );
 		}
-		else if (timeOut == 0)
+		else if (waitTimeOut == 0)
 		{
 			ppollTime.tv_sec = 0;
 			ppollTime.tv_nsec = 0;
 
 			selectRetCode = ppoll(_eventFds, _eventFdsCount, &ppollTime, 0);
 		}
-		else if ( timeOut < 0 )
+		else if ( waitTimeOut < 0 )
 			selectRetCode = ppoll( _eventFds, _eventFdsCount, 0, 0 );
 
 		if ( selectRetCode > 0 )
@@ -1797,13 +1940,23 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 #error "No Implementation for Operating System That Does Not Implement ppoll"
 #endif
 
+		if ( selectRetCode > 0 )
+			_lastEventTime = GetTime::getMicros();
+		else if ( busyPolling && selectRetCode == 0 )
+			selectRetCode = 1; // rsslReactorDispatch() reads the channels without blocking
+
+		if ( _submitQueue.isEnabled() )
+			drainSubmitQueue();
+
 		if ( selectRetCode > 0 )
 		{
 			loopCount = 0;
 			do
 			{
 				_userLock.lock();
+				setReactorDispatchThread( true );
 				reactorRetCode = _pRsslReactor ? rsslReactorDispatch( _pRsslReactor, &dispatchOpts, &_reactorDispatchErrorInfo ) : RSSL_RET_SUCCESS;
+				setReactorDispatchThread( false );
 				_userLock.unlock();
 				++loopCount;
 			}
@@ -2008,6 +2161,11 @@ ItemCallbackClient& OmmBaseImpl::getItemCallbackClient()
 	return *_pItemCallbackClient;
 }
 
+SlabAllocator* OmmBaseImpl::getItemSlab()
+{
+	return _pItemSlab;
+}
+
 DictionaryCallbackClient& OmmBaseImpl::getDictionaryCallbackClient()
 {
 	return *_pDictionaryCallbackClient;
@@ -2037,6 +2195,9 @@ void OmmBaseImpl::reissue( const ReqMsg& reqMsg, UInt64 handle )
 {
 	_userLock.lock();
 
+	// submits queued before this call must reach the item first
+	if ( _submitQueue.isEnabled() ) drainSubmitQueue();
+
 	if ( _pItemCallbackClient ) _pItemCallbackClient->reissue( reqMsg, handle );
 
 	_userLock.unlock();
@@ -2046,6 +2207,9 @@ void OmmBaseImpl::unregister( UInt64 handle )
 {
 	_userLock.lock();
 
+	// submits queued before this call must reach the item first
+	if ( _submitQueue.isEnabled() ) drainSubmitQueue();
+
 	if ( _pItemCallbackClient ) _pItemCallbackClient->unregister( handle );
 
 	_userLock.unlock();
@@ -2053,8 +2217,18 @@ void OmmBaseImpl::unregister( UInt64 handle )
 
 void OmmBaseImpl::submit( const GenericMsg& genericMsg, UInt64 handle )
 {
+	// callbacks run on the thread dispatching the reactor, which already holds the user lock
+	if ( _submitQueue.isEnabled() && !isReactorDispatchThread() )
+	{
+		queueSubmit( ItemCallbackClient::getRsslMsg( genericMsg ), SubmitQueueEntry::GenericMsgEnum, handle, 0 );
+		return;
+	}
+
 	_userLock.lock();
 
+	// submits queued before this call must reach the item first
+	if ( _submitQueue.isEnabled() ) drainSubmitQueue();
+
 	if ( _pItemCallbackClient ) _pItemCallbackClient->submit( genericMsg, handle );
 
 	_userLock.unlock();
@@ -2062,13 +2236,124 @@ void OmmBaseImpl::submit( const GenericMsg& genericMsg, UInt64 handle )
 
 void OmmBaseImpl::submit( const PostMsg& postMsg, UInt64 handle )
 {
+	// callbacks run on the thread dispatching the reactor, which already holds the user lock
+	if ( _submitQueue.isEnabled() && !isReactorDispatchThread() )
+	{
+		const EmaString* pServiceName;
+		RsslMsg* pRsslMsg = ItemCallbackClient::getRsslMsg( postMsg, pServiceName );
+		queueSubmit( pRsslMsg, SubmitQueueEntry::PostMsgEnum, handle, pServiceName );
+		return;
+	}
+
 	_userLock.lock();
 
+	// submits queued before this call must reach the item first
+	if ( _submitQueue.isEnabled() ) drainSubmitQueue();
+
 	if ( _pItemCallbackClient ) _pItemCallbackClient->submit( postMsg, handle );
 
 	_userLock.unlock();
 }
 
+void OmmBaseImpl::setReactorDispatchThread( bool dispatching )
+{
+#ifdef WIN32
+	_reactorDispatchThread = GetCurrentThreadId();
+#else
+	_reactorDispatchThread = pthread_self();
+#endif
+	_reactorDispatching = dispatching;
+}
+
+bool OmmBaseImpl::isReactorDispatchThread() const
+{
+	// only the dispatching thread sets these, so a thread always sees its own values
+#ifdef WIN32
+	return _reactorDispatching && _reactorDispatchThread == GetCurrentThreadId();
+#else
+	return _reactorDispatching && pthread_equal( _reactorDispatchThread, pthread_self() );
+#endif
+}
+
+void OmmBaseImpl::queueSubmit( RsslMsg* pRsslMsg, SubmitQueueEntry::MsgType msgType, UInt64 handle, const EmaString* pServiceName )
+{
+	SubmitQueueEntry* pEntry = _submitQueue.getEntry();
+	if ( !pEntry )
+	{
+		// the pool is fixed at SubmitQueueSize entries; let the caller retry once the queue drains
+		EmaString temp( "Failed to queue " );
+		temp.append( msgType == SubmitQueueEntry::PostMsgEnum ? "PostMsg" : "GenericMsg" )
+			.append( " for submit. Reason: submit queue is full." );
+		handleIue( temp, OmmInvalidUsageException::NoBuffersEnum );
+		return;
+	}
+
+	RsslRet ret = pEntry->encode( pRsslMsg, msgType, handle, pServiceName );
+	if ( ret != RSSL_RET_SUCCESS )
+	{
+		_submitQueue.returnEntry( pEntry );
+
+		EmaString temp( "Failed to queue " );
+		temp.append( msgType == SubmitQueueEntry::PostMsgEnum ? "PostMsg" : "GenericMsg" )
+			.append( " for submit. Reason: " ).append( rsslRetCodeToString( ret ) ).append( "." );
+		handleIue( temp, ret );
+		return;
+	}
+
+	_submitQueue.push( pEntry );
+
+	pipeWrite();
+}
+
+void OmmBaseImpl::drainSubmitQueue()
+{
+	SubmitQueueEntry* pEntry;
+
+	// entries are popped under the user lock so that only one thread at a time consumes the queue;
+	// the lock is held for the whole drain, which also covers the log calls below
+	_userLock.lock();
+
+	while ( ( pEntry = _submitQueue.pop() ) != 0 )
+	{
+		RsslMsg rsslMsg;
+
+		try
+		{
+			if ( pEntry->decode( &rsslMsg ) != RSSL_RET_SUCCESS )
+			{
+				if ( _pLoggerClient && OmmLoggerClient::ErrorEnum >= _activeConfig.loggerConfig.minLoggerSeverity )
+				{
+					EmaString temp( "Failed to decode queued message for submit on handle " );
+					temp.append( pEntry->getHandle() ).append( "; message dropped." );
+					_pLoggerClient->log( _activeConfig.instanceName, OmmLoggerClient::ErrorEnum, temp );
+				}
+			}
+			else if ( _pItemCallbackClient )
+			{
+				if ( pEntry->getMsgType() == SubmitQueueEntry::PostMsgEnum )
+					_pItemCallbackClient->submit( &rsslMsg.postMsg, pEntry->hasServiceName() ? &pEntry->getServiceName() : 0, pEntry->getHandle() );
+				else
+					_pItemCallbackClient->submit( &rsslMsg.genericMsg, pEntry->getHandle() );
+			}
+		}
+		catch ( const OmmException& ommException )
+		{
+			// handleIhe() and handleIue() go to the error client when one is set, as on the direct path;
+			// otherwise they throw, and the submitting thread has already returned, so log the failure here
+			if ( _pLoggerClient && OmmLoggerClient::ErrorEnum >= _activeConfig.loggerConfig.minLoggerSeverity )
+			{
+				EmaString temp( "Failed to submit queued message. Reason: " );
+				temp.append( ommException.getText() );
+				_pLoggerClient->log( _activeConfig.instanceName, OmmLoggerClient::ErrorEnum, temp );
+			}
+		}
+
+		_submitQueue.returnEntry( pEntry );
+	}
+
+	_userLock.unlock();
+}
+
 ActiveConfig& OmmBaseImpl::getActiveConfig()
 {
 	return _activeConfig;
@@ -2086,6 +2371,19 @@ Mutex& OmmBaseImpl::getUserMutex()
 
 void OmmBaseImpl::run()
 {
+	if ( _activeConfig.cpuApiThreadBind >= 0 && RSSL_THREAD_BIND_CURRENT( static_cast<int>( _activeConfig.cpuApiThreadBind ) ) < 0 )
+	{
+		if ( OmmLoggerClient::WarningEnum >= _activeConfig.loggerConfig.minLoggerSeverity )
+		{
+			EmaString temp( "Failed to bind the API dispatch thread to CPU " );
+			temp.append( _activeConfig.cpuApiThreadBind ).append( "; it will run unbound." );
+
+			_userLock.lock();
+			if ( _pLoggerClient ) _pLoggerClient->log( _activeConfig.instanceName, OmmLoggerClient::WarningEnum, temp );
+			_userLock.unlock();
+		}
+	}
+
 	_dispatchLock.lock();
 	_bApiDispatchThreadStarted = true;
 
@@ -14,6 +14,9 @@
 #else
 #define USING_POLL
 #define USING_PPOLL
+#if defined( __linux__ )
+#define USING_EPOLL
+#endif
 #endif
 
 #include "rtr/rsslReactor.h"
@@ -25,6 +28,7 @@
 #include "OmmConsumerClient.h"
 #include "OmmProviderClient.h"
 #include "Pipe.h"
+#include "SubmitQueue.h"
 #include "TimeOut.h"
 #include "ActiveConfig.h"
 #include "ErrorClientHandler.h"
@@ -109,6 +113,9 @@ public :
 
 	ItemCallbackClient& getItemCallbackClient();
 
+	// Allocator for items and the objects they own; 0 before initialization.
+	SlabAllocator* getItemSlab();
+
 	DictionaryCallbackClient& getDictionaryCallbackClient();
 
 	DirectoryCallbackClient& getDirectoryCallbackClient();
@@ -127,7 +134,7 @@ public :
 
 	bool hasErrorClientHandler() const;
 
-	EmaList< TimeOut* >& getTimeOutList();
+	TimeOutQueue& getTimeOutList();
 
 	Mutex& getTimeOutMutex();
 
@@ -210,6 +217,18 @@ protected:
 
 	bool isPipeWritten();
 
+	// encodes the message on the calling thread and queues it for the dispatch thread
+	void queueSubmit( RsslMsg*, SubmitQueueEntry::MsgType, UInt64 handle, const EmaString* pServiceName );
+
+	// submits messages queued by user threads; called on the dispatch thread
+	void drainSubmitQueue();
+
+	// records whether the calling thread is inside rsslReactorDispatch(); called with the user lock held
+	void setReactorDispatchThread( bool dispatching );
+
+	// true when called from a callback of rsslReactorDispatch(); submits from there skip the queue
+	bool isReactorDispatchThread() const;
+
 	// return values:
 	// -2 -> error
 	// -1 -> timeout expired ( nothing dispatched )
@@ -241,12 +260,14 @@ protected:
 	DirectoryCallbackClient*	_pDirectoryCallbackClient;
 	DictionaryCallbackClient*	_pDictionaryCallbackClient;
 	ItemCallbackClient*			_pItemCallbackClient;
+	SlabAllocator*				_pItemSlab;
 	OmmConsumerClient&			_consAdminClient;
 	OmmProviderClient&			_provAdminClient;
 	void*						_adminClosure;
 	OmmLoggerClient*			_pLoggerClient;
 	Pipe						_pipe;
 	UInt32						_pipeWriteCount;
+	SubmitQueue					_submitQueue;
 	bool						_atExit;
 	bool						_eventTimedOut;
 	bool						_bMsgDispatched;
@@ -254,8 +275,15 @@ protected:
 	bool						_hasConsAdminClient;
 	bool						_hasProvAdminClient;
 	ErrorClientHandler*			_pErrorClientHandler;
-	EmaList< TimeOut* >			_theTimeOuts;
+	TimeOutQueue			_theTimeOuts;
 	bool						_bApiDispatchThreadStarted;
+#ifdef WIN32
+	volatile DWORD				_reactorDispatchThread;
+#else
+	volatile pthread_t			_reactorDispatchThread;
+#endif
+	volatile bool				_reactorDispatching;
+	Int64						_lastEventTime;	// microseconds; start of the busy poll window
 
 private:
 
@@ -25,12 +25,19 @@
 #else
 #define USING_POLL
 #define USING_PPOLL
+#if defined( __linux__ )
+#define USING_EPOLL
+#endif
 #endif
 
 #ifdef USING_PPOLL
 #include <poll.h>
 #endif
 
+#ifdef USING_EPOLL
+#include <sys/epoll.h>
+#endif
+
 namespace thomsonreuters {
 
 namespace ema {
@@ -79,7 +86,10 @@ public:
 
 		virtual bool isAtExit() = 0;
 
+		OmmCommonImpl();
+
 #ifdef USING_POLL
+  // when _epollFd is set, these add/remove the fd in the epoll set instead of _eventFds
   void removeFd( int );
   int addFd( int, short events = POLLIN );
 #endif
@@ -91,6 +101,9 @@ protected:
   nfds_t			_eventFdsCapacity;
   int				_pipeReadEventFdsIdx;
 #endif
+#ifdef USING_EPOLL
+  int				_epollFd;
+#endif
 
 };
 
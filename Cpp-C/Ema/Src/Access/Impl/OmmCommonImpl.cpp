@@ -8,11 +8,43 @@
 
 #include "OmmBaseImplMap.h"
 
+#ifdef USING_EPOLL
+#include <errno.h>
+#endif
+
 using namespace thomsonreuters::ema::access;
 
+OmmCommonImpl::OmmCommonImpl()
+#ifdef USING_POLL
+	: _eventFds( 0 ),
+	_eventFdsCount( 0 ),
+	_eventFdsCapacity( 0 ),
+	_pipeReadEventFdsIdx( -1 )
+#ifdef USING_EPOLL
+	, _epollFd( -1 )
+#endif
+#endif
+{
+}
+
 #ifdef USING_POLL
 int OmmCommonImpl::addFd( int fd, short events )
 {
+#ifdef USING_EPOLL
+	if ( _epollFd != -1 )
+	{
+		epoll_event event;
+		event.events = ( events & POLLIN ) ? EPOLLIN : 0;	// EPOLLERR and EPOLLHUP are always reported
+		event.data.u64 = 0;
+		event.data.fd = fd;
+
+		if ( epoll_ctl( _epollFd, EPOLL_CTL_ADD, fd, &event ) == 0 )
+			return 0;
+
+		return ( errno == EEXIST ) ? epoll_ctl( _epollFd, EPOLL_CTL_MOD, fd, &event ) : -1;
+	}
+#endif
+
 	if ( _eventFdsCount == _eventFdsCapacity )
 	{
 		_eventFdsCapacity *= 2;
@@ -29,6 +61,15 @@ int OmmCommonImpl::addFd( int fd, short events )
 
 void OmmCommonImpl::removeFd( int fd )
 {
+#ifdef USING_EPOLL
+  if ( _epollFd != -1 )
+  {
+	epoll_event event;	// ignored, but must not be NULL on kernels before 2.6.9
+	epoll_ctl( _epollFd, EPOLL_CTL_DEL, fd, &event );
+	return;
+  }
+#endif
+
   _pipeReadEventFdsIdx = -1;
 
   int i;
@@ -130,6 +130,9 @@ void OmmConsumerImpl::readCustomConfig( EmaConfigImpl* pConfigImpl )
 	if ( pConfigImpl->get<UInt64>( instanceNodeName + "MaxOutstandingPosts", tmp ) )
 		_activeConfig.maxOutstandingPosts = static_cast<UInt32>( tmp > maxUInt32 ? maxUInt32 : tmp );
 
+	if ( pConfigImpl->get<UInt64>( instanceNodeName + "SubmitQueueSize", tmp ) )
+		_activeConfig.submitQueueSize = static_cast<UInt32>( tmp > maxUInt32 ? maxUInt32 : tmp );
+
 	_activeConfig.pRsslDirectoryRequestMsg = pConfigImpl->getDirectoryReq();
 
 	_activeConfig.pRsslEnumDefRequestMsg = pConfigImpl->getEnumDefDictionaryReq();
@@ -215,6 +215,11 @@ void OmmIProviderImpl::readCustomConfig(EmaConfigServerImpl* pConfigImpl)
 	if (pConfigImpl->get<UInt64>(instanceNodeName + "EnumTypeFragmentSize", tmp))
 		_ommIProviderActiveConfig.maxEnumTypeFragmentSize = tmp > 0xFFFFFFFF ? 0xFFFFFFFF : (UInt32)tmp;
 
+	if (pConfigImpl->get<UInt64>(instanceNodeName + "ReactorShardCount", tmp))
+		_ommIProviderActiveConfig.setReactorShardCount(tmp);
+
+	pConfigImpl->get<EmaString>(instanceNodeName + "ReactorShardCpuList", _ommIProviderActiveConfig.reactorShardCpuList);
+
 	if (ProgrammaticConfigure* ppc = pConfigImpl->getProgrammaticConfigure())
 	{
 		ppc->retrieveCustomConfig(_ommIProviderActiveConfig.configuredName, _ommIProviderActiveConfig);
@@ -302,7 +307,7 @@ void OmmIProviderImpl::submit(const GenericMsg& genericMsg, UInt64 handle)
 	RsslErrorInfo rsslErrorInfo;
 	clearRsslErrorInfo(&rsslErrorInfo);
 	Int32 retCode;
-	if ( (retCode = rsslReactorSubmitMsg(_pRsslReactor, itemInfo->getClientSession()->getChannel(), &submitMsgOpts, &rsslErrorInfo)) != RSSL_RET_SUCCESS )
+	if ( (retCode = rsslReactorSubmitMsg(getRsslReactor(itemInfo->getClientSession()->getChannel()), itemInfo->getClientSession()->getChannel(), &submitMsgOpts, &rsslErrorInfo)) != RSSL_RET_SUCCESS )
 	{
 		_userLock.unlock();
 		EmaString temp("Internal error: rsslReactorSubmitMsg() failed in OmmIProviderImpl::submit( const GenericMsg& ).");
@@ -553,7 +558,7 @@ void OmmIProviderImpl::submit(const RefreshMsg& refreshMsg, UInt64 handle)
 
 	RsslErrorInfo rsslErrorInfo;
 	clearRsslErrorInfo(&rsslErrorInfo);
-	if (rsslReactorSubmitMsg(_pRsslReactor, pReactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorSubmitMsg(getRsslReactor(pReactorChannel), pReactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		_userLock.unlock();
 		EmaString temp("Internal error: rsslReactorSubmitMsg() failed in OmmIProviderImpl::submit( const RefreshMsg& ).");
@@ -736,7 +741,7 @@ void OmmIProviderImpl::submit(const UpdateMsg& updateMsg, UInt64 handle)
 
 	RsslErrorInfo rsslErrorInfo;
 	clearRsslErrorInfo(&rsslErrorInfo);
-	if (rsslReactorSubmitMsg(_pRsslReactor, itemInfo->getClientSession()->getChannel(), &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorSubmitMsg(getRsslReactor(itemInfo->getClientSession()->getChannel()), itemInfo->getClientSession()->getChannel(), &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		_userLock.unlock();
 		EmaString temp("Internal error: rsslReactorSubmitMsg() failed in OmmIProviderImpl::submit( const UpdateMsg& ).");
@@ -951,7 +956,7 @@ void OmmIProviderImpl::submit(const StatusMsg& stausMsg, UInt64 handle)
 
 	RsslErrorInfo rsslErrorInfo;
 	clearRsslErrorInfo(&rsslErrorInfo);
-	if (rsslReactorSubmitMsg(_pRsslReactor, pReactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorSubmitMsg(getRsslReactor(pReactorChannel), pReactorChannel, &submitMsgOpts, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		_userLock.unlock();
 		EmaString temp("Internal error: rsslReactorSubmitMsg() failed in OmmIProviderImpl::submit( const StatusMsg& ).");
@@ -1016,7 +1021,7 @@ bool OmmIProviderImpl::submit(RsslReactorSubmitMsgOptions submitMsgOptions, cons
 					rsslRDMMsg.rdmMsgBase.streamId = itemInfo->getStreamId();
 					submitMsgOptions.pRDMMsg = &rsslRDMMsg;
 
-					if (rsslReactorSubmitMsg(_pRsslReactor, itemInfo->getClientSession()->getChannel(), &submitMsgOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+					if (rsslReactorSubmitMsg(getRsslReactor(itemInfo->getClientSession()->getChannel()), itemInfo->getClientSession()->getChannel(), &submitMsgOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 					{
 						return false;
 					}
@@ -1063,7 +1068,7 @@ bool OmmIProviderImpl::submit(RsslReactorSubmitMsgOptions submitMsgOptions, cons
 					rsslRDMMsg.rdmMsgBase.streamId = itemInfo->getStreamId();
 					submitMsgOptions.pRDMMsg = &rsslRDMMsg;
 
-					if (rsslReactorSubmitMsg(_pRsslReactor, itemInfo->getClientSession()->getChannel(), &submitMsgOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+					if (rsslReactorSubmitMsg(getRsslReactor(itemInfo->getClientSession()->getChannel()), itemInfo->getClientSession()->getChannel(), &submitMsgOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 					{
 						return false;
 					}
@@ -1096,7 +1101,7 @@ bool OmmIProviderImpl::submit(RsslReactorSubmitMsgOptions submitMsgOptions, cons
 
 			submitMsgOptions.pRsslMsg->msgBase.streamId = itemInfo->getStreamId();
 
-			if (rsslReactorSubmitMsg(_pRsslReactor, itemInfo->getClientSession()->getChannel(), &submitMsgOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+			if (rsslReactorSubmitMsg(getRsslReactor(itemInfo->getClientSession()->getChannel()), itemInfo->getClientSession()->getChannel(), &submitMsgOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 			{
 				return false;
 			}
@@ -1295,7 +1300,7 @@ void OmmIProviderImpl::submit(const AckMsg& ackMsg, UInt64 handle)
 	RsslErrorInfo rsslErrorInfo;
 	clearRsslErrorInfo(&rsslErrorInfo);
 	Int32 retCode;
-	if ((retCode = rsslReactorSubmitMsg(_pRsslReactor, itemInfo->getClientSession()->getChannel(), &submitMsgOpts, &rsslErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((retCode = rsslReactorSubmitMsg(getRsslReactor(itemInfo->getClientSession()->getChannel()), itemInfo->getClientSession()->getChannel(), &submitMsgOpts, &rsslErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		_userLock.unlock();
 		EmaString temp("Internal error: rsslReactorSubmitMsg() failed in OmmIProviderImpl::submit( const AckMsg& ).");
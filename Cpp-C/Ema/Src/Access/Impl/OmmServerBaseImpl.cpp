@@ -32,6 +32,8 @@
 
 #include "GetTime.h"
 
+#include <stdlib.h>
+
 #ifdef WIN32
 #include <windows.h>
 #else
@@ -51,12 +53,15 @@ OmmServerBaseImpl::OmmServerBaseImpl(ActiveServerConfig& activeServerConfig, Omm
 	_reactorDispatchErrorInfo(),
 	_state( NotInitializedEnum ),
 	_pRsslReactor(0),
+	_reactorShards(),
+	_reactorShardSessionCounts(),
 	_pServerChannelHandler(0),
 	_pLoginHandler(0),
 	_pDirectoryHandler(0),
 	_pDictionaryHandler(0),
 	_pMarketItemHandler(0),
 	_pItemCallbackClient(0),
+	_pItemSlab( 0 ),
 	_pLoggerClient(0),
 	_pipe(),
 	_pipeWriteCount(0),
@@ -82,12 +87,15 @@ OmmServerBaseImpl::OmmServerBaseImpl(ActiveServerConfig& activeServerConfig, Omm
 	_reactorDispatchErrorInfo(),
 	_state(NotInitializedEnum),
 	_pRsslReactor(0),
+	_reactorShards(),
+	_reactorShardSessionCounts(),
 	_pServerChannelHandler(0),
 	_pLoginHandler(0),
 	_pDirectoryHandler(0),
 	_pDictionaryHandler(0),
 	_pMarketItemHandler(0),
 	_pItemCallbackClient(0),
+	_pItemSlab( 0 ),
 	_pLoggerClient(0),
 	_pipe(),
 	_pipeWriteCount(0),
@@ -115,6 +123,12 @@ OmmServerBaseImpl::OmmServerBaseImpl(ActiveServerConfig& activeServerConfig, Omm
 
 OmmServerBaseImpl::~OmmServerBaseImpl()
 {
+	// pending timeouts may live in the slab, which is only freed once they are gone
+	TimeOut::deleteAll( *this );
+
+	if ( _pItemSlab )
+		_pItemSlab->release();
+
 	if (_pErrorClientHandler)
 		delete _pErrorClientHandler;
 }
@@ -709,26 +723,54 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 		RsslErrorInfo rsslErrorInfo;
 		clearRsslErrorInfo(&rsslErrorInfo);
 
-		rsslClearCreateReactorOptions(&reactorOpts);
-
-		reactorOpts.userSpecPtr = (void*)this;
+		// Client channels are spread over reactorShardCount reactors; each has its own worker thread,
+		// optionally bound to the next CPU core from reactorShardCpuList.
+		const char* pCpuList = _activeServerConfig.reactorShardCpuList.c_str();
 
-		_pRsslReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo);
-		if (!_pRsslReactor)
+		for (UInt32 shard = 0; shard < _activeServerConfig.reactorShardCount; ++shard)
 		{
-			EmaString temp("Failed to initialize OmmServerBaseImpl (rsslCreateReactor).");
-			temp.append("' Error Id='").append(rsslErrorInfo.rsslError.rsslErrorId)
-				.append("' Internal sysError='").append(rsslErrorInfo.rsslError.sysError)
-				.append("' Error Location='").append(rsslErrorInfo.errorLocation)
-				.append("' Error Text='").append(rsslErrorInfo.rsslError.text).append("'. ");
-			if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
-				_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
-			throwIueException( temp, OmmInvalidUsageException::InternalErrorEnum );
-			return;
+			rsslClearCreateReactorOptions(&reactorOpts);
+
+			reactorOpts.userSpecPtr = (void*)this;
+
+			if (*pCpuList)
+			{
+				char* pEnd;
+				long cpuId = strtol(pCpuList, &pEnd, 10);
+				if (pEnd != pCpuList)
+					reactorOpts.workerCpuId = (RsslInt32)cpuId;
+
+				pCpuList = pEnd;
+				while (*pCpuList == ',' || *pCpuList == ' ')
+					++pCpuList;
+			}
+
+			RsslReactor* pRsslReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo);
+			if (!pRsslReactor)
+			{
+				EmaString temp("Failed to initialize OmmServerBaseImpl (rsslCreateReactor).");
+				temp.append("' Error Id='").append(rsslErrorInfo.rsslError.rsslErrorId)
+					.append("' Internal sysError='").append(rsslErrorInfo.rsslError.sysError)
+					.append("' Error Location='").append(rsslErrorInfo.errorLocation)
+					.append("' Error Text='").append(rsslErrorInfo.rsslError.text).append("'. ");
+				if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+					_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
+				throwIueException( temp, OmmInvalidUsageException::InternalErrorEnum );
+				return;
+			}
+
+			_reactorShards.push_back(pRsslReactor);
+			_reactorShardSessionCounts.push_back(0);
+
+			if (!_pRsslReactor)
+				_pRsslReactor = pRsslReactor;
 		}
-		else if (OmmLoggerClient::VerboseEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+
+		if (OmmLoggerClient::VerboseEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
 		{
 			EmaString temp("Successfully created Reactor.");
+			if (_reactorShards.size() > 1)
+				temp.append(" Reactor shards: ").append(_reactorShards.size()).append(".");
 			_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::VerboseEnum, temp);
 		}
 
@@ -740,14 +782,19 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 
 		FD_SET(_pipe.readFD(), &_readFds);
 		FD_SET(_pipe.readFD(), &_exceptFds);
-		FD_SET(_pRsslReactor->eventFd, &_readFds);
-		FD_SET(_pRsslReactor->eventFd, &_exceptFds);
+		for (UInt32 shard = 0; shard < _reactorShards.size(); ++shard)
+		{
+			FD_SET(_reactorShards[shard]->eventFd, &_readFds);
+			FD_SET(_reactorShards[shard]->eventFd, &_exceptFds);
+		}
 #else
 		_eventFdsCapacity = 8;
 		_eventFds = new pollfd[_eventFdsCapacity];
 		_eventFdsCount = 0;
 		_pipeReadEventFdsIdx = addFd(_pipe.readFD());
 		_serverReadEventFdsIdx = addFd(_pRsslReactor->eventFd);
+		for (UInt32 shard = 1; shard < _reactorShards.size(); ++shard)
+			addFd(_reactorShards[shard]->eventFd);
 #endif
 		_pServerChannelHandler = ServerChannelHandler::create(this);
 		_pServerChannelHandler->initialize();
@@ -764,6 +811,10 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 		_pMarketItemHandler = MarketItemHandler::create(this);
 		_pMarketItemHandler->initialize();
 
+		// chunks grow up to a sixteenth of the expected item count
+		if ( !_pItemSlab )
+			_pItemSlab = SlabAllocator::create( _activeServerConfig.itemCountHint / 16 );
+
 		_pItemCallbackClient = ItemCallbackClient::create( *this );
 		_pItemCallbackClient->initialize();
 
@@ -797,17 +848,20 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 		jsonConverterOptions.closeChannelFromFailure = (RsslBool)_activeServerConfig.closeChannelFromFailure;
 		jsonConverterOptions.outputBufferSize = _activeServerConfig.outputBufferSize;
 
-		if (rsslReactorInitJsonConverter(_pRsslReactor, &jsonConverterOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+		for (UInt32 shard = 0; shard < _reactorShards.size(); ++shard)
 		{
-			EmaString temp("Failed to initialize OmmServerBaseImpl (RWF/JSON Converter).");
-			temp.append("' Error Id='").append(rsslErrorInfo.rsslError.rsslErrorId)
-				.append("' Internal sysError='").append(rsslErrorInfo.rsslError.sysError)
-				.append("' Error Location='").append(rsslErrorInfo.errorLocation)
-				.append("' Error Text='").append(rsslErrorInfo.rsslError.text).append("'. ");
-			if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
-				_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
-			throwIueException(temp, OmmInvalidUsageException::InternalErrorEnum);
-			return;
+			if (rsslReactorInitJsonConverter(_reactorShards[shard], &jsonConverterOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+			{
+				EmaString temp("Failed to initialize OmmServerBaseImpl (RWF/JSON Converter).");
+				temp.append("' Error Id='").append(rsslErrorInfo.rsslError.rsslErrorId)
+					.append("' Internal sysError='").append(rsslErrorInfo.rsslError.sysError)
+					.append("' Error Location='").append(rsslErrorInfo.errorLocation)
+					.append("' Error Text='").append(rsslErrorInfo.rsslError.text).append("'. ");
+				if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+					_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
+				throwIueException(temp, OmmInvalidUsageException::InternalErrorEnum);
+				return;
+			}
 		}
 
 		rsslClearOMMProviderRole(&_providerRole);
@@ -983,7 +1037,7 @@ bool OmmServerBaseImpl::hasErrorClientHandler() const
 	return _pErrorClientHandler != 0 ? true : false;
 }
 
-EmaList< TimeOut* >& OmmServerBaseImpl::getTimeOutList()
+TimeOutQueue& OmmServerBaseImpl::getTimeOutList()
 {
 	return _theTimeOuts;
 }
@@ -1008,6 +1062,60 @@ RsslReactor* OmmServerBaseImpl::getRsslReactor()
 	return _pRsslReactor;
 }
 
+RsslReactor* OmmServerBaseImpl::getRsslReactor(RsslReactorChannel* pRsslReactorChannel)
+{
+	ClientSession* clientSession = pRsslReactorChannel ? (ClientSession*)pRsslReactorChannel->userSpecPtr : 0;
+
+	if (clientSession && clientSession->getReactorShard() < _reactorShards.size())
+		return _reactorShards[clientSession->getReactorShard()];
+
+	return _pRsslReactor;
+}
+
+UInt32 OmmServerBaseImpl::acquireReactorShard()
+{
+	UInt32 shard = 0;
+
+	_userLock.lock();
+
+	for (UInt32 index = 1; index < _reactorShardSessionCounts.size(); ++index)
+	{
+		if (_reactorShardSessionCounts[index] < _reactorShardSessionCounts[shard])
+			shard = index;
+	}
+
+	if (shard < _reactorShardSessionCounts.size())
+		++_reactorShardSessionCounts[shard];
+
+	_userLock.unlock();
+
+	return shard;
+}
+
+void OmmServerBaseImpl::releaseReactorShard(UInt32 shard)
+{
+	_userLock.lock();
+
+	if (shard < _reactorShardSessionCounts.size() && _reactorShardSessionCounts[shard] > 0)
+		--_reactorShardSessionCounts[shard];
+
+	_userLock.unlock();
+}
+
+UInt32 OmmServerBaseImpl::getReactorShardCount()
+{
+	MutexLocker lock(_userLock);
+
+	return _reactorShards.size();
+}
+
+UInt32 OmmServerBaseImpl::getReactorShardSessionCount(UInt32 shard)
+{
+	MutexLocker lock(_userLock);
+
+	return shard < _reactorShardSessionCounts.size() ? _reactorShardSessionCounts[shard] : 0;
+}
+
 bool OmmServerBaseImpl::isPipeWritten()
 {
 	MutexLocker lock(_pipeLock);
@@ -1143,25 +1251,31 @@ void OmmServerBaseImpl::uninitialize(bool caughtException, bool calledFromInit)
 	if (_pRsslReactor)
 	{
 		RsslErrorInfo rsslErrorInfo;
-		clearRsslErrorInfo(&rsslErrorInfo);
 
-		if (RSSL_RET_SUCCESS != rsslDestroyReactor(_pRsslReactor, &rsslErrorInfo))
+		for (UInt32 shard = 0; shard < _reactorShards.size(); ++shard)
 		{
-			if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+			clearRsslErrorInfo(&rsslErrorInfo);
+
+			if (RSSL_RET_SUCCESS != rsslDestroyReactor(_reactorShards[shard], &rsslErrorInfo))
 			{
-				EmaString temp("Failed to uninitialize OmmServerBaseImpl( rsslDestroyReactor ).");
-				temp.append("' Error Id='").append(rsslErrorInfo.rsslError.rsslErrorId)
-					.append("' Internal sysError='").append(rsslErrorInfo.rsslError.sysError)
-					.append("' Error Location='").append(rsslErrorInfo.errorLocation)
-					.append("' Error Text='").append(rsslErrorInfo.rsslError.text).append("'. ");
+				if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+				{
+					EmaString temp("Failed to uninitialize OmmServerBaseImpl( rsslDestroyReactor ).");
+					temp.append("' Error Id='").append(rsslErrorInfo.rsslError.rsslErrorId)
+						.append("' Internal sysError='").append(rsslErrorInfo.rsslError.sysError)
+						.append("' Error Location='").append(rsslErrorInfo.errorLocation)
+						.append("' Error Text='").append(rsslErrorInfo.rsslError.text).append("'. ");
 
-				_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
+					_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
+				}
 			}
 		}
 
 		if (_pServerChannelHandler)
 			_pServerChannelHandler->closeActiveSessions();
 
+		_reactorShards.clear();
+		_reactorShardSessionCounts.clear();
 		_pRsslReactor = 0;
 	}
 
@@ -1312,7 +1426,7 @@ Int64 OmmServerBaseImpl::rsslReactorDispatchLoop(Int64 timeOut, UInt32 count, bo
 			_reactorAcceptOptions.rsslAcceptOptions.userSpecPtr = clientSession;
 			_reactorAcceptOptions.initializationTimeout = _activeServerConfig.pServerConfig->initializationTimeout;
 
-			if (rsslReactorAccept(_pRsslReactor, _pRsslServer, &_reactorAcceptOptions, (RsslReactorChannelRole*)&_providerRole, &_reactorDispatchErrorInfo) != RSSL_RET_SUCCESS)
+			if (rsslReactorAccept(_reactorShards[clientSession->getReactorShard()], _pRsslServer, &_reactorAcceptOptions, (RsslReactorChannelRole*)&_providerRole, &_reactorDispatchErrorInfo) != RSSL_RET_SUCCESS)
 			{
 				ClientSession::destroy(clientSession);
 
@@ -1372,7 +1486,7 @@ Int64 OmmServerBaseImpl::rsslReactorDispatchLoop(Int64 timeOut, UInt32 count, bo
 
 				_reactorAcceptOptions.initializationTimeout = _activeServerConfig.pServerConfig->initializationTimeout;
 
-				if (rsslReactorAccept(_pRsslReactor, _pRsslServer, &_reactorAcceptOptions, (RsslReactorChannelRole*)&_providerRole, &_reactorDispatchErrorInfo) != RSSL_RET_SUCCESS)
+				if (rsslReactorAccept(_reactorShards[clientSession->getReactorShard()], _pRsslServer, &_reactorAcceptOptions, (RsslReactorChannelRole*)&_providerRole, &_reactorDispatchErrorInfo) != RSSL_RET_SUCCESS)
 				{
 					ClientSession::destroy(clientSession);
 
@@ -1414,15 +1528,21 @@ Int64 OmmServerBaseImpl::rsslReactorDispatchLoop(Int64 timeOut, UInt32 count, bo
 
 		if (selectRetCode > 0)
 		{
-			loopCount = 0;
-			do
+			reactorRetCode = RSSL_RET_SUCCESS;
+
+			// every reactor shard is dispatched on this thread; callbacks stay serialized by _userLock
+			for (UInt32 shard = 0; shard < _reactorShards.size() && reactorRetCode >= RSSL_RET_SUCCESS; ++shard)
 			{
-				_userLock.lock();
-				reactorRetCode = _pRsslReactor ? rsslReactorDispatch(_pRsslReactor, &dispatchOpts, &_reactorDispatchErrorInfo) : RSSL_RET_SUCCESS;
-				_userLock.unlock();
+				loopCount = 0;
+				do
+				{
+					_userLock.lock();
+					reactorRetCode = shard < _reactorShards.size() ? rsslReactorDispatch(_reactorShards[shard], &dispatchOpts, &_reactorDispatchErrorInfo) : RSSL_RET_SUCCESS;
+					_userLock.unlock();
 
-				++loopCount;
-			} while (reactorRetCode > RSSL_RET_SUCCESS && !bMsgDispRcvd && loopCount < 5);
+					++loopCount;
+				} while (reactorRetCode > RSSL_RET_SUCCESS && !bMsgDispRcvd && loopCount < 5);
+			}
 
 			if (reactorRetCode < RSSL_RET_SUCCESS)
 			{
@@ -1646,6 +1766,11 @@ ItemCallbackClient& OmmServerBaseImpl::getItemCallbackClient()
 	return *_pItemCallbackClient;
 }
 
+SlabAllocator* OmmServerBaseImpl::getItemSlab()
+{
+	return _pItemSlab;
+}
+
 MarketItemHandler& OmmServerBaseImpl::getMarketItemHandler()
 {
 	return *_pMarketItemHandler;
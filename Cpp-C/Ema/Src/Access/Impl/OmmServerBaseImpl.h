@@ -95,6 +95,9 @@ public:
 
 	ItemCallbackClient& getItemCallbackClient();
 
+	// Allocator for items and the objects they own; 0 before initialization.
+	SlabAllocator* getItemSlab();
+
 	MarketItemHandler& getMarketItemHandler();
 
 	DictionaryHandler& getDictionaryHandler();
@@ -115,7 +118,7 @@ public:
 
 	bool hasErrorClientHandler() const;
 
-	EmaList< TimeOut* >& getTimeOutList();
+	TimeOutQueue& getTimeOutList();
 
 	Mutex& getTimeOutMutex();
 
@@ -123,6 +126,19 @@ public:
 
 	RsslReactor* getRsslReactor();
 
+	// Returns the reactor shard that the client channel was accepted on.
+	RsslReactor* getRsslReactor(RsslReactorChannel*);
+
+	// Picks the reactor shard with the fewest client sessions for a new client session.
+	UInt32 acquireReactorShard();
+
+	void releaseReactorShard(UInt32);
+
+	UInt32 getReactorShardCount();
+
+	// Returns the number of client sessions assigned to the reactor shard.
+	UInt32 getReactorShardSessionCount(UInt32);
+
 	void installTimeOut();
 
 	void handleIue(const EmaString&, Int32 errorCode);
@@ -233,12 +249,15 @@ protected:
 	RsslErrorInfo				_reactorDispatchErrorInfo;
 	ServerImplState				_state;
 	RsslReactor*				_pRsslReactor;
+	EmaVector<RsslReactor*>		_reactorShards;
+	EmaVector<UInt32>			_reactorShardSessionCounts;
 	ServerChannelHandler*		_pServerChannelHandler;
 	LoginHandler*				_pLoginHandler;
 	DirectoryHandler*			_pDirectoryHandler;
 	DictionaryHandler*			_pDictionaryHandler;
 	MarketItemHandler*			_pMarketItemHandler;
 	ItemCallbackClient*			_pItemCallbackClient;
+	SlabAllocator*				_pItemSlab;
 	OmmLoggerClient*			_pLoggerClient;
 	Pipe						_pipe;
 	UInt32						_pipeWriteCount;
@@ -247,7 +266,7 @@ protected:
 	bool						_bMsgDispatched;
 	bool						_bEventReceived;
 	ErrorClientHandler*			_pErrorClientHandler;
-	EmaList< TimeOut* >			_theTimeOuts;
+	TimeOutQueue			_theTimeOuts;
 	OmmProviderClient*			_pOmmProviderClient;
 	OmmProviderEvent			ommProviderEvent;
 	void*						_pClosure;
@@ -16,6 +16,11 @@
 #include  <sys/types.h>
 #endif
 
+#if defined( __linux__ )
+#include  <sys/eventfd.h>
+#include  <stdint.h>
+#endif
+
 using namespace thomsonreuters::ema::access;
 
 Pipe::Pipe() :
@@ -71,6 +76,10 @@ bool Pipe::create( int winPipePort )
 	if ( 0 != setsockopt( _fds[1], IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(char) ) )
 		return false;
 
+#elif defined( __linux__ )
+	_fds[0] = _fds[1] = eventfd( 0, EFD_NONBLOCK );
+	if ( -1 == _fds[0] )
+		return false;
 #else
 	if ( -1 == pipe( _fds ) )
 	{
@@ -89,6 +98,9 @@ void Pipe::close()
 {
 	if ( _initialized )
 	{
+		if ( _fds[1] == _fds[0] )
+			_fds[1] = -1;
+
 		closeFD( 0 );
 		closeFD( 1 );
 
@@ -125,6 +137,9 @@ int Pipe::read( void* buffer, int length )
 	while ( dataLength > 0 && retVal != dataLength && ( Sleep(0), retryCount-- ) );
 
 	return retVal <= 0 ? retVal : length;
+#elif defined( __linux__ )
+	uint64_t count;
+	return ::read( _fds[0], &count, sizeof( count ) ) == sizeof( count ) ? length : -1;
 #else
 	return ::read( _fds[0], buffer, length );
 #endif	
@@ -134,6 +149,9 @@ int	Pipe::write( const void* buffer, int length )
 {
 #ifdef WIN32
 	return ::send( _fds[1], (const char *)buffer, length, 0 );
+#elif defined( __linux__ )
+	uint64_t count = 1;
+	return ::write( _fds[1], &count, sizeof( count ) ) == sizeof( count ) ? length : -1;
 #else
 	return ::write( _fds[1], buffer, length );
 #endif
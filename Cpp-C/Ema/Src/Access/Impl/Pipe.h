@@ -18,6 +18,8 @@ namespace access {
 #define WinPipePort_Name		"WinPipePort"
 #define WinPipePort_Default		9001
 
+// On Linux the pipe is an eventfd: readFD() and writeFD() are the same descriptor,
+// each write() signals it and a single read() clears all outstanding signals.
 class Pipe
 {
 public:
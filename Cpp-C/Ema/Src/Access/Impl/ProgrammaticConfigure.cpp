@@ -1162,6 +1162,14 @@ void ProgrammaticConfigure::retrieveInstanceCommonConfig( const Map& map, const
 												{
 													activeConfig.dispatchTimeoutApiThread = eentry.getInt();
 												}
+												else if ( eentry.getName() == "BusyPollTimeout" )
+												{
+													activeConfig.busyPollTimeout = eentry.getInt();
+												}
+												else if ( eentry.getName() == "CpuApiThreadBind" )
+												{
+													activeConfig.cpuApiThreadBind = eentry.getInt();
+												}
 												else if (eentry.getName() == "XmlTraceMaxFileSize")
 												{
 													activeConfig.xmlTraceMaxFileSize = eentry.getInt();
@@ -1444,6 +1452,10 @@ void ProgrammaticConfigure::retrieveInstanceCustomConfig( const Map& map, const
 												{
 													static_cast<ActiveConfig&>(activeConfig).setMaxOutstandingPosts( eentry.getUInt() );
 												}
+												else if ( eentry.getName() == "SubmitQueueSize" )
+												{
+													static_cast<ActiveConfig&>(activeConfig).setSubmitQueueSize( eentry.getUInt() );
+												}
 												else if ( eentry.getName() == "DirectoryRequestTimeOut" )
 												{
 													static_cast<ActiveConfig&>(activeConfig).setDirectoryRequestTimeOut( eentry.getUInt() );
@@ -1600,6 +1612,16 @@ void ProgrammaticConfigure::retrieveInstanceCustomConfig( const Map& map, const
 												{
 													static_cast<OmmIProviderActiveConfig&>(activeConfig).setMaxFieldDictFragmentSize(eentry.getUInt());
 												}
+												else if (eentry.getName() == "ReactorShardCount")
+												{
+													static_cast<ActiveServerConfig&>(activeConfig).setReactorShardCount(eentry.getUInt());
+												}
+												break;
+											case DataType::AsciiEnum:
+												if (eentry.getName() == "ReactorShardCpuList")
+												{
+													static_cast<ActiveServerConfig&>(activeConfig).reactorShardCpuList = eentry.getAscii();
+												}
 												break;
 											}
 										}
@@ -413,7 +413,7 @@ void ServerChannelHandler::closeChannel(RsslReactorChannel* pRsslReactorChannel)
 	if (pRsslReactorChannel->socketId != REACTOR_INVALID_SOCKET)
 		_pOmmServerBaseImpl->removeSocket(pRsslReactorChannel->socketId);
 
-	if (rsslReactorCloseChannel(_pOmmServerBaseImpl->getRsslReactor(), pRsslReactorChannel, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	if (rsslReactorCloseChannel(_pOmmServerBaseImpl->getRsslReactor(pRsslReactorChannel), pRsslReactorChannel, &rsslErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		if (OmmLoggerClient::ErrorEnum >= _pOmmServerBaseImpl->getActiveConfig().loggerConfig.minLoggerSeverity)
 		{
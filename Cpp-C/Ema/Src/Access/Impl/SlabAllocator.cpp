@@ -0,0 +1,191 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "SlabAllocator.h"
+
+#include <string.h>
+
+using namespace thomsonreuters::ema::access;
+
+// Every block, and every heap allocation made for a SlabAllocated object, starts with
+// this header. It is padded to a size class so that objects keep their alignment.
+struct SlabBlockHeader
+{
+	SlabAllocator*	pAllocator;		// 0 for heap allocations
+	UInt32			sizeClass;
+};
+
+#define SLAB_ALLOCATOR_HEADER_SIZE	SLAB_ALLOCATOR_SIZE_CLASS
+
+SlabAllocator* SlabAllocator::create( UInt32 maxChunkBlocks )
+{
+	return new ( std::nothrow ) SlabAllocator( maxChunkBlocks );
+}
+
+SlabAllocator::SlabAllocator( UInt32 maxChunkBlocks ) :
+	_chunks( 0 ),
+	_maxChunkBlocks( maxChunkBlocks < SLAB_ALLOCATOR_MIN_CHUNK_BLOCKS ? SLAB_ALLOCATOR_MIN_CHUNK_BLOCKS : maxChunkBlocks ),
+	_released( false )
+{
+	for ( UInt32 idx = 0; idx < SLAB_ALLOCATOR_SIZE_CLASSES; ++idx )
+	{
+		_freeLists[idx] = 0;
+		_nextChunkBlocks[idx] = SLAB_ALLOCATOR_MIN_CHUNK_BLOCKS;
+	}
+
+	memset( &_statistics, 0, sizeof( _statistics ) );
+}
+
+SlabAllocator::~SlabAllocator()
+{
+	while ( _chunks )
+	{
+		Chunk* chunk = _chunks;
+		_chunks = chunk->_next;
+		::operator delete( chunk );
+	}
+}
+
+void SlabAllocator::release()
+{
+	_lock.lock();
+
+	_released = true;
+	bool unused = ( _statistics.blocksInUse == 0 );
+
+	_lock.unlock();
+
+	if ( unused )
+		delete this;
+}
+
+bool SlabAllocator::addChunk( UInt32 sizeClass )
+{
+	UInt32 blockSize = ( sizeClass + 1 ) * SLAB_ALLOCATOR_SIZE_CLASS;
+	UInt32 blockCount = _nextChunkBlocks[sizeClass];
+
+	// the chunk link takes the first size class worth of bytes, so blocks stay aligned
+	char* memory = static_cast< char* >( ::operator new( SLAB_ALLOCATOR_SIZE_CLASS + (size_t)blockCount * blockSize, std::nothrow ) );
+	if ( !memory )
+		return false;
+
+	Chunk* chunk = reinterpret_cast< Chunk* >( memory );
+	chunk->_next = _chunks;
+	_chunks = chunk;
+
+	for ( UInt32 idx = blockCount; idx != 0; --idx )
+	{
+		FreeBlock* block = reinterpret_cast< FreeBlock* >( memory + SLAB_ALLOCATOR_SIZE_CLASS + (size_t)( idx - 1 ) * blockSize );
+		block->_next = _freeLists[sizeClass];
+		_freeLists[sizeClass] = block;
+	}
+
+	if ( blockCount < _maxChunkBlocks )
+		_nextChunkBlocks[sizeClass] = ( blockCount * 2 < _maxChunkBlocks ) ? blockCount * 2 : _maxChunkBlocks;
+
+	++_statistics.chunkAllocations;
+
+	return true;
+}
+
+void* SlabAllocator::allocate( size_t size )
+{
+	size_t totalSize = size + SLAB_ALLOCATOR_HEADER_SIZE;
+
+	if ( totalSize > SLAB_ALLOCATOR_MAX_BLOCK_SIZE )
+	{
+		_lock.lock();
+		++_statistics.heapAllocations;
+		_lock.unlock();
+
+		return SlabAllocated::operator new( size );
+	}
+
+	UInt32 sizeClass = (UInt32)( ( totalSize - 1 ) / SLAB_ALLOCATOR_SIZE_CLASS );
+
+	_lock.lock();
+
+	if ( !_freeLists[sizeClass] && !addChunk( sizeClass ) )
+	{
+		_lock.unlock();
+		throw std::bad_alloc();
+	}
+
+	FreeBlock* block = _freeLists[sizeClass];
+	_freeLists[sizeClass] = block->_next;
+
+	++_statistics.allocations;
+	++_statistics.blocksInUse;
+
+	_lock.unlock();
+
+	SlabBlockHeader* header = reinterpret_cast< SlabBlockHeader* >( block );
+	header->pAllocator = this;
+	header->sizeClass = sizeClass;
+
+	return reinterpret_cast< char* >( block ) + SLAB_ALLOCATOR_HEADER_SIZE;
+}
+
+void SlabAllocator::freeBlock( void* block, UInt32 sizeClass )
+{
+	_lock.lock();
+
+	FreeBlock* freeBlock = static_cast< FreeBlock* >( block );
+	freeBlock->_next = _freeLists[sizeClass];
+	_freeLists[sizeClass] = freeBlock;
+
+	bool unused = ( --_statistics.blocksInUse == 0 && _released );
+
+	_lock.unlock();
+
+	if ( unused )
+		delete this;
+}
+
+void SlabAllocator::deallocate( void* p )
+{
+	SlabBlockHeader* header = reinterpret_cast< SlabBlockHeader* >( static_cast< char* >( p ) - SLAB_ALLOCATOR_HEADER_SIZE );
+
+	if ( header->pAllocator )
+		header->pAllocator->freeBlock( header, header->sizeClass );
+	else
+		::operator delete( header );
+}
+
+void SlabAllocator::getStatistics( Statistics& statistics )
+{
+	_lock.lock();
+	statistics = _statistics;
+	_lock.unlock();
+}
+
+void* SlabAllocated::operator new( size_t size )
+{
+	SlabBlockHeader* header = static_cast< SlabBlockHeader* >( ::operator new( size + SLAB_ALLOCATOR_HEADER_SIZE ) );
+	header->pAllocator = 0;
+	header->sizeClass = 0;
+
+	return reinterpret_cast< char* >( header ) + SLAB_ALLOCATOR_HEADER_SIZE;
+}
+
+void* SlabAllocated::operator new( size_t size, SlabAllocator* pAllocator )
+{
+	return pAllocator ? pAllocator->allocate( size ) : SlabAllocated::operator new( size );
+}
+
+void SlabAllocated::operator delete( void* p )
+{
+	if ( p )
+		SlabAllocator::deallocate( p );
+}
+
+void SlabAllocated::operator delete( void* p, SlabAllocator* )
+{
+	if ( p )
+		SlabAllocator::deallocate( p );
+}
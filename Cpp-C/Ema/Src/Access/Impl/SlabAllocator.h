@@ -0,0 +1,119 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __thomsonreuters_ema_access_SlabAllocator_h
+#define __thomsonreuters_ema_access_SlabAllocator_h
+
+#include "Mutex.h"
+#include "Common.h"
+
+#include <new>
+#include <stddef.h>
+
+namespace thomsonreuters {
+
+namespace ema {
+
+namespace access {
+
+// Blocks are handed out in size classes of this many bytes, up to the largest block below.
+// Larger objects come from the heap.
+#define SLAB_ALLOCATOR_SIZE_CLASS		16
+#define SLAB_ALLOCATOR_MAX_BLOCK_SIZE	1024
+#define SLAB_ALLOCATOR_SIZE_CLASSES		( SLAB_ALLOCATOR_MAX_BLOCK_SIZE / SLAB_ALLOCATOR_SIZE_CLASS )
+
+// Number of blocks in the first chunk of a size class; each further chunk doubles until it reaches the configured maximum.
+#define SLAB_ALLOCATOR_MIN_CHUNK_BLOCKS	32
+
+// Allocates objects of many sizes from large chunks, one free list per size class.
+// Freed blocks are reused by later allocations and chunks are only freed with the
+// allocator. An allocator is owned by one OmmBaseImpl or OmmServerBaseImpl, which
+// releases it when done; the allocator then lives on until its last block is freed,
+// so objects that outlive their owner can still be deleted safely.
+class SlabAllocator
+{
+public :
+
+	struct Statistics
+	{
+		UInt64	allocations;		// blocks handed out from chunks
+		UInt64	heapAllocations;	// allocations too large for a block
+		UInt64	chunkAllocations;	// chunks taken from the heap
+		UInt64	blocksInUse;		// blocks currently handed out
+	};
+
+	// Returns 0 if the allocator could not be created.
+	static SlabAllocator* create( UInt32 maxChunkBlocks );
+
+	// Gives up the owner's reference. The allocator is deleted once no blocks are in use.
+	void release();
+
+	// Throws std::bad_alloc on failure.
+	void* allocate( size_t );
+
+	// Frees memory returned by allocate() or by SlabAllocated::operator new().
+	static void deallocate( void* );
+
+	void getStatistics( Statistics& );
+
+private :
+
+	struct FreeBlock
+	{
+		FreeBlock*		_next;
+	};
+
+	struct Chunk
+	{
+		Chunk*			_next;
+	};
+
+	SlabAllocator( UInt32 maxChunkBlocks );
+
+	virtual ~SlabAllocator();
+
+	void freeBlock( void*, UInt32 sizeClass );
+
+	bool addChunk( UInt32 sizeClass );
+
+	Mutex			_lock;
+	FreeBlock*		_freeLists[SLAB_ALLOCATOR_SIZE_CLASSES];
+	UInt32			_nextChunkBlocks[SLAB_ALLOCATOR_SIZE_CLASSES];
+	Chunk*			_chunks;
+	UInt32			_maxChunkBlocks;
+	bool			_released;
+	Statistics		_statistics;
+
+	SlabAllocator( const SlabAllocator& );
+	SlabAllocator& operator=( const SlabAllocator& );
+};
+
+// Base for classes whose objects can be placed in a SlabAllocator with
+// new ( pSlabAllocator ) T( ... ). Plain new, or a null allocator, uses the heap.
+// Either way, delete returns the memory to where it came from.
+class SlabAllocated
+{
+public :
+
+	static void* operator new( size_t );
+
+	static void* operator new( size_t, SlabAllocator* );
+
+	static void operator delete( void* );
+
+	// used only if a constructor throws
+	static void operator delete( void*, SlabAllocator* );
+};
+
+}
+
+}
+
+}
+
+#endif // __thomsonreuters_ema_access_SlabAllocator_h
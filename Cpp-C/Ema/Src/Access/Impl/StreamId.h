@@ -10,6 +10,7 @@
 #define __thomsonreuters_ema_access_StreamId_h
 
 #include "EmaList.h"
+#include "SlabAllocator.h"
 
 namespace thomsonreuters {
 	
@@ -17,7 +18,7 @@ namespace ema {
 
 namespace access {
 
-class StreamId : public ListLinks< StreamId >
+class StreamId : public ListLinks< StreamId >, public SlabAllocated
 {
 public:
 
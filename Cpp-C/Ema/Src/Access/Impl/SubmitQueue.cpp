@@ -0,0 +1,261 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "SubmitQueue.h"
+#include "rtr/rsslIterators.h"
+#include "rtr/rsslMsgEncoders.h"
+#include "rtr/rsslMsgDecoders.h"
+
+#include <new>
+
+#ifdef WIN32
+#define SUBMIT_QUEUE_EXCHANGE( pTarget, pValue ) \
+	(SubmitQueueEntry*)InterlockedExchangePointer( (PVOID volatile*)(pTarget), (PVOID)(pValue) )
+#define SUBMIT_QUEUE_BARRIER() MemoryBarrier()
+#define SUBMIT_QUEUE_COMPARE_AND_SWAP64( pTarget, compValue, newValue ) \
+	(UInt64)InterlockedCompareExchange64( (LONGLONG volatile*)(pTarget), (LONGLONG)(newValue), (LONGLONG)(compValue) )
+#else
+#define SUBMIT_QUEUE_EXCHANGE( pTarget, pValue ) \
+	( __sync_synchronize(), __sync_lock_test_and_set( (pTarget), (pValue) ) )
+#define SUBMIT_QUEUE_BARRIER() __sync_synchronize()
+#define SUBMIT_QUEUE_COMPARE_AND_SWAP64( pTarget, compValue, newValue ) \
+	__sync_val_compare_and_swap( (pTarget), (compValue), (newValue) )
+#endif
+
+// marks the end of the free list
+#define SUBMIT_QUEUE_NO_ENTRY	0xFFFFFFFF
+
+#define SUBMIT_QUEUE_FREE_HEAD( tag, index )	( ( (UInt64)(tag) << 32 ) | (UInt64)(index) )
+
+using namespace thomsonreuters::ema::access;
+
+SubmitQueueEntry::SubmitQueueEntry( UInt32 bufferSize ) :
+	_next( 0 ),
+	_nextFree( SUBMIT_QUEUE_NO_ENTRY ),
+	_index( 0 ),
+	_msgType( PostMsgEnum ),
+	_handle( 0 ),
+	_serviceName(),
+	_hasServiceName( false ),
+	_pData( bufferSize ? new char[bufferSize] : 0 ),
+	_capacity( bufferSize ),
+	_length( 0 )
+{
+}
+
+SubmitQueueEntry::~SubmitQueueEntry()
+{
+	delete[] _pData;
+}
+
+RsslRet SubmitQueueEntry::encode( RsslMsg* pRsslMsg, MsgType msgType, UInt64 handle, const EmaString* pServiceName )
+{
+	RsslEncodeIterator encIter;
+	RsslBuffer buffer;
+	RsslRet ret;
+
+	_msgType = msgType;
+	_handle = handle;
+	_hasServiceName = pServiceName ? true : false;
+	if ( pServiceName )
+		_serviceName = *pServiceName;
+
+	while ( true )
+	{
+		if ( !_pData )
+		{
+			try
+			{
+				_pData = new char[_capacity ? _capacity : SUBMIT_QUEUE_ENTRY_BUFFER_SIZE];
+			}
+			catch ( std::bad_alloc& )
+			{
+				return RSSL_RET_BUFFER_NO_BUFFERS;
+			}
+
+			if ( !_capacity ) _capacity = SUBMIT_QUEUE_ENTRY_BUFFER_SIZE;
+		}
+
+		buffer.data = _pData;
+		buffer.length = _capacity;
+
+		rsslClearEncodeIterator( &encIter );
+		rsslSetEncodeIteratorRWFVersion( &encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION );
+		rsslSetEncodeIteratorBuffer( &encIter, &buffer );
+
+		if ( ( ret = rsslEncodeMsg( &encIter, pRsslMsg ) ) != RSSL_RET_BUFFER_TOO_SMALL )
+			break;
+
+		// grow the buffer and try again; the entry keeps the larger buffer when it is reused
+		delete[] _pData;
+		_pData = 0;
+		_capacity *= 2;
+	}
+
+	_length = ( ret == RSSL_RET_SUCCESS ) ? rsslGetEncodedBufferLength( &encIter ) : 0;
+
+	return ret;
+}
+
+RsslRet SubmitQueueEntry::decode( RsslMsg* pRsslMsg )
+{
+	RsslDecodeIterator decIter;
+	RsslBuffer buffer;
+
+	buffer.data = _pData;
+	buffer.length = _length;
+
+	rsslClearDecodeIterator( &decIter );
+	rsslSetDecodeIteratorRWFVersion( &decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION );
+	rsslSetDecodeIteratorBuffer( &decIter, &buffer );
+
+	rsslClearMsg( pRsslMsg );
+	return rsslDecodeMsg( &decIter, pRsslMsg );
+}
+
+SubmitQueue::SubmitQueue() :
+	_head( &_stub ),
+	_tail( &_stub ),
+	_stub(),
+	_pEntries( 0 ),
+	_entryCount( 0 ),
+	_freeHead( SUBMIT_QUEUE_FREE_HEAD( 0, SUBMIT_QUEUE_NO_ENTRY ) ),
+	_enabled( false )
+{
+}
+
+SubmitQueue::~SubmitQueue()
+{
+	clear();
+}
+
+void SubmitQueue::initialize( UInt32 entryCount )
+{
+	if ( !entryCount || entryCount == SUBMIT_QUEUE_NO_ENTRY )
+		return;
+
+	_pEntries = new ( std::nothrow ) SubmitQueueEntry[entryCount];
+	if ( !_pEntries )
+		return;
+
+	_entryCount = entryCount;
+
+	for ( UInt32 i = 0; i < entryCount; ++i )
+	{
+		// the buffers are allocated here so that queuing a typical message does not allocate
+		_pEntries[i]._pData = new ( std::nothrow ) char[SUBMIT_QUEUE_ENTRY_BUFFER_SIZE];
+		_pEntries[i]._capacity = _pEntries[i]._pData ? SUBMIT_QUEUE_ENTRY_BUFFER_SIZE : 0;
+		_pEntries[i]._index = i;
+		_pEntries[i]._nextFree = ( i + 1 < entryCount ) ? i + 1 : SUBMIT_QUEUE_NO_ENTRY;
+	}
+
+	_freeHead = SUBMIT_QUEUE_FREE_HEAD( 0, 0 );
+	_enabled = true;
+}
+
+void SubmitQueue::clear()
+{
+	_enabled = false;
+
+	// popped entries belong to the pool, which is freed below
+	while ( pop() != 0 );
+
+	_head = _tail = &_stub;
+	_stub._next = 0;
+
+	delete[] _pEntries;
+	_pEntries = 0;
+	_entryCount = 0;
+	_freeHead = SUBMIT_QUEUE_FREE_HEAD( 0, SUBMIT_QUEUE_NO_ENTRY );
+}
+
+SubmitQueueEntry* SubmitQueue::getEntry()
+{
+	UInt64 head = _freeHead;
+
+	while ( true )
+	{
+		UInt32 index = (UInt32)head;
+		if ( index == SUBMIT_QUEUE_NO_ENTRY )
+			return 0;
+
+		// if another thread takes this entry first, _nextFree may be stale, but then the tag has changed and the swap fails
+		UInt64 newHead = SUBMIT_QUEUE_FREE_HEAD( ( head >> 32 ) + 1, _pEntries[index]._nextFree );
+		UInt64 prevHead = SUBMIT_QUEUE_COMPARE_AND_SWAP64( &_freeHead, head, newHead );
+
+		if ( prevHead == head )
+			return &_pEntries[index];
+
+		head = prevHead;
+	}
+}
+
+void SubmitQueue::returnEntry( SubmitQueueEntry* pEntry )
+{
+	UInt64 head = _freeHead;
+
+	while ( true )
+	{
+		pEntry->_nextFree = (UInt32)head;
+
+		UInt64 newHead = SUBMIT_QUEUE_FREE_HEAD( ( head >> 32 ) + 1, pEntry->_index );
+		UInt64 prevHead = SUBMIT_QUEUE_COMPARE_AND_SWAP64( &_freeHead, head, newHead );
+
+		if ( prevHead == head )
+			return;
+
+		head = prevHead;
+	}
+}
+
+void SubmitQueue::push( SubmitQueueEntry* pEntry )
+{
+	pEntry->_next = 0;
+
+	// Swing the head to the new entry first, then link the previous head to it.
+	// Between the two steps the consumer sees the queue end at the previous head.
+	SubmitQueueEntry* pPrev = SUBMIT_QUEUE_EXCHANGE( &_head, pEntry );
+	pPrev->_next = pEntry;
+}
+
+SubmitQueueEntry* SubmitQueue::pop()
+{
+	SubmitQueueEntry* pTail = _tail;
+	SubmitQueueEntry* pNext = pTail->_next;
+
+	if ( pTail == &_stub )
+	{
+		if ( !pNext )
+			return 0;
+
+		_tail = pTail = pNext;
+		pNext = pNext->_next;
+	}
+
+	if ( pNext )
+	{
+		_tail = pNext;
+		SUBMIT_QUEUE_BARRIER();
+		return pTail;
+	}
+
+	if ( pTail != _head )
+		return 0;
+
+	// pTail is the last entry; put the stub behind it so pTail can be handed out.
+	push( &_stub );
+
+	if ( ( pNext = pTail->_next ) != 0 )
+	{
+		_tail = pNext;
+		SUBMIT_QUEUE_BARRIER();
+		return pTail;
+	}
+
+	return 0;
+}
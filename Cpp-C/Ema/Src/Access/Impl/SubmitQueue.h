@@ -0,0 +1,127 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __thomsonreuters_ema_access_SubmitQueue_h
+#define __thomsonreuters_ema_access_SubmitQueue_h
+
+#include "EmaString.h"
+#include "rtr/rsslMsg.h"
+
+namespace thomsonreuters {
+
+namespace ema {
+
+namespace access {
+
+#define SUBMIT_QUEUE_ENTRY_BUFFER_SIZE		1024
+
+// A message submitted by a user thread, encoded into the entry's own buffer.
+class SubmitQueueEntry
+{
+public :
+
+	enum MsgType
+	{
+		PostMsgEnum,
+		GenericMsgEnum
+	};
+
+	SubmitQueueEntry( UInt32 bufferSize = 0 );
+
+	virtual ~SubmitQueueEntry();
+
+	// Encodes the message into this entry's buffer, growing the buffer if needed.
+	RsslRet encode( RsslMsg*, MsgType, UInt64 handle, const EmaString* pServiceName );
+
+	// Decodes the message from this entry's buffer; the decoded message points into the buffer.
+	RsslRet decode( RsslMsg* );
+
+	MsgType getMsgType() const { return _msgType; }
+
+	UInt64 getHandle() const { return _handle; }
+
+	bool hasServiceName() const { return _hasServiceName; }
+
+	const EmaString& getServiceName() const { return _serviceName; }
+
+private :
+
+	friend class SubmitQueue;
+
+	SubmitQueueEntry* volatile	_next;
+	volatile UInt32				_nextFree;
+	UInt32						_index;
+	MsgType						_msgType;
+	UInt64						_handle;
+	EmaString					_serviceName;
+	bool						_hasServiceName;
+	char*						_pData;
+	UInt32						_capacity;
+	UInt32						_length;
+
+	SubmitQueueEntry( const SubmitQueueEntry& );
+	SubmitQueueEntry& operator=( const SubmitQueueEntry& );
+};
+
+// Multiple-producer, single-consumer queue of submitted messages.
+// Any thread may get an entry, encode into it and push it; pushing is lock-free.
+// Only one thread at a time may pop entries. Entries come from a fixed pool allocated by
+// initialize(), kept on a lock-free free list; when the pool is empty, getEntry() fails
+// rather than allocating, so the pool size bounds the memory held by queued messages.
+class SubmitQueue
+{
+public :
+
+	SubmitQueue();
+
+	virtual ~SubmitQueue();
+
+	// Pre-allocates the given number of entries. A count of zero leaves the queue disabled.
+	void initialize( UInt32 entryCount );
+
+	// Frees all entries, including any not yet popped, and disables the queue.
+	// Must not be called while other threads are using the queue.
+	void clear();
+
+	bool isEnabled() const { return _enabled; }
+
+	// Returns an entry from the pool, or 0 if all entries are in use.
+	SubmitQueueEntry* getEntry();
+
+	// Returns an entry taken by getEntry() to the pool.
+	void returnEntry( SubmitQueueEntry* );
+
+	void push( SubmitQueueEntry* );
+
+	// Returns the oldest entry, or 0 if the queue is empty (or a push is still in progress; the pushing thread signals the dispatch thread once it completes).
+	SubmitQueueEntry* pop();
+
+private :
+
+	SubmitQueueEntry* volatile	_head;
+	SubmitQueueEntry*			_tail;
+	SubmitQueueEntry			_stub;
+	SubmitQueueEntry*			_pEntries;
+	UInt32						_entryCount;
+	volatile UInt64				_freeHead;		// index of the first free entry in the low 32 bits, and a tag
+												// changed on every update in the high 32 bits so that a
+												// compare-and-swap cannot succeed on a head that was popped
+												// and pushed back in between (ABA)
+	bool						_enabled;
+
+	SubmitQueue( const SubmitQueue& );
+	SubmitQueue& operator=( const SubmitQueue& );
+};
+
+}
+
+}
+
+}
+
+#endif // __thomsonreuters_ema_access_SubmitQueue_h
@@ -23,7 +23,9 @@ TimeOut::TimeOut( TimeOutClient& timeOutClient, Int64 lengthInMicroSeconds, void
 	_timeoutTime(),
 	_canceled( false ),
 	_allocatedOnHeap( allocatedOnHeap ),
-	_timeOutClient(timeOutClient)
+	_timeOutClient(timeOutClient),
+	_sequence( 0 ),
+	_queuePosition( TimeOutQueue::NotQueued )
 {
 	if ( lengthInMicroSeconds == 0 )
 	{
@@ -59,41 +61,33 @@ TimeOut::~TimeOut()
 bool TimeOut::operator<( const TimeOut& rhs ) const
 {
 #ifdef WIN32
-	return _timeoutTime.QuadPart < rhs._timeoutTime.QuadPart;
+	if ( _timeoutTime.QuadPart != rhs._timeoutTime.QuadPart )
+		return _timeoutTime.QuadPart < rhs._timeoutTime.QuadPart;
 #else
-	return _timeoutTime < rhs._timeoutTime;
+	if ( _timeoutTime != rhs._timeoutTime )
+		return _timeoutTime < rhs._timeoutTime;
 #endif
+	return _sequence < rhs._sequence;
 }
 
 bool TimeOut::getTimeOutInMicroSeconds(TimeOutClient& timeOutClient, Int64& value)
 {
 	MutexLocker ml(timeOutClient.getTimeOutMutex());
 
-	EmaList< TimeOut* >& _theTimeOuts(timeOutClient.getTimeOutList());
-
-	if ( _theTimeOuts.empty() )
-		return false;
+	TimeOutQueue& _theTimeOuts(timeOutClient.getTimeOutList());
 
 	TimeOut* p( _theTimeOuts.front() );
-	while ( true )
+	while ( p && p->_canceled )
 	{
-		if ( !p )
-			return false;
-
-		if ( p->_canceled )
-		{
-			TimeOut * toBeDeleted( p );
-			p = p->next();
-			_theTimeOuts.remove( toBeDeleted );
-			if ( toBeDeleted->_allocatedOnHeap )
-				delete toBeDeleted;
-		}
-		else if ( !p->_lengthInMicroSeconds )
-			p = p->next();
-		else
-			break;
+		_theTimeOuts.remove( p );
+		if ( p->_allocatedOnHeap )
+			delete p;
+		p = _theTimeOuts.front();
 	}
 
+	if ( !p )
+		return false;
+
 	TimeOutTimeType current;
 
 #ifdef WIN32
@@ -120,9 +114,7 @@ void TimeOut::cancel()
 
 	_canceled = true;
 
-	EmaList< TimeOut* > & _theTimeOuts(_timeOutClient.getTimeOutList());
-
-	_theTimeOuts.remove( this );
+	_timeOutClient.getTimeOutList().remove( this );
 
 	if ( _allocatedOnHeap ) delete this;
 }
@@ -145,7 +137,9 @@ void TimeOut::execute( TimeOutClient& timeOutClient )
 	current = ts.tv_sec * static_cast<int>( 1E9 ) + ts.tv_nsec;
 #endif
 
-	TimeOut * p(timeOutClient.getTimeOutList().front());
+	TimeOutQueue& _theTimeOuts(timeOutClient.getTimeOutList());
+
+	TimeOut * p(_theTimeOuts.front());
 	while ( p )
 	{
 #ifdef WIN32
@@ -156,17 +150,32 @@ void TimeOut::execute( TimeOutClient& timeOutClient )
 		{
 			if ( !p->_canceled )
 				( *p )( );
+			// the functor may have added timeouts, so remove this one by its own position
+			_theTimeOuts.remove( p );
 			if ( p->_allocatedOnHeap )
-				delete timeOutClient.getTimeOutList().pop_front();
-			else
-				timeOutClient.getTimeOutList().pop_front();
-			p = timeOutClient.getTimeOutList().front();
+				delete p;
+			p = _theTimeOuts.front();
 		}
 		else
 			return;
 	}
 }
 
+void TimeOut::deleteAll( TimeOutClient& timeOutClient )
+{
+	MutexLocker ml(timeOutClient.getTimeOutMutex());
+
+	TimeOutQueue& _theTimeOuts(timeOutClient.getTimeOutList());
+
+	TimeOut* p;
+	while ( ( p = _theTimeOuts.front() ) != 0 )
+	{
+		_theTimeOuts.remove( p );
+		if ( p->_allocatedOnHeap )
+			delete p;
+	}
+}
+
 TimeOutClient::TimeOutClient()
 {
 
@@ -174,3 +183,114 @@ TimeOutClient::TimeOutClient()
 TimeOutClient::~TimeOutClient()
 {
 }
+
+TimeOutQueue::TimeOutQueue() :
+	_heap(),
+	_nextSequence( 0 )
+{
+}
+
+TimeOutQueue::~TimeOutQueue()
+{
+}
+
+bool TimeOutQueue::empty() const
+{
+	return _heap.empty();
+}
+
+UInt32 TimeOutQueue::size() const
+{
+	return _heap.size();
+}
+
+TimeOut* TimeOutQueue::front() const
+{
+	return _heap.empty() ? 0 : _heap[0];
+}
+
+void TimeOutQueue::insert( TimeOut* timeOut )
+{
+	timeOut->_sequence = _nextSequence++;
+	_heap.push_back( timeOut );
+	timeOut->_queuePosition = _heap.size() - 1;
+	siftUp( timeOut->_queuePosition );
+}
+
+void TimeOutQueue::remove( TimeOut* timeOut )
+{
+	UInt32 position( timeOut->_queuePosition );
+	if ( position >= _heap.size() || _heap[position] != timeOut )
+		return;
+
+	timeOut->_queuePosition = NotQueued;
+
+	UInt32 last( _heap.size() - 1 );
+	if ( position != last )
+	{
+		place( _heap[last], position );
+		_heap.removePosition( last );
+
+		if ( position > 0 && *_heap[position] < *_heap[( position - 1 ) / 2] )
+			siftUp( position );
+		else
+			siftDown( position );
+	}
+	else
+		_heap.removePosition( last );
+}
+
+void TimeOutQueue::clear()
+{
+	for ( UInt32 i = 0; i < _heap.size(); ++i )
+		_heap[i]->_queuePosition = NotQueued;
+
+	_heap.clear();
+}
+
+void TimeOutQueue::place( TimeOut* timeOut, UInt32 position )
+{
+	_heap[position] = timeOut;
+	timeOut->_queuePosition = position;
+}
+
+void TimeOutQueue::siftUp( UInt32 position )
+{
+	TimeOut* timeOut( _heap[position] );
+
+	while ( position > 0 )
+	{
+		UInt32 parent( ( position - 1 ) / 2 );
+		if ( !( *timeOut < *_heap[parent] ) )
+			break;
+
+		place( _heap[parent], position );
+		position = parent;
+	}
+
+	place( timeOut, position );
+}
+
+void TimeOutQueue::siftDown( UInt32 position )
+{
+	TimeOut* timeOut( _heap[position] );
+	UInt32 size( _heap.size() );
+
+	while ( true )
+	{
+		UInt32 child( 2 * position + 1 );
+		if ( child >= size )
+			break;
+
+		if ( child + 1 < size && *_heap[child + 1] < *_heap[child] )
+			++child;
+
+		if ( !( *_heap[child] < *timeOut ) )
+			break;
+
+		place( _heap[child], position );
+		position = child;
+	}
+
+	place( timeOut, position );
+}
@@ -15,8 +15,9 @@
 #include <time.h>
 #endif
 
-#include "EmaList.h"
+#include "EmaVector.h"
 #include "Mutex.h"
+#include "SlabAllocator.h"
 
 namespace thomsonreuters {
 
@@ -31,8 +32,9 @@ namespace access {
 #endif
 
 class TimeOutClient;
+class TimeOutQueue;
 
-class TimeOut : public ListLinks< TimeOut >
+class TimeOut : public SlabAllocated
 {
 public:
 
@@ -40,6 +42,9 @@ public:
 
 	static void execute(TimeOutClient&);
 
+	// Removes all pending timeouts without running them and frees those allocated on the heap.
+	static void deleteAll(TimeOutClient&);
+
 	TimeOut(TimeOutClient&, Int64, void(*functor)(void *), void* args, bool allocatedOnHeap);
 
 	virtual ~TimeOut();
@@ -54,6 +59,8 @@ public:
 
 private:
 
+	friend class TimeOutQueue;
+
 	static TimeOutTimeType	frequency;
 
 	void( *_functor )( void * );
@@ -63,6 +70,49 @@ private:
 	bool				_canceled;
 	bool				_allocatedOnHeap;
 	TimeOutClient&		_timeOutClient;
+	UInt64				_sequence;
+	UInt32				_queuePosition;
+};
+
+// Binary min-heap of pending timeouts ordered by expiry time, with ties kept in the
+// order they were added. Each TimeOut records its position in the heap so it can be
+// removed without a search.
+class TimeOutQueue
+{
+public:
+
+	TimeOutQueue();
+
+	virtual ~TimeOutQueue();
+
+	bool empty() const;
+
+	UInt32 size() const;
+
+	TimeOut* front() const;
+
+	void insert( TimeOut* );
+
+	// does nothing if the timeout is not in this queue
+	void remove( TimeOut* );
+
+	void clear();
+
+	static const UInt32 NotQueued = 0xFFFFFFFF;
+
+private:
+
+	void place( TimeOut*, UInt32 );
+
+	void siftUp( UInt32 );
+
+	void siftDown( UInt32 );
+
+	EmaVector< TimeOut* >	_heap;
+	UInt64					_nextSequence;
+
+	TimeOutQueue( const TimeOutQueue& );
+	TimeOutQueue& operator=( const TimeOutQueue& );
 };
 
 class TimeOutClient
@@ -71,7 +121,7 @@ public:
 	TimeOutClient();
 	virtual ~TimeOutClient();
 
-	virtual EmaList< TimeOut* >& getTimeOutList() = 0;
+	virtual TimeOutQueue& getTimeOutList() = 0;
 	virtual void installTimeOut() = 0;
 	virtual Mutex& getTimeOutMutex() = 0;
 
@@ -680,6 +680,7 @@ public :
 private :
 
 	friend class thomsonreuters::ema::rdm::DictionaryUtility;
+	friend class FieldListView;
 
 	void getInfoXmlStr( EmaString& ) const;
 
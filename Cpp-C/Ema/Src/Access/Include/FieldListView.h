@@ -0,0 +1,199 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __thomsonreuters_ema_access_FieldListView_h
+#define __thomsonreuters_ema_access_FieldListView_h
+
+/**
+	@class thomsonreuters::ema::access::FieldListView FieldListView.h "Access/Include/FieldListView.h"
+	@brief FieldListView is a read-only, forward-only view over the entries of a received FieldList.
+
+	FieldListView walks the encoded entries of a FieldList without creating a Data object for
+	each entry. Scalar values are decoded only when requested, and buffer types are returned
+	as pointers into the received message, so no copy is made.
+
+	The following code snippet shows decoding of a FieldList in OmmConsumerClient::onUpdateMsg().
+
+	\code
+
+	void AppClient::onUpdateMsg( const UpdateMsg& updateMsg, const OmmConsumerEvent& )
+	{
+		if ( updateMsg.getPayload().getDataType() != DataType::FieldListEnum )
+			return;
+
+		FieldListView view( updateMsg.getPayload().getFieldList() );
+
+		while ( view.forth() )
+		{
+			if ( view.getCode() == Data::BlankEnum )
+				continue;
+
+			switch ( view.getLoadType() )
+			{
+			case DataType::RealEnum :
+				price = view.getDouble();
+				break;
+			case DataType::AsciiEnum :
+				name.set( view.getRawData(), view.getRawLength() );
+				break;
+			...
+			}
+		}
+	}
+
+	\endcode
+
+	\remark FieldListView coexists with FieldList::forth() and FieldList::getEntry(); the two
+			keep separate positions in the same FieldList.
+	\remark Data returned by a FieldListView is valid only as long as the FieldList it was set on.
+	\remark Objects of this class are intended to be short lived or rather transitional.
+	\remark All methods in this class are \ref SingleThreaded.
+
+	@see FieldList,
+		FieldEntry,
+		OmmReal
+*/
+
+#include "Access/Include/Data.h"
+#include "Access/Include/OmmReal.h"
+
+namespace thomsonreuters {
+
+namespace ema {
+
+namespace access {
+
+class FieldList;
+class FieldListViewDecoder;
+
+class EMA_ACCESS_API FieldListView
+{
+public :
+
+	///@name Constructor
+	//@{
+	/** Constructs an empty FieldListView. set() must be called before iterating.
+	*/
+	FieldListView();
+
+	/** Constructs FieldListView over a received FieldList.
+		@param[in] fieldList received FieldList to iterate
+		@throw OmmInvalidUsageException if the FieldList was not received (e.g. it is being encoded)
+	*/
+	FieldListView( const FieldList& fieldList );
+	//@}
+
+	///@name Destructor
+	//@{
+	virtual ~FieldListView();
+	//@}
+
+	///@name Operations
+	//@{
+	/** Points this view at a received FieldList and positions it before the first entry.
+		@param[in] fieldList received FieldList to iterate
+		@throw OmmInvalidUsageException if the FieldList was not received (e.g. it is being encoded)
+		@return reference to this object
+	*/
+	FieldListView& set( const FieldList& fieldList );
+
+	/** Iterates through the entries of the FieldList.
+		@return false at the end of FieldList; true otherwise
+	*/
+	bool forth();
+
+	/** Resets iteration to the start of the FieldList.
+	*/
+	void reset();
+	//@}
+
+	///@name Accessors
+	//@{
+	/** Returns the FieldId of the current entry.
+		@return field id
+	*/
+	Int16 getFieldId() const;
+
+	/** Returns the DataType of the current entry as defined in the field dictionary.
+		\remark return of DataType::ErrorEnum signifies that the entry could not be decoded or
+				its FieldId is not found in the field dictionary
+		@return data type of the current entry
+	*/
+	DataType::DataTypeEnum getLoadType() const;
+
+	/** Returns the Code of the current entry.
+		\remark Attempts to extract a value will cause OmmInvalidUsageException if Data::BlankEnum is returned.
+		@return data code of the current entry
+	*/
+	Data::DataCode getCode() const;
+
+	/** Returns the current entry as Int64.
+		@throw OmmInvalidUsageException if getLoadType() returns type other than DataType::IntEnum or the entry is blank
+		@return Int64
+	*/
+	Int64 getInt() const;
+
+	/** Returns the current entry as UInt64.
+		@throw OmmInvalidUsageException if getLoadType() returns type other than DataType::UIntEnum or the entry is blank
+		@return UInt64
+	*/
+	UInt64 getUInt() const;
+
+	/** Returns the current entry as UInt16.
+		@throw OmmInvalidUsageException if getLoadType() returns type other than DataType::EnumEnum or the entry is blank
+		@return UInt16
+	*/
+	UInt16 getEnum() const;
+
+	/** Returns the current entry as double.
+		@throw OmmInvalidUsageException if getLoadType() returns type other than DataType::RealEnum,
+				DataType::FloatEnum or DataType::DoubleEnum, or the entry is blank
+		@return double
+	*/
+	double getDouble() const;
+
+	/** Returns the mantissa of the current entry.
+		@throw OmmInvalidUsageException if getLoadType() returns type other than DataType::RealEnum or the entry is blank
+		@return mantissa
+	*/
+	Int64 getRealMantissa() const;
+
+	/** Returns the magnitude type of the current entry.
+		@throw OmmInvalidUsageException if getLoadType() returns type other than DataType::RealEnum or the entry is blank
+		@return magnitude type
+	*/
+	OmmReal::MagnitudeType getRealMagnitudeType() const;
+
+	/** Returns a pointer to the encoded content of the current entry.
+		\remark For DataType::BufferEnum, DataType::AsciiEnum, DataType::Utf8Enum and DataType::RmtesEnum
+				this is the value itself; it is not null terminated.
+		@return pointer to encoded content; valid only as long as the FieldList
+	*/
+	const char* getRawData() const;
+
+	/** Returns the length of the encoded content of the current entry.
+		@return length of encoded content
+	*/
+	UInt32 getRawLength() const;
+	//@}
+
+private :
+
+	FieldListViewDecoder*	_pDecoder;
+
+	FieldListView( const FieldListView& );
+	FieldListView& operator=( const FieldListView& );
+};
+
+}
+
+}
+
+}
+
+#endif // __thomsonreuters_ema_access_FieldListView_h
@@ -252,6 +252,10 @@ public :
 		@return void
 		@throw OmmInvalidHandleException if passed in handle does not refer to an open stream
 		\remark This method is \ref ObjectLevelSafe
+		\remark When SubmitQueueSize is configured, a call made outside a callback queues the message,
+		which is sent on the next dispatch pass (in UserDispatch mode, the next dispatch() call);
+		an invalid handle is then reported through the error client or the log instead of an exception.
+		When all SubmitQueueSize entries are in use, OmmInvalidUsageException is thrown with NoBuffersEnum.
 	*/
 	void submit( const GenericMsg& genericMsg, UInt64 handle );
 
@@ -263,6 +267,10 @@ public :
 		@return void
 		@throw OmmInvalidHandleException if passed in handle does not refer to an open stream
 		\remark This method is \ref ObjectLevelSafe
+		\remark When SubmitQueueSize is configured, a call made outside a callback queues the message,
+		which is sent on the next dispatch pass (in UserDispatch mode, the next dispatch() call);
+		an invalid handle is then reported through the error client or the log instead of an exception.
+		When all SubmitQueueSize entries are in use, OmmInvalidUsageException is thrown with NoBuffersEnum.
 	*/
 	void submit( const PostMsg& postMsg, UInt64 handle );
 
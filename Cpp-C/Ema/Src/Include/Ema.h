@@ -69,6 +69,7 @@
 #include "Access/Include/OmmArrayEntry.h"
 #include "Access/Include/ElementEntry.h"
 #include "Access/Include/FieldEntry.h"
+#include "Access/Include/FieldListView.h"
 #include "Access/Include/FilterEntry.h"
 #include "Access/Include/MapEntry.h"
 #include "Access/Include/SeriesEntry.h"
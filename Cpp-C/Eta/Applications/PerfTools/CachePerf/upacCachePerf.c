@@ -0,0 +1,355 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+/* CachePerf measures the apply and retrieve throughput of the payload cache,
+ * for MarketPrice-style field lists and for a MarketByOrder-style map. */
+
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMsgDecoders.h"
+#include "rtr/rsslMsgEncoders.h"
+#include "rtr/rsslGetTime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Number of different update messages applied in turn. */
+#define UPDATE_VARIANTS 16
+#define ORDER_UPDATE_MSGS 256
+
+static char fieldDictionaryFileName[256] = "RDMFieldDictionary";
+static RsslUInt32 itemCount = 1000;
+static RsslUInt32 iterationCount = 1000000;
+static RsslUInt32 orderCount = 1000;
+static RsslUInt32 retrieveBufferSize = 6144;
+
+static RsslDataDictionary dictionary;
+static RsslCacheError cacheError;
+
+/* MarketPrice refresh fields: BID, ASK, BIDSIZE, ASKSIZE, TRDPRC_1, ACVOL_1, HIGH_1, LOW_1, OPEN_PRC, HST_CLOSE. */
+static const RsslFieldId priceFieldIds[] = { 22, 25, 30, 31, 6, 32, 12, 13, 19, 21 };
+#define PRICE_FIELD_COUNT (sizeof(priceFieldIds)/sizeof(RsslFieldId))
+
+/* Fields changed by each update: BID, ASK, TRDPRC_1, ACVOL_1. */
+static const RsslFieldId priceUpdateFieldIds[] = { 22, 25, 6, 32 };
+#define PRICE_UPDATE_FIELD_COUNT (sizeof(priceUpdateFieldIds)/sizeof(RsslFieldId))
+
+/* MarketByOrder entry fields: ORDER_PRC, ORDER_SIZE, QUOTIM_MS. */
+static const RsslFieldId orderFieldIds[] = { 3427, 3428, 3855 };
+#define ORDER_FIELD_COUNT (sizeof(orderFieldIds)/sizeof(RsslFieldId))
+
+static void exitOnFailure(RsslRet ret, const char *text)
+{
+	if (ret >= RSSL_RET_SUCCESS)
+		return;
+
+	printf("%s failed: %d (%s)\n", text, ret, cacheError.text);
+	exit(-1);
+}
+
+static void encodeMsgInit(RsslEncodeIterator *pIter, RsslBuffer *pBuffer, RsslUInt8 msgClass, RsslUInt8 domainType,
+		RsslContainerType containerType)
+{
+	RsslMsg msg;
+
+	rsslClearMsg(&msg);
+	msg.msgBase.msgClass = msgClass;
+	msg.msgBase.streamId = 5;
+	msg.msgBase.domainType = domainType;
+	msg.msgBase.containerType = containerType;
+	if (msgClass == RSSL_MC_REFRESH)
+	{
+		msg.refreshMsg.flags = RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_CLEAR_CACHE;
+		msg.refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+		msg.refreshMsg.state.dataState = RSSL_DATA_OK;
+	}
+
+	rsslClearEncodeIterator(pIter);
+	rsslSetEncodeIteratorBuffer(pIter, pBuffer);
+	exitOnFailure(rsslEncodeMsgInit(pIter, &msg, 0), "rsslEncodeMsgInit");
+}
+
+static void encodeMsgComplete(RsslEncodeIterator *pIter, RsslBuffer *pBuffer)
+{
+	exitOnFailure(rsslEncodeMsgComplete(pIter, RSSL_TRUE), "rsslEncodeMsgComplete");
+	pBuffer->length = rsslGetEncodedBufferLength(pIter);
+}
+
+static void encodeRealFields(RsslEncodeIterator *pIter, const RsslFieldId *fieldIds, RsslUInt32 fieldCount, RsslInt value)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslReal real;
+	RsslUInt32 i;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	exitOnFailure(rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0), "rsslEncodeFieldListInit");
+
+	for (i = 0; i < fieldCount; ++i)
+	{
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = fieldIds[i];
+		fieldEntry.dataType = RSSL_DT_REAL;
+		rsslClearReal(&real);
+		real.hint = RSSL_RH_EXPONENT_2;
+		real.value = value + i;
+		exitOnFailure(rsslEncodeFieldEntry(pIter, &fieldEntry, &real), "rsslEncodeFieldEntry");
+	}
+
+	exitOnFailure(rsslEncodeFieldListComplete(pIter, RSSL_TRUE), "rsslEncodeFieldListComplete");
+}
+
+static void encodeOrderMap(RsslBuffer *pBuffer, RsslUInt8 msgClass, RsslUInt32 firstOrder, RsslUInt32 count,
+		RsslMapEntryActions action, RsslInt value)
+{
+	RsslEncodeIterator eIter;
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	char keyData[32];
+	RsslBuffer key;
+	RsslUInt32 i;
+
+	encodeMsgInit(&eIter, pBuffer, msgClass, RSSL_DMT_MARKET_BY_ORDER, RSSL_DT_MAP);
+
+	rsslClearMap(&map);
+	map.keyPrimitiveType = RSSL_DT_BUFFER;
+	map.containerType = RSSL_DT_FIELD_LIST;
+	exitOnFailure(rsslEncodeMapInit(&eIter, &map, 0, 0), "rsslEncodeMapInit");
+
+	for (i = firstOrder; i < firstOrder + count; ++i)
+	{
+		key.data = keyData;
+		key.length = (RsslUInt32)snprintf(keyData, sizeof(keyData), "ORDER%u", i);
+		rsslClearMapEntry(&mapEntry);
+		mapEntry.action = action;
+		exitOnFailure(rsslEncodeMapEntryInit(&eIter, &mapEntry, &key, 0), "rsslEncodeMapEntryInit");
+		encodeRealFields(&eIter, orderFieldIds, (action == RSSL_MPEA_ADD_ENTRY) ? ORDER_FIELD_COUNT : 2, value);
+		exitOnFailure(rsslEncodeMapEntryComplete(&eIter, RSSL_TRUE), "rsslEncodeMapEntryComplete");
+	}
+
+	exitOnFailure(rsslEncodeMapComplete(&eIter, RSSL_TRUE), "rsslEncodeMapComplete");
+	encodeMsgComplete(&eIter, pBuffer);
+}
+
+static RsslRet applyMsg(RsslPayloadEntryHandle entry, RsslBuffer *pBuffer)
+{
+	RsslDecodeIterator dIter;
+	RsslMsg msg;
+	RsslRet ret;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
+	if ((ret = rsslDecodeMsg(&dIter, &msg)) < RSSL_RET_SUCCESS)
+		return ret;
+	return rsslPayloadEntryApply(entry, &dIter, &msg, &cacheError);
+}
+
+/* Retrieves the entry, in as many parts as the retrieve buffer size requires. Returns the number of parts. */
+static RsslUInt32 retrieveEntry(RsslPayloadEntryHandle entry, RsslPayloadCursorHandle cursor, char *pMemory)
+{
+	RsslEncodeIterator eIter;
+	RsslBuffer buffer;
+	RsslUInt32 partCount = 0;
+
+	rsslPayloadCursorClear(cursor);
+	do
+	{
+		buffer.data = pMemory;
+		buffer.length = retrieveBufferSize;
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+		exitOnFailure(rsslPayloadEntryRetrieve(entry, &eIter, cursor, &cacheError), "rsslPayloadEntryRetrieve");
+		++partCount;
+	} while (!rsslPayloadCursorIsComplete(cursor));
+
+	return partCount;
+}
+
+static void printRate(const char *name, RsslUInt32 count, RsslTimeValue startTime, RsslTimeValue endTime)
+{
+	double seconds = (double)(endTime - startTime) / 1000000000.0;
+
+	printf("  %-28s %10u in %8.3f sec: %12.0f/sec, %8.1f nsec each\n", name, count, seconds,
+			seconds > 0 ? (double)count / seconds : 0.0, seconds > 0 ? seconds * 1000000000.0 / count : 0.0);
+}
+
+static void runFieldListTest(RsslPayloadCacheHandle cache, char *pMsgMemory, char *pRetrieveMemory)
+{
+	RsslPayloadEntryHandle *entries;
+	RsslPayloadCursorHandle cursor = rsslPayloadCursorCreate();
+	RsslBuffer refreshMsg, updateMsgs[UPDATE_VARIANTS];
+	RsslEncodeIterator eIter;
+	RsslTimeValue startTime;
+	RsslUInt32 i;
+
+	printf("Field list: %u items, %u fields per refresh, %u fields per update\n",
+			itemCount, (RsslUInt32)PRICE_FIELD_COUNT, (RsslUInt32)PRICE_UPDATE_FIELD_COUNT);
+
+	if (!(entries = (RsslPayloadEntryHandle*)malloc(itemCount * sizeof(RsslPayloadEntryHandle))))
+		exitOnFailure(RSSL_RET_FAILURE, "malloc");
+
+	refreshMsg.data = pMsgMemory;
+	refreshMsg.length = 1024;
+	encodeMsgInit(&eIter, &refreshMsg, RSSL_MC_REFRESH, RSSL_DMT_MARKET_PRICE, RSSL_DT_FIELD_LIST);
+	encodeRealFields(&eIter, priceFieldIds, PRICE_FIELD_COUNT, 10000);
+	encodeMsgComplete(&eIter, &refreshMsg);
+
+	for (i = 0; i < UPDATE_VARIANTS; ++i)
+	{
+		updateMsgs[i].data = pMsgMemory + 1024 * (i + 1);
+		updateMsgs[i].length = 1024;
+		encodeMsgInit(&eIter, &updateMsgs[i], RSSL_MC_UPDATE, RSSL_DMT_MARKET_PRICE, RSSL_DT_FIELD_LIST);
+		encodeRealFields(&eIter, priceUpdateFieldIds, PRICE_UPDATE_FIELD_COUNT, 10000 + i * 100);
+		encodeMsgComplete(&eIter, &updateMsgs[i]);
+	}
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < itemCount; ++i)
+	{
+		if (!(entries[i] = rsslPayloadEntryCreate(cache, &cacheError)))
+			exitOnFailure(RSSL_RET_FAILURE, "rsslPayloadEntryCreate");
+		exitOnFailure(applyMsg(entries[i], &refreshMsg), "refresh apply");
+	}
+	printRate("create + refresh apply", itemCount, startTime, rsslGetTimeNano());
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterationCount; ++i)
+		exitOnFailure(applyMsg(entries[i % itemCount], &updateMsgs[i % UPDATE_VARIANTS]), "update apply");
+	printRate("update apply", iterationCount, startTime, rsslGetTimeNano());
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterationCount; ++i)
+		retrieveEntry(entries[i % itemCount], cursor, pRetrieveMemory);
+	printRate("retrieve", iterationCount, startTime, rsslGetTimeNano());
+
+	for (i = 0; i < itemCount; ++i)
+		rsslPayloadEntryDestroy(entries[i]);
+	free(entries);
+	rsslPayloadCursorDestroy(cursor);
+}
+
+static void runMapTest(RsslPayloadCacheHandle cache, char *pMsgMemory, char *pRetrieveMemory)
+{
+	RsslPayloadEntryHandle entry;
+	RsslPayloadCursorHandle cursor = rsslPayloadCursorCreate();
+	RsslBuffer msgBuffer, orderUpdateMsgs[ORDER_UPDATE_MSGS];
+	RsslTimeValue startTime;
+	RsslUInt32 i, partCount = 0, retrieveCount = iterationCount / orderCount + 1;
+	RsslUInt32 orderMsgCount = (orderCount + 99) / 100;
+
+	printf("Map: %u orders, %u byte retrieve buffer\n", orderCount, retrieveBufferSize);
+
+	if (!(entry = rsslPayloadEntryCreate(cache, &cacheError)))
+		exitOnFailure(RSSL_RET_FAILURE, "rsslPayloadEntryCreate");
+
+	/* Build the book 100 orders at a time. */
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < orderMsgCount; ++i)
+	{
+		RsslUInt32 count = (orderCount - i * 100 < 100) ? orderCount - i * 100 : 100;
+
+		msgBuffer.data = pMsgMemory;
+		msgBuffer.length = 65536;
+		encodeOrderMap(&msgBuffer, i ? RSSL_MC_UPDATE : RSSL_MC_REFRESH, i * 100, count, RSSL_MPEA_ADD_ENTRY, 20000);
+		exitOnFailure(applyMsg(entry, &msgBuffer), "order add apply");
+	}
+	printRate("order add apply", orderCount, startTime, rsslGetTimeNano());
+
+	/* Each update message changes one order; encode them up front. */
+	for (i = 0; i < ORDER_UPDATE_MSGS; ++i)
+	{
+		orderUpdateMsgs[i].data = pMsgMemory + 256 * i;
+		orderUpdateMsgs[i].length = 256;
+		encodeOrderMap(&orderUpdateMsgs[i], RSSL_MC_UPDATE, (i * 7919) % orderCount, 1, RSSL_MPEA_UPDATE_ENTRY, 20000 + i);
+	}
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterationCount; ++i)
+		exitOnFailure(applyMsg(entry, &orderUpdateMsgs[i % ORDER_UPDATE_MSGS]), "order update apply");
+	printRate("order update apply", iterationCount, startTime, rsslGetTimeNano());
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < retrieveCount; ++i)
+		partCount += retrieveEntry(entry, cursor, pRetrieveMemory);
+	printRate("book retrieve", retrieveCount, startTime, rsslGetTimeNano());
+	printf("  %u parts per retrieve\n", partCount / retrieveCount);
+
+	rsslPayloadEntryDestroy(entry);
+	rsslPayloadCursorDestroy(cursor);
+}
+
+int main(int argc, char **argv)
+{
+	RsslPayloadCacheConfigOptions config;
+	RsslPayloadCacheHandle cache;
+	char errorMemory[256];
+	RsslBuffer errorText = { sizeof(errorMemory), errorMemory };
+	char *pMsgMemory, *pRetrieveMemory;
+	int i;
+
+	for (i = 1; i < argc; ++i)
+	{
+		if (strcmp("-fdict", argv[i]) == 0 && i + 1 < argc)
+			snprintf(fieldDictionaryFileName, sizeof(fieldDictionaryFileName), "%s", argv[++i]);
+		else if (strcmp("-items", argv[i]) == 0 && i + 1 < argc)
+			itemCount = (RsslUInt32)atoi(argv[++i]);
+		else if (strcmp("-iterations", argv[i]) == 0 && i + 1 < argc)
+			iterationCount = (RsslUInt32)atoi(argv[++i]);
+		else if (strcmp("-orders", argv[i]) == 0 && i + 1 < argc)
+			orderCount = (RsslUInt32)atoi(argv[++i]);
+		else if (strcmp("-bufSize", argv[i]) == 0 && i + 1 < argc)
+			retrieveBufferSize = (RsslUInt32)atoi(argv[++i]);
+		else
+		{
+			printf("Usage: %s [-fdict <field dictionary>] [-items <count>] [-iterations <count>] [-orders <count>] [-bufSize <bytes>]\n"
+					"  -fdict      Field dictionary file (default RDMFieldDictionary)\n"
+					"  -items      Number of MarketPrice entries (default 1000)\n"
+					"  -iterations Number of updates applied and entries retrieved (default 1000000)\n"
+					"  -orders     Number of orders in the MarketByOrder entry (default 1000)\n"
+					"  -bufSize    Size of the retrieve buffer (default 6144)\n", argv[0]);
+			return -1;
+		}
+	}
+
+	if (itemCount == 0 || iterationCount == 0 || orderCount == 0 || retrieveBufferSize == 0)
+	{
+		printf("Counts and buffer size must be greater than zero.\n");
+		return -1;
+	}
+
+	rsslClearDataDictionary(&dictionary);
+	if (rsslLoadFieldDictionary(fieldDictionaryFileName, &dictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to load field dictionary %s: %.*s\n", fieldDictionaryFileName, errorText.length, errorText.data);
+		return -1;
+	}
+
+	pMsgMemory = (char*)malloc(65536);
+	pRetrieveMemory = (char*)malloc(retrieveBufferSize);
+	if (!pMsgMemory || !pRetrieveMemory)
+		exitOnFailure(RSSL_RET_FAILURE, "malloc");
+
+	exitOnFailure(rsslPayloadCacheInitialize(), "rsslPayloadCacheInitialize");
+	config.maxItems = 0;
+	if (!(cache = rsslPayloadCacheCreate(&config, &cacheError)))
+		exitOnFailure(RSSL_RET_FAILURE, "rsslPayloadCacheCreate");
+	exitOnFailure(rsslPayloadCacheSetDictionary(cache, &dictionary, "CachePerf", &cacheError), "rsslPayloadCacheSetDictionary");
+
+	runFieldListTest(cache, pMsgMemory, pRetrieveMemory);
+	runMapTest(cache, pMsgMemory, pRetrieveMemory);
+
+	rsslPayloadCacheDestroy(cache);
+	rsslPayloadCacheUninitialize();
+	rsslDeleteDataDictionary(&dictionary);
+	free(pMsgMemory);
+	free(pRetrieveMemory);
+	return 0;
+}
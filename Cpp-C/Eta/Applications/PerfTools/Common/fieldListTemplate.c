@@ -0,0 +1,203 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#include "fieldListTemplate.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Scratch space for encoding one patched value, with its field list header and FID. */
+#define FIELD_LIST_TEMPLATE_MAX_VALUE_LENGTH 32
+
+/* Only primitives with a small maximum encoded size can be patched, so a
+ * replacement value always fits the scratch space. */
+static RsslBool fieldListTemplateCanPatch(RsslUInt8 dataType)
+{
+	switch(dataType)
+	{
+		case RSSL_DT_INT:
+		case RSSL_DT_UINT:
+		case RSSL_DT_FLOAT:
+		case RSSL_DT_DOUBLE:
+		case RSSL_DT_REAL:
+		case RSSL_DT_DATE:
+		case RSSL_DT_TIME:
+		case RSSL_DT_DATETIME:
+		case RSSL_DT_ENUM:
+			return RSSL_TRUE;
+		default:
+			return RSSL_FALSE;
+	}
+}
+
+RsslRet fieldListTemplateCompile(FieldListTemplate *pTemplate, RsslBuffer *pEncodedList, RsslFieldSetDefDb *pGlobalSetDb)
+{
+	RsslDecodeIterator dIter;
+	RsslFieldList fList;
+	RsslFieldEntry fEntry;
+	RsslInt32 entryCount = 0, setEntryCount = 0, i;
+	RsslUInt32 position;
+	char *memory;
+	RsslRet ret;
+
+	clearFieldListTemplate(pTemplate);
+
+	/* Count the entries, and check the list carries no local set data. */
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorGlobalFieldListSetDB(&dIter, pGlobalSetDb);
+	rsslSetDecodeIteratorBuffer(&dIter, pEncodedList);
+	if ((ret = rsslDecodeFieldList(&dIter, &fList, NULL)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (fList.flags & ~(RSSL_FLF_HAS_STANDARD_DATA | RSSL_FLF_HAS_SET_DATA | RSSL_FLF_HAS_SET_ID))
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (rsslFieldListCheckHasSetData(&fList))
+	{
+		/* Set-defined entries are copied as they are and cannot be patched. */
+		if (!pGlobalSetDb || fList.setId <= RSSL_FIELD_SET_MAX_LOCAL_ID || !pGlobalSetDb->definitions[fList.setId])
+			return RSSL_RET_SET_DEF_NOT_PROVIDED;
+		setEntryCount = pGlobalSetDb->definitions[fList.setId]->count;
+	}
+
+	while ((ret = rsslDecodeFieldEntry(&dIter, &fEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+		++entryCount;
+	}
+	entryCount -= setEntryCount;
+
+	if (!(memory = (char*)malloc(entryCount * sizeof(FieldListTemplateEntry) + pEncodedList->length)))
+		return RSSL_RET_FAILURE;
+
+	pTemplate->entries = (FieldListTemplateEntry*)memory;
+	pTemplate->entryCount = entryCount;
+	pTemplate->encodedList.data = memory + entryCount * sizeof(FieldListTemplateEntry);
+	pTemplate->encodedList.length = pEncodedList->length;
+	memcpy(pTemplate->encodedList.data, pEncodedList->data, pEncodedList->length);
+
+	/* Standard entries end the field list back to back, each a two-byte FID and a
+	 * length-prefixed value, so the first of them starts wherever the sum of the
+	 * entry sizes says it does. */
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorGlobalFieldListSetDB(&dIter, pGlobalSetDb);
+	rsslSetDecodeIteratorBuffer(&dIter, &pTemplate->encodedList);
+	rsslDecodeFieldList(&dIter, &fList, NULL);
+
+	for(i = 0; i < setEntryCount; ++i)
+		rsslDecodeFieldEntry(&dIter, &fEntry);
+
+	position = pTemplate->encodedList.length;
+	for(i = 0; rsslDecodeFieldEntry(&dIter, &fEntry) != RSSL_RET_END_OF_CONTAINER; ++i)
+	{
+		pTemplate->entries[i].fieldId = fEntry.fieldId;
+		pTemplate->entries[i].valueLength = fEntry.encData.length + ((fEntry.encData.length < 0xFE) ? 1 : 3);
+		position -= 2 + pTemplate->entries[i].valueLength;
+	}
+
+	for(i = 0; i < entryCount; ++i)
+	{
+		pTemplate->entries[i].valueOffset = position + 2;
+		position += 2 + pTemplate->entries[i].valueLength;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet fieldListTemplateEncode(RsslEncodeIterator *pIter, FieldListTemplate *pTemplate,
+		FieldListTemplatePatch *patches, RsslInt32 patchCount)
+{
+	char values[FIELD_LIST_TEMPLATE_MAX_PATCHES][FIELD_LIST_TEMPLATE_MAX_VALUE_LENGTH];
+	RsslUInt32 valueOffsets[FIELD_LIST_TEMPLATE_MAX_PATCHES];
+	RsslUInt32 valueLengths[FIELD_LIST_TEMPLATE_MAX_PATCHES];
+	RsslUInt32 totalLength = pTemplate->encodedList.length, copied = 0;
+	RsslInt32 i, lastIndex = -1;
+	RsslBuffer outBuffer;
+	char *out;
+	RsslRet ret;
+
+	if (patchCount > FIELD_LIST_TEMPLATE_MAX_PATCHES)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* Encode the replacement values first so the final length is known. */
+	for(i = 0; i < patchCount; ++i)
+	{
+		FieldListTemplateEntry *pEntry;
+		RsslEncodeIterator valueIter;
+		RsslBuffer valueBuffer;
+		RsslFieldList fList;
+		RsslFieldEntry fEntry;
+		RsslUInt32 valueStart;
+
+		if (patches[i].entryIndex <= lastIndex || patches[i].entryIndex >= pTemplate->entryCount)
+			return RSSL_RET_INVALID_ARGUMENT;
+		lastIndex = patches[i].entryIndex;
+
+		pEntry = &pTemplate->entries[lastIndex];
+		if (!fieldListTemplateCanPatch(patches[i].dataType))
+			return RSSL_RET_INVALID_ARGUMENT;
+
+		/* Encode the value as the only entry of a scratch field list, exactly as
+		 * rsslEncodeFieldEntry() would write it, and keep the bytes after its FID. */
+		rsslClearEncodeIterator(&valueIter);
+		valueBuffer.data = values[i];
+		valueBuffer.length = FIELD_LIST_TEMPLATE_MAX_VALUE_LENGTH;
+		rsslSetEncodeIteratorBuffer(&valueIter, &valueBuffer);
+
+		rsslClearFieldList(&fList);
+		fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+		if ((ret = rsslEncodeFieldListInit(&valueIter, &fList, 0, 0)) < RSSL_RET_SUCCESS)
+			return ret;
+		valueStart = rsslGetEncodedBufferLength(&valueIter) + 2;
+
+		rsslClearFieldEntry(&fEntry);
+		fEntry.fieldId = pEntry->fieldId;
+		fEntry.dataType = patches[i].dataType;
+		if ((ret = rsslEncodeFieldEntry(&valueIter, &fEntry, patches[i].pValue)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		valueOffsets[i] = valueStart;
+		valueLengths[i] = rsslGetEncodedBufferLength(&valueIter) - valueStart;
+
+		totalLength = totalLength - pEntry->valueLength + valueLengths[i];
+	}
+
+	if ((ret = rsslEncodeNonRWFDataTypeInit(pIter, &outBuffer)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (outBuffer.length < totalLength)
+	{
+		rsslEncodeNonRWFDataTypeComplete(pIter, &outBuffer, RSSL_FALSE);
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	/* Copy the template, splicing each new value in place of the old one. */
+	out = outBuffer.data;
+	for(i = 0; i < patchCount; ++i)
+	{
+		FieldListTemplateEntry *pEntry = &pTemplate->entries[patches[i].entryIndex];
+		RsslUInt32 length = pEntry->valueOffset - copied;
+
+		memcpy(out, pTemplate->encodedList.data + copied, length);
+		out += length;
+		memcpy(out, values[i] + valueOffsets[i], valueLengths[i]);
+		out += valueLengths[i];
+		copied = pEntry->valueOffset + pEntry->valueLength;
+	}
+	memcpy(out, pTemplate->encodedList.data + copied, pTemplate->encodedList.length - copied);
+
+	outBuffer.length = totalLength;
+	return rsslEncodeNonRWFDataTypeComplete(pIter, &outBuffer, RSSL_TRUE);
+}
+
+void fieldListTemplateCleanup(FieldListTemplate *pTemplate)
+{
+	/* entries and encodedList share one allocation, starting at entries. */
+	free(pTemplate->entries);
+	clearFieldListTemplate(pTemplate);
+}
@@ -0,0 +1,71 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+/* fieldListTemplate.h
+ * Precompiled field list encodings. A template is compiled once from a field list
+ * encoded with the normal encoder, recording the position of every entry's value.
+ * Each later encode copies the template into the message buffer and splices in
+ * any values that change, so the output is byte-identical to encoding the
+ * same fields with rsslEncodeFieldEntry() but costs little more than a memcpy. */
+
+#ifndef _FIELD_LIST_TEMPLATE_H
+#define _FIELD_LIST_TEMPLATE_H
+
+#include "rtr/rsslMessagePackage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Largest number of values that can be patched in one encode. */
+#define FIELD_LIST_TEMPLATE_MAX_PATCHES 8
+
+/* Location of one standard entry's value within a template. */
+typedef struct {
+	RsslFieldId		fieldId;
+	RsslUInt32		valueOffset;	/* Offset of the entry's value, starting at its length. */
+	RsslUInt32		valueLength;	/* Size of the value in the template, including its length. */
+} FieldListTemplateEntry;
+
+/* A precompiled field list. */
+typedef struct {
+	RsslBuffer				encodedList;	/* The field list as encoded by the normal encoder. */
+	RsslInt32				entryCount;		/* Number of standard entries in the field list. */
+	FieldListTemplateEntry	*entries;		/* Value locations of the standard entries, in entry order. */
+} FieldListTemplate;
+
+/* A value to splice into a template when encoding it. */
+typedef struct {
+	RsslInt32	entryIndex;		/* Index of the standard entry to replace. Patches must be in ascending entry order. */
+	RsslUInt8	dataType;		/* Type of the value. Must be a primitive of fixed maximum size, e.g. UINT, INT, REAL, DATE, TIME. */
+	void		*pValue;		/* Value of dataType, or NULL to encode the entry as blank. */
+} FieldListTemplatePatch;
+
+RTR_C_INLINE void clearFieldListTemplate(FieldListTemplate *pTemplate)
+{
+	memset(pTemplate, 0, sizeof(FieldListTemplate));
+}
+
+/* Copies an encoded field list into a template and records where each standard entry's value sits.
+ * If the list starts with set data, its set definition must be in pGlobalSetDb; the set-defined
+ * entries are copied as they are and cannot be patched. */
+RsslRet fieldListTemplateCompile(FieldListTemplate *pTemplate, RsslBuffer *pEncodedList, RsslFieldSetDefDb *pGlobalSetDb);
+
+/* Writes the template into the iterator's current container, replacing the values
+ * of the patched entries. The iterator must be positioned where a field list
+ * would be encoded, e.g. after rsslEncodeMsgInit() returned RSSL_RET_ENCODE_CONTAINER. */
+RsslRet fieldListTemplateEncode(RsslEncodeIterator *pIter, FieldListTemplate *pTemplate,
+		FieldListTemplatePatch *patches, RsslInt32 patchCount);
+
+/* Frees memory held by a template. */
+void fieldListTemplateCleanup(FieldListTemplate *pTemplate);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,139 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#include "fieldSetDefAnalyzer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Largest number of entries a set definition can hold. */
+#define FIELD_SET_DEF_MAX_ENTRIES 255
+
+static FieldSetDefLayout *findLayout(FieldSetDefAnalyzer *pAnalyzer, RsslFieldSetDefEntry *pEntries, RsslInt32 count)
+{
+	RsslInt32 i, j;
+
+	for(i = 0; i < pAnalyzer->layoutCount; ++i)
+	{
+		FieldSetDefLayout *pLayout = &pAnalyzer->layouts[i];
+
+		if (pLayout->setDef.count != count)
+			continue;
+
+		for(j = 0; j < count; ++j)
+		{
+			if (pLayout->setDef.pEntries[j].fieldId != pEntries[j].fieldId
+					|| pLayout->setDef.pEntries[j].dataType != pEntries[j].dataType)
+				break;
+		}
+
+		if (j == count)
+			return pLayout;
+	}
+
+	return NULL;
+}
+
+/* Sorts layouts by descending use, then by the order they were first seen. */
+static int compareLayouts(const void *pLeft, const void *pRight)
+{
+	const FieldSetDefLayout *pLeftLayout = (const FieldSetDefLayout*)pLeft;
+	const FieldSetDefLayout *pRightLayout = (const FieldSetDefLayout*)pRight;
+
+	if (pLeftLayout->useCount != pRightLayout->useCount)
+		return (pLeftLayout->useCount > pRightLayout->useCount) ? -1 : 1;
+
+	return pLeftLayout->order - pRightLayout->order;
+}
+
+RsslRet fieldSetDefAnalyzerAddLayout(FieldSetDefAnalyzer *pAnalyzer, RsslFieldSetDefEntry *pEntries, RsslInt32 count)
+{
+	FieldSetDefLayout *pLayout;
+
+	if (count < FIELD_SET_DEF_ANALYZER_MIN_ENTRIES || count > FIELD_SET_DEF_MAX_ENTRIES)
+		return RSSL_RET_SUCCESS;
+
+	if ((pLayout = findLayout(pAnalyzer, pEntries, count)))
+	{
+		++pLayout->useCount;
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (pAnalyzer->layoutCount == pAnalyzer->layoutMax)
+	{
+		RsslInt32 layoutMax = pAnalyzer->layoutMax ? pAnalyzer->layoutMax * 2 : 16;
+		FieldSetDefLayout *layouts = (FieldSetDefLayout*)realloc(pAnalyzer->layouts, layoutMax * sizeof(FieldSetDefLayout));
+
+		if (!layouts)
+			return RSSL_RET_FAILURE;
+
+		pAnalyzer->layouts = layouts;
+		pAnalyzer->layoutMax = layoutMax;
+	}
+
+	pLayout = &pAnalyzer->layouts[pAnalyzer->layoutCount];
+	if (!(pLayout->setDef.pEntries = (RsslFieldSetDefEntry*)malloc(count * sizeof(RsslFieldSetDefEntry))))
+		return RSSL_RET_FAILURE;
+
+	memcpy(pLayout->setDef.pEntries, pEntries, count * sizeof(RsslFieldSetDefEntry));
+	pLayout->setDef.count = (RsslUInt8)count;
+	pLayout->setDef.setId = 0;
+	pLayout->useCount = 1;
+	pLayout->order = pAnalyzer->layoutCount++;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet fieldSetDefAnalyzerBuildDb(FieldSetDefAnalyzer *pAnalyzer, RsslFieldSetDefDb *pSetDefDb, RsslInt32 maxSetDefs)
+{
+	RsslBuffer version = RSSL_INIT_BUFFER;
+	RsslInt32 i;
+	RsslRet ret;
+
+	if (maxSetDefs > RSSL_MAX_GLOBAL_SET_ID - RSSL_FIELD_SET_MAX_LOCAL_ID)
+		maxSetDefs = RSSL_MAX_GLOBAL_SET_ID - RSSL_FIELD_SET_MAX_LOCAL_ID;
+
+	qsort(pAnalyzer->layouts, pAnalyzer->layoutCount, sizeof(FieldSetDefLayout), compareLayouts);
+
+	rsslClearFieldSetDb(pSetDefDb);
+	if ((ret = rsslAllocateFieldSetDefDb(pSetDefDb, &version)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Global set IDs start after the range reserved for local set definitions. */
+	for(i = 0; i < pAnalyzer->layoutCount && i < maxSetDefs; ++i)
+	{
+		pAnalyzer->layouts[i].setDef.setId = (RsslUInt16)(RSSL_FIELD_SET_MAX_LOCAL_ID + 1 + i);
+		if ((ret = rsslAddFieldSetDefToDb(pSetDefDb, &pAnalyzer->layouts[i].setDef)) != RSSL_RET_SUCCESS)
+		{
+			rsslDeleteFieldSetDefDb(pSetDefDb);
+			return ret;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslUInt16 fieldSetDefAnalyzerGetSetId(FieldSetDefAnalyzer *pAnalyzer, RsslFieldSetDefEntry *pEntries, RsslInt32 count)
+{
+	FieldSetDefLayout *pLayout;
+
+	if (count < FIELD_SET_DEF_ANALYZER_MIN_ENTRIES || count > FIELD_SET_DEF_MAX_ENTRIES)
+		return 0;
+
+	return (pLayout = findLayout(pAnalyzer, pEntries, count)) ? pLayout->setDef.setId : 0;
+}
+
+void fieldSetDefAnalyzerCleanup(FieldSetDefAnalyzer *pAnalyzer)
+{
+	RsslInt32 i;
+
+	for(i = 0; i < pAnalyzer->layoutCount; ++i)
+		free(pAnalyzer->layouts[i].setDef.pEntries);
+
+	free(pAnalyzer->layouts);
+	clearFieldSetDefAnalyzer(pAnalyzer);
+}
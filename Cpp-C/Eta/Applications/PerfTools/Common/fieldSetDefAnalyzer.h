@@ -0,0 +1,65 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+/* fieldSetDefAnalyzer.h
+ * Learns which field list layouts are used most often and builds a global
+ * set definition database from them. Field lists that match one of the
+ * definitions can then be encoded as set-defined data, which leaves out the
+ * field ID of every entry in the set. */
+
+#ifndef _FIELD_SET_DEF_ANALYZER_H
+#define _FIELD_SET_DEF_ANALYZER_H
+
+#include "rtr/rsslMessagePackage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Layouts with fewer entries than this are not worth a set definition, since the
+ * set ID and set length can cost as much as the field IDs they save. */
+#define FIELD_SET_DEF_ANALYZER_MIN_ENTRIES 3
+
+/* One layout seen by the analyzer. */
+typedef struct {
+	RsslFieldSetDef	setDef;		/* Field IDs and types of the layout. setId is 0 until a definition is assigned. */
+	RsslUInt32		useCount;	/* Number of field lists seen with this layout. */
+	RsslInt32		order;		/* Order in which the layout was first seen, used to break ties. */
+} FieldSetDefLayout;
+
+/* Counts field list layouts. */
+typedef struct {
+	RsslInt32			layoutCount;	/* Number of distinct layouts seen. */
+	RsslInt32			layoutMax;		/* Size of the layouts array. */
+	FieldSetDefLayout	*layouts;		/* Layouts seen so far. */
+} FieldSetDefAnalyzer;
+
+RTR_C_INLINE void clearFieldSetDefAnalyzer(FieldSetDefAnalyzer *pAnalyzer)
+{
+	memset(pAnalyzer, 0, sizeof(FieldSetDefAnalyzer));
+}
+
+/* Counts one field list with the given entries. Layouts too short or too long for a
+ * set definition are ignored. */
+RsslRet fieldSetDefAnalyzerAddLayout(FieldSetDefAnalyzer *pAnalyzer, RsslFieldSetDefEntry *pEntries, RsslInt32 count);
+
+/* Assigns global set IDs to the most used layouts, up to maxSetDefs of them, and
+ * allocates pSetDefDb with their definitions. Release the database with
+ * rsslDeleteFieldSetDefDb(). */
+RsslRet fieldSetDefAnalyzerBuildDb(FieldSetDefAnalyzer *pAnalyzer, RsslFieldSetDefDb *pSetDefDb, RsslInt32 maxSetDefs);
+
+/* Returns the global set ID assigned to the given layout, or 0 if it has none. */
+RsslUInt16 fieldSetDefAnalyzerGetSetId(FieldSetDefAnalyzer *pAnalyzer, RsslFieldSetDefEntry *pEntries, RsslInt32 count);
+
+/* Frees memory held by the analyzer. Databases built from it are not affected. */
+void fieldSetDefAnalyzerCleanup(FieldSetDefAnalyzer *pAnalyzer);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -64,7 +64,8 @@ RsslInt32 getMarketPriceGenMsgCount()
 }
 
 
-RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpMsg,
+/* Encodes the fields of a MarketPrice message one entry at a time. */
+static RsslRet encodeMarketPriceFields(RsslEncodeIterator *pIter, MarketPriceMsg *mpMsg,
 		RsslMsgClasses msgClass, RsslUInt encodeStartTime)
 {
 	RsslFieldList fList;
@@ -72,12 +73,21 @@ RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpM
 	RsslInt32 i;
 	RsslRet ret;
 
-	assert(!(msgClass == RSSL_MC_REFRESH && encodeStartTime));
-
 	/* encode field list */
 	rsslClearFieldList(&fList);
 	rsslClearFieldEntry(&fEntry);
-	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if (mpMsg->setId)
+	{
+		/* The fields match a global set definition, so encode them as set data.
+		 * Only the latency fields, if any, follow as standard data. */
+		rsslSetEncodeIteratorGlobalFieldListSetDB(pIter, xmlMarketPriceMsgs.setDefDb);
+		fList.flags = RSSL_FLF_HAS_SET_DATA | RSSL_FLF_HAS_SET_ID;
+		fList.setId = mpMsg->setId;
+		if (msgClass == RSSL_MC_REFRESH || encodeStartTime)
+			fList.flags |= RSSL_FLF_HAS_STANDARD_DATA;
+	}
+	else
+		fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
 	if ((ret = rsslEncodeFieldListInit(pIter, &fList, 0, 0)) < RSSL_RET_SUCCESS)
 		return ret;
 
@@ -127,6 +137,90 @@ RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpM
 	return RSSL_RET_SUCCESS;
 }
 
+RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpMsg,
+		RsslMsgClasses msgClass, RsslUInt encodeStartTime)
+{
+	assert(!(msgClass == RSSL_MC_REFRESH && encodeStartTime));
+
+	if (encodeStartTime)
+	{
+		FieldListTemplate *pTemplate = &mpMsg->latencyTemplate;
+		RsslFieldId latencyFid = (msgClass == RSSL_MC_GENERIC) ? TIM_TRK_3_FID : (msgClass == RSSL_MC_POST) ? TIM_TRK_2_FID : TIM_TRK_1_FID;
+
+		/* The latency timestamp is the last entry of the template. */
+		if (pTemplate->encodedList.data && pTemplate->entryCount > 0
+				&& pTemplate->entries[pTemplate->entryCount - 1].fieldId == latencyFid)
+		{
+			FieldListTemplatePatch patch;
+
+			patch.entryIndex = pTemplate->entryCount - 1;
+			patch.dataType = RSSL_DT_UINT;
+			patch.pValue = &encodeStartTime;
+			return fieldListTemplateEncode(pIter, pTemplate, &patch, 1);
+		}
+	}
+	else if (mpMsg->dataTemplate.encodedList.data)
+		return fieldListTemplateEncode(pIter, &mpMsg->dataTemplate, NULL, 0);
+
+	return encodeMarketPriceFields(pIter, mpMsg, msgClass, encodeStartTime);
+}
+
+/* Encodes the fields of a message one entry at a time and compiles the result into a template. */
+static RsslRet compileMarketPriceTemplate(FieldListTemplate *pTemplate, MarketPriceMsg *mpMsg,
+		RsslMsgClasses msgClass, RsslUInt encodeStartTime)
+{
+	RsslEncodeIterator eIter;
+	RsslBuffer buffer;
+	RsslUInt32 bufferSize = mpMsg->estimatedContentLength + 64;
+	RsslRet ret;
+
+	for(;;)
+	{
+		if (!(buffer.data = (char*)malloc(bufferSize)))
+			return RSSL_RET_FAILURE;
+		buffer.length = bufferSize;
+
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+		if ((ret = encodeMarketPriceFields(&eIter, mpMsg, msgClass, encodeStartTime)) != RSSL_RET_BUFFER_TOO_SMALL)
+			break;
+
+		free(buffer.data);
+		bufferSize *= 2;
+	}
+
+	if (ret == RSSL_RET_SUCCESS)
+	{
+		buffer.length = rsslGetEncodedBufferLength(&eIter);
+		ret = fieldListTemplateCompile(pTemplate, &buffer, xmlMarketPriceMsgs.setDefDb);
+	}
+
+	free(buffer.data);
+	return ret;
+}
+
+RsslRet compileMarketPriceMsgTemplates(MarketPriceMsg *mpMsg, RsslMsgClasses msgClass)
+{
+	RsslRet ret;
+
+	if ((ret = compileMarketPriceTemplate(&mpMsg->dataTemplate, mpMsg, msgClass, 0)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Refreshes never carry a latency timestamp. Any nonzero placeholder adds the
+	 * latency entry, whose value is replaced on every encode. */
+	if (msgClass != RSSL_MC_REFRESH
+			&& (ret = compileMarketPriceTemplate(&mpMsg->latencyTemplate, mpMsg, msgClass, 1)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	return RSSL_RET_SUCCESS;
+}
+
+void cleanupMarketPriceMsgTemplates(MarketPriceMsg *mpMsg)
+{
+	fieldListTemplateCleanup(&mpMsg->dataTemplate);
+	fieldListTemplateCleanup(&mpMsg->latencyTemplate);
+}
+
 MarketPriceItem *createMarketPriceItem()
 {
 	MarketPriceItem* pMpItem = (MarketPriceItem*)malloc(sizeof(MarketPriceItem));
@@ -30,6 +30,13 @@ typedef struct {
 RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpMsg,
 		RsslMsgClasses msgClass, RsslUInt encodeStartTime);
 
+/* Precompiles the field list templates of a MarketPrice message, so that encodeMarketPriceDataBody()
+ * only needs to copy them and patch in the latency timestamp. */
+RsslRet compileMarketPriceMsgTemplates(MarketPriceMsg *mpMsg, RsslMsgClasses msgClass);
+
+/* Frees the field list templates of a MarketPrice message. */
+void cleanupMarketPriceMsgTemplates(MarketPriceMsg *mpMsg);
+
 /* Clears a MarketPriceItem. */
 RTR_C_INLINE void clearMarketPriceItem(MarketPriceItem* itemInfo)
 {
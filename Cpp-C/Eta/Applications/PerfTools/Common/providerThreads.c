@@ -55,6 +55,7 @@ void clearProviderThreadConfig()
 	providerThreadConfig.takeMCastStats = RSSL_FALSE;
 	providerThreadConfig.nanoTime = RSSL_FALSE;
 	providerThreadConfig.measureEncode = RSSL_FALSE;
+	providerThreadConfig.globalSetDefs = RSSL_FALSE;
 }
 
 void providerThreadConfigInit()
@@ -167,7 +168,7 @@ void providerThreadConfigInit()
 	}
 
 
-	if (xmlMsgDataInit(providerThreadConfig.msgFilename) != RSSL_RET_SUCCESS)
+	if (xmlMsgDataInit(providerThreadConfig.msgFilename, providerThreadConfig.globalSetDefs) != RSSL_RET_SUCCESS)
 		exit(-1);
 
 	directoryServiceInit();
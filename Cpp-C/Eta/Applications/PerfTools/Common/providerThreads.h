@@ -72,6 +72,7 @@ typedef struct
 	RsslBool	nanoTime;   				/* Configures timestamp format. */
 	RsslBool	measureEncode;				/* Measure time to encode messages(-measureEncode) */
 	RsslBool	measureDecode;				/* Measure time to decode latency updates (-measureDecode) */
+	RsslBool	globalSetDefs;				/* Learn global set definitions from the message file(-globalSetDefs) */
 
 	RsslInt32	*threadBindList;			/* List of CPU ID's to bind threads to */
 	RsslInt32	threadCount;				/* Number of provider threads to create. */
@@ -7,6 +7,7 @@
 
 #include "statistics.h"
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #ifdef WIN32
 #include <windows.h>
@@ -276,3 +277,107 @@ RsslRet getResourceUsageStats(ResourceUsageStats *pStats)
 
 	return RSSL_RET_SUCCESS;
 }
+
+static const char *latencyTraceStageNames[RSSL_LT_STAGE_COUNT] =
+{
+	"Socket receive",
+	"Decompress",
+	"Transport read",
+	"Reactor event",
+	"Watchlist fanout",
+	"User callback"
+};
+
+RsslRet latencyTraceHistogramInit(LatencyTraceHistogram *pHist, RsslUInt32 maxSamples)
+{
+	int i;
+
+	memset(pHist, 0, sizeof(LatencyTraceHistogram));
+	for(i = 0; i < RSSL_LT_STAGE_COUNT; ++i)
+		clearValueStatistics(&pHist->stageStats[i]);
+
+	if (!(pHist->_samples = (RsslLatencyTraceSample*)malloc(maxSamples * sizeof(RsslLatencyTraceSample))))
+		return RSSL_RET_FAILURE;
+	pHist->_maxSamples = maxSamples;
+
+	return RSSL_RET_SUCCESS;
+}
+
+void latencyTraceHistogramCleanup(LatencyTraceHistogram *pHist)
+{
+	free(pHist->_samples);
+	pHist->_samples = NULL;
+}
+
+void latencyTraceHistogramCollect(LatencyTraceHistogram *pHist)
+{
+	RsslUInt32 count, i;
+
+	do
+	{
+		count = rsslLatencyTraceDrain(pHist->_samples, pHist->_maxSamples);
+
+		for(i = 0; i < count; ++i)
+		{
+			RsslLatencyTraceSample *pSample = &pHist->_samples[i];
+			RsslUInt64 stageNsec;
+			int bucket;
+
+			if (pSample->threadIndex >= LATENCY_TRACE_MAX_THREADS || pSample->stage >= RSSL_LT_STAGE_COUNT)
+				continue;
+
+			/* Samples from one thread are drained in order, so the previous stamp of this message is the
+			 * last sample seen from the thread. */
+			if (pHist->_lastMsgId[pSample->threadIndex] == pSample->msgId)
+			{
+				if (pSample->timeNsec < pHist->_lastTimeNsec[pSample->threadIndex])
+					++pHist->outOfOrderCount;
+				else
+				{
+					stageNsec = pSample->timeNsec - pHist->_lastTimeNsec[pSample->threadIndex];
+
+					for(bucket = 0; bucket < LATENCY_TRACE_BUCKETS - 1 && (stageNsec >> (bucket + 1)); ++bucket);
+					++pHist->buckets[pSample->stage][bucket];
+					updateValueStatistics(&pHist->stageStats[pSample->stage], (double)stageNsec / 1000.0);
+				}
+			}
+
+			pHist->_lastMsgId[pSample->threadIndex] = pSample->msgId;
+			pHist->_lastTimeNsec[pSample->threadIndex] = pSample->timeNsec;
+		}
+	} while (count == pHist->_maxSamples);
+}
+
+void printLatencyTraceHistogram(FILE *file, LatencyTraceHistogram *pHist)
+{
+	int stage, bucket;
+
+	fprintf(file, "Latency Trace (time since previous stage):\n");
+
+	for(stage = 0; stage < RSSL_LT_STAGE_COUNT; ++stage)
+	{
+		ValueStatistics *pStats = &pHist->stageStats[stage];
+
+		if (!pStats->count)
+			continue;
+
+		fprintf(file, "  %s (usec): Avg:%8.3f StdDev:%8.3f Max:%8.3f Min:%8.3f, Samples: %llu\n",
+				latencyTraceStageNames[stage], pStats->average, sqrt(pStats->variance),
+				pStats->maxValue, pStats->minValue, pStats->count);
+
+		for(bucket = 0; bucket < LATENCY_TRACE_BUCKETS; ++bucket)
+		{
+			if (pHist->buckets[stage][bucket])
+				fprintf(file, "    %10llu - %10llu nsec: %llu (%.2f%%)\n",
+						(bucket ? 1ULL << bucket : 0ULL), (1ULL << (bucket + 1)) - 1, pHist->buckets[stage][bucket],
+						(double)pHist->buckets[stage][bucket] * 100.0 / (double)pStats->count);
+		}
+	}
+
+	if (pHist->outOfOrderCount)
+		fprintf(file, "  Out of order stamps: %llu\n", pHist->outOfOrderCount);
+	if (rsslLatencyTraceDroppedCount())
+		fprintf(file, "  Dropped samples: %llu\n", rsslLatencyTraceDroppedCount());
+
+	fprintf(file, "\n");
+}
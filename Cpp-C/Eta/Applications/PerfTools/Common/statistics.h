@@ -16,6 +16,7 @@
 #include "rtr/rsslThread.h"
 #include "rtr/rsslTypes.h"
 #include "rtr/rsslRetCodes.h"
+#include "rtr/rsslLatencyTrace.h"
 
 #include <float.h>
 
@@ -157,6 +158,37 @@ RsslRet initResourceUsageStats(ResourceUsageStats *pStats);
 /* Calculates Resource Usage since the last call to this function.  */
 RsslRet getResourceUsageStats(ResourceUsageStats *pStats);
 
+/*** Latency Trace Histograms. ***/
+
+/* Collects the samples recorded by rsslLatencyTrace into a log2 histogram per stage.
+ * The time for a stage is the time since the previous stamp of the same message. */
+
+#define LATENCY_TRACE_BUCKETS 32		/* Bucket n counts stage times in [2^n, 2^(n+1)) nanoseconds; bucket 0 includes 0. */
+#define LATENCY_TRACE_MAX_THREADS 64	/* Samples from threads past this are ignored. */
+
+typedef struct {
+	RsslUInt64				buckets[RSSL_LT_STAGE_COUNT][LATENCY_TRACE_BUCKETS];
+	ValueStatistics			stageStats[RSSL_LT_STAGE_COUNT];		/* Stage times, in microseconds. */
+	RsslUInt64				outOfOrderCount;	/* Stamps earlier than the previous stamp, e.g. from an unsynchronized NIC clock. */
+
+	RsslLatencyTraceSample	*_samples;
+	RsslUInt32				_maxSamples;
+	RsslUInt64				_lastMsgId[LATENCY_TRACE_MAX_THREADS];
+	RsslUInt64				_lastTimeNsec[LATENCY_TRACE_MAX_THREADS];
+} LatencyTraceHistogram;
+
+/* Initializes a LatencyTraceHistogram that drains up to maxSamples at a time. */
+RsslRet latencyTraceHistogramInit(LatencyTraceHistogram *pHist, RsslUInt32 maxSamples);
+
+/* Frees memory used by a LatencyTraceHistogram. */
+void latencyTraceHistogramCleanup(LatencyTraceHistogram *pHist);
+
+/* Drains all recorded samples and adds them to the histogram. */
+void latencyTraceHistogramCollect(LatencyTraceHistogram *pHist);
+
+/* Prints statistics and a histogram for each stage. */
+void printLatencyTraceHistogram(FILE *file, LatencyTraceHistogram *pHist);
+
 #ifdef __cplusplus
 };
 #endif
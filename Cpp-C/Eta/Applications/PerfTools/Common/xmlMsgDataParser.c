@@ -6,6 +6,8 @@
 */
 
 #include "xmlMsgDataParser.h"
+#include "marketPriceEncoder.h"
+#include "fieldSetDefAnalyzer.h"
 #include "rtr/rsslMemoryBuffer.h"
 #include <assert.h>
 #include <stdlib.h>
@@ -16,6 +18,9 @@
 #define XML_MBO_ROOT_NODE_NAME "marketByOrderMsgList"
 #define XML_MP_ROOT_NODE_NAME "marketPriceMsgList"
 
+/* Largest number of global set definitions learned from the MarketPrice messages. */
+#define MAX_MARKET_PRICE_SET_DEFS 64
+
 #define ORDER_BID 1
 #define ORDER_ASK 2
 
@@ -25,6 +30,7 @@ RsslBool xmlMsgDataLoaded = RSSL_FALSE;
 RsslBool xmlMsgDataHasMarketPrice = RSSL_FALSE;
 MarketPriceMsgList xmlMarketPriceMsgs;
 static RsslBuffer mpMsgMemory, mpMsgMemoryOrig;
+static RsslFieldSetDefDb mpSetDefDb = RSSL_INIT_FIELD_LIST_SET_DB;
 
 /* Defines the payload of the MarketByOrder response */
 RsslBool xmlMsgDataHasMarketByOrder = RSSL_FALSE;
@@ -924,16 +930,148 @@ RsslRet parseXMLMarketByOrder(xmlNode *pXmlMsgList)
 	return RSSL_RET_SUCCESS;
 }
 
+/* Clears the set ID and templates of a MarketPrice message. Message memory is not
+ * zeroed, so this is done before learning set definitions or compiling templates;
+ * cleanup is then safe even if either stops partway. */
+static void clearMarketPriceMsgEncoding(MarketPriceMsg *pMsg)
+{
+	pMsg->setId = 0;
+	clearFieldListTemplate(&pMsg->dataTemplate);
+	clearFieldListTemplate(&pMsg->latencyTemplate);
+}
+
+/* Counts the layout of a MarketPrice message's fields, or once the set definitions
+ * are built, marks the message with the one matching its fields. */
+static RsslRet analyzeMarketPriceMsg(FieldSetDefAnalyzer *pAnalyzer, MarketPriceMsg *pMsg, RsslBool assignSetId)
+{
+	RsslFieldSetDefEntry entries[255];
+	RsslInt32 i;
+
+	/* Longer lists can't be described by one set definition. */
+	if (pMsg->fieldEntriesCount > 255)
+		return RSSL_RET_SUCCESS;
+
+	for(i = 0; i < pMsg->fieldEntriesCount; ++i)
+	{
+		entries[i].fieldId = pMsg->fieldEntries[i].fieldEntry.fieldId;
+		entries[i].dataType = pMsg->fieldEntries[i].fieldEntry.dataType;
+	}
+
+	if (assignSetId)
+	{
+		pMsg->setId = fieldSetDefAnalyzerGetSetId(pAnalyzer, entries, pMsg->fieldEntriesCount);
+		return RSSL_RET_SUCCESS;
+	}
+
+	return fieldSetDefAnalyzerAddLayout(pAnalyzer, entries, pMsg->fieldEntriesCount);
+}
+
+static RsslRet analyzeMarketPriceMsgs(FieldSetDefAnalyzer *pAnalyzer, RsslBool assignSetId)
+{
+	RsslInt32 i;
+	RsslRet ret;
+
+	if ((ret = analyzeMarketPriceMsg(pAnalyzer, &xmlMarketPriceMsgs.refreshMsg, assignSetId)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	for(i = 0; i < xmlMarketPriceMsgs.updateMsgCount; ++i)
+		if ((ret = analyzeMarketPriceMsg(pAnalyzer, &xmlMarketPriceMsgs.updateMsgs[i], assignSetId)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	for(i = 0; i < xmlMarketPriceMsgs.postMsgCount; ++i)
+		if ((ret = analyzeMarketPriceMsg(pAnalyzer, &xmlMarketPriceMsgs.postMsgs[i], assignSetId)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	for(i = 0; i < xmlMarketPriceMsgs.genMsgCount; ++i)
+		if ((ret = analyzeMarketPriceMsg(pAnalyzer, &xmlMarketPriceMsgs.genMsgs[i], assignSetId)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Learns global set definitions from the field layouts of the MarketPrice messages.
+ * Providers and consumers loading the same message file learn the same definitions. */
+static RsslRet learnMarketPriceSetDefs()
+{
+	FieldSetDefAnalyzer analyzer;
+	RsslRet ret;
+
+	clearFieldSetDefAnalyzer(&analyzer);
+
+	if ((ret = analyzeMarketPriceMsgs(&analyzer, RSSL_FALSE)) == RSSL_RET_SUCCESS
+			&& (ret = fieldSetDefAnalyzerBuildDb(&analyzer, &mpSetDefDb, MAX_MARKET_PRICE_SET_DEFS)) == RSSL_RET_SUCCESS)
+	{
+		xmlMarketPriceMsgs.setDefDb = &mpSetDefDb;
+		ret = analyzeMarketPriceMsgs(&analyzer, RSSL_TRUE);
+		printf("Learned %d global set definitions from %d MarketPrice field layouts.\n",
+				(analyzer.layoutCount < MAX_MARKET_PRICE_SET_DEFS) ? analyzer.layoutCount : MAX_MARKET_PRICE_SET_DEFS,
+				analyzer.layoutCount);
+	}
+
+	fieldSetDefAnalyzerCleanup(&analyzer);
+	return ret;
+}
+
+/* Precompiles the encoded field lists of all MarketPrice messages. */
+static RsslRet compileMarketPriceTemplates()
+{
+	RsslInt32 i;
+	RsslRet ret;
+
+	if ((ret = compileMarketPriceMsgTemplates(&xmlMarketPriceMsgs.refreshMsg, RSSL_MC_REFRESH)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	for(i = 0; i < xmlMarketPriceMsgs.updateMsgCount; ++i)
+		if ((ret = compileMarketPriceMsgTemplates(&xmlMarketPriceMsgs.updateMsgs[i], RSSL_MC_UPDATE)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	for(i = 0; i < xmlMarketPriceMsgs.postMsgCount; ++i)
+		if ((ret = compileMarketPriceMsgTemplates(&xmlMarketPriceMsgs.postMsgs[i], RSSL_MC_POST)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	for(i = 0; i < xmlMarketPriceMsgs.genMsgCount; ++i)
+		if ((ret = compileMarketPriceMsgTemplates(&xmlMarketPriceMsgs.genMsgs[i], RSSL_MC_GENERIC)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void cleanupMarketPriceTemplates()
+{
+	RsslInt32 i;
+
+	cleanupMarketPriceMsgTemplates(&xmlMarketPriceMsgs.refreshMsg);
+
+	for(i = 0; i < xmlMarketPriceMsgs.updateMsgCount; ++i)
+		cleanupMarketPriceMsgTemplates(&xmlMarketPriceMsgs.updateMsgs[i]);
+
+	for(i = 0; i < xmlMarketPriceMsgs.postMsgCount; ++i)
+		cleanupMarketPriceMsgTemplates(&xmlMarketPriceMsgs.postMsgs[i]);
+
+	for(i = 0; i < xmlMarketPriceMsgs.genMsgCount; ++i)
+		cleanupMarketPriceMsgTemplates(&xmlMarketPriceMsgs.genMsgs[i]);
+}
+
 void xmlMsgDataCleanup()
 {
+	if (xmlMsgDataHasMarketPrice)
+		cleanupMarketPriceTemplates();
+
+	if (xmlMarketPriceMsgs.setDefDb)
+	{
+		rsslDeleteFieldSetDefDb(xmlMarketPriceMsgs.setDefDb);
+		xmlMarketPriceMsgs.setDefDb = NULL;
+	}
+
 	free(mpMsgMemoryOrig.data);
 	free(mboMsgMemoryOrig.data);
 	rsslDeleteDataDictionary(&dictionary);
 }
 
-RsslRet xmlMsgDataInit(char *filename)
+RsslRet xmlMsgDataInit(char *filename, RsslBool useGlobalSetDefs)
 {
 	RsslRet ret;
+	RsslInt32 i;
 
 	xmlDoc *pXmlDoc;
 	xmlNode *pXmlRoot, *pXmlMsgList;
@@ -1013,6 +1151,28 @@ RsslRet xmlMsgDataInit(char *filename)
 			} while (ret != RSSL_RET_SUCCESS);
 
 			xmlMsgDataHasMarketPrice = RSSL_TRUE;
+
+			clearMarketPriceMsgEncoding(&xmlMarketPriceMsgs.refreshMsg);
+			for(i = 0; i < xmlMarketPriceMsgs.updateMsgCount; ++i)
+				clearMarketPriceMsgEncoding(&xmlMarketPriceMsgs.updateMsgs[i]);
+			for(i = 0; i < xmlMarketPriceMsgs.postMsgCount; ++i)
+				clearMarketPriceMsgEncoding(&xmlMarketPriceMsgs.postMsgs[i]);
+			for(i = 0; i < xmlMarketPriceMsgs.genMsgCount; ++i)
+				clearMarketPriceMsgEncoding(&xmlMarketPriceMsgs.genMsgs[i]);
+
+			if (useGlobalSetDefs && learnMarketPriceSetDefs() != RSSL_RET_SUCCESS)
+			{
+				printf(XML_ERR_STR "Failed to learn MarketPrice set definitions.\n");
+				xmlFreeDoc(pXmlDoc);
+				return RSSL_RET_FAILURE;
+			}
+
+			if (compileMarketPriceTemplates() != RSSL_RET_SUCCESS)
+			{
+				printf(XML_ERR_STR "Failed to compile MarketPrice field list templates.\n");
+				xmlFreeDoc(pXmlDoc);
+				return RSSL_RET_FAILURE;
+			}
 		}
 		else if (strcmp((char*)pXmlMsgList->name, XML_MBO_ROOT_NODE_NAME) == 0)
 		{
@@ -12,6 +12,7 @@
 #define _XML_MSG_DATA_PARSER_H
 
 #include "testUtils.h"
+#include "fieldListTemplate.h"
 #include "rtr/rsslMessagePackage.h"
 #include "libxml/tree.h"
 #include "libxml/parser.h"
@@ -102,6 +103,9 @@ typedef struct {
 	RsslInt32	fieldEntriesCount;		/* Number of fields in list. */
 	MarketField *fieldEntries;			/* List of fields. */
 	RsslUInt32	estimatedContentLength;	/* Estimated size of payload. */
+	RsslUInt16	setId;					/* Global set definition matching the fields, or 0 if none. */
+	FieldListTemplate	dataTemplate;		/* Precompiled encoding of the fields. */
+	FieldListTemplate	latencyTemplate;	/* Precompiled encoding of the fields followed by a latency timestamp. */
 } MarketPriceMsg;
 
 RTR_C_INLINE void clearMarketPriceMsg(MarketPriceMsg *pMsg)
@@ -118,6 +122,7 @@ typedef struct {
 	MarketPriceMsg	*postMsgs;		/* List of posts. */
 	RsslInt32		genMsgCount;	/* Number of generic messages in list. */
 	MarketPriceMsg	*genMsgs;		/* List of generic messages. */
+	RsslFieldSetDefDb	*setDefDb;	/* Global set definitions learned from the messages, if enabled. */
 } MarketPriceMsgList;
 
 /* Clears a MarketPriceMsgList. */
@@ -148,8 +153,10 @@ RsslRet parseXMLMarketByOrder(xmlNode *pXmlMsgList);
 /* Whether XML data has been loaded. */
 extern RsslBool xmlMsgDataLoaded;
 
-/* Builds payloads for messages from XML. Loads dictionary */
-RsslRet xmlMsgDataInit(char *filename);
+/* Builds payloads for messages from XML. Loads dictionary.
+ * If useGlobalSetDefs is set, also learns global set definitions from the MarketPrice
+ * messages and encodes them as set-defined data. */
+RsslRet xmlMsgDataInit(char *filename, RsslBool useGlobalSetDefs);
 
 /* Cleans up memory associated with message payloads. Frees dictionary. */
 void xmlMsgDataCleanup();
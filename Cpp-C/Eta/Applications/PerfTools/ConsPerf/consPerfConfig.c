@@ -38,6 +38,7 @@ static void clearConsPerfConfig()
 	consPerfConfig.recvBufSize = 0;
 	consPerfConfig.highWaterMark = 0;
 	consPerfConfig.tcpNoDelay = RSSL_TRUE;
+	consPerfConfig.busyPollUsec = 0;
 	consPerfConfig.connectionType = RSSL_CONN_TYPE_SOCKET;
 	consPerfConfig.guaranteedOutputBuffers = 5000;
 	consPerfConfig.numInputBuffers = 15;
@@ -54,6 +55,7 @@ static void clearConsPerfConfig()
 	consPerfConfig.requestSnapshots = RSSL_FALSE;
 
 	consPerfConfig.nanoTime = RSSL_FALSE;
+	consPerfConfig.globalSetDefs = RSSL_FALSE;
 
 	consPerfConfig.postsPerSec = 0;
 	consPerfConfig.latencyPostsPerSec = 0;
@@ -290,6 +292,14 @@ void initConsPerfConfig(int argc, char **argv)
 		{
 			++iargs; consPerfConfig.measureDecode = RSSL_TRUE;
 		}
+		else if(strcmp("-latencyTrace", argv[iargs]) == 0)
+		{
+			++iargs; consPerfConfig.latencyTrace = RSSL_TRUE;
+		}
+		else if(strcmp("-globalSetDefs", argv[iargs]) == 0)
+		{
+			++iargs; consPerfConfig.globalSetDefs = RSSL_TRUE;
+		}
 		else if(strcmp("-postingRate", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -310,6 +320,11 @@ void initConsPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			consPerfConfig.latencyGenMsgsPerSec = atoi(argv[iargs++]);
 		}
+		else if(strcmp("-busyPoll", argv[iargs]) == 0)
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			consPerfConfig.busyPollUsec = atoi(argv[iargs++]);
+		}
 		else if(strcmp("-tickRate", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -532,6 +547,7 @@ void printConsPerfConfig(FILE *file)
 		"         High Water Mark: %u%s\n"
 		"          Interface Name: %s\n"
 		"             Tcp_NoDelay: %s\n"
+		"               Busy Poll: %u%s\n"
 		"                Username: %s\n"
 		"              Item Count: %d\n"
 		"       Common Item Count: %d\n"
@@ -567,6 +583,7 @@ void printConsPerfConfig(FILE *file)
 		consPerfConfig.highWaterMark, (consPerfConfig.highWaterMark > 0 ? " bytes" : "(use default)"),
 		strlen(consPerfConfig.interfaceName) ? consPerfConfig.interfaceName : "(use default)",
 		(consPerfConfig.tcpNoDelay ? "Yes" : "No"),
+		consPerfConfig.busyPollUsec, (consPerfConfig.busyPollUsec ? " usec" : "(off)"),
 		strlen(consPerfConfig.username) ? consPerfConfig.username : "(use system login name)",
 		consPerfConfig.itemRequestCount,
 		consPerfConfig.commonItemCount,
@@ -594,9 +611,13 @@ void printConsPerfConfig(FILE *file)
 
 	fprintf(file,
 			"      Nanosecond Latency: %s\n"
-			"          Measure Decode: %s\n\n",
+			"          Measure Decode: %s\n"
+			"           Latency Trace: %s\n"
+			"  Global Set Definitions: %s\n\n",
 			consPerfConfig.nanoTime ? "Yes" : "No",
-			consPerfConfig.measureDecode ? "Yes" : "No"
+			consPerfConfig.measureDecode ? "Yes" : "No",
+			consPerfConfig.latencyTrace ? "Yes" : "No",
+			consPerfConfig.globalSetDefs ? "Yes" : "No"
 		   );
 }
 
@@ -618,6 +639,8 @@ void exitWithUsage()
 			"  -tcpDelay                            Turns off tcp_nodelay in RsslConnectOptions, enabling Nagle's\n"
 			"  -sendBufSize <size>                  System Send Buffer Size(configures sysSendBufSize in RsslConnectOptions)\n"
 			"  -recvBufSize <size>                  System Receive Buffer Size(configures sysRecvBufSize in RsslConnectOptions)\n"
+			"  -busyPoll <usec>                     Spin on reads for this long after each message before blocking again.\n"
+			"                                       Also sets SO_BUSY_POLL(configures tcpOpts.busyPollUsec in RsslConnectOptions)\n"
 			"\n"
 			"  -tickRate <ticks per second>         Ticks per second\n"
 			"  -itemCount <count>                   Number of items to request\n"
@@ -650,6 +673,10 @@ void exitWithUsage()
 			"\n"
 			"  -nanoTime                            Assume latency has nanosecond precision instead of microsecond.\n"
 			"  -measureDecode                       Measure decode time of updates.\n"
+			"  -latencyTrace                        Trace messages from socket receive to the message callback and print\n"
+			"                                         a latency histogram for each stage. Uses SO_TIMESTAMPING where available.\n"
+			"  -globalSetDefs                       Learn global field set definitions from the message file, as the provider does\n"
+			"                                         with -globalSetDefs, and use them to encode and decode MarketPrice data.\n"
 			"\n"
 			"  -castore                             File location of the certificate authority store.\n"
 			"  -spTLSv1.2                           Specifies that TLSv1.2 can be used for an OpenSSL-based encrypted connection\n"
@@ -54,6 +54,7 @@ typedef struct
 	RsslUInt32			recvBufSize;				/* System Send Buffer Size(-recvBufSize) */
 	RsslUInt32			highWaterMark;				/* sets the point which will cause UPA to automatically flush */
 	RsslBool			tcpNoDelay;					/* Enable/Disable Nagle's algorithm. See -tcpDelay */
+	RsslUInt32			busyPollUsec;				/* Microseconds to spin on reads after the last message before blocking. See -busyPoll */
 	RsslBool			requestSnapshots;			/* Whether to request all items as snapshots. See -snapshot */
 
 	char				username[128];				/* Username used when logging in. */
@@ -70,6 +71,8 @@ typedef struct
 
 	RsslBool			nanoTime;					/* Whether to assume latency is nanosecond precision instead of microsecond. */
 	RsslBool			measureDecode;				/* Measure time to decode latency updates (-measureDecode) */
+	RsslBool			latencyTrace;				/* Trace each message through the transport and reactor and report per-stage histograms (-latencyTrace) */
+	RsslBool			globalSetDefs;				/* Learn global set definitions from the message file. See -globalSetDefs. */
 
 	RsslBool			useReactor;					/* Use the VA Reactor instead of the UPA Channel for sending and receiving. */
 	RsslBool			useWatchlist;				/* Use the VA Reactor watchlist instead of the UPA Channel for sending and receiving. */
@@ -1176,6 +1176,7 @@ static RsslRet connectChannel(ConsumerThread* pConsumerThread)
 	if (consPerfConfig.connectionType == RSSL_CONN_TYPE_SOCKET || consPerfConfig.connectionType == RSSL_CONN_TYPE_ENCRYPTED)
 	{
 		copts.tcpOpts.tcp_nodelay = consPerfConfig.tcpNoDelay;
+		copts.tcpOpts.busyPollUsec = consPerfConfig.busyPollUsec;
 	}
 
 	if (consPerfConfig.connectionType == RSSL_CONN_TYPE_WEBSOCKET || 
@@ -1327,6 +1328,7 @@ static RsslRet connectReactor(ConsumerThread* pConsumerThread)
 	if(consPerfConfig.connectionType == RSSL_CONN_TYPE_SOCKET || consPerfConfig.connectionType == RSSL_CONN_TYPE_ENCRYPTED)
 	{
 		cInfo.rsslConnectOptions.tcpOpts.tcp_nodelay = consPerfConfig.tcpNoDelay;
+		cInfo.rsslConnectOptions.tcpOpts.busyPollUsec = consPerfConfig.busyPollUsec;
 	}
 
 	if (consPerfConfig.connectionType == RSSL_CONN_TYPE_WEBSOCKET || 
@@ -2222,6 +2224,7 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 	ConsumerThread* pConsumerThread = (ConsumerThread*)threadStruct;
 	RsslInt64 nsecPerTick;
 	RsslTimeValue currentTime, nextTickTime;
+	RsslTimeValue lastActivityTime, busyPollNsec = (RsslTimeValue)consPerfConfig.busyPollUsec * 1000;
 	struct timeval time_interval;
 	fd_set useRead;
 	fd_set useExcept;
@@ -2267,6 +2270,7 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 
 	currentTime = rsslGetTimeNano();
 	nextTickTime = currentTime + nsecPerTick;
+	lastActivityTime = currentTime;
 	time_interval.tv_sec = 0;
 
 	while(1)
@@ -2282,12 +2286,18 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 		useWrt = pConsumerThread->wrtfds;
 
 		currentTime = rsslGetTimeNano();
-		time_interval.tv_usec = (long)((currentTime > nextTickTime) ? 0 : ((nextTickTime - currentTime)/1000));
+		/* When busy polling, spin on a zero-timeout select for a while after the last read instead of sleeping until the next tick. */
+		if (currentTime > nextTickTime || currentTime - lastActivityTime < busyPollNsec)
+			time_interval.tv_usec = 0;
+		else
+			time_interval.tv_usec = (long)((nextTickTime - currentTime)/1000);
 
 		selRet = select(FD_SETSIZE,&useRead,&useWrt,&useExcept,&time_interval);
 
 		if (selRet > 0)
 		{
+			lastActivityTime = currentTime;
+
 			if (pConsumerThread->pChannel != NULL && FD_ISSET(pConsumerThread->pChannel->socketId, &useRead))
 			{
 				RsslBuffer messageBuff = RSSL_INIT_BUFFER;
@@ -2504,6 +2514,10 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 		}
 		else if (selRet == 0)
 		{
+			/* A spinning select returns before the tick is due. */
+			if (busyPollNsec && rsslGetTimeNano() < nextTickTime)
+				continue;
+
 			if (consumerThreadCheckPings(pConsumerThread))
 			{
 				rsslCloseChannel(pConsumerThread->pChannel, &closeError);
@@ -2591,6 +2605,7 @@ RSSL_THREAD_DECLARE(runConsumerReactorConnection, threadStruct)
 	ConsumerThread* pConsumerThread = (ConsumerThread*)threadStruct;
 	RsslInt64 nsecPerTick;
 	RsslTimeValue currentTime, nextTickTime;
+	RsslTimeValue lastActivityTime, busyPollNsec = (RsslTimeValue)consPerfConfig.busyPollUsec * 1000;
 	struct timeval time_interval;
 	fd_set useRead;
 	fd_set useExcept;
@@ -2635,6 +2650,7 @@ RSSL_THREAD_DECLARE(runConsumerReactorConnection, threadStruct)
 
 	currentTime = rsslGetTimeNano();
 	nextTickTime = currentTime + nsecPerTick;
+	lastActivityTime = currentTime;
 	time_interval.tv_sec = 0;
 
 	while(1)
@@ -2652,12 +2668,18 @@ RSSL_THREAD_DECLARE(runConsumerReactorConnection, threadStruct)
 		useWrt = pConsumerThread->wrtfds;
 
 		currentTime = rsslGetTimeNano();
-		time_interval.tv_usec = (long)((currentTime > nextTickTime) ? 0 : ((nextTickTime - currentTime)/1000));
+		/* When busy polling, spin on a zero-timeout select for a while after the last read instead of sleeping until the next tick. */
+		if (currentTime > nextTickTime || currentTime - lastActivityTime < busyPollNsec)
+			time_interval.tv_usec = 0;
+		else
+			time_interval.tv_usec = (long)((nextTickTime - currentTime)/1000);
 
 		selRet = select(FD_SETSIZE,&useRead,&useWrt,&useExcept,&time_interval);
 
 		if (selRet > 0)
 		{
+			lastActivityTime = currentTime;
+
 			while (shutdownThreads == RSSL_FALSE &&
 				   (readret = rsslReactorDispatch(pConsumerThread->pReactor, &dispatchOptions, &reactorErrorInfo)) > RSSL_RET_SUCCESS) {}
 			if (readret < RSSL_RET_SUCCESS)
@@ -2675,6 +2697,10 @@ RSSL_THREAD_DECLARE(runConsumerReactorConnection, threadStruct)
 		}
 		else if (selRet == 0)
 		{
+			/* A spinning select returns before the tick is due. */
+			if (busyPollNsec && rsslGetTimeNano() < nextTickTime)
+				continue;
+
 			currentTime = rsslGetTimeNano();
 			nextTickTime += nsecPerTick;
 			
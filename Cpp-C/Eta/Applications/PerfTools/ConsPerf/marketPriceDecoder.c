@@ -73,6 +73,9 @@ RsslRet decodeMPUpdate(RsslDecodeIterator *pIter, RsslMsg *msg, ConsumerThread*
 	// Zero out the primitive before decoding 
 	memset(&primitive, 0, sizeof(RsslPrimitive));
 
+	/* Set data, if any, is defined by the global set definitions learned from the message file. */
+	rsslSetDecodeIteratorGlobalFieldListSetDB(pIter, xmlMarketPriceMsgs.setDefDb);
+
 	/* decode field list */
 	if ((ret = rsslDecodeFieldList(pIter, &fList, 0)) == RSSL_RET_SUCCESS)
 	{
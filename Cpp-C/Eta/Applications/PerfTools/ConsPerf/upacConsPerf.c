@@ -49,6 +49,9 @@ ConsumerStats totalStats;
 /* CPU & Memory Usage samples */
 static ValueStatistics cpuUsageStats, memUsageStats;
 
+/* Per-stage latencies, if -latencyTrace is used. */
+static LatencyTraceHistogram latencyTraceHistogram;
+
 RsslTimeValue currentTime, startTime, endTime;
 RsslUInt32 currentRuntimeSec = 0, intervalSeconds = 0;
 
@@ -88,9 +91,9 @@ int main(int argc, char **argv)
 	consumerStatsInit(&totalStats);
 
 
-	if (consPerfConfig.postsPerSec || consPerfConfig.genMsgsPerSec)
+	if (consPerfConfig.postsPerSec || consPerfConfig.genMsgsPerSec || consPerfConfig.globalSetDefs)
 	{
-		if (xmlMsgDataInit(consPerfConfig.msgFilename) != RSSL_RET_SUCCESS)
+		if (xmlMsgDataInit(consPerfConfig.msgFilename, consPerfConfig.globalSetDefs) != RSSL_RET_SUCCESS)
 			exit(-1);
 	}
 
@@ -136,6 +139,21 @@ int main(int argc, char **argv)
 	for(i = 0; i < consPerfConfig.threadCount; ++i)
 		consumerThreads[i].cpuId = consPerfConfig.threadBindList[i];
 
+	if (consPerfConfig.latencyTrace)
+	{
+		RsslLatencyTraceOpts latencyTraceOpts;
+
+		rsslClearLatencyTraceOpts(&latencyTraceOpts);
+		latencyTraceOpts.socketTimestamps = RSSL_TRUE;
+
+		if (latencyTraceHistogramInit(&latencyTraceHistogram, latencyTraceOpts.ringSize) != RSSL_RET_SUCCESS
+				|| rsslLatencyTraceEnable(&latencyTraceOpts) != RSSL_RET_SUCCESS)
+		{
+			printf("Failed to enable latency tracing.\n");
+			exit(RSSL_RET_FAILURE);
+		}
+	}
+
 	/* Initialize RSSL */
 	if (consPerfConfig.useReactor == RSSL_FALSE && consPerfConfig.useWatchlist == RSSL_FALSE) // use UPA Channel
 	{
@@ -275,6 +293,9 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 
 	rsslInitQueue(&latencyRecords);
 
+	if (consPerfConfig.latencyTrace)
+		latencyTraceHistogramCollect(&latencyTraceHistogram);
+
 	if (timePassedSec)
 	{
 		if ((ret = getResourceUsageStats(&resourceStats)) != RSSL_RET_SUCCESS)
@@ -615,6 +636,15 @@ void consumerCleanupThreads()
 	printSummaryStatistics(stdout);
 	printSummaryStatistics(summaryFile);
 
+	if (consPerfConfig.latencyTrace)
+	{
+		rsslLatencyTraceDisable();
+		latencyTraceHistogramCollect(&latencyTraceHistogram);
+		printLatencyTraceHistogram(stdout, &latencyTraceHistogram);
+		printLatencyTraceHistogram(summaryFile, &latencyTraceHistogram);
+		latencyTraceHistogramCleanup(&latencyTraceHistogram);
+	}
+
 	/* Add a warning if the test failed. */
 	for(i = 0; i < consPerfConfig.threadCount; i++)
 	{
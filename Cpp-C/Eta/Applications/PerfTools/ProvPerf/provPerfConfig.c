@@ -47,6 +47,8 @@ static void clearProvPerfConfig()
 	snprintf(provPerfConfig.protocolList, sizeof(provPerfConfig.protocolList), "");
 	provPerfConfig.guaranteedOutputTunnelBuffers = 15000;
 	provPerfConfig.tunnelStreamBufsUsed = RSSL_FALSE;
+	provPerfConfig.workerThreadBindList = NULL;
+	provPerfConfig.workerThreadCount = 0;
 }
 
 void exitConfigError(char **argv)
@@ -259,6 +261,10 @@ void initProvPerfConfig(int argc, char **argv)
 		{
 			providerThreadConfig.measureEncode = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-globalSetDefs", argv[iargs]))
+		{
+			providerThreadConfig.globalSetDefs = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-directWrite", argv[iargs]))
 		{
 			providerThreadConfig.writeFlags |= RSSL_WRITE_DIRECT_SOCKET_WRITE;
@@ -267,6 +273,29 @@ void initProvPerfConfig(int argc, char **argv)
 		{
 			provPerfConfig.useReactor = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-workerThreads", argv[iargs]))
+		{
+			char *pToken;
+
+			provPerfConfig.workerThreadCount = 0;
+
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+
+			provPerfConfig.workerThreadBindList = (RsslInt32*)malloc(128 * sizeof(RsslInt32));
+			pToken = strtok(argv[iargs], ",");
+			while(pToken)
+			{
+				if (++provPerfConfig.workerThreadCount > 128)
+				{
+					printf("Config Error: Too many worker threads specified.\n");
+					exitConfigError(argv);
+				}
+
+				sscanf(pToken, "%d", &provPerfConfig.workerThreadBindList[provPerfConfig.workerThreadCount-1]);
+
+				pToken = strtok(NULL, ",");
+			}
+		}
 		else if (strcmp("-connType", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -330,6 +359,21 @@ void initProvPerfConfig(int argc, char **argv)
 		exitConfigError(argv);
 	}
 
+	if (provPerfConfig.workerThreadCount > 0)
+	{
+		if (!provPerfConfig.useReactor)
+		{
+			printf("Config Error: -workerThreads requires -reactor.\n");
+			exitConfigError(argv);
+		}
+
+		if (provPerfConfig.workerThreadCount != providerThreadConfig.threadCount)
+		{
+			printf("Config Error: -workerThreads must list one CPU for each provider thread in -threads.\n");
+			exitConfigError(argv);
+		}
+	}
+
 	loginConfig.applicationName = applicationName;
 	loginConfig.applicationId = applicationId;
 	setLoginConfigPosition();
@@ -345,11 +389,23 @@ void printProvPerfConfig(FILE *file)
 	int i;
 	int threadStringPos = 0;
 	char threadString[128];
+	int workerThreadStringPos = 0;
+	char workerThreadString[128];
 
 	/* Build thread list */
 	threadStringPos += snprintf(threadString, 128, "%d", providerThreadConfig.threadBindList[0]);
 	for(i = 1; i < providerThreadConfig.threadCount; ++i)
 		threadStringPos += snprintf(threadString + threadStringPos, 128 - threadStringPos, ",%d", providerThreadConfig.threadBindList[i]);
+
+	/* Build reactor worker thread list */
+	if (provPerfConfig.workerThreadCount > 0)
+	{
+		workerThreadStringPos += snprintf(workerThreadString, 128, "%d", provPerfConfig.workerThreadBindList[0]);
+		for(i = 1; i < provPerfConfig.workerThreadCount; ++i)
+			workerThreadStringPos += snprintf(workerThreadString + workerThreadStringPos, 128 - workerThreadStringPos, ",%d", provPerfConfig.workerThreadBindList[i]);
+	}
+	else
+		snprintf(workerThreadString, 128, "(not bound)");
 	
 
 
@@ -360,6 +416,7 @@ void printProvPerfConfig(FILE *file)
 			"		  Connection Type: %u\n"	
 			"                    Port: %s\n"
 			"             Thread List: %s\n"
+			"      Worker Thread List: %s\n"
 			"          Output Buffers: %u\n"
 			"      Max Output Buffers: %u\n"
 			"       Max Fragment Size: %u\n"
@@ -386,6 +443,7 @@ void printProvPerfConfig(FILE *file)
 			provPerfConfig.connType,
 			provPerfConfig.portNo,
 			threadString,
+			workerThreadString,
 			provPerfConfig.guaranteedOutputBuffers,
 			provPerfConfig.maxOutputBuffers,
 			provPerfConfig.maxFragmentSize,
@@ -447,10 +505,12 @@ void printProvPerfConfig(FILE *file)
 	fprintf(file,
 			"     Pre-Encoded Updates: %s\n"
 			"         Nanosecond Time: %s\n"
-			"          Measure Encode: %s\n",
+			"          Measure Encode: %s\n"
+			"  Global Set Definitions: %s\n",
 			providerThreadConfig.preEncItems ? "Yes" : "No",
 			providerThreadConfig.nanoTime ? "Yes" : "No",
-			providerThreadConfig.measureEncode ? "Yes" : "No");
+			providerThreadConfig.measureEncode ? "Yes" : "No",
+			providerThreadConfig.globalSetDefs ? "Yes" : "No");
 
 	fprintf(file,
 			"             Use Reactor: %s\n\n",
@@ -503,8 +563,13 @@ void exitWithUsage()
 			"  -preEnc                              Use Pre-Encoded updates\n"
 			"  -nanoTime                            Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -measureEncode                       Measure encoding time of messages.\n"
+			"  -globalSetDefs                       Learn global field set definitions from the message file and encode MarketPrice\n"
+			"                                         data as set-defined data. Consumers must also use -globalSetDefs.\n"
 			"\n"
 			"  -reactor                             Use the VA Reactor instead of the UPA Channel for sending and receiving.\n"
+			"  -workerThreads <thread list>         With -reactor, CPU's to bind each provider thread's reactor worker thread to.\n"
+			"                                        Comma-separated list with one entry per thread in -threads.\n"
+			"                                        (e.g. \"-threads 0,2 -workerThreads 1,3\")\n"
 			"\n"
 			"  -pl \"<list>\"                         List of supported WS sub-protocols in order of preference(',' | white space delineated)\n"
 			"\n"
@@ -34,6 +34,8 @@ typedef struct
 	RsslUInt32			writeStatsInterval;			/* Controls how often statistics are written. */
 	RsslBool			displayStats;				/* Controls whether stats appear on the screen. */
 	RsslBool			useReactor;					/* Use the VA Reactor instead of the UPA Channel for sending and receiving. */
+	RsslInt32			*workerThreadBindList;		/* List of CPU ID's to bind each provider thread's reactor worker to. See -workerThreads */
+	RsslInt32			workerThreadCount;			/* Number of entries in workerThreadBindList; 0 leaves the reactor workers unbound. */
 	RsslConnectionTypes connType;					/* Connection type for this provider */
 	char				serverCert[255];			/* Server certificate file location */
 	char				serverKey[255];				/* Server private key file location */
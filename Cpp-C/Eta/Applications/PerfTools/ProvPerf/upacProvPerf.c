@@ -169,6 +169,9 @@ RSSL_THREAD_DECLARE(runReactorConnectionHandler, pArg)
 	// create reactor
 	rsslClearCreateReactorOptions(&reactorOpts);
 
+	if (provPerfConfig.workerThreadCount > 0)
+		reactorOpts.workerCpuId = provPerfConfig.workerThreadBindList[pProvThread->providerIndex];
+
 	if (!(pProvThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
 	{
 		printf("Reactor creation failed: %s\n", rsslErrorInfo.rsslError.text);
@@ -1373,6 +1376,9 @@ RsslRet decodeMPUpdate(RsslDecodeIterator *pIter, RsslMsg *msg, ProviderThread*
 
 	RsslUInt genMsgTimeTracker = 0;
 
+	/* Set data, if any, is defined by the global set definitions learned from the message file. */
+	rsslSetDecodeIteratorGlobalFieldListSetDB(pIter, xmlMarketPriceMsgs.setDefDb);
+
 	/* decode field list */
 	if ((ret = rsslDecodeFieldList(pIter, &fList, 0)) == RSSL_RET_SUCCESS)
 	{
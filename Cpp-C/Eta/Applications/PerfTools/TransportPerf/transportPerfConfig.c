@@ -59,6 +59,7 @@ static void clearTransportPerfConfig()
 	snprintf(transportPerfConfig.caStore, sizeof(transportPerfConfig.caStore), "");
 	snprintf(transportPerfConfig.serverCert, sizeof(transportPerfConfig.serverCert), "");
 	snprintf(transportPerfConfig.serverKey, sizeof(transportPerfConfig.serverKey), "");
+	transportPerfConfig.enableKTLS = RSSL_FALSE;
 
 	snprintf(transportPerfConfig.protocolList, sizeof(transportPerfConfig.protocolList), "");
 
@@ -260,6 +261,8 @@ void initTransportPerfConfig(int argc, char **argv)
 				transportPerfConfig.compressionType = RSSL_COMP_ZLIB;
 			else if (0 == strcmp(argv[iargs], "lz4"))
 				transportPerfConfig.compressionType = RSSL_COMP_LZ4;
+			else if (0 == strcmp(argv[iargs], "lz4stream"))
+				transportPerfConfig.compressionType = RSSL_COMP_LZ4_STREAM;
 			else
 			{
 				/* Read it as a number. */
@@ -368,6 +371,10 @@ void initTransportPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			snprintf(transportPerfConfig.serverCert, sizeof(transportPerfConfig.serverCert), "%s", argv[iargs]);
 		}
+		else if (0 == strcmp("-ktls", argv[iargs]))
+		{
+			transportPerfConfig.enableKTLS = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-pl", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -474,6 +481,8 @@ const char *compressionTypeToString(RsslCompTypes compType)
 			return "zlib";
 		case RSSL_COMP_LZ4:
 			return "lz4";
+		case RSSL_COMP_LZ4_STREAM:
+			return "lz4stream";
 		default:
 			return "unknown";
 	}
@@ -503,17 +512,21 @@ void printTransportPerfConfig(FILE *file)
 		{
 			fprintf(file,
 				"Encrypted Connection Type: %s\n"
-				"			  CA Store: %s\n",
+				"			  CA Store: %s\n"
+				"			Kernel TLS: %s\n",
 				connectionTypeToString(transportPerfConfig.encryptedConnectionType),
-				transportPerfConfig.caStore);
+				transportPerfConfig.caStore,
+				(transportPerfConfig.enableKTLS ? "Yes" : "No"));
 		}
 		else
 		{
 			fprintf(file,
 				"	Server Private Key: %s\n"
-				"	Server Certificate: %s\n",
+				"	Server Certificate: %s\n"
+				"			Kernel TLS: %s\n",
 				transportPerfConfig.serverKey,
-				transportPerfConfig.serverCert);
+				transportPerfConfig.serverCert,
+				(transportPerfConfig.enableKTLS ? "Yes" : "No"));
 		}
 	}
 	
@@ -636,7 +649,7 @@ void exitWithUsage()
 			"  -sendBufSize <size>        System Send Buffer Size(configures sysSendBufSize in the RSSL bind/connection options)\n"
 			"  -recvBufSize <size>        System Receive Buffer Size(configures sysRecvBufSize in the RSSL bind/connection options)\n"
 			"  -highWaterMark <bytes>     Number of queued bytes at which rsslWrite() internally flushes.\n"
-			"  -compressionType <type>    Type of compression to use(\"none\", \"zlib\", \"lz4\")\n"
+			"  -compressionType <type>    Type of compression to use(\"none\", \"zlib\", \"lz4\", \"lz4stream\")\n"
 			"  -compressionLevel <num>    Level of compression.\n"
 			"  -if <interface name>       Name of network interface to use\n"
 			"  -tcpDelay                  Turns off tcp_nodelay in RsslBindOpts, enabling Nagle's\n"
@@ -664,6 +677,7 @@ void exitWithUsage()
 			"  -castore					  File location of the certificate authority store for client connections.\n"
 			"  -keyfile				  	  Server private key for OpenSSL encryption.\n"
 			"  -cert					  Server certificate for openSSL encryption.\n"
+			"  -ktls					  Hand TLS sends to the kernel after the handshake (Linux, OpenSSL 3). Falls back to OpenSSL if unavailable.\n"
 			"\n"
 			
 			);
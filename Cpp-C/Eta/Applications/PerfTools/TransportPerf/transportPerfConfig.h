@@ -67,6 +67,7 @@ typedef struct
 	char				caStore[255];
 	char				serverCert[255];
 	char				serverKey[255];
+	RsslBool			enableKTLS;					/* Ask OpenSSL to offload TLS sends to the kernel. See -ktls */
 	char				protocolList[128];			/* List of desired or supported sub-protocols for respective client or server websocket connection.*/
 
 } TransportPerfConfig;
@@ -53,6 +53,7 @@ static RsslUInt32 currentRuntimeSec = 0, intervalSeconds = 0;
 
 RsslUInt64 totalMsgSentCount = 0;
 RsslUInt64 totalBytesSent = 0;
+RsslUInt64 totalUncompBytesSent = 0;
 RsslUInt64 totalMsgReceivedCount = 0;
 RsslUInt64 totalBytesReceived = 0;
 
@@ -211,6 +212,7 @@ RsslRet processMsgReflect(ChannelHandler *pChanHandler, ChannelInfo *pChannelInf
 	if (ret >= RSSL_RET_SUCCESS)
 	{
 		countStatAdd(&pHandler->transportThread.bytesSent, outBytes);
+		countStatAdd(&pHandler->transportThread.uncompBytesSent, uncompOutBytes);
 		countStatIncr(&pHandler->transportThread.msgsSent);
 		if(ret > 0)
 			channelHandlerRequestFlush(pChanHandler, pSession->pChannelInfo);
@@ -223,6 +225,7 @@ RsslRet processMsgReflect(ChannelHandler *pChanHandler, ChannelInfo *pChannelInf
 			if (chnl->state == RSSL_CH_STATE_ACTIVE)
 			{
 				countStatAdd(&pHandler->transportThread.bytesSent, outBytes);
+				countStatAdd(&pHandler->transportThread.uncompBytesSent, uncompOutBytes);
 				countStatIncr(&pHandler->transportThread.msgsSent);
 				channelHandlerRequestFlush(pChanHandler, pSession->pChannelInfo);
 				return 1;
@@ -789,6 +792,7 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 
 		totalMsgSentCount += intervalMsgSentCount;
 		totalBytesSent += intervalBytesSent;
+		totalUncompBytesSent += countStatGetChange(&sessionHandlerList[i].transportThread.uncompBytesSent);
 		totalMsgReceivedCount += intervalMsgReceivedCount;
 		totalBytesReceived += intervalBytesReceived;
 
@@ -913,6 +917,7 @@ static RsslServer* bindRsslServer(RsslError* error)
 	{
 		sopts.encryptionOpts.serverCert = transportPerfConfig.serverCert;
 		sopts.encryptionOpts.serverPrivateKey = transportPerfConfig.serverKey;
+		sopts.encryptionOpts.enableKTLS = transportPerfConfig.enableKTLS;
 	}
 	if ((srvr = rsslBind(&sopts, error)) == 0)
 		return NULL;
@@ -1002,6 +1007,7 @@ static RsslChannel* startConnection()
 	{
 		copts.encryptionOpts.encryptedProtocol = transportPerfConfig.encryptedConnectionType;
 		copts.encryptionOpts.openSSLCAStore = transportPerfConfig.caStore;
+		copts.encryptionOpts.enableKTLS = transportPerfConfig.enableKTLS;
 	}
 
 	if (transportPerfConfig.connectionType == RSSL_CONN_TYPE_WEBSOCKET ||
@@ -1096,6 +1102,16 @@ void cleanUpAndExit()
 	exit(0);
 }
 
+/* Prints how much the sent data was compressed. */
+static void printCompressionStats(FILE *file, RsslUInt64 uncompBytesSent, RsslUInt64 bytesSent)
+{
+	fprintf( file,
+			"  Uncompressed Data Sent (MB): %.2f\n"
+			"  Compression Ratio: %.2f\n",
+			(double)uncompBytesSent / 1048576.0,
+			bytesSent ? (double)uncompBytesSent / (double)bytesSent : 0);
+}
+
 static void printSummaryStats(FILE *file)
 {
 	RsslInt32 i;
@@ -1155,7 +1171,7 @@ static void printSummaryStats(FILE *file)
 					"  Avg. Msg Sent Rate: %.0f\n"
 					"  Avg. Msg Recv Rate: %.0f\n"
 					"  Avg. Data Sent Rate (MB): %.2f\n"
-					"  Avg. Data Recv Rate (MB): %.2f\n\n",
+					"  Avg. Data Recv Rate (MB): %.2f\n",
 					threadConnectedTime,
 					countStatGetTotal(&pThread->msgsSent),
 					countStatGetTotal(&pThread->msgsReceived),
@@ -1165,6 +1181,11 @@ static void printSummaryStats(FILE *file)
 					threadConnectedTime ? (double)countStatGetTotal(&pThread->msgsReceived)/ threadConnectedTime : 0,
 					threadConnectedTime ? (double)countStatGetTotal(&pThread->bytesSent) / 1048576.0 / threadConnectedTime : 0,
 					threadConnectedTime ? (double)countStatGetTotal(&pThread->bytesReceived) / 1048576.0 / threadConnectedTime : 0);
+
+			if (transportPerfConfig.compressionType != RSSL_COMP_NONE)
+				printCompressionStats(file, countStatGetTotal(&pThread->uncompBytesSent), countStatGetTotal(&pThread->bytesSent));
+
+			fprintf( file, "\n");
 		}
 
 	}
@@ -1209,6 +1230,9 @@ static void printSummaryStats(FILE *file)
 			connectedTime ? (double)totalBytesSent / 1048576.0 / connectedTime : 0,
 			connectedTime ? (double)totalBytesReceived / 1048576.0 / connectedTime : 0);
 
+	if (transportPerfConfig.compressionType != RSSL_COMP_NONE)
+		printCompressionStats(file, totalUncompBytesSent, totalBytesSent);
+
 	if (cpuUsageStats.count)
 	{
 		assert(memUsageStats.count);
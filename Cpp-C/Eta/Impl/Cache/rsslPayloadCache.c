@@ -0,0 +1,412 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslPayloadCacheImpl.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static RSSL_STATIC_MUTEX_DECL(cacheGlobalLock);
+static RsslInt32 cacheInitCount = 0;
+
+/* Field databases, shared between caches by dictionary key. */
+static RsslQueue cacheDictionaryList;
+
+void rsslCacheSetError(RsslCacheError *pError, RsslRet errorId, const char *format, ...)
+{
+	va_list args;
+
+	if (!pError)
+		return;
+
+	pError->rsslErrorId = errorId;
+	va_start(args, format);
+	vsnprintf(pError->text, MAX_OMM_CACHE_ERROR_TEXT, format, args);
+	va_end(args);
+}
+
+void rsslPayloadCacheLock(RsslPayloadCacheImpl *pCache)
+{
+	RSSL_MUTEX_LOCK(&pCache->lock);
+}
+
+void rsslPayloadCacheUnlock(RsslPayloadCacheImpl *pCache)
+{
+	RSSL_MUTEX_UNLOCK(&pCache->lock);
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheInitialize()
+{
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	if (cacheInitCount++ == 0)
+		rsslInitQueue(&cacheDictionaryList);
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	return RSSL_RET_SUCCESS;
+}
+
+static void cacheDictionaryFree(RsslCacheDictionary *pDictionary)
+{
+	RsslCacheFieldTable *pFieldTable = pDictionary->pFieldTable;
+
+	while (pFieldTable)
+	{
+		RsslCacheFieldTable *pRetired = pFieldTable->pRetired;
+		free(pFieldTable);
+		pFieldTable = pRetired;
+	}
+
+	free(pDictionary->key);
+	free(pDictionary);
+}
+
+static void cacheDictionaryRelease(RsslCacheDictionary *pDictionary)
+{
+	/* Called with cacheGlobalLock held. */
+	if (--pDictionary->refCount > 0)
+		return;
+
+	rsslQueueRemoveLink(&cacheDictionaryList, &pDictionary->link);
+	cacheDictionaryFree(pDictionary);
+}
+
+RSSL_VA_API void rsslPayloadCacheUninitialize()
+{
+	RsslQueueLink *pLink;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	if (cacheInitCount > 0 && --cacheInitCount == 0)
+	{
+		/* Dictionaries still referenced by caches that were not destroyed are released here. */
+		while ((pLink = rsslQueueRemoveFirstLink(&cacheDictionaryList)))
+		{
+			cacheDictionaryFree(RSSL_QUEUE_LINK_TO_OBJECT(RsslCacheDictionary, link, pLink));
+		}
+	}
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+}
+
+RSSL_VA_API RsslBool rsslPayloadCacheIsInitialized()
+{
+	RsslBool isInitialized;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	isInitialized = (cacheInitCount > 0) ? RSSL_TRUE : RSSL_FALSE;
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	return isInitialized;
+}
+
+RSSL_VA_API RsslPayloadCacheHandle rsslPayloadCacheCreate(const RsslPayloadCacheConfigOptions* configOptions,
+		RsslCacheError *error)
+{
+	RsslPayloadCacheImpl *pCache;
+
+	if (!rsslPayloadCacheIsInitialized())
+	{
+		rsslCacheSetError(error, RSSL_RET_INIT_NOT_INITIALIZED, "Payload cache is not initialized.");
+		return NULL;
+	}
+
+	if (!configOptions)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Missing cache configuration options.");
+		return NULL;
+	}
+
+	if (!(pCache = (RsslPayloadCacheImpl*)calloc(1, sizeof(RsslPayloadCacheImpl))))
+	{
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Failed to allocate payload cache.");
+		return NULL;
+	}
+
+	RSSL_MUTEX_INIT(&pCache->lock);
+	pCache->config = *configOptions;
+	rsslInitQueue(&pCache->entryList);
+	rsslCacheErrorClear(error);
+	return (RsslPayloadCacheHandle)pCache;
+}
+
+RSSL_VA_API void rsslPayloadCacheDestroy(RsslPayloadCacheHandle handle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)handle;
+
+	if (!pCache)
+		return;
+
+	rsslPayloadCacheClearAll(handle);
+
+	if (pCache->pDictionary)
+	{
+		RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+		if (cacheInitCount > 0)
+			cacheDictionaryRelease(pCache->pDictionary);
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	}
+
+	RSSL_MUTEX_DESTROY(&pCache->lock);
+	free(pCache);
+}
+
+static RsslCacheDictionary *cacheDictionaryFind(const char *dictionaryKey)
+{
+	RsslQueueLink *pLink;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&cacheDictionaryList, pLink)
+	{
+		RsslCacheDictionary *pDictionary = RSSL_QUEUE_LINK_TO_OBJECT(RsslCacheDictionary, link, pLink);
+		if (strcmp(pDictionary->key, dictionaryKey) == 0)
+			return pDictionary;
+	}
+
+	return NULL;
+}
+
+/* Adds the fields of the RDM Field Dictionary to the field database. Fields already in the
+ * database must be unchanged; nothing is added if any of them differ.
+ * Called with cacheGlobalLock held. Caches sharing the dictionary may be reading the current
+ * field table, so a new table is built and published in its place; the old one is kept until
+ * the dictionary is freed. */
+static RsslRet cacheDictionaryExtend(RsslCacheDictionary *pDictionary, const RsslDataDictionary *rsslDictionary,
+		RsslCacheError *error)
+{
+	RsslCacheFieldTable *pOldTable = pDictionary->pFieldTable;
+	RsslCacheFieldTable *pNewTable;
+	RsslInt32 fid;
+	RsslInt32 minFid = rsslDictionary->minFid;
+	RsslInt32 maxFid = rsslDictionary->maxFid;
+
+	if (pOldTable)
+	{
+		for (fid = rsslDictionary->minFid; fid <= rsslDictionary->maxFid; ++fid)
+		{
+			RsslDictionaryEntry *pEntry = rsslDictionary->entriesArray[fid];
+			const RsslCacheFieldDef *pDef;
+
+			if (!pEntry)
+				continue;
+
+			if ((pDef = rsslCacheFieldTableGetField(pOldTable, (RsslFieldId)fid))
+					&& (pDef->rwfType != pEntry->rwfType || pDef->rwfLength != pEntry->rwfLength))
+			{
+				rsslCacheSetError(error, RSSL_RET_FAILURE,
+						"Dictionary extension for key %s changes the definition of field %d.", pDictionary->key, fid);
+				return RSSL_RET_FAILURE;
+			}
+		}
+
+		if (pOldTable->minFid < minFid) minFid = pOldTable->minFid;
+		if (pOldTable->maxFid > maxFid) maxFid = pOldTable->maxFid;
+	}
+
+	if (!(pNewTable = (RsslCacheFieldTable*)calloc(1, sizeof(RsslCacheFieldTable)
+					+ (size_t)(maxFid - minFid + 1) * sizeof(RsslCacheFieldDef))))
+	{
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Failed to allocate field database.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pNewTable->pRetired = pOldTable;
+	pNewTable->minFid = minFid;
+	pNewTable->maxFid = maxFid;
+	pNewTable->pFieldDefs = (RsslCacheFieldDef*)(pNewTable + 1);
+
+	if (pOldTable)
+		memcpy(&pNewTable->pFieldDefs[pOldTable->minFid - minFid], pOldTable->pFieldDefs,
+				(size_t)(pOldTable->maxFid - pOldTable->minFid + 1) * sizeof(RsslCacheFieldDef));
+
+	for (fid = rsslDictionary->minFid; fid <= rsslDictionary->maxFid; ++fid)
+	{
+		RsslDictionaryEntry *pEntry = rsslDictionary->entriesArray[fid];
+
+		if (!pEntry)
+			continue;
+
+		pNewTable->pFieldDefs[fid - minFid].rwfType = pEntry->rwfType;
+		pNewTable->pFieldDefs[fid - minFid].rwfLength = (RsslUInt16)pEntry->rwfLength;
+	}
+
+	RSSL_CACHE_STORE_RELEASE(pDictionary->pFieldTable, pNewTable);
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheSetDictionary(RsslPayloadCacheHandle cacheHandle,
+		const RsslDataDictionary *rsslDictionary,
+		const char* dictionaryKey,
+		RsslCacheError* error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslCacheDictionary *pDictionary;
+	RsslRet ret;
+
+	if (!pCache || !rsslDictionary || !dictionaryKey)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Missing cache handle, dictionary or dictionary key.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (!rsslDictionary->isInitialized || !rsslDictionary->entriesArray || rsslDictionary->numberOfEntries == 0)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Field dictionary for key %s is not loaded.", dictionaryKey);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+
+	if (!(pDictionary = cacheDictionaryFind(dictionaryKey)))
+	{
+		if (!(pDictionary = (RsslCacheDictionary*)calloc(1, sizeof(RsslCacheDictionary)))
+				|| !(pDictionary->key = (char*)malloc(strlen(dictionaryKey) + 1)))
+		{
+			free(pDictionary);
+			RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+			rsslCacheSetError(error, RSSL_RET_FAILURE, "Failed to allocate field database.");
+			return RSSL_RET_FAILURE;
+		}
+
+		strcpy(pDictionary->key, dictionaryKey);
+		rsslQueueAddLinkToBack(&cacheDictionaryList, &pDictionary->link);
+	}
+	else if (pCache->pDictionary && pCache->pDictionary != pDictionary)
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Cache already has a dictionary set by another key.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((ret = cacheDictionaryExtend(pDictionary, rsslDictionary, error)) != RSSL_RET_SUCCESS)
+	{
+		if (pDictionary->refCount == 0)
+		{
+			++pDictionary->refCount;
+			cacheDictionaryRelease(pDictionary);
+		}
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		return ret;
+	}
+
+	if (!pCache->pDictionary)
+	{
+		/* The dictionary is kept for as long as a cache uses it, or until the last uninitialize. */
+		++pDictionary->refCount;
+		pCache->pDictionary = pDictionary;
+	}
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	rsslCacheErrorClear(error);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheBindDictionary(RsslPayloadCacheHandle cacheHandle,
+		const RsslDataDictionary *rsslDictionary,
+		const char* dictionaryKey,
+		RsslCacheError* error)
+{
+	return rsslPayloadCacheSetDictionary(cacheHandle, rsslDictionary, dictionaryKey, error);
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheSetSharedDictionaryKey(RsslPayloadCacheHandle cacheHandle,
+		const char* dictionaryKey,
+		RsslCacheError *error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslCacheDictionary *pDictionary;
+
+	if (!pCache || !dictionaryKey)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Missing cache handle or dictionary key.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+
+	if (!(pDictionary = cacheDictionaryFind(dictionaryKey)))
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Unknown dictionary key %s.", dictionaryKey);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (pCache->pDictionary != pDictionary)
+	{
+		if (pCache->pDictionary)
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+			rsslCacheSetError(error, RSSL_RET_FAILURE, "Cache already has a dictionary set by another key.");
+			return RSSL_RET_FAILURE;
+		}
+
+		++pDictionary->refCount;
+		pCache->pDictionary = pDictionary;
+	}
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	rsslCacheErrorClear(error);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheBindSharedDictionaryKey(RsslPayloadCacheHandle cacheHandle,
+		const char* dictionaryKey,
+		RsslCacheError *error)
+{
+	return rsslPayloadCacheSetSharedDictionaryKey(cacheHandle, dictionaryKey, error);
+}
+
+RSSL_VA_API RsslUInt rsslPayloadCacheGetEntryCount(RsslPayloadCacheHandle cacheHandle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslUInt count;
+
+	if (!pCache)
+		return 0;
+
+	rsslPayloadCacheLock(pCache);
+	count = rsslQueueGetElementCount(&pCache->entryList);
+	rsslPayloadCacheUnlock(pCache);
+	return count;
+}
+
+RSSL_VA_API RsslUInt rsslPayloadCacheGetEntryList(RsslPayloadCacheHandle cacheHandle,
+		RsslPayloadEntryHandle arrHandles[],
+		RsslUInt arrSize)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslQueueLink *pLink;
+	RsslUInt count = 0;
+
+	if (!pCache || !arrHandles)
+		return 0;
+
+	rsslPayloadCacheLock(pCache);
+	RSSL_QUEUE_FOR_EACH_LINK(&pCache->entryList, pLink)
+	{
+		if (count == arrSize)
+			break;
+		arrHandles[count++] = (RsslPayloadEntryHandle)RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, link, pLink);
+	}
+	rsslPayloadCacheUnlock(pCache);
+	return count;
+}
+
+RSSL_VA_API void rsslPayloadCacheClearAll(RsslPayloadCacheHandle cacheHandle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslQueueLink *pLink;
+
+	if (!pCache)
+		return;
+
+	rsslPayloadCacheLock(pCache);
+	while ((pLink = rsslQueueRemoveFirstLink(&pCache->entryList)))
+	{
+		RsslPayloadEntryImpl *pEntry = RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, link, pLink);
+		rsslPayloadEntryCleanup(pEntry);
+		free(pEntry);
+	}
+	rsslPayloadCacheUnlock(pCache);
+}
@@ -0,0 +1,1116 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslPayloadCacheImpl.h"
+#include "rtr/rsslIterators.h"
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslMap.h"
+#include "rtr/rsslPrimitiveDecoders.h"
+#include "rtr/rsslPrimitiveEncoders.h"
+#include "decodeRoutines.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Largest standard encoding of a non-buffer primitive type (RsslDateTime with nanoseconds). */
+#define RSSL_CACHE_MAX_PRIMITIVE_LENGTH 32
+
+/* Initial number of slots in a field list. */
+#define RSSL_CACHE_INITIAL_SLOT_COUNT 16
+
+/* Initial number of buckets in a map's entry table. */
+#define RSSL_CACHE_INITIAL_MAP_BUCKETS 64
+
+/* Largest buffer tried when tracing an entry. */
+#define RSSL_CACHE_MAX_TRACE_BUFFER (64 * 1024 * 1024)
+
+/*** Arena ***/
+
+static char *cacheArenaAlloc(RsslCacheArena *pArena, RsslUInt32 size)
+{
+	RsslCacheArenaBlock *pBlock = pArena->pBlocks;
+	char *pData;
+
+	if (!pBlock || pBlock->size - pBlock->used < size)
+	{
+		RsslUInt32 blockSize = (size > RSSL_CACHE_ARENA_BLOCK_SIZE) ? size : RSSL_CACHE_ARENA_BLOCK_SIZE;
+
+		if (!(pBlock = (RsslCacheArenaBlock*)malloc(sizeof(RsslCacheArenaBlock) + blockSize)))
+			return NULL;
+
+		pBlock->size = blockSize;
+		pBlock->used = 0;
+
+		if (pArena->pBlocks && size > RSSL_CACHE_ARENA_BLOCK_SIZE / 2)
+		{
+			/* Large value; keep allocating from the current block. */
+			pBlock->pNext = pArena->pBlocks->pNext;
+			pArena->pBlocks->pNext = pBlock;
+		}
+		else
+		{
+			pBlock->pNext = pArena->pBlocks;
+			pArena->pBlocks = pBlock;
+		}
+	}
+
+	pData = (char*)(pBlock + 1) + pBlock->used;
+	pBlock->used += size;
+	pArena->usedBytes += size;
+	pArena->liveBytes += size;
+	return pData;
+}
+
+RTR_C_INLINE void cacheArenaRelease(RsslCacheArena *pArena, RsslUInt32 size)
+{
+	pArena->liveBytes -= size;
+}
+
+static void cacheArenaCleanup(RsslCacheArena *pArena)
+{
+	RsslCacheArenaBlock *pBlock;
+
+	while ((pBlock = pArena->pBlocks))
+	{
+		pArena->pBlocks = pBlock->pNext;
+		free(pBlock);
+	}
+
+	pArena->usedBytes = 0;
+	pArena->liveBytes = 0;
+}
+
+/*** Field lists ***/
+
+RTR_C_INLINE RsslUInt32 cacheFieldIndexPosition(RsslCacheFieldList *pFieldList, RsslFieldId fieldId)
+{
+	return ((RsslUInt32)(RsslUInt16)fieldId * 2654435761u) & pFieldList->indexMask;
+}
+
+static RsslCacheFieldSlot *cacheFieldListFind(RsslCacheFieldList *pFieldList, RsslFieldId fieldId)
+{
+	RsslUInt32 pos;
+
+	if (!pFieldList->pIndex)
+		return NULL;
+
+	for (pos = cacheFieldIndexPosition(pFieldList, fieldId); pFieldList->pIndex[pos];
+			pos = (pos + 1) & pFieldList->indexMask)
+	{
+		RsslCacheFieldSlot *pSlot = &pFieldList->pSlots[pFieldList->pIndex[pos] - 1];
+		if (pSlot->fieldId == fieldId)
+			return pSlot;
+	}
+
+	return NULL;
+}
+
+static RsslCacheFieldSlot *cacheFieldListAdd(RsslCacheFieldList *pFieldList, RsslFieldId fieldId)
+{
+	RsslCacheFieldSlot *pSlot;
+	RsslUInt32 pos;
+
+	if (pFieldList->slotCount == pFieldList->slotCapacity)
+	{
+		RsslUInt32 slotCapacity = pFieldList->slotCapacity ? pFieldList->slotCapacity * 2 : RSSL_CACHE_INITIAL_SLOT_COUNT;
+		RsslCacheFieldSlot *pSlots;
+
+		if (!(pSlots = (RsslCacheFieldSlot*)realloc(pFieldList->pSlots, slotCapacity * sizeof(RsslCacheFieldSlot))))
+			return NULL;
+
+		pFieldList->pSlots = pSlots;
+		pFieldList->slotCapacity = slotCapacity;
+	}
+
+	/* Keep the index at most half full. */
+	if (!pFieldList->pIndex || (pFieldList->slotCount + 1) * 2 > pFieldList->indexMask + 1)
+	{
+		RsslUInt32 indexSize = pFieldList->pIndex ? (pFieldList->indexMask + 1) * 2 : RSSL_CACHE_INITIAL_SLOT_COUNT * 2;
+		RsslUInt32 *pIndex;
+		RsslUInt32 i;
+
+		if (!(pIndex = (RsslUInt32*)calloc(indexSize, sizeof(RsslUInt32))))
+			return NULL;
+
+		free(pFieldList->pIndex);
+		pFieldList->pIndex = pIndex;
+		pFieldList->indexMask = indexSize - 1;
+
+		for (i = 0; i < pFieldList->slotCount; ++i)
+		{
+			for (pos = cacheFieldIndexPosition(pFieldList, pFieldList->pSlots[i].fieldId); pIndex[pos];
+					pos = (pos + 1) & pFieldList->indexMask);
+			pIndex[pos] = i + 1;
+		}
+	}
+
+	for (pos = cacheFieldIndexPosition(pFieldList, fieldId); pFieldList->pIndex[pos];
+			pos = (pos + 1) & pFieldList->indexMask);
+
+	pSlot = &pFieldList->pSlots[pFieldList->slotCount];
+	pSlot->fieldId = fieldId;
+	pSlot->length = 0;
+	pSlot->capacity = 0;
+	pFieldList->pIndex[pos] = ++pFieldList->slotCount;
+	return pSlot;
+}
+
+/* Removes all fields. The slot and index arrays are kept for reuse. */
+static void cacheFieldListClear(RsslCacheArena *pArena, RsslCacheFieldList *pFieldList)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < pFieldList->slotCount; ++i)
+		cacheArenaRelease(pArena, pFieldList->pSlots[i].capacity);
+
+	if (pFieldList->pIndex)
+		memset(pFieldList->pIndex, 0, (pFieldList->indexMask + 1) * sizeof(RsslUInt32));
+
+	pFieldList->slotCount = 0;
+	pFieldList->flags = 0;
+}
+
+static void cacheFieldListCleanup(RsslCacheArena *pArena, RsslCacheFieldList *pFieldList)
+{
+	cacheFieldListClear(pArena, pFieldList);
+	free(pFieldList->pSlots);
+	free(pFieldList->pIndex);
+	memset(pFieldList, 0, sizeof(RsslCacheFieldList));
+}
+
+/* Copies an encoded value into the slot. Arena space for a longer value is sized by the dictionary
+ * length of the field, so later updates to it are normally copied in place. */
+static RsslRet cacheFieldSlotSet(RsslCacheArena *pArena, RsslCacheFieldSlot *pSlot, const RsslCacheFieldDef *pDef,
+		const char *pData, RsslUInt32 length)
+{
+	if (pSlot->capacity < length && (pSlot->capacity || length > RSSL_CACHE_INLINE_DATA_SIZE))
+	{
+		RsslUInt32 capacity = pDef->rwfLength;
+		char *pNewData;
+
+		if (capacity > RSSL_CACHE_MAX_RESERVED_LENGTH)
+			capacity = RSSL_CACHE_MAX_RESERVED_LENGTH;
+		if (capacity < length)
+			capacity = length;
+
+		if (!(pNewData = cacheArenaAlloc(pArena, capacity)))
+			return RSSL_RET_FAILURE;
+
+		cacheArenaRelease(pArena, pSlot->capacity);
+		pSlot->value.pData = pNewData;
+		pSlot->capacity = capacity;
+	}
+
+	memcpy(rsslCacheFieldSlotData(pSlot), pData, length);
+	pSlot->length = length;
+	return RSSL_RET_SUCCESS;
+}
+
+/*** Encoded buffers ***/
+
+static RsslRet cacheBufferSet(RsslCacheArena *pArena, RsslCacheBuffer *pBuffer, const RsslBuffer *pData)
+{
+	if (pBuffer->capacity < pData->length)
+	{
+		char *pNewData;
+
+		if (!(pNewData = cacheArenaAlloc(pArena, pData->length)))
+			return RSSL_RET_FAILURE;
+
+		cacheArenaRelease(pArena, pBuffer->capacity);
+		pBuffer->data = pNewData;
+		pBuffer->capacity = pData->length;
+	}
+
+	if (pData->length)
+		memcpy(pBuffer->data, pData->data, pData->length);
+	pBuffer->length = pData->length;
+	return RSSL_RET_SUCCESS;
+}
+
+static void cacheBufferClear(RsslCacheArena *pArena, RsslCacheBuffer *pBuffer)
+{
+	cacheArenaRelease(pArena, pBuffer->capacity);
+	pBuffer->data = NULL;
+	pBuffer->length = 0;
+	pBuffer->capacity = 0;
+}
+
+/*** Compaction ***/
+
+static void cacheFieldListMove(RsslCacheArena *pArena, RsslCacheFieldList *pFieldList)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < pFieldList->slotCount; ++i)
+	{
+		RsslCacheFieldSlot *pSlot = &pFieldList->pSlots[i];
+		char *pNewData;
+
+		if (!pSlot->capacity)
+			continue;
+
+		pNewData = cacheArenaAlloc(pArena, pSlot->capacity);
+		memcpy(pNewData, pSlot->value.pData, pSlot->length);
+		pSlot->value.pData = pNewData;
+	}
+}
+
+static void cacheBufferMove(RsslCacheArena *pArena, RsslCacheBuffer *pBuffer)
+{
+	char *pNewData;
+
+	if (!pBuffer->capacity)
+		return;
+
+	pNewData = cacheArenaAlloc(pArena, pBuffer->capacity);
+	memcpy(pNewData, pBuffer->data, pBuffer->length);
+	pBuffer->data = pNewData;
+}
+
+/* Moves the live data of the entry into a single new block once most of the arena has been given up. */
+static void cacheEntryCompact(RsslPayloadEntryImpl *pEntry)
+{
+	RsslCacheArena newArena;
+	RsslCacheArenaBlock *pBlock;
+	RsslQueueLink *pLink;
+	RsslUInt32 wasted = pEntry->arena.usedBytes - pEntry->arena.liveBytes;
+
+	if (wasted <= pEntry->arena.liveBytes || wasted <= RSSL_CACHE_ARENA_BLOCK_SIZE)
+		return;
+
+	/* Allocate the whole block up front, so that moving the data cannot fail. */
+	if (!(pBlock = (RsslCacheArenaBlock*)malloc(sizeof(RsslCacheArenaBlock) + pEntry->arena.liveBytes)))
+		return;
+
+	pBlock->pNext = NULL;
+	pBlock->size = pEntry->arena.liveBytes;
+	pBlock->used = 0;
+	newArena.pBlocks = pBlock;
+	newArena.usedBytes = 0;
+	newArena.liveBytes = 0;
+
+	cacheFieldListMove(&newArena, &pEntry->fieldList);
+	cacheFieldListMove(&newArena, &pEntry->map.summaryFieldList);
+	cacheBufferMove(&newArena, &pEntry->map.summaryData);
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pEntry->map.entryList, pLink)
+	{
+		RsslCacheMapEntry *pMapEntry = RSSL_QUEUE_LINK_TO_OBJECT(RsslCacheMapEntry, link, pLink);
+		cacheFieldListMove(&newArena, &pMapEntry->fieldList);
+		cacheBufferMove(&newArena, &pMapEntry->encData);
+		cacheBufferMove(&newArena, &pMapEntry->permData);
+	}
+
+	cacheArenaCleanup(&pEntry->arena);
+	pEntry->arena = newArena;
+}
+
+/*** Maps ***/
+
+static void cacheMapEntryDestroy(RsslPayloadEntryImpl *pEntry, RsslCacheMapEntry *pMapEntry)
+{
+	rsslHashTableRemoveLink(&pEntry->map.entryTable, &pMapEntry->hashLink);
+	rsslQueueRemoveLink(&pEntry->map.entryList, &pMapEntry->link);
+	cacheFieldListCleanup(&pEntry->arena, &pMapEntry->fieldList);
+	cacheBufferClear(&pEntry->arena, &pMapEntry->encData);
+	cacheBufferClear(&pEntry->arena, &pMapEntry->permData);
+	free(pMapEntry);
+	++pEntry->map.changeCount;
+}
+
+static RsslCacheMapEntry *cacheMapEntryCreate(RsslPayloadEntryImpl *pEntry, const RsslBuffer *pKey)
+{
+	RsslCacheMapEntry *pMapEntry;
+
+	/* The key is copied to the end of the structure. */
+	if (!(pMapEntry = (RsslCacheMapEntry*)calloc(1, sizeof(RsslCacheMapEntry) + pKey->length)))
+		return NULL;
+
+	pMapEntry->key.data = (char*)(pMapEntry + 1);
+	pMapEntry->key.length = pKey->length;
+	memcpy(pMapEntry->key.data, pKey->data, pKey->length);
+
+	rsslHashLinkInit(&pMapEntry->hashLink);
+	rsslHashTableInsertLink(&pEntry->map.entryTable, &pMapEntry->hashLink, &pMapEntry->key, NULL);
+	rsslQueueAddLinkToBack(&pEntry->map.entryList, &pMapEntry->link);
+	++pEntry->map.changeCount;
+	return pMapEntry;
+}
+
+static void cacheMapClear(RsslPayloadEntryImpl *pEntry)
+{
+	RsslQueueLink *pLink;
+
+	while ((pLink = rsslQueuePeekFront(&pEntry->map.entryList)))
+		cacheMapEntryDestroy(pEntry, RSSL_QUEUE_LINK_TO_OBJECT(RsslCacheMapEntry, link, pLink));
+
+	cacheFieldListClear(&pEntry->arena, &pEntry->map.summaryFieldList);
+	cacheBufferClear(&pEntry->arena, &pEntry->map.summaryData);
+	pEntry->map.flags = 0;
+}
+
+/*** Entry ***/
+
+static void cacheEntryClear(RsslPayloadEntryImpl *pEntry)
+{
+	if (pEntry->dataType == RSSL_DT_MAP)
+		cacheMapClear(pEntry);
+
+	cacheFieldListClear(&pEntry->arena, &pEntry->fieldList);
+	pEntry->dataType = RSSL_DT_UNKNOWN;
+
+	/* Nothing in the arena is referenced any more; keep the most recent block for reuse. */
+	if (pEntry->arena.pBlocks)
+	{
+		RsslCacheArenaBlock *pBlock = pEntry->arena.pBlocks;
+
+		pEntry->arena.pBlocks = pBlock->pNext;
+		cacheArenaCleanup(&pEntry->arena);
+		pBlock->pNext = NULL;
+		pBlock->used = 0;
+		pEntry->arena.pBlocks = pBlock;
+	}
+}
+
+void rsslPayloadEntryCleanup(RsslPayloadEntryImpl *pEntry)
+{
+	if (pEntry->map.entryTable.queueList)
+	{
+		cacheMapClear(pEntry);
+		rsslHashTableCleanup(&pEntry->map.entryTable);
+	}
+
+	cacheFieldListCleanup(&pEntry->arena, &pEntry->fieldList);
+	cacheFieldListCleanup(&pEntry->arena, &pEntry->map.summaryFieldList);
+	cacheArenaCleanup(&pEntry->arena);
+}
+
+RSSL_VA_API RsslPayloadEntryHandle rsslPayloadEntryCreate(RsslPayloadCacheHandle cacheHandle, RsslCacheError *error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslPayloadEntryImpl *pEntry;
+
+	if (!pCache)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Missing cache handle.");
+		return NULL;
+	}
+
+	if (!pCache->pDictionary)
+	{
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "No dictionary has been set for this cache.");
+		return NULL;
+	}
+
+	rsslPayloadCacheLock(pCache);
+
+	if (pCache->config.maxItems && rsslQueueGetElementCount(&pCache->entryList) >= pCache->config.maxItems)
+	{
+		rsslPayloadCacheUnlock(pCache);
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Cache has reached its limit of " RTR_LLU " entries.", pCache->config.maxItems);
+		return NULL;
+	}
+
+	if (!(pEntry = (RsslPayloadEntryImpl*)calloc(1, sizeof(RsslPayloadEntryImpl))))
+	{
+		rsslPayloadCacheUnlock(pCache);
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Failed to allocate payload entry.");
+		return NULL;
+	}
+
+	pEntry->pCache = pCache;
+	pEntry->dataType = RSSL_DT_UNKNOWN;
+	rsslInitQueue(&pEntry->map.entryList);
+	rsslQueueAddLinkToBack(&pCache->entryList, &pEntry->link);
+
+	rsslPayloadCacheUnlock(pCache);
+	rsslCacheErrorClear(error);
+	return (RsslPayloadEntryHandle)pEntry;
+}
+
+RSSL_VA_API void rsslPayloadEntryDestroy(RsslPayloadEntryHandle handle)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslPayloadCacheImpl *pCache;
+
+	if (!pEntry)
+		return;
+
+	pCache = pEntry->pCache;
+	rsslPayloadCacheLock(pCache);
+	rsslQueueRemoveLink(&pCache->entryList, &pEntry->link);
+	rsslPayloadCacheUnlock(pCache);
+
+	rsslPayloadEntryCleanup(pEntry);
+	free(pEntry);
+}
+
+RSSL_VA_API void rsslPayloadEntryClear(RsslPayloadEntryHandle handle)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+
+	if (!pEntry)
+		return;
+
+	rsslPayloadCacheLock(pEntry->pCache);
+	cacheEntryClear(pEntry);
+	rsslPayloadCacheUnlock(pEntry->pCache);
+}
+
+RSSL_VA_API RsslContainerType rsslPayloadEntryGetDataType(RsslPayloadEntryHandle handle)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+
+	return pEntry ? pEntry->dataType : RSSL_DT_UNKNOWN;
+}
+
+/*** Apply ***/
+
+/* Result of applying data to an entry; warnings do not stop the apply. */
+typedef struct
+{
+	RsslCacheError	*pError;
+	RsslBool		hasWarning;
+} RsslCacheApplyStatus;
+
+static void cacheApplyWarning(RsslCacheApplyStatus *pStatus, const char *text, RsslFieldId fieldId)
+{
+	/* Only the first warning is reported. */
+	if (pStatus->hasWarning)
+		return;
+
+	pStatus->hasWarning = RSSL_TRUE;
+	rsslCacheSetError(pStatus->pError, RSSL_RET_SUCCESS, text, fieldId);
+}
+
+/* Converts a field decoded from set-defined data to its standard encoding. */
+static RsslRet cacheNormalizeSetField(RsslDecodeIterator *dIter, RsslDataType dataType, char *pWorkspace,
+		RsslBuffer *pEncData)
+{
+	union
+	{
+		RsslInt			intValue;
+		RsslUInt		uintValue;
+		RsslFloat		floatValue;
+		RsslDouble		doubleValue;
+		RsslReal		realValue;
+		RsslDate		dateValue;
+		RsslTime		timeValue;
+		RsslDateTime	dateTimeValue;
+		RsslQos			qosValue;
+		RsslState		stateValue;
+		RsslEnum		enumValue;
+		RsslBuffer		bufferValue;
+	} value;
+	RsslEncodeIterator eIter;
+	RsslBuffer workspace;
+	RsslRet ret;
+
+	if ((ret = rsslDecodePrimitiveType(dIter, dataType, &value)) == RSSL_RET_BLANK_DATA)
+	{
+		pEncData->length = 0;
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	switch(dataType)
+	{
+		case RSSL_DT_BUFFER:
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+		case RSSL_DT_RMTES_STRING:
+			*pEncData = value.bufferValue;
+			return RSSL_RET_SUCCESS;
+		default:
+			break;
+	}
+
+	workspace.data = pWorkspace;
+	workspace.length = RSSL_CACHE_MAX_PRIMITIVE_LENGTH;
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorBuffer(&eIter, &workspace);
+
+	if ((ret = rsslEncodePrimitiveType(&eIter, dataType, &value)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pEncData->data = pWorkspace;
+	pEncData->length = rsslGetEncodedBufferLength(&eIter);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Applies a field list. When addFields is false, only fields already in the list are updated. */
+static RsslRet cacheApplyFieldList(RsslPayloadEntryImpl *pEntry, RsslCacheFieldList *pCacheFieldList,
+		RsslDecodeIterator *dIter, RsslLocalFieldSetDefDb *pSetDb, RsslBool addFields, RsslCacheApplyStatus *pStatus)
+{
+	/* Read once, so the whole field list is applied with one table even if the dictionary is extended meanwhile. */
+	const RsslCacheFieldTable *pFieldTable = rsslCacheDictionaryGetFieldTable(pEntry->pCache->pDictionary);
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	char workspace[RSSL_CACHE_MAX_PRIMITIVE_LENGTH];
+	RsslRet ret;
+
+	if ((ret = rsslDecodeFieldList(dIter, &fieldList, pSetDb)) == RSSL_RET_NO_DATA)
+		return RSSL_RET_SUCCESS;
+	else if (ret < RSSL_RET_SUCCESS)
+	{
+		rsslCacheSetError(pStatus->pError, ret, "Failed to decode field list (%d).", ret);
+		return ret;
+	}
+
+	if (rsslFieldListCheckHasInfo(&fieldList))
+	{
+		pCacheFieldList->flags = RSSL_FLF_HAS_FIELD_LIST_INFO;
+		pCacheFieldList->dictionaryId = fieldList.dictionaryId;
+		pCacheFieldList->fieldListNum = fieldList.fieldListNum;
+	}
+
+	while ((ret = rsslDecodeFieldEntry(dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		const RsslCacheFieldDef *pDef;
+		RsslCacheFieldSlot *pSlot;
+		RsslBuffer encData;
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, ret, "Failed to decode field entry (%d).", ret);
+			return ret;
+		}
+
+		if (!(pDef = rsslCacheFieldTableGetField(pFieldTable, fieldEntry.fieldId)))
+		{
+			cacheApplyWarning(pStatus, "Field %d is not in the dictionary and was not cached.", fieldEntry.fieldId);
+			continue;
+		}
+
+		if (!(pSlot = cacheFieldListFind(pCacheFieldList, fieldEntry.fieldId)))
+		{
+			if (!addFields)
+			{
+				cacheApplyWarning(pStatus, "Update to field %d ignored, as the field is not in the cache entry.", fieldEntry.fieldId);
+				continue;
+			}
+
+			if (!(pSlot = cacheFieldListAdd(pCacheFieldList, fieldEntry.fieldId)))
+			{
+				rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE, "Failed to allocate field %d.", fieldEntry.fieldId);
+				return RSSL_RET_FAILURE;
+			}
+		}
+
+		/* Fields from set-defined data are stored in their standard encoding. */
+		if (fieldEntry.dataType == RSSL_DT_UNKNOWN)
+			encData = fieldEntry.encData;
+		else if ((ret = cacheNormalizeSetField(dIter, fieldEntry.dataType, workspace, &encData)) < RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, ret, "Failed to decode set-defined field %d (%d).", fieldEntry.fieldId, ret);
+			return ret;
+		}
+
+		if (cacheFieldSlotSet(&pEntry->arena, pSlot, pDef, encData.data, encData.length) != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE, "Failed to allocate data for field %d.", fieldEntry.fieldId);
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet cacheApplyMap(RsslPayloadEntryImpl *pEntry, RsslDecodeIterator *dIter, RsslCacheApplyStatus *pStatus)
+{
+	RsslCacheMap *pCacheMap = &pEntry->map;
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslLocalFieldSetDefDb setDb;
+	char setDefMemory[3825];
+	RsslLocalFieldSetDefDb *pSetDb = NULL;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeMap(dIter, &map)) == RSSL_RET_NO_DATA)
+		return RSSL_RET_SUCCESS;
+	else if (ret < RSSL_RET_SUCCESS)
+	{
+		rsslCacheSetError(pStatus->pError, ret, "Failed to decode map (%d).", ret);
+		return ret;
+	}
+
+	if (!pCacheMap->entryTable.queueList)
+	{
+		RsslErrorInfo errorInfo;
+
+		if (rsslHashTableInit(&pCacheMap->entryTable, RSSL_CACHE_INITIAL_MAP_BUCKETS, rsslHashBufferSum,
+				rsslHashBufferCompare, RSSL_TRUE, &errorInfo) != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE, "Failed to allocate map entry table.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	if (rsslQueueGetElementCount(&pCacheMap->entryList) == 0 && !pCacheMap->flags)
+	{
+		pCacheMap->keyPrimitiveType = map.keyPrimitiveType;
+		pCacheMap->containerType = map.containerType;
+	}
+	else if (pCacheMap->keyPrimitiveType != map.keyPrimitiveType || pCacheMap->containerType != map.containerType)
+	{
+		rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE,
+				"Map key type %d or container type %d does not match the cache entry.", map.keyPrimitiveType, map.containerType);
+		return RSSL_RET_FAILURE;
+	}
+
+	pCacheMap->flags |= map.flags & (RSSL_MPF_HAS_KEY_FIELD_ID | RSSL_MPF_HAS_SUMMARY_DATA | RSSL_MPF_HAS_PER_ENTRY_PERM_DATA);
+	if (rsslMapCheckHasKeyFieldId(&map))
+		pCacheMap->keyFieldId = map.keyFieldId;
+
+	if (rsslMapCheckHasSetDefs(&map))
+	{
+		rsslClearLocalFieldSetDefDb(&setDb);
+		setDb.entries.data = setDefMemory;
+		setDb.entries.length = sizeof(setDefMemory);
+		if ((ret = rsslDecodeLocalFieldSetDefDb(dIter, &setDb)) < RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, ret, "Failed to decode map set definitions (%d).", ret);
+			return ret;
+		}
+		pSetDb = &setDb;
+	}
+
+	if (rsslMapCheckHasSummaryData(&map))
+	{
+		if (map.containerType == RSSL_DT_FIELD_LIST)
+		{
+			if ((ret = cacheApplyFieldList(pEntry, &pCacheMap->summaryFieldList, dIter, pSetDb, RSSL_TRUE, pStatus)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+		else if (cacheBufferSet(&pEntry->arena, &pCacheMap->summaryData, &map.encSummaryData) != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE, "Failed to allocate map summary data.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	while ((ret = rsslDecodeMapEntry(dIter, &mapEntry, NULL)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RsslHashLink *pHashLink;
+		RsslCacheMapEntry *pMapEntry;
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, ret, "Failed to decode map entry (%d).", ret);
+			return ret;
+		}
+
+		pHashLink = rsslHashTableFind(&pCacheMap->entryTable, &mapEntry.encKey, NULL);
+		pMapEntry = pHashLink ? RSSL_HASH_LINK_TO_OBJECT(RsslCacheMapEntry, hashLink, pHashLink) : NULL;
+
+		if (mapEntry.action == RSSL_MPEA_DELETE_ENTRY)
+		{
+			if (pMapEntry)
+				cacheMapEntryDestroy(pEntry, pMapEntry);
+			continue;
+		}
+
+		if (!pMapEntry)
+		{
+			if (!(pMapEntry = cacheMapEntryCreate(pEntry, &mapEntry.encKey)))
+			{
+				rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE, "Failed to allocate map entry.");
+				return RSSL_RET_FAILURE;
+			}
+		}
+		else if (mapEntry.action == RSSL_MPEA_ADD_ENTRY)
+		{
+			/* An add replaces the entry. */
+			cacheFieldListClear(&pEntry->arena, &pMapEntry->fieldList);
+			cacheBufferClear(&pEntry->arena, &pMapEntry->encData);
+			cacheBufferClear(&pEntry->arena, &pMapEntry->permData);
+			pMapEntry->hasPermData = RSSL_FALSE;
+		}
+
+		if (rsslMapEntryCheckHasPermData(&mapEntry))
+		{
+			if (cacheBufferSet(&pEntry->arena, &pMapEntry->permData, &mapEntry.permData) != RSSL_RET_SUCCESS)
+			{
+				rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE, "Failed to allocate map entry permission data.");
+				return RSSL_RET_FAILURE;
+			}
+			pMapEntry->hasPermData = RSSL_TRUE;
+		}
+
+		if (map.containerType == RSSL_DT_FIELD_LIST)
+		{
+			if ((ret = cacheApplyFieldList(pEntry, &pMapEntry->fieldList, dIter, pSetDb, RSSL_TRUE, pStatus)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+		else if (cacheBufferSet(&pEntry->arena, &pMapEntry->encData, &mapEntry.encData) != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pStatus->pError, RSSL_RET_FAILURE, "Failed to allocate map entry data.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryApply(RsslPayloadEntryHandle handle,
+		RsslDecodeIterator *dIter,
+		RsslMsg *msg,
+		RsslCacheError *errorInfo)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslCacheApplyStatus status;
+	RsslContainerType containerType;
+	RsslRet ret;
+
+	if (!pEntry || !dIter || !msg)
+	{
+		rsslCacheSetError(errorInfo, RSSL_RET_INVALID_ARGUMENT, "Missing payload entry, decode iterator or message.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	switch(msg->msgBase.msgClass)
+	{
+		case RSSL_MC_REFRESH:
+		case RSSL_MC_UPDATE:
+		case RSSL_MC_STATUS:
+			break;
+		default:
+			rsslCacheSetError(errorInfo, RSSL_RET_INVALID_ARGUMENT, "Message class %d cannot be applied to the cache.",
+					msg->msgBase.msgClass);
+			return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	containerType = msg->msgBase.containerType;
+	status.pError = errorInfo;
+	status.hasWarning = RSSL_FALSE;
+	rsslCacheErrorClear(errorInfo);
+
+	rsslPayloadCacheLock(pEntry->pCache);
+
+	if ((msg->msgBase.msgClass == RSSL_MC_REFRESH && rsslRefreshMsgCheckClearCache(&msg->refreshMsg))
+			|| (msg->msgBase.msgClass == RSSL_MC_STATUS && rsslStatusMsgCheckClearCache(&msg->statusMsg)))
+		cacheEntryClear(pEntry);
+
+	if (msg->msgBase.msgClass == RSSL_MC_STATUS || containerType == RSSL_DT_NO_DATA)
+	{
+		rsslPayloadCacheUnlock(pEntry->pCache);
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (pEntry->dataType != RSSL_DT_UNKNOWN && pEntry->dataType != containerType)
+	{
+		rsslPayloadCacheUnlock(pEntry->pCache);
+		rsslCacheSetError(errorInfo, RSSL_RET_FAILURE, "Container type %d does not match the cache entry type %d.",
+				containerType, pEntry->dataType);
+		return RSSL_RET_FAILURE;
+	}
+
+	switch(containerType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			pEntry->dataType = RSSL_DT_FIELD_LIST;
+			ret = cacheApplyFieldList(pEntry, &pEntry->fieldList, dIter, NULL,
+					(msg->msgBase.msgClass == RSSL_MC_REFRESH) ? RSSL_TRUE : RSSL_FALSE, &status);
+			break;
+		case RSSL_DT_MAP:
+			pEntry->dataType = RSSL_DT_MAP;
+			ret = cacheApplyMap(pEntry, dIter, &status);
+			break;
+		default:
+			rsslPayloadCacheUnlock(pEntry->pCache);
+			rsslCacheSetError(errorInfo, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Container type %d is not supported by the cache.",
+					containerType);
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	cacheEntryCompact(pEntry);
+	rsslPayloadCacheUnlock(pEntry->pCache);
+
+	if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Warnings are reported as a failure, with the rsslErrorId left as RSSL_RET_SUCCESS. */
+	return status.hasWarning ? RSSL_RET_FAILURE : RSSL_RET_SUCCESS;
+}
+
+/*** Retrieve ***/
+
+/* Encodes a field list from its slots. On failure the field list is rolled back. */
+static RsslRet cacheEncodeFieldList(RsslEncodeIterator *eIter, RsslCacheFieldList *pCacheFieldList)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA | pCacheFieldList->flags;
+	fieldList.dictionaryId = pCacheFieldList->dictionaryId;
+	fieldList.fieldListNum = pCacheFieldList->fieldListNum;
+
+	if ((ret = rsslEncodeFieldListInit(eIter, &fieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeFieldListComplete(eIter, RSSL_FALSE);
+		return ret;
+	}
+
+	rsslClearFieldEntry(&fieldEntry);
+	for (i = 0; i < pCacheFieldList->slotCount; ++i)
+	{
+		RsslCacheFieldSlot *pSlot = &pCacheFieldList->pSlots[i];
+
+		/* Pre-encoded data; a zero length is encoded as blank. */
+		fieldEntry.fieldId = pSlot->fieldId;
+		fieldEntry.encData.data = rsslCacheFieldSlotData(pSlot);
+		fieldEntry.encData.length = pSlot->length;
+
+		if ((ret = rsslEncodeFieldEntry(eIter, &fieldEntry, NULL)) < RSSL_RET_SUCCESS)
+		{
+			rsslEncodeFieldListComplete(eIter, RSSL_FALSE);
+			return ret;
+		}
+	}
+
+	return rsslEncodeFieldListComplete(eIter, RSSL_TRUE);
+}
+
+static RsslRet cacheEncodeMapEntry(RsslEncodeIterator *eIter, RsslCacheMap *pCacheMap, RsslCacheMapEntry *pMapEntry)
+{
+	RsslMapEntry mapEntry;
+	RsslRet ret;
+
+	rsslClearMapEntry(&mapEntry);
+	mapEntry.action = RSSL_MPEA_ADD_ENTRY;
+	mapEntry.encKey = pMapEntry->key;
+
+	if (pMapEntry->hasPermData)
+	{
+		mapEntry.flags |= RSSL_MPEF_HAS_PERM_DATA;
+		mapEntry.permData.data = pMapEntry->permData.data;
+		mapEntry.permData.length = pMapEntry->permData.length;
+	}
+
+	if (pCacheMap->containerType != RSSL_DT_FIELD_LIST)
+	{
+		mapEntry.encData.data = pMapEntry->encData.data;
+		mapEntry.encData.length = pMapEntry->encData.length;
+		return rsslEncodeMapEntry(eIter, &mapEntry, NULL);
+	}
+
+	if ((ret = rsslEncodeMapEntryInit(eIter, &mapEntry, NULL, 0)) < RSSL_RET_SUCCESS
+			|| (ret = cacheEncodeFieldList(eIter, &pMapEntry->fieldList)) < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeMapEntryComplete(eIter, RSSL_FALSE);
+		return ret;
+	}
+
+	return rsslEncodeMapEntryComplete(eIter, RSSL_TRUE);
+}
+
+/* Encodes as many map entries as fit. Entries from pCursor->pNextLink onward are encoded
+ * when a cursor is given; otherwise all entries must fit. */
+static RsslRet cacheEncodeMap(RsslEncodeIterator *eIter, RsslCacheMap *pCacheMap, RsslPayloadCursorImpl *pCursor,
+		RsslCacheError *errorInfo)
+{
+	RsslMap map;
+	RsslQueueLink *pLink;
+	RsslUInt32 entryCount = 0;
+	RsslBool isFirstPart = (!pCursor || pCursor->entriesRetrieved == 0) ? RSSL_TRUE : RSSL_FALSE;
+	RsslRet ret;
+
+	rsslClearMap(&map);
+	map.flags = pCacheMap->flags & (RSSL_MPF_HAS_KEY_FIELD_ID | RSSL_MPF_HAS_PER_ENTRY_PERM_DATA);
+	map.keyPrimitiveType = pCacheMap->keyPrimitiveType;
+	map.containerType = pCacheMap->containerType;
+	map.keyFieldId = pCacheMap->keyFieldId;
+
+	if (isFirstPart)
+	{
+		/* Summary data and the count hint are only sent with the first part. */
+		map.flags |= RSSL_MPF_HAS_TOTAL_COUNT_HINT;
+		map.totalCountHint = rsslQueueGetElementCount(&pCacheMap->entryList);
+
+		if (pCacheMap->flags & RSSL_MPF_HAS_SUMMARY_DATA)
+		{
+			map.flags |= RSSL_MPF_HAS_SUMMARY_DATA;
+			if (pCacheMap->containerType != RSSL_DT_FIELD_LIST)
+			{
+				map.encSummaryData.data = pCacheMap->summaryData.data;
+				map.encSummaryData.length = pCacheMap->summaryData.length;
+			}
+		}
+	}
+
+	if ((ret = rsslEncodeMapInit(eIter, &map, 0, 0)) < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeMapComplete(eIter, RSSL_FALSE);
+		return ret;
+	}
+
+	if ((map.flags & RSSL_MPF_HAS_SUMMARY_DATA) && pCacheMap->containerType == RSSL_DT_FIELD_LIST)
+	{
+		if ((ret = cacheEncodeFieldList(eIter, &pCacheMap->summaryFieldList)) < RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeMapSummaryDataComplete(eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		{
+			rsslEncodeMapComplete(eIter, RSSL_FALSE);
+			return ret;
+		}
+	}
+
+	for (pLink = pCursor && pCursor->pNextLink ? pCursor->pNextLink : rsslQueuePeekFront(&pCacheMap->entryList);
+			pLink; pLink = rsslQueuePeekNext(&pCacheMap->entryList, pLink))
+	{
+		RsslCacheMapEntry *pMapEntry = RSSL_QUEUE_LINK_TO_OBJECT(RsslCacheMapEntry, link, pLink);
+
+		if ((ret = cacheEncodeMapEntry(eIter, pCacheMap, pMapEntry)) < RSSL_RET_SUCCESS)
+		{
+			if (ret != RSSL_RET_BUFFER_TOO_SMALL || !pCursor || entryCount == 0)
+			{
+				rsslEncodeMapComplete(eIter, RSSL_FALSE);
+				rsslCacheSetError(errorInfo, ret, "Failed to encode map entry (%d).", ret);
+				return ret;
+			}
+
+			/* The rest of the entries go in the next part. */
+			break;
+		}
+
+		++entryCount;
+	}
+
+	if ((ret = rsslEncodeMapComplete(eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+	{
+		rsslCacheSetError(errorInfo, ret, "Failed to complete map encoding (%d).", ret);
+		return ret;
+	}
+
+	if (pCursor)
+	{
+		pCursor->entriesRetrieved += entryCount;
+		pCursor->pNextLink = pLink;
+		pCursor->isComplete = pLink ? RSSL_FALSE : RSSL_TRUE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryRetrieve(RsslPayloadEntryHandle handle,
+		RsslEncodeIterator *eIter,
+		RsslPayloadCursorHandle cursorHandle,
+		RsslCacheError *errorInfo)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslPayloadCursorImpl *pCursor = (RsslPayloadCursorImpl*)cursorHandle;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	if (!pEntry || !eIter)
+	{
+		rsslCacheSetError(errorInfo, RSSL_RET_INVALID_ARGUMENT, "Missing payload entry or encode iterator.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	rsslCacheErrorClear(errorInfo);
+	rsslPayloadCacheLock(pEntry->pCache);
+
+	if (pCursor)
+	{
+		if (pCursor->isComplete)
+		{
+			rsslPayloadCacheUnlock(pEntry->pCache);
+			rsslCacheSetError(errorInfo, RSSL_RET_INVALID_ARGUMENT, "Cursor is complete and must be cleared before reuse.");
+			return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		if (pCursor->entriesRetrieved == 0)
+		{
+			pCursor->pEntry = pEntry;
+			pCursor->changeCount = pEntry->map.changeCount;
+		}
+		else if (pCursor->pEntry != pEntry || pCursor->changeCount != pEntry->map.changeCount)
+		{
+			/* The next entry may have been removed since the last part. */
+			rsslPayloadCacheUnlock(pEntry->pCache);
+			rsslCacheSetError(errorInfo, RSSL_RET_FAILURE, "Map entries were added or removed during multi-part retrieval.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	switch(pEntry->dataType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			if ((ret = cacheEncodeFieldList(eIter, &pEntry->fieldList)) < RSSL_RET_SUCCESS)
+				rsslCacheSetError(errorInfo, ret, "Failed to encode field list (%d).", ret);
+			else if (pCursor)
+				pCursor->isComplete = RSSL_TRUE;
+			break;
+		case RSSL_DT_MAP:
+			ret = cacheEncodeMap(eIter, &pEntry->map, pCursor, errorInfo);
+			break;
+		default:
+			/* Nothing to retrieve. */
+			if (pCursor)
+				pCursor->isComplete = RSSL_TRUE;
+			break;
+	}
+
+	rsslPayloadCacheUnlock(pEntry->pCache);
+	return ret;
+}
+
+/*** Trace ***/
+
+RSSL_VA_API RsslRet rsslPayloadEntryTrace(RsslPayloadEntryHandle handle,
+		RsslInt traceFormat,
+		FILE *file,
+		RsslDataDictionary *dictionary)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslEncodeIterator eIter;
+	RsslDecodeIterator dIter;
+	RsslCacheError error;
+	RsslBuffer buffer;
+	RsslUInt32 bufferSize;
+	RsslRet ret;
+
+	if (!pEntry || !file || traceFormat != PAYLOAD_ENTRY_TRACE_OPTION_XML)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	fprintf(file, "<!-- Payload entry %p, data type %d -->\n", (void*)pEntry, pEntry->dataType);
+
+	if (pEntry->dataType == RSSL_DT_UNKNOWN)
+		return RSSL_RET_SUCCESS;
+
+	/* Retrieve the whole entry in one part, growing the buffer until it fits. */
+	for (bufferSize = 4096, buffer.data = NULL; ; bufferSize *= 2)
+	{
+		free(buffer.data);
+
+		if (bufferSize > RSSL_CACHE_MAX_TRACE_BUFFER || !(buffer.data = (char*)malloc(bufferSize)))
+			return RSSL_RET_FAILURE;
+
+		buffer.length = bufferSize;
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+
+		if ((ret = rsslPayloadEntryRetrieve(handle, &eIter, NULL, &error)) != RSSL_RET_BUFFER_TOO_SMALL)
+			break;
+	}
+
+	if (ret == RSSL_RET_SUCCESS)
+	{
+		buffer.length = rsslGetEncodedBufferLength(&eIter);
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+		ret = (decodeDataTypeToXML(file, pEntry->dataType, &buffer, dictionary, NULL, &dIter) < 0) ?
+			RSSL_RET_FAILURE : RSSL_RET_SUCCESS;
+	}
+
+	free(buffer.data);
+	return ret;
+}
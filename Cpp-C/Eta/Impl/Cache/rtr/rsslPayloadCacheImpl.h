@@ -0,0 +1,215 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#ifndef _RSSL_PAYLOAD_CACHE_IMPL_H
+#define _RSSL_PAYLOAD_CACHE_IMPL_H
+
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslHashTable.h"
+#include "rtr/rsslThread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Layout of a payload entry:
+ * - A field list is stored as an array of fixed-size slots, one per FID, in the order the FIDs
+ *   were first received. A small open-addressed index maps a FID to its slot, so applying an
+ *   update field is a single lookup and copy.
+ * - The value of each slot is kept in its encoded form. Values of up to RSSL_CACHE_INLINE_DATA_SIZE
+ *   bytes are stored in the slot itself; longer values are stored in the entry's arena, with room
+ *   reserved for the longest value the field dictionary allows for that FID.
+ * - A map keeps its entries in arrival order, and in a hash table keyed by the encoded entry key.
+ *   Each map entry holds a field list (as above) or, for other container types, its encoded data.
+ * Retrieval re-encodes the stored values straight into the caller's buffer. */
+
+/* Values up to this length are stored in the field slot. */
+#define RSSL_CACHE_INLINE_DATA_SIZE 16
+
+/* Minimum size of an arena block. */
+#define RSSL_CACHE_ARENA_BLOCK_SIZE 2048
+
+/* Largest amount of arena space reserved up front for a value, regardless of its dictionary length. */
+#define RSSL_CACHE_MAX_RESERVED_LENGTH 1024
+
+/* Field definition in the field database. */
+typedef struct
+{
+	RsslUInt8	rwfType;	/* RWF type; RSSL_DT_UNKNOWN if the FID is not in the dictionary */
+	RsslUInt16	rwfLength;	/* RWF length from the dictionary */
+} RsslCacheFieldDef;
+
+/* Table of field definitions, indexed by (fieldId - minFid). A table is never changed once it
+ * is published; extending the dictionary publishes a new table. */
+typedef struct RsslCacheFieldTable
+{
+	struct RsslCacheFieldTable	*pRetired;	/* Table this one replaced, freed with the dictionary */
+	RsslInt32			minFid;
+	RsslInt32			maxFid;
+	RsslCacheFieldDef	*pFieldDefs;	/* Follows this structure */
+} RsslCacheFieldTable;
+
+/* Field database built from an RDM Field Dictionary, shared by every cache using its dictionary key.
+ * pFieldTable is replaced under the global cache lock and read without it, so caches sharing the
+ * dictionary can apply entries while another cache extends it. */
+typedef struct
+{
+	RsslQueueLink		link;
+	char				*key;
+	RsslInt32			refCount;
+	RsslCacheFieldTable	* volatile pFieldTable;
+} RsslCacheDictionary;
+
+/* Publishes and reads the field table pointer, so that a reader sees the table fully built. */
+#ifdef WIN32
+/* Volatile accesses have acquire and release semantics on Windows. */
+#define RSSL_CACHE_STORE_RELEASE(__var, __value) ((__var) = (__value))
+#define RSSL_CACHE_LOAD_ACQUIRE(__var) (__var)
+#else
+#define RSSL_CACHE_STORE_RELEASE(__var, __value) __atomic_store_n(&(__var), (__value), __ATOMIC_RELEASE)
+#define RSSL_CACHE_LOAD_ACQUIRE(__var) __atomic_load_n(&(__var), __ATOMIC_ACQUIRE)
+#endif
+
+/* Returns the current field table of the dictionary. */
+RTR_C_INLINE const RsslCacheFieldTable *rsslCacheDictionaryGetFieldTable(RsslCacheDictionary *pDictionary)
+{
+	return RSSL_CACHE_LOAD_ACQUIRE(pDictionary->pFieldTable);
+}
+
+RTR_C_INLINE const RsslCacheFieldDef *rsslCacheFieldTableGetField(const RsslCacheFieldTable *pFieldTable, RsslFieldId fieldId)
+{
+	if (fieldId < pFieldTable->minFid || fieldId > pFieldTable->maxFid)
+		return NULL;
+	return pFieldTable->pFieldDefs[fieldId - pFieldTable->minFid].rwfType != RSSL_DT_UNKNOWN ?
+		&pFieldTable->pFieldDefs[fieldId - pFieldTable->minFid] : NULL;
+}
+
+/* Block of arena memory. Data follows the header. */
+typedef struct RsslCacheArenaBlock
+{
+	struct RsslCacheArenaBlock	*pNext;
+	RsslUInt32					size;
+	RsslUInt32					used;
+} RsslCacheArenaBlock;
+
+/* Bump allocator for the variable-length data of an entry. Space that is given up is not
+ * reused; the arena is compacted once more than half of its space has been given up. */
+typedef struct
+{
+	RsslCacheArenaBlock	*pBlocks;
+	RsslUInt32			usedBytes;		/* Bytes handed out by the arena */
+	RsslUInt32			liveBytes;		/* Bytes currently referenced by the entry */
+} RsslCacheArena;
+
+/* Variable-length encoded data held in an arena. */
+typedef struct
+{
+	char		*data;
+	RsslUInt32	length;
+	RsslUInt32	capacity;
+} RsslCacheBuffer;
+
+/* Slot holding one field of a field list. */
+typedef struct
+{
+	RsslFieldId		fieldId;
+	RsslUInt32		length;		/* Encoded length; 0 for blank */
+	RsslUInt32		capacity;	/* Arena space reserved for the value; 0 when the value is stored in the slot */
+	union
+	{
+		char	inlineData[RSSL_CACHE_INLINE_DATA_SIZE];
+		char	*pData;
+	} value;
+} RsslCacheFieldSlot;
+
+RTR_C_INLINE char *rsslCacheFieldSlotData(RsslCacheFieldSlot *pSlot)
+{
+	return pSlot->capacity ? pSlot->value.pData : pSlot->value.inlineData;
+}
+
+typedef struct
+{
+	RsslUInt8			flags;			/* RSSL_FLF_HAS_FIELD_LIST_INFO, if received */
+	RsslInt16			dictionaryId;
+	RsslInt16			fieldListNum;
+	RsslUInt32			slotCount;
+	RsslUInt32			slotCapacity;
+	RsslCacheFieldSlot	*pSlots;
+	RsslUInt32			indexMask;		/* Size of pIndex, minus one */
+	RsslUInt32			*pIndex;		/* Slot position plus one, or 0 if unused */
+} RsslCacheFieldList;
+
+typedef struct
+{
+	RsslQueueLink		link;			/* Link in RsslCacheMap.entryList */
+	RsslHashLink		hashLink;		/* Link in RsslCacheMap.entryTable */
+	RsslBuffer			key;			/* Encoded key; the key data follows this structure */
+	RsslBool			hasPermData;
+	RsslCacheBuffer		permData;
+	RsslCacheBuffer		encData;		/* Entry data, when the map does not contain field lists */
+	RsslCacheFieldList	fieldList;		/* Entry data, when the map contains field lists */
+} RsslCacheMapEntry;
+
+typedef struct
+{
+	RsslUInt8		flags;				/* RSSL_MPF_HAS_KEY_FIELD_ID, RSSL_MPF_HAS_SUMMARY_DATA and RSSL_MPF_HAS_PER_ENTRY_PERM_DATA */
+	RsslUInt8		keyPrimitiveType;
+	RsslUInt8		containerType;
+	RsslFieldId		keyFieldId;
+	RsslCacheBuffer	summaryData;		/* Summary data, when the map does not contain field lists */
+	RsslCacheFieldList	summaryFieldList;	/* Summary data, when the map contains field lists */
+	RsslQueue		entryList;
+	RsslHashTable	entryTable;
+	RsslUInt32		changeCount;		/* Incremented when entries are added or removed */
+} RsslCacheMap;
+
+typedef struct
+{
+	RsslMutex				lock;
+	RsslPayloadCacheConfigOptions	config;
+	RsslCacheDictionary		*pDictionary;
+	RsslQueue				entryList;
+} RsslPayloadCacheImpl;
+
+typedef struct
+{
+	RsslQueueLink		link;		/* Link in cache's entryList */
+	RsslPayloadCacheImpl	*pCache;
+	RsslContainerType	dataType;
+	RsslCacheArena		arena;
+	RsslCacheFieldList	fieldList;
+	RsslCacheMap		map;
+} RsslPayloadEntryImpl;
+
+/* Progress of a multi-part retrieval. */
+typedef struct
+{
+	RsslBool				isComplete;
+	RsslPayloadEntryImpl	*pEntry;			/* Entry being retrieved */
+	RsslUInt32				changeCount;		/* Entry's map change count at the last part */
+	RsslUInt32				entriesRetrieved;	/* Map entries retrieved so far */
+	RsslQueueLink			*pNextLink;			/* Next map entry to retrieve */
+} RsslPayloadCursorImpl;
+
+/* Locks/unlocks the cache that owns an entry. */
+void rsslPayloadCacheLock(RsslPayloadCacheImpl *pCache);
+void rsslPayloadCacheUnlock(RsslPayloadCacheImpl *pCache);
+
+/* Frees the contents of an entry (without removing it from its cache). */
+void rsslPayloadEntryCleanup(RsslPayloadEntryImpl *pEntry);
+
+/* Sets the error text and code. */
+void rsslCacheSetError(RsslCacheError *pError, RsslRet errorId, const char *format, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -10,6 +10,11 @@
 #include "rtr/decoderTools.h"
 #include "rtr/rsslIteratorUtilsInt.h"
 #include "rtr/rsslPrimitiveDecoders.h"
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslReal.h"
+#include "rtr/rsslDateTime.h"
+#include "rtr/rsslQos.h"
+#include "rtr/rsslState.h"
 
 RSSL_API RsslRet rsslDecodeMap(
 				RsslDecodeIterator	*oIter,
@@ -200,6 +205,233 @@ RSSL_API RsslRet rsslDecodeMapEntry(
 	}
 }
 
+/* Returns the size of the structure that rsslDecodePrimitiveType() decodes the type into, or 0 if it has none. */
+static RsslUInt32 _rsslPrimitiveValueSize(RsslPrimitiveType type)
+{
+	switch(type)
+	{
+		case RSSL_DT_INT: return sizeof(RsslInt);
+		case RSSL_DT_UINT: return sizeof(RsslUInt);
+		case RSSL_DT_FLOAT: return sizeof(RsslFloat);
+		case RSSL_DT_DOUBLE: return sizeof(RsslDouble);
+		case RSSL_DT_REAL: return sizeof(RsslReal);
+		case RSSL_DT_DATE: return sizeof(RsslDate);
+		case RSSL_DT_TIME: return sizeof(RsslTime);
+		case RSSL_DT_DATETIME: return sizeof(RsslDateTime);
+		case RSSL_DT_QOS: return sizeof(RsslQos);
+		case RSSL_DT_STATE: return sizeof(RsslState);
+		case RSSL_DT_ENUM: return sizeof(RsslEnum);
+		case RSSL_DT_BUFFER:
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+		case RSSL_DT_RMTES_STRING: return sizeof(RsslBuffer);
+		default: return 0;
+	}
+}
+
+/* Decodes the value of a field into its column, with the iterator pointed at the encoded value. Returns 1 if
+ * this filled the column for the row, 0 if the column already had a value for it, or a failure code. */
+RTR_C_ALWAYS_INLINE RsslRet _rsslDecodeColumnValue(RsslDecodeIterator *iIter, RsslMapFieldColumn *column, RsslUInt32 row)
+{
+	RsslRet ret;
+	RsslUInt8 status = column->status[row];
+
+	if ((ret = (*(_rsslDataTypeInfo[column->dataType].bufferDecoders))(iIter, 
+			(char*)column->values + row * _rsslPrimitiveValueSize(column->dataType))) < RSSL_RET_SUCCESS)
+		return ret;
+
+	column->status[row] = (ret == RSSL_RET_BLANK_DATA) ? RSSL_MCVS_BLANK : RSSL_MCVS_PRESENT;
+	return (status == RSSL_MCVS_NOT_PRESENT) ? 1 : 0;
+}
+
+RSSL_API RsslRet rsslDecodeMapEntryColumns(
+				RsslDecodeIterator		*iIter,
+				RsslMapColumns			*oColumns,
+				RsslLocalFieldSetDefDb	*iLocalSetDb )
+{
+	RsslMap		*map;
+	RsslBuffer	encKey;
+	RsslBuffer	encData;
+	RsslUInt8	flags;
+	RsslFieldList	fieldList;
+	RsslFieldEntry	fieldEntry;
+	RsslDecodingLevel *_levelInfo;
+	RsslDecodingLevel *_valueLevelInfo;
+	char		*position;
+	char		*_endBufPtr;
+	RsslUInt32	keySize = 0;
+	RsslUInt32	row, col, found;
+	RsslUInt16	fieldCount;
+	RsslRet		ret;
+
+	RSSL_ASSERT(iIter && oColumns, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(iIter->_decodingLevel > -1 && iIter->_decodingLevel < 17, Invalid or incorrect iterator used);
+	RSSL_ASSERT(iIter->_levelInfo[iIter->_decodingLevel]._listType, Invalid decoding attempted);
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+	_valueLevelInfo = &iIter->_levelInfo[iIter->_decodingLevel + 1];
+	map = (RsslMap*)_levelInfo->_listType;
+	oColumns->count = 0;
+
+	if (map->containerType != RSSL_DT_FIELD_LIST)
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+
+	if (oColumns->keys && (keySize = _rsslPrimitiveValueSize(map->keyPrimitiveType)) == 0)
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+
+	for (col = 0; col < oColumns->columnCount; ++col)
+	{
+		if (_rsslPrimitiveValueSize(oColumns->columns[col].dataType) == 0)
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	while (oColumns->count < oColumns->capacity)
+	{
+		row = oColumns->count;
+
+		if (_levelInfo->_nextItemPosition >= _levelInfo->_itemCount)
+		{
+			_endOfList(iIter);
+			return RSSL_RET_END_OF_CONTAINER;
+		}
+
+		/* Entry header, as in rsslDecodeMapEntry() */
+		position = _levelInfo->_nextEntryPtr;
+		if ((position + 2) > _levelInfo->_endBufPtr)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		position += rwfGet8(flags, position);
+
+		if (rsslMapCheckHasPerEntryPermData(map) && ((flags >> 4) & RSSL_MPEF_HAS_PERM_DATA))
+		{
+			position = _rsslDecodeBuffer15(&encData, position);
+			if (position > _levelInfo->_endBufPtr)
+				return RSSL_RET_INCOMPLETE_DATA;
+		}
+
+		position = _rsslDecodeBuffer15(&encKey, position);
+		if (position > _levelInfo->_endBufPtr)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		if (oColumns->keys)
+		{
+			iIter->_curBufPtr = encKey.data ? encKey.data : position;
+			_valueLevelInfo->_endBufPtr = position;
+			if ((ret = (*(_rsslDataTypeInfo[map->keyPrimitiveType].bufferDecoders))(iIter, (char*)oColumns->keys + row * keySize)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if ((flags & 0xF) == RSSL_MPEA_DELETE_ENTRY)
+		{
+			encData.data = 0;
+			encData.length = 0;
+		}
+		else
+		{
+			position += rwfGetBuffer16(&encData, position);
+			if (position > _levelInfo->_endBufPtr)
+				return RSSL_RET_INCOMPLETE_DATA;
+		}
+
+		_levelInfo->_nextItemPosition++;
+		iIter->_curBufPtr = _levelInfo->_nextEntryPtr = position;
+
+		oColumns->actions[row] = (flags & 0xF);
+		if (oColumns->encKeys)
+			oColumns->encKeys[row] = encKey;
+
+		for (col = 0; col < oColumns->columnCount; ++col)
+			oColumns->columns[col].status[row] = RSSL_MCVS_NOT_PRESENT;
+
+		++oColumns->count;
+
+		if (encData.length == 0)
+			continue;
+
+		position = encData.data;
+		_endBufPtr = position + encData.length;
+		found = 0;
+
+		if (*position & RSSL_FLF_HAS_SET_DATA)
+		{
+			/* Set data needs the set definitions, so use the regular entry decoders. */
+			iIter->_curBufPtr = encData.data;
+			_valueLevelInfo->_endBufPtr = _endBufPtr;
+			if ((ret = rsslDecodeFieldList(iIter, &fieldList, iLocalSetDb)) < RSSL_RET_SUCCESS)
+				return ret;
+
+			while (found < oColumns->columnCount && (ret = rsslDecodeFieldEntry(iIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+			{
+				if (ret < RSSL_RET_SUCCESS)
+					return ret;
+
+				for (col = 0; col < oColumns->columnCount; ++col)
+				{
+					if (oColumns->columns[col].fieldId == fieldEntry.fieldId)
+					{
+						if ((ret = _rsslDecodeColumnValue(iIter, &oColumns->columns[col], row)) < RSSL_RET_SUCCESS)
+							return ret;
+						found += ret;
+						break;
+					}
+				}
+			}
+
+			/* Skip whatever remains of the field list */
+			if (ret != RSSL_RET_END_OF_CONTAINER)
+				rsslFinishDecodeEntries(iIter);
+
+			continue;
+		}
+
+		/* Standard data is walked in place. The iterator stays on the map, and only the value level is pointed at
+		 * each requested field for its primitive decoder. */
+		if (*position++ & RSSL_FLF_HAS_FIELD_LIST_INFO)
+		{
+			if (position >= _endBufPtr || (position += 1 + *(RsslUInt8*)position) > _endBufPtr)
+				return RSSL_RET_INCOMPLETE_DATA;
+		}
+
+		if (!(encData.data[0] & RSSL_FLF_HAS_STANDARD_DATA))
+			continue;
+
+		if (position + 2 > _endBufPtr)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		position += rwfGet16(fieldCount, position);
+
+		while (fieldCount-- > 0 && found < oColumns->columnCount)
+		{
+			RsslFieldId fieldId;
+			RsslBuffer	fieldData;
+
+			if (_endBufPtr - position < 3)
+				return RSSL_RET_INCOMPLETE_DATA;
+
+			position += rwfGet16(fieldId, position);
+			position += rwfGetBuffer16(&fieldData, position);
+			if (position > _endBufPtr)
+				return RSSL_RET_INCOMPLETE_DATA;
+
+			for (col = 0; col < oColumns->columnCount; ++col)
+			{
+				if (oColumns->columns[col].fieldId == fieldId)
+				{
+					iIter->_curBufPtr = fieldData.data;
+					_valueLevelInfo->_endBufPtr = fieldData.data + fieldData.length;
+
+					if ((ret = _rsslDecodeColumnValue(iIter, &oColumns->columns[col], row)) < RSSL_RET_SUCCESS)
+						return ret;
+					found += ret;
+					break;
+				}
+			}
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslMapFlagsToOmmString(RsslBuffer *oBuffer, RsslUInt8 flags)
 {
 	const char *flagStrings[5 /* The max possible number of flags */];
@@ -985,6 +985,302 @@ RSSL_API RsslRet rsslExtractPostId(
 	return RSSL_RET_SUCCESS;
 }
 
+RSSL_API RsslRet rsslDecodeMsgHeaderView(const RsslDecodeIterator *dIter, RsslMsgHeaderView *pView)
+{
+	char *position = dIter->_curBufPtr;
+	char *endBufPtr = dIter->_levelInfo[dIter->_decodingLevel + 1]._endBufPtr;
+	RsslUInt16 headerSize;
+
+	RSSL_ASSERT(pView, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(dIter->_pBuffer, Invalid parameters or parameters passed in as NULL);
+
+	/* header size, msgClass, domainType and streamId must all be present */
+	if (endBufPtr - position < 8)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	position += rwfGet16(headerSize, position);
+
+	if ((position + headerSize) > endBufPtr)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	pView->_pHeaderEnd = position + headerSize;
+
+	position += rwfGet8(pView->msgClass, position);
+	/* Top three bits reserved for later use */
+	pView->msgClass &= 0x1F;
+
+	position += rwfGet8(pView->domainType, position);
+	position += rwfGet32(pView->streamId, position);
+
+	if (pView->msgClass < RSSL_MC_REQUEST || pView->msgClass > RSSL_MC_POST)
+		return RSSL_RET_FAILURE;
+
+	/* every class starts its own section with flags and containerType */
+	position += rwfGetResBitU15(&pView->flags, position);
+	position += rwfGet8(pView->containerType, position);
+	/* need to scale containerType */
+	pView->containerType += RSSL_DT_CONTAINER_TYPE_MIN;
+
+	if (position > pView->_pHeaderEnd)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	pView->_pClassHeader = position;
+	pView->_resolved = RSSL_FALSE;
+
+	pView->encMsgBuffer.data = dIter->_curBufPtr;
+	pView->encMsgBuffer.length = (rtrUInt32)(endBufPtr - dIter->_curBufPtr);
+
+	pView->encDataBody.length = (rtrUInt32)(endBufPtr - pView->_pHeaderEnd);
+	pView->encDataBody.data = pView->encDataBody.length ? pView->_pHeaderEnd : 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Walks the class-specific section of the header once, recording where the sequence number,
+ * group Id and message key are so later accessors can go straight to them. */
+static RsslRet _rsslMsgHeaderViewResolve(RsslMsgHeaderView *pView)
+{
+	char *position = pView->_pClassHeader;
+	RsslUInt16 flags = pView->flags;
+	RsslUInt16 length;
+	RsslQos qos;
+
+	pView->_pSeqNum = pView->_pGroupId = pView->_pMsgKey = 0;
+
+	switch (pView->msgClass)
+	{
+	case RSSL_MC_UPDATE:
+		++position; /* updateType */
+		if (flags & RSSL_UPMF_HAS_SEQ_NUM)
+		{
+			pView->_pSeqNum = position;
+			position += 4;
+		}
+		if (flags & RSSL_UPMF_HAS_CONF_INFO)
+		{
+			position += rwfGetResBitU15(&length, position);
+			position += 2;
+		}
+		if (flags & RSSL_UPMF_HAS_PERM_DATA)
+		{
+			position += rwfGetResBitU15(&length, position);
+			position += length;
+		}
+		if (flags & RSSL_UPMF_HAS_MSG_KEY)
+			pView->_pMsgKey = position;
+		break;
+
+	case RSSL_MC_GENERIC:
+		if (flags & RSSL_GNMF_HAS_SEQ_NUM)
+		{
+			pView->_pSeqNum = position;
+			position += 4;
+		}
+		if (flags & RSSL_GNMF_HAS_SECONDARY_SEQ_NUM)
+			position += 4;
+		if (flags & RSSL_GNMF_HAS_PERM_DATA)
+		{
+			position += rwfGetResBitU15(&length, position);
+			position += length;
+		}
+		if (flags & RSSL_GNMF_HAS_MSG_KEY)
+			pView->_pMsgKey = position;
+		break;
+
+	case RSSL_MC_REFRESH:
+		if (flags & RSSL_RFMF_HAS_SEQ_NUM)
+		{
+			pView->_pSeqNum = position;
+			position += 4;
+		}
+		/* state */
+		position += 2;
+		position += rwfGetResBitU15(&length, position);
+		position += length;
+		pView->_pGroupId = position;
+		position += rwfGet8(length, position);
+		position += length;
+		if (flags & RSSL_RFMF_HAS_PERM_DATA)
+		{
+			position += rwfGetResBitU15(&length, position);
+			position += length;
+		}
+		if (flags & RSSL_RFMF_HAS_QOS)
+			position = _rsslDecodeQos(&qos, position);
+		if (flags & RSSL_RFMF_HAS_MSG_KEY)
+			pView->_pMsgKey = position;
+		break;
+
+	case RSSL_MC_POST:
+		position += 8; /* postUserInfo */
+		if (flags & RSSL_PSMF_HAS_SEQ_NUM)
+			pView->_pSeqNum = position;
+		if (flags & RSSL_PSMF_HAS_MSG_KEY)
+		{
+			if (flags & RSSL_PSMF_HAS_SEQ_NUM)
+				position += 4;
+			if (flags & RSSL_PSMF_HAS_POST_ID)
+				position += 4;
+			if (flags & RSSL_PSMF_HAS_PERM_DATA)
+			{
+				position += rwfGetResBitU15(&length, position);
+				position += length;
+			}
+			pView->_pMsgKey = position;
+		}
+		break;
+
+	case RSSL_MC_REQUEST:
+		if (flags & RSSL_RQMF_HAS_PRIORITY)
+		{
+			++position; /* priorityClass */
+			position += rwfGetOptByteU16(&length, position);
+		}
+		if (flags & RSSL_RQMF_HAS_QOS)
+			position = _rsslDecodeQos(&qos, position);
+		if (flags & RSSL_RQMF_HAS_WORST_QOS)
+			position = _rsslDecodeQos(&qos, position);
+		/* request always has a key */
+		pView->_pMsgKey = position;
+		break;
+
+	case RSSL_MC_STATUS:
+		if (flags & RSSL_STMF_HAS_STATE)
+		{
+			position += 2;
+			position += rwfGetResBitU15(&length, position);
+			position += length;
+		}
+		if (flags & RSSL_STMF_HAS_GROUP_ID)
+		{
+			pView->_pGroupId = position;
+			position += rwfGet8(length, position);
+			position += length;
+		}
+		if (flags & RSSL_STMF_HAS_PERM_DATA)
+		{
+			position += rwfGetResBitU15(&length, position);
+			position += length;
+		}
+		if (flags & RSSL_STMF_HAS_MSG_KEY)
+			pView->_pMsgKey = position;
+		break;
+
+	case RSSL_MC_ACK:
+		position += 4; /* ackId */
+		if (flags & RSSL_AKMF_HAS_NAK_CODE)
+			++position;
+		if (flags & RSSL_AKMF_HAS_TEXT)
+		{
+			position += rwfGetOptByteU16(&length, position);
+			position += length;
+		}
+		if (flags & RSSL_AKMF_HAS_SEQ_NUM)
+		{
+			pView->_pSeqNum = position;
+			position += 4;
+		}
+		if (flags & RSSL_AKMF_HAS_MSG_KEY)
+			pView->_pMsgKey = position;
+		break;
+
+	default: /* RSSL_MC_CLOSE has none of these members */
+		break;
+	}
+
+	if (position > pView->_pHeaderEnd)
+	{
+		pView->_pSeqNum = pView->_pGroupId = pView->_pMsgKey = 0;
+		return RSSL_RET_INCOMPLETE_DATA;
+	}
+
+	pView->_resolved = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgHeaderViewGetSeqNum(RsslMsgHeaderView *pView, RsslUInt32 *pSeqNum)
+{
+	RsslRet ret;
+
+	if (!pView->_resolved)
+	{
+		/* The sequence number sits at a fixed offset for the common classes, so
+		 * avoid walking the rest of the header for them. */
+		char *position = 0;
+
+		switch (pView->msgClass)
+		{
+		case RSSL_MC_UPDATE:
+			if (pView->flags & RSSL_UPMF_HAS_SEQ_NUM)
+				position = pView->_pClassHeader + 1; /* after updateType */
+			break;
+		case RSSL_MC_REFRESH:
+			if (pView->flags & RSSL_RFMF_HAS_SEQ_NUM)
+				position = pView->_pClassHeader;
+			break;
+		case RSSL_MC_GENERIC:
+			if (pView->flags & RSSL_GNMF_HAS_SEQ_NUM)
+				position = pView->_pClassHeader;
+			break;
+		default:
+			if ((ret = _rsslMsgHeaderViewResolve(pView)) != RSSL_RET_SUCCESS)
+				return ret;
+			position = pView->_pSeqNum;
+			break;
+		}
+
+		if (!position)
+			return RSSL_RET_FAILURE;
+
+		if (position + 4 > pView->_pHeaderEnd)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		rwfGet32(*pSeqNum, position);
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (!pView->_pSeqNum)
+		return RSSL_RET_FAILURE;
+
+	rwfGet32(*pSeqNum, pView->_pSeqNum);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgHeaderViewGetGroupId(RsslMsgHeaderView *pView, RsslBuffer *pGroupId)
+{
+	RsslRet ret;
+
+	if (!pView->_resolved && (ret = _rsslMsgHeaderViewResolve(pView)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (!pView->_pGroupId)
+		return RSSL_RET_FAILURE;
+
+	rwfGetBuffer8(pGroupId, pView->_pGroupId);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgHeaderViewGetMsgKey(RsslMsgHeaderView *pView, RsslMsgKey *pKey)
+{
+	RsslRet ret;
+	RsslUInt16 keySize;
+	char *position;
+
+	if (!pView->_resolved && (ret = _rsslMsgHeaderViewResolve(pView)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (!pView->_pMsgKey)
+		return RSSL_RET_FAILURE;
+
+	position = pView->_pMsgKey;
+	position += rwfGetResBitU15(&keySize, position);
+	if (position + keySize > pView->_pHeaderEnd)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	rsslDecodeBaseKey(pKey, position);
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API const RsslUInt32* rsslGetSeqNum( const RsslMsg * pMsg )
 {
 	switch (pMsg->msgBase.msgClass)
@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "limits.h"
+#include <string.h>
 
 #include "rtr/rsslTypes.h"
 
@@ -19,6 +20,15 @@ extern "C" {
 #include "rtr/rsslcnvtab.h"
 #include "rtr/retmacros.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RSSL_RMTES_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#pragma intrinsic(_BitScanForward)
+#endif
+#endif
+
 const char ESC_CHAR = 0x1B;
 const char LBRKT_CHAR = 0x5B;
 const char RHPA_CHAR = 0x60; 	/* Used for partial updates */
@@ -207,6 +217,127 @@ int UCS2ToUTF8(unsigned short UCS_char, char* iter, char* endChar)
 	return 0;
 }
 
+#ifdef RSSL_RMTES_SSE2
+/* Returns the index of the lowest set bit. bits must not be zero. */
+static int _rmtesLowestBit(unsigned int bits)
+{
+#if defined(__GNUC__)
+	return __builtin_ctz(bits);
+#elif defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, bits);
+	return (int)index;
+#else
+	int index = 0;
+	while (!(bits & 1))
+	{
+		bits >>= 1;
+		++index;
+	}
+	return index;
+#endif
+}
+#endif
+
+/* Returns the number of bytes from inIter that are printable 7-bit characters (0x20 - 0x7E). */
+static size_t plainRunLength(const unsigned char* inIter, const unsigned char* endInput)
+{
+	const unsigned char* iter = inIter;
+
+#ifdef RSSL_RMTES_SSE2
+	const __m128i lowBound = _mm_set1_epi8(0x1F);
+	const __m128i highBound = _mm_set1_epi8(0x7F);
+
+	/* Bytes of 0x80 and above are negative as signed chars, so they fail the low bound. */
+	while (endInput - iter >= 16)
+	{
+		__m128i chars = _mm_loadu_si128((const __m128i*)iter);
+		__m128i plain = _mm_and_si128(_mm_cmpgt_epi8(chars, lowBound), _mm_cmplt_epi8(chars, highBound));
+		unsigned int notPlain = ~(unsigned int)_mm_movemask_epi8(plain) & 0xFFFF;
+
+		if (notPlain)
+			return (size_t)(iter - inIter) + _rmtesLowestBit(notPlain);
+
+		iter += 16;
+	}
+#endif
+
+	while (iter < endInput && *iter >= 0x20 && *iter < 0x7F)
+		++iter;
+
+	return (size_t)(iter - inIter);
+}
+
+/* Fast path for rsslRMTESToUTF8. Converts the run of characters starting at inIter that
+ * need no control parsing: printable 7-bit characters when the GL set has no conversion
+ * table are copied as a block, and GR characters are looked up in the GR set's table.
+ * Stops at the first character that needs the full parser, and returns the number of input
+ * bytes consumed, or -1 if the output buffer is too small. */
+static int convertRunToUTF8(unsigned char* inIter, unsigned char* endInput, char** pOutIter, char* endOutput, RsslRmtesWorkingSet* pWorkingSet)
+{
+	unsigned char* startInput = inIter;
+	char* outIter = *pOutIter;
+	RsslRmtesCharSet* pGL = *pWorkingSet->GL;
+	RsslRmtesCharSet* pGR = *pWorkingSet->GR;
+	int plainGL = (pGL->_table1 == NULL && pGL->_table2 == NULL && pGL->_stride != 2);
+	int grLowest = GRLowest(pGR);
+	int grHighest = GRHighest(pGR);
+	int tempRet;
+	unsigned short tempShort;
+	size_t runLength;
+
+	while (inIter < endInput)
+	{
+		if (plainGL && *inIter >= 0x20 && *inIter < 0x7F)
+		{
+			runLength = plainRunLength(inIter, endInput);
+			if (runLength > (size_t)(endOutput - outIter))
+				return -1;
+
+			memcpy(outIter, inIter, runLength);
+			outIter += runLength;
+			inIter += runLength;
+		}
+		else if (*inIter >= grLowest && *inIter <= grHighest)
+		{
+			if (pGR->_stride == 2)
+			{
+				if (inIter + 1 >= endInput || inIter[1] < grLowest || inIter[1] > grHighest)
+					break;
+
+				if ((tempRet = UCS2ToUTF8(ConvertStride2GR(inIter[0], inIter[1], pGR), outIter, endOutput)) == 0)
+					return -1;
+
+				outIter += tempRet;
+				inIter += 2;
+			}
+			else
+			{
+				tempShort = pGR->_table1 ? pGR->_table1[*inIter - grLowest] : *inIter;
+				if ((tempRet = UCS2ToUTF8(tempShort, outIter, endOutput)) == 0)
+					return -1;
+
+				outIter += tempRet;
+
+				if (pGR->_table2 && (tempShort = pGR->_table2[*inIter - grLowest]) != 0)
+				{
+					if ((tempRet = UCS2ToUTF8(tempShort, outIter, endOutput)) == 0)
+						return -1;
+
+					outIter += tempRet;
+				}
+
+				inIter++;
+			}
+		}
+		else
+			break;
+	}
+
+	*pOutIter = outIter;
+	return (int)(inIter - startInput);
+}
+
 int UTF8ToUCS2(unsigned char *UTF_char, RsslUInt16* iter, unsigned char* endChar)
 {
 	if(UTF_char[0] < 0x80)
@@ -605,6 +736,17 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 	{
 		if(encType == TYPE_RMTES)
 		{
+			if(shiftGL == NULL && *inIter >= 0x20)
+			{
+				/* Plain text and single-shift-free GR text is converted in runs */
+				if((ret = convertRunToUTF8(inIter, endInput, &outIter, endOutput, &curWorkingSet)) < 0)
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				inIter += ret;
+				if(inIter == endInput)
+					break;
+			}
+
 			if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
@@ -812,11 +954,18 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 				else
 					inIter += ret;
 			}
-			else /* Just copy the data, since it's already encoded in UTF8 */
+			else /* Just copy the data up to the next escape, since it's already encoded in UTF8 */
 			{
-				*outIter = *inIter;
-				outIter++;
-				inIter++;
+				tempChar = (unsigned char*)memchr(inIter, 0x1B, endInput - inIter);
+				if(tempChar == NULL)
+					tempChar = endInput;
+
+				if((size_t)(tempChar - inIter) > (size_t)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, tempChar - inIter);
+				outIter += tempChar - inIter;
+				inIter = tempChar;
 			}
 		}
 	}
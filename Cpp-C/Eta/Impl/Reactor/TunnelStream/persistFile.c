@@ -20,6 +20,7 @@
 #include <fcntl.h>
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #define rssl_errno errno
 #endif
 
@@ -96,6 +97,16 @@ RTR_C_INLINE RsslRet fileRead(PersistFile *pFile, RsslUInt32 position, RsslUInt3
 #ifdef WIN32
 	DWORD outBytes;
 #endif
+
+	if (pFile->_pMap != NULL)
+	{
+		if (position > pFile->_mapLength || length > pFile->_mapLength - position)
+			return RSSL_RET_FAILURE;
+
+		memcpy(pValue, pFile->_pMap + position, length);
+		return RSSL_RET_SUCCESS;
+	}
+
 	/* Move to writing position */
 #ifdef WIN32
 	if (SetFilePointer(pFile->_file, position, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
@@ -122,6 +133,16 @@ RTR_C_INLINE RsslRet fileWrite(PersistFile *pFile, RsslUInt32 position, RsslUInt
 	DWORD outBytes;
 #endif
 
+	if (pFile->_pMap != NULL)
+	{
+		if (position > pFile->_mapLength || length > pFile->_mapLength - position)
+			return RSSL_RET_FAILURE;
+
+		memcpy(pFile->_pMap + position, pValue, length);
+		return RSSL_RET_SUCCESS;
+	}
+
+
 	/* Move to writing position */
 #ifdef WIN32
 	if (SetFilePointer(pFile->_file, position, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
@@ -177,12 +198,13 @@ RTR_C_INLINE RsslRet fileWriteBuffer(PersistFile *pFile, RsslUInt32 position, Rs
 	return fileWrite(pFile, position, pBuffer->length, (void*)pBuffer->data);
 }
 
-RTR_C_INLINE RsslRet persistFileCommit(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
+/* Writes all changes to disk. */
+static RsslRet persistFileSync(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
 {
 #ifdef WIN32
 	if (FlushFileBuffers(pFile->_file) == FALSE)
 #else
-	if (fsync(pFile->_file) < 0)
+	if (pFile->_pMap != NULL ? msync(pFile->_pMap, pFile->_mapLength, MS_SYNC) < 0 : fsync(pFile->_file) < 0)
 #endif
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
@@ -191,9 +213,81 @@ RTR_C_INLINE RsslRet persistFileCommit(PersistFile *pFile, RsslErrorInfo *pError
 		return RSSL_RET_FAILURE;
 	}
 
+	pFile->_commitPending = RSSL_FALSE;
 	return RSSL_RET_SUCCESS;
 }
 
+/* Commits changes to disk, or leaves them for persistFileFlush if commits are deferred.
+ * When the file is memory-mapped, deferred changes are already visible to the OS, so only a
+ * system failure (not a failure of this process) can lose them. */
+RTR_C_INLINE RsslRet persistFileCommit(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
+{
+	if (pFile->_commitInterval == 0)
+		return persistFileSync(pFile, pErrorInfo);
+
+	pFile->_commitPending = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet persistFileFlush(PersistFile *pFile, RsslInt64 currentTimeMs, RsslErrorInfo *pErrorInfo)
+{
+	if (!pFile->_commitPending)
+		return RSSL_RET_SUCCESS;
+
+	if (pFile->_commitInterval > 0 && currentTimeMs < pFile->_lastCommitTime + pFile->_commitInterval)
+		return RSSL_RET_SUCCESS;
+
+	if (persistFileSync(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	pFile->_lastCommitTime = currentTimeMs;
+	return RSSL_RET_SUCCESS;
+}
+
+#ifndef WIN32
+/* Maps the file into memory, so that reads and writes do not need a system call each. 
+ * If the file is too small to hold a header, it is left unmapped and reads fail as they would without the mapping.
+ * The file's blocks are reserved first; a store through the mapping into a hole that cannot be allocated
+ * raises SIGBUS, so running out of disk space must be reported here instead. */
+static RsslRet persistFileMap(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
+{
+	struct stat fileStat;
+	void *pMap;
+	int ret;
+
+	if (fstat(pFile->_file, &fileStat) < 0)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Failed to get persistence file size: SysError %d", rssl_errno);
+		pErrorInfo->rsslError.sysError = rssl_errno;
+		return RSSL_RET_FAILURE;
+	}
+
+	if (fileStat.st_size < PERS_HP_END || (RsslUInt64)fileStat.st_size > 0xFFFFFFFFULL)
+		return RSSL_RET_SUCCESS;
+
+	if ((ret = posix_fallocate(pFile->_file, 0, fileStat.st_size)) != 0)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Failed to allocate persistence file space: SysError %d", ret);
+		pErrorInfo->rsslError.sysError = ret;
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((pMap = mmap(NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, pFile->_file, 0)) == MAP_FAILED)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Failed to map persistence file: SysError %d", rssl_errno);
+		pErrorInfo->rsslError.sysError = rssl_errno;
+		return RSSL_RET_FAILURE;
+	}
+
+	pFile->_pMap = (char*)pMap;
+	pFile->_mapLength = (RsslUInt32)fileStat.st_size;
+	return RSSL_RET_SUCCESS;
+}
+#endif
+
 /* Populates a list of persisted message buffers from the file. */
 static RsslRet persistenceLoadMsgList(PersistFile *pFile, RsslQueue *pQueue, RsslUInt32 filePosition, RsslUInt32 *pTransmittedCount, RsslErrorInfo *pErrorInfo)
 {
@@ -536,6 +630,8 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 	}
 
 	pFile->_streamId = pOpts->streamId;
+	pFile->_commitInterval = pOpts->commitInterval;
+	pFile->_lastCommitTime = pOpts->currentTimeMs;
 
 	if (!fileExists)
 	{
@@ -562,6 +658,14 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 			return NULL;
 		}
 
+#ifndef WIN32
+		if (persistFileMap(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			persistFileClose(pFile);
+			return NULL;
+		}
+#endif
+
 		/* Initialize file header. */
 
 		if (fileWriteUInt32(pFile, PERS_HP_MAX_MSGS, pFile->_maxMsgCount)
@@ -675,7 +779,7 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 			return NULL;
 		}
 
-		if (persistFileCommit(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
+		if (persistFileSync(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
 		{
 			persistFileClose(pFile);
 			return NULL;
@@ -690,6 +794,14 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 		RsslUInt32 tmpSeqNum;
 		RsslUInt32 transmittedCount;
 
+#ifndef WIN32
+		if (persistFileMap(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			persistFileClose(pFile);
+			return NULL;
+		}
+#endif
+
 		if ((fileReadUInt32(pFile, PERS_HP_FILE_VERSION, &pFile->_version)) != RSSL_RET_SUCCESS)
 		{
 			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
@@ -819,6 +931,17 @@ void persistFileClose(PersistFile *pFile)
 {
 	RsslQueueLink *pLink;
 
+	if (pFile->_commitPending)
+	{
+		RsslErrorInfo errorInfo;
+		persistFileSync(pFile, &errorInfo);
+	}
+
+#ifndef WIN32
+	if (pFile->_pMap != NULL)
+		munmap(pFile->_pMap, pFile->_mapLength);
+#endif
+
 #ifdef WIN32
 	if (pFile->_file != INVALID_HANDLE_VALUE)
 		CloseHandle(pFile->_file);
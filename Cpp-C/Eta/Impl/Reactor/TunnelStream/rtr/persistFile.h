@@ -55,6 +55,12 @@ typedef struct
 
 	RsslUInt32			_maxMsgLength;	/* Maximum size of messages that can be stored. */
 	RsslUInt32			_maxMsgCount;	/* Maximum number of messages present in the file. */
+
+	char				*_pMap;			/* Mapping of the file, if it is memory-mapped. Reads and writes go through this. */
+	RsslUInt32			_mapLength;		/* Length of the mapping. */
+	RsslInt64			_commitInterval;	/* See PersistFileOpenOptions.commitInterval. */
+	RsslInt64			_lastCommitTime;	/* Time the file was last committed, if commits are deferred. */
+	RsslBool			_commitPending;	/* Changes have been written that are not yet committed. */
 } PersistFile;
 
 /* Save an encoded message. */
@@ -83,6 +89,12 @@ RTR_C_INLINE RsslQueue *persistFileGetSavedList(PersistFile *pFile);
 /* Set the last received sequence number. */
 RsslRet persistFileSaveLastInSeqNum(PersistFile *pFile, RsslUInt32 seqNum, RsslErrorInfo *pErrorInfo);
 
+/* Commits deferred changes to disk, if any are pending and the commit interval has elapsed. */
+RsslRet persistFileFlush(PersistFile *pFile, RsslInt64 currentTimeMs, RsslErrorInfo *pErrorInfo);
+
+/* Returns the time at which deferred changes are due to be committed, or RDM_QMSG_TC_INFINITE if none are pending. */
+RTR_C_INLINE RsslInt64 persistFileGetNextCommitTime(PersistFile *pFile);
+
 /* Options for persistFileOpen */
 typedef struct
 {
@@ -91,6 +103,9 @@ typedef struct
 	RsslUInt32	maxMsgSize;
 	RsslUInt32	maxMsgCount;
 	RsslInt64	currentTimeMs;
+	RsslInt64	commitInterval;	/* 0 commits every change to disk before returning. A positive value defers
+								 * commits to persistFileFlush, at most once per that many milliseconds.
+								 * A negative value defers commits to every call to persistFileFlush. */
 } PersistFileOpenOptions;
 
 /* Clears a PersistFileOpenOptions structure. */
@@ -137,6 +152,14 @@ RTR_C_INLINE RsslQueue *persistFileGetSavedList(PersistFile *pFile)
 	return &pFile->_savedList;
 }
 
+RTR_C_INLINE RsslInt64 persistFileGetNextCommitTime(PersistFile *pFile)
+{
+	if (!pFile->_commitPending)
+		return RDM_QMSG_TC_INFINITE;
+
+	return (pFile->_commitInterval > 0) ? pFile->_lastCommitTime + pFile->_commitInterval : pFile->_lastCommitTime;
+}
+
 #ifdef __cplusplus
 }
 #endif
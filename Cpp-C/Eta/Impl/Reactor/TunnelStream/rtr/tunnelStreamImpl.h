@@ -170,6 +170,7 @@ typedef struct
 	RsslInt32							_authLoginStreamId;
 	RsslBuffer							_memoryBuffer;
 	char*								_persistenceFilePath;
+	RsslInt64							_persistenceCommitInterval;
 	RsslRDMLoginRequest					*_pAuthLoginRequest;
 	RsslBool							_authLoginRequestIsCopied;
 	RsslInt64							_nextExpireTime;
@@ -311,6 +312,11 @@ RTR_C_INLINE char *tunnelStreamGetPersistenceFilePath(TunnelStreamImpl *pTunnel)
 	return pTunnel->_persistenceFilePath;
 }
 
+RTR_C_INLINE RsslInt64 tunnelStreamGetPersistenceCommitInterval(TunnelStreamImpl *pTunnel)
+{
+	return pTunnel->_persistenceCommitInterval;
+}
+
 RTR_C_INLINE RsslBuffer *tunnelStreamGetMemoryHeapBuffer(TunnelStreamImpl *pTunnel)
 {
 	return &pTunnel->_memoryBuffer;
@@ -65,6 +65,12 @@ RsslRet tunnelSubstreamExpireBuffer(TunnelSubstream *pSubstream, RsslBuffer *pTu
 /* Updates a buffer for transmission (ensures persistence is updated and updates any timeout */
 RsslRet	tunnelSubstreamUpdateMsgForTransmit(TunnelSubstream *pSubstream, RsslBuffer *pBuffer, RsslErrorInfo *pErrorInfo);
 
+/* Commits deferred changes to the substream's persistence file, if they are due. */
+RsslRet tunnelSubstreamFlushPersistence(TunnelSubstream *pSubstream, RsslInt64 currentTimeMs, RsslErrorInfo *pErrorInfo);
+
+/* Returns the time at which deferred persistence changes are due to be committed, or RDM_QMSG_TC_INFINITE if there are none. */
+RsslInt64 tunnelSubstreamGetPersistenceCommitTime(TunnelSubstream *pSubstream);
+
 /* Closes a substream. */
 RsslRet tunnelSubstreamClose(TunnelSubstream *pSubstream,
 		RsslErrorInfo *pErrorInfo);
@@ -76,6 +76,9 @@ static TunnelBufferImpl* _tunnelStreamGetBufferForFragmentation(TunnelStreamImpl
 /* Handle a tunnel stream request retry if possible. */
 static RsslBool _tunnelStreamHandleRequestRetry(TunnelStreamImpl *pTunnelImpl);
 
+/* Commits deferred changes to substream persistence files. */
+static RsslRet _tunnelStreamFlushPersistence(TunnelStreamImpl *pTunnelImpl, RsslErrorInfo *pErrorInfo);
+
 static void _tunnelStreamSetResponseTimerWithBackoff(TunnelStreamImpl *pTunnelImpl)
 {
 	RsslUInt32 i;
@@ -241,6 +244,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 
 	if (pOpts->classOfService.guarantee.type == RDM_COS_GU_PERSISTENT_QUEUE)
 	{
+		pTunnelImpl->_persistenceCommitInterval = pOpts->classOfService.guarantee.persistenceCommitInterval;
 		rsslInitQueue(&pTunnelImpl->_substreams);
 		if (rsslHashTableInit(&pTunnelImpl->_substreamsById, 101, rsslHashU32Sum, rsslHashU32Compare,
 					RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
@@ -1314,6 +1318,10 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 											if ((ret = tunnelSubstreamRead(pSubstream, &substreamMsg, pErrorInfo))
 												!= RSSL_RET_SUCCESS)
 												return RSSL_RET_FAILURE;
+
+											/* Commit any persistence changes on the next dispatch. */
+											if (tunnelSubstreamGetPersistenceCommitTime(pSubstream) != RDM_QMSG_TC_INFINITE)
+												tunnelStreamSetNeedsDispatch(pTunnelImpl);
 										}
 										/* Otherwise ignore. */
 
@@ -1683,6 +1691,9 @@ RsslRet tunnelStreamDispatch(RsslTunnelStream *pTunnel,
 			if ((ret = _tunnelStreamSendMessages(pTunnelImpl, pErrorInfo))< RSSL_RET_SUCCESS)
 				return ret;
 
+			if (_tunnelStreamFlushPersistence(pTunnelImpl, pErrorInfo) != RSSL_RET_SUCCESS)
+				return RSSL_RET_FAILURE;
+
 			if (rsslQueueGetElementCount(&pTunnelImpl->_tunnelBufferTransmitList) == 0)
 				tunnelStreamUnsetNeedsDispatch(pTunnelImpl);
 
@@ -2277,6 +2288,34 @@ RsslRet tunnelStreamProcessTimer(TunnelStreamImpl *pTunnelImpl, RsslInt64 curren
 	else
 		tunnelStreamUnsetHasExpireTime(pTunnelImpl);
 
+	return _tunnelStreamFlushPersistence(pTunnelImpl, pErrorInfo);
+}
+
+static RsslRet _tunnelStreamFlushPersistence(TunnelStreamImpl *pTunnelImpl, RsslErrorInfo *pErrorInfo)
+{
+	RsslQueueLink *pLink;
+	RsslInt64 currentTime;
+
+	/* Nothing is deferred if every change is committed immediately. */
+	if (pTunnelImpl->_persistenceCommitInterval == 0)
+		return RSSL_RET_SUCCESS;
+
+	currentTime = tunnelStreamGetCurrentTimeMs(pTunnelImpl);
+
+	for (pLink = rsslQueueStart(&pTunnelImpl->_substreams); pLink != NULL;
+			pLink = rsslQueueForth(&pTunnelImpl->_substreams))
+	{
+		TunnelSubstream *pSubstream = RSSL_QUEUE_LINK_TO_OBJECT(TunnelSubstream, _tunnelQueueLink, pLink);
+		RsslInt64 commitTime;
+
+		if (tunnelSubstreamFlushPersistence(pSubstream, currentTime, pErrorInfo) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+
+		/* Set a timer for changes that are not yet due. */
+		if ((commitTime = tunnelSubstreamGetPersistenceCommitTime(pSubstream)) != RDM_QMSG_TC_INFINITE)
+			tunnelStreamSetNextExpireTime(pTunnelImpl, commitTime);
+	}
+
 	return RSSL_RET_SUCCESS;
 }
 
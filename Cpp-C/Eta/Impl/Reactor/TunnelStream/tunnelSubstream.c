@@ -132,6 +132,7 @@ TunnelSubstream *tunnelSubstreamOpen(RsslTunnelStream *pTunnel,
 
 		pfOpts.currentTimeMs = tunnelStreamGetCurrentTimeMs(pSubstreamImpl->_tunnelImpl);
 		pfOpts.maxMsgSize = (RsslUInt32)pSubstreamImpl->_tunnelImpl->base.classOfService.common.maxFragmentSize;
+		pfOpts.commitInterval = tunnelStreamGetPersistenceCommitInterval(pSubstreamImpl->_tunnelImpl);
 
 		pSubstreamImpl->_pPersistFile = persistFileOpen(&pfOpts, &pSubstreamImpl->_lastInSeqNum, &pSubstreamImpl->_lastOutSeqNum, pErrorInfo);
 
@@ -1151,6 +1152,26 @@ RsslRet tunnelSubstreamClose(TunnelSubstream *pSubstream,
 	return RSSL_RET_SUCCESS;
 }
 
+RsslRet tunnelSubstreamFlushPersistence(TunnelSubstream *pSubstream, RsslInt64 currentTimeMs, RsslErrorInfo *pErrorInfo)
+{
+	TunnelSubstreamImpl *pSubstreamImpl = (TunnelSubstreamImpl*)pSubstream;
+
+	if (pSubstreamImpl->_pPersistFile == NULL)
+		return RSSL_RET_SUCCESS;
+
+	return persistFileFlush(pSubstreamImpl->_pPersistFile, currentTimeMs, pErrorInfo);
+}
+
+RsslInt64 tunnelSubstreamGetPersistenceCommitTime(TunnelSubstream *pSubstream)
+{
+	TunnelSubstreamImpl *pSubstreamImpl = (TunnelSubstreamImpl*)pSubstream;
+
+	if (pSubstreamImpl->_pPersistFile == NULL)
+		return RDM_QMSG_TC_INFINITE;
+
+	return persistFileGetNextCommitTime(pSubstreamImpl->_pPersistFile);
+}
+
 void tunnelSubstreamDestroy(TunnelSubstream *pSubstream)
 {
 	TunnelSubstreamImpl *pSubstreamImpl = (TunnelSubstreamImpl*)pSubstream;
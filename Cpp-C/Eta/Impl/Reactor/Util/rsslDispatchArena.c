@@ -0,0 +1,184 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslDispatchArena.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Alignment of every allocation, enough for any field of the RDM structures. */
+#define RSSL_DA_ALIGN 8
+#define RSSL_DA_ROUND_UP(length) (((length) + (RSSL_DA_ALIGN - 1)) & ~(RsslUInt32)(RSSL_DA_ALIGN - 1))
+
+/* Number of resets over which the block size is checked for shrinking. */
+#define RSSL_DA_SHRINK_WINDOW 1024
+
+/* Header size, rounded so that block data starts aligned. */
+#define RSSL_DA_HEADER_SIZE RSSL_DA_ROUND_UP((RsslUInt32)sizeof(RsslDispatchArenaBlock))
+
+static RsslRet _daPushBlock(RsslDispatchArena *pArena, RsslUInt32 size)
+{
+	RsslDispatchArenaBlock *pBlock;
+
+	size = RSSL_DA_ROUND_UP(size);
+	if ((pBlock = (RsslDispatchArenaBlock*)malloc(RSSL_DA_HEADER_SIZE + size)) == NULL)
+		return RSSL_RET_FAILURE;
+
+	pBlock->size = size;
+	pBlock->pNext = pArena->pBlocks;
+	pArena->pBlocks = pBlock;
+	pArena->pCursor = (char*)pBlock + RSSL_DA_HEADER_SIZE;
+	pArena->freeLength = size;
+	++pArena->blockAllocCount;
+	return RSSL_RET_SUCCESS;
+}
+
+static void _daFreeBlocks(RsslDispatchArenaBlock *pBlock)
+{
+	while (pBlock)
+	{
+		RsslDispatchArenaBlock *pNext = pBlock->pNext;
+		free(pBlock);
+		pBlock = pNext;
+	}
+}
+
+RsslRet rsslDispatchArenaInit(RsslDispatchArena *pArena, RsslUInt32 blockSize)
+{
+	memset(pArena, 0, sizeof(RsslDispatchArena));
+	pArena->blockSize = RSSL_DA_ROUND_UP(blockSize ? blockSize : RSSL_DA_ALIGN);
+	pArena->minBlockSize = pArena->blockSize;
+	return _daPushBlock(pArena, pArena->blockSize);
+}
+
+void rsslDispatchArenaCleanup(RsslDispatchArena *pArena)
+{
+	_daFreeBlocks(pArena->pBlocks);
+	pArena->pBlocks = NULL;
+	pArena->pCursor = NULL;
+	pArena->freeLength = 0;
+}
+
+void *rsslDispatchArenaAlloc(RsslDispatchArena *pArena, RsslUInt32 length)
+{
+	char *pMem;
+
+	length = RSSL_DA_ROUND_UP(length);
+	if (length > pArena->freeLength
+			&& _daPushBlock(pArena, length > pArena->blockSize ? length : pArena->blockSize) != RSSL_RET_SUCCESS)
+		return NULL;
+
+	pMem = pArena->pCursor;
+	pArena->pCursor += length;
+	pArena->freeLength -= length;
+	++pArena->allocCount;
+	pArena->allocBytes += length;
+	return pMem;
+}
+
+void rsslDispatchArenaGetBuffer(RsslDispatchArena *pArena, RsslBuffer *pBuffer)
+{
+	pBuffer->data = pArena->pCursor;
+	pBuffer->length = pArena->freeLength;
+}
+
+void rsslDispatchArenaCommit(RsslDispatchArena *pArena, RsslUInt32 length)
+{
+	if (length == 0)
+		return;
+
+	/* Rounding up may reach past the end of the block; the rest of it is then used up. */
+	length = RSSL_DA_ROUND_UP(length);
+	if (length > pArena->freeLength)
+		length = pArena->freeLength;
+
+	pArena->pCursor += length;
+	pArena->freeLength -= length;
+	++pArena->allocCount;
+	pArena->allocBytes += length;
+}
+
+RsslRet rsslDispatchArenaGrow(RsslDispatchArena *pArena, RsslUInt32 length)
+{
+	RsslUInt32 size = pArena->blockSize;
+
+	while (size < length && size < 0x80000000)
+		size <<= 1;
+
+	return _daPushBlock(pArena, size < length ? length : size);
+}
+
+/* Returns the block size to keep for passes that allocate length bytes: a multiple of the
+ * initial block size, and never smaller than it. */
+static RsslUInt32 _daBlockSizeFor(RsslDispatchArena *pArena, RsslUInt32 length)
+{
+	RsslUInt32 blocks = (length + pArena->minBlockSize - 1) / pArena->minBlockSize;
+
+	return (blocks ? blocks : 1) * pArena->minBlockSize;
+}
+
+/* Replaces all blocks with a single block of size bytes. */
+static void _daReplaceBlocks(RsslDispatchArena *pArena, RsslUInt32 size)
+{
+	_daFreeBlocks(pArena->pBlocks);
+	pArena->pBlocks = NULL;
+	pArena->blockSize = size;
+
+	if (_daPushBlock(pArena, size) != RSSL_RET_SUCCESS)
+	{
+		/* Fall back to an empty arena; the next allocation will try again. */
+		pArena->pCursor = NULL;
+		pArena->freeLength = 0;
+	}
+}
+
+void rsslDispatchArenaReset(RsslDispatchArena *pArena)
+{
+	RsslUInt32 allocBytes = pArena->allocBytes;
+
+	pArena->lastAllocCount = pArena->allocCount;
+	pArena->lastAllocBytes = allocBytes;
+	if (allocBytes > pArena->maxAllocBytes)
+		pArena->maxAllocBytes = allocBytes;
+	pArena->totalAllocCount += pArena->allocCount;
+	pArena->allocCount = 0;
+	pArena->allocBytes = 0;
+
+	if (allocBytes > pArena->windowMaxAllocBytes)
+		pArena->windowMaxAllocBytes = allocBytes;
+
+	if (pArena->pBlocks && pArena->pBlocks->pNext)
+	{
+		/* The last pass needed more than one block. Replace them with a single block
+		 * that holds what the pass allocated. */
+		_daReplaceBlocks(pArena, _daBlockSizeFor(pArena, allocBytes));
+		pArena->windowResetCount = 0;
+		pArena->windowMaxAllocBytes = 0;
+		return;
+	}
+
+	if (++pArena->windowResetCount >= RSSL_DA_SHRINK_WINDOW)
+	{
+		/* Halve a grown block that the last window of passes barely used. */
+		if (pArena->blockSize > pArena->minBlockSize && pArena->windowMaxAllocBytes <= pArena->blockSize / 4)
+		{
+			_daReplaceBlocks(pArena, _daBlockSizeFor(pArena, pArena->blockSize / 2));
+			pArena->windowResetCount = 0;
+			pArena->windowMaxAllocBytes = 0;
+			return;
+		}
+
+		pArena->windowResetCount = 0;
+		pArena->windowMaxAllocBytes = 0;
+	}
+
+	if (pArena->pBlocks)
+	{
+		pArena->pCursor = (char*)pArena->pBlocks + RSSL_DA_HEADER_SIZE;
+		pArena->freeLength = pArena->pBlocks->size;
+	}
+}
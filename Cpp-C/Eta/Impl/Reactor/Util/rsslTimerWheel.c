@@ -0,0 +1,279 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslTimerWheel.h"
+
+#if defined(_MSC_VER) && defined(_WIN64)
+#include <intrin.h>
+#pragma intrinsic(_BitScanForward64)
+#endif
+
+/* Returns the index of the lowest set bit. bits must not be zero. */
+static int _twLowestBit(RsslUInt64 bits)
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(bits);
+#elif defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanForward64(&index, bits);
+	return (int)index;
+#else
+	int index = 0;
+	while (!(bits & 1))
+	{
+		bits >>= 1;
+		++index;
+	}
+	return index;
+#endif
+}
+
+/* Rotates the slot bitmap so that the given slot is bit 0. */
+RTR_C_INLINE RsslUInt64 _twRotate(RsslUInt64 bits, int slot)
+{
+	return slot ? ((bits >> slot) | (bits << (RSSL_TW_LEVEL_SLOTS - slot))) : bits;
+}
+
+/* Places a timer in the slot matching its expire time. */
+static void _twPlaceTimer(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer)
+{
+	RsslInt64 delta = pTimer->expireTime - pWheel->currentTick;
+	int level;
+
+	if (delta < 0)
+	{
+		/* Already expired. */
+		pTimer->pQueue = &pWheel->expired;
+		rsslQueueAddLinkToBack(&pWheel->expired, &pTimer->qlTimer);
+		return;
+	}
+
+	++pWheel->timerCount;
+
+	for (level = 0; level < RSSL_TW_LEVELS; ++level)
+	{
+		if (delta < ((RsslInt64)1 << (RSSL_TW_LEVEL_BITS * (level + 1))))
+		{
+			int slot = (int)((pTimer->expireTime >> (RSSL_TW_LEVEL_BITS * level)) & RSSL_TW_LEVEL_MASK);
+
+			pTimer->pQueue = &pWheel->slots[level][slot];
+			rsslQueueAddLinkToBack(pTimer->pQueue, &pTimer->qlTimer);
+			pWheel->occupied[level] |= ((RsslUInt64)1 << slot);
+			if (pTimer->expireTime < pWheel->slotExpireTimes[level][slot])
+				pWheel->slotExpireTimes[level][slot] = pTimer->expireTime;
+			return;
+		}
+	}
+
+	pTimer->pQueue = &pWheel->overflow;
+	rsslQueueAddLinkToBack(&pWheel->overflow, &pTimer->qlTimer);
+}
+
+/* Returns the earliest expire time of the timers in a slot. */
+static RsslInt64 _twScanSlot(RsslQueue *pSlot)
+{
+	RsslInt64 expireTime = RSSL_TW_TIME_UNSET;
+	RsslQueueLink *pLink;
+
+	for (pLink = rsslQueuePeekFront(pSlot); pLink; pLink = rsslQueuePeekNext(pSlot, pLink))
+	{
+		RsslTimerWheelTimer *pTimer = RSSL_QUEUE_LINK_TO_OBJECT(RsslTimerWheelTimer, qlTimer, pLink);
+
+		if (pTimer->expireTime < expireTime)
+			expireTime = pTimer->expireTime;
+	}
+
+	return expireTime;
+}
+
+/* Removes all timers from a queue and places them again (used when a level's slot or the
+ * overflow list comes due). */
+static void _twReplaceQueue(RsslTimerWheel *pWheel, RsslQueue *pQueue)
+{
+	RsslQueue timers;
+	RsslQueueLink *pLink;
+
+	rsslInitQueue(&timers);
+	rsslQueueAppend(&timers, pQueue);
+
+	while ((pLink = rsslQueueRemoveFirstLink(&timers)))
+	{
+		RsslTimerWheelTimer *pTimer = RSSL_QUEUE_LINK_TO_OBJECT(RsslTimerWheelTimer, qlTimer, pLink);
+		--pWheel->timerCount;
+		_twPlaceTimer(pWheel, pTimer);
+	}
+}
+
+void rsslTimerWheelInit(RsslTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	int level, slot;
+
+	for (level = 0; level < RSSL_TW_LEVELS; ++level)
+	{
+		for (slot = 0; slot < RSSL_TW_LEVEL_SLOTS; ++slot)
+		{
+			rsslInitQueue(&pWheel->slots[level][slot]);
+			pWheel->slotExpireTimes[level][slot] = RSSL_TW_TIME_UNSET;
+		}
+		pWheel->occupied[level] = 0;
+	}
+
+	rsslInitQueue(&pWheel->overflow);
+	rsslInitQueue(&pWheel->expired);
+	pWheel->currentTick = currentTime;
+	pWheel->timerCount = 0;
+}
+
+void rsslTimerWheelSchedule(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer, RsslInt64 expireTime)
+{
+	rsslTimerWheelCancel(pWheel, pTimer);
+	pTimer->expireTime = expireTime;
+	_twPlaceTimer(pWheel, pTimer);
+}
+
+void rsslTimerWheelCancel(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer)
+{
+	RsslQueue *pQueue = pTimer->pQueue;
+	ptrdiff_t index;
+
+	if (pQueue == NULL)
+		return;
+
+	rsslQueueRemoveLink(pQueue, &pTimer->qlTimer);
+	pTimer->pQueue = NULL;
+
+	if (pQueue == &pWheel->expired)
+		return;
+
+	--pWheel->timerCount;
+
+	index = pQueue - &pWheel->slots[0][0];
+	if (index >= 0 && index < RSSL_TW_LEVELS * RSSL_TW_LEVEL_SLOTS && !rsslQueueGetElementCount(pQueue))
+		pWheel->occupied[index / RSSL_TW_LEVEL_SLOTS] &= ~((RsslUInt64)1 << (index % RSSL_TW_LEVEL_SLOTS));
+}
+
+RsslUInt32 rsslTimerWheelAdvance(RsslTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	while (pWheel->currentTick <= currentTime)
+	{
+		RsslInt64 tick = pWheel->currentTick;
+		RsslQueue *pSlot;
+		RsslQueueLink *pLink;
+		int level, slot;
+
+		if (pWheel->timerCount == 0)
+		{
+			pWheel->currentTick = currentTime + 1;
+			break;
+		}
+
+		/* If no timers are in the lower levels, skip ahead to the next tick where
+		 * something could cascade down (but no further than the current time). */
+		for (level = 0; level < RSSL_TW_LEVELS && !pWheel->occupied[level]; ++level);
+
+		if (level > 0)
+		{
+			RsslInt64 span = (RsslInt64)1 << (RSSL_TW_LEVEL_BITS * level);
+			RsslInt64 nextTick = (tick + span - 1) & ~(span - 1);
+
+			if (nextTick > currentTime)
+			{
+				pWheel->currentTick = currentTime + 1;
+				break;
+			}
+
+			tick = pWheel->currentTick = nextTick;
+		}
+
+		/* Cascade any upper-level slots that are now due. */
+		if ((tick & (((RsslInt64)1 << (RSSL_TW_LEVEL_BITS * RSSL_TW_LEVELS)) - 1)) == 0)
+			_twReplaceQueue(pWheel, &pWheel->overflow);
+
+		for (level = RSSL_TW_LEVELS - 1; level > 0; --level)
+		{
+			if ((tick & (((RsslInt64)1 << (RSSL_TW_LEVEL_BITS * level)) - 1)) == 0)
+			{
+				slot = (int)((tick >> (RSSL_TW_LEVEL_BITS * level)) & RSSL_TW_LEVEL_MASK);
+				pWheel->occupied[level] &= ~((RsslUInt64)1 << slot);
+				pWheel->slotExpireTimes[level][slot] = RSSL_TW_TIME_UNSET;
+				_twReplaceQueue(pWheel, &pWheel->slots[level][slot]);
+			}
+		}
+
+		/* Expire the timers in this tick's slot. */
+		slot = (int)(tick & RSSL_TW_LEVEL_MASK);
+		pSlot = &pWheel->slots[0][slot];
+
+		if (pWheel->occupied[0] & ((RsslUInt64)1 << slot))
+		{
+			pWheel->occupied[0] &= ~((RsslUInt64)1 << slot);
+			pWheel->timerCount -= rsslQueueGetElementCount(pSlot);
+			for (pLink = rsslQueuePeekFront(pSlot); pLink; pLink = rsslQueuePeekNext(pSlot, pLink))
+				RSSL_QUEUE_LINK_TO_OBJECT(RsslTimerWheelTimer, qlTimer, pLink)->pQueue = &pWheel->expired;
+			rsslQueueAppend(&pWheel->expired, pSlot);
+		}
+
+		pWheel->currentTick = tick + 1;
+	}
+
+	return rsslQueueGetElementCount(&pWheel->expired);
+}
+
+RsslInt64 rsslTimerWheelGetNextExpireTime(RsslTimerWheel *pWheel)
+{
+	RsslInt64 nextTime = RSSL_TW_TIME_UNSET;
+	int level;
+
+	if (rsslQueueGetElementCount(&pWheel->expired))
+		return pWheel->currentTick - 1;
+
+	if (pWheel->timerCount == 0)
+		return RSSL_TW_TIME_UNSET;
+
+	for (level = 0; level < RSSL_TW_LEVELS; ++level)
+	{
+		int shift = RSSL_TW_LEVEL_BITS * level;
+		RsslInt64 base;
+		RsslInt64 time;
+		int slot;
+
+		if (!pWheel->occupied[level])
+			continue;
+
+		/* Find the first occupied slot at or after the next boundary of this level. */
+		base = (pWheel->currentTick + ((RsslInt64)1 << shift) - 1) >> shift;
+		time = (base + _twLowestBit(_twRotate(pWheel->occupied[level], (int)(base & RSSL_TW_LEVEL_MASK)))) << shift;
+
+		/* A level 0 slot covers one tick, so its time is exact. An upper-level slot cascades at its boundary,
+		 * but its timers are not due until the earliest one expires, so report that instead of waking early
+		 * for the cascade. If the time kept for the slot has passed, the timer it belonged to was cancelled. */
+		if (level > 0)
+		{
+			slot = (int)((time >> shift) & RSSL_TW_LEVEL_MASK);
+
+			if (pWheel->slotExpireTimes[level][slot] < pWheel->currentTick)
+				pWheel->slotExpireTimes[level][slot] = _twScanSlot(&pWheel->slots[level][slot]);
+
+			if (pWheel->slotExpireTimes[level][slot] > time)
+				time = pWheel->slotExpireTimes[level][slot];
+		}
+
+		if (time < nextTime)
+			nextTime = time;
+	}
+
+	if (rsslQueueGetElementCount(&pWheel->overflow))
+	{
+		int shift = RSSL_TW_LEVEL_BITS * RSSL_TW_LEVELS;
+		RsslInt64 time = ((pWheel->currentTick + ((RsslInt64)1 << shift) - 1) >> shift) << shift;
+
+		if (time < nextTime)
+			nextTime = time;
+	}
+
+	return nextTime;
+}
@@ -0,0 +1,80 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#ifndef _RSSL_DISPATCH_ARENA_H
+#define _RSSL_DISPATCH_ARENA_H
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslRetCodes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bump allocator for memory that is only needed until the reactor's next dispatch pass, such as
+ * RDM structures decoded for a callback. Allocating moves a cursor through the current block; a
+ * reset gives all of it back at once. When one pass needs more than the current block, further
+ * blocks are chained on, and the next reset replaces them with a single block large enough for
+ * the whole pass, so steady-state dispatching makes no heap allocations. A block grown past the
+ * initial size is halved when a window of passes has used no more than a quarter of it.
+ *
+ * An arena is not thread-safe; the reactor only uses it while holding its interface lock. */
+
+typedef struct RsslDispatchArenaBlock
+{
+	struct RsslDispatchArenaBlock	*pNext;		/* Next older block. */
+	RsslUInt32						size;		/* Usable bytes following this header. */
+} RsslDispatchArenaBlock;
+
+typedef struct
+{
+	RsslDispatchArenaBlock	*pBlocks;		/* Blocks in use, current block first. */
+	char					*pCursor;		/* Next free byte in the current block. */
+	RsslUInt32				freeLength;		/* Bytes left in the current block. */
+	RsslUInt32				blockSize;		/* Size of the block kept across resets. */
+	RsslUInt32				minBlockSize;	/* Initial block size; blocks are kept at a multiple of it. */
+	RsslUInt32				windowResetCount;		/* Resets since the current shrink window started. */
+	RsslUInt32				windowMaxAllocBytes;	/* Largest allocBytes seen in the current shrink window. */
+
+	RsslUInt32				allocCount;			/* Allocations since the last reset. */
+	RsslUInt32				allocBytes;			/* Bytes handed out since the last reset. */
+	RsslUInt32				lastAllocCount;		/* allocCount at the last reset. */
+	RsslUInt32				lastAllocBytes;		/* allocBytes at the last reset. */
+	RsslUInt32				maxAllocBytes;		/* Largest allocBytes seen at a reset. */
+	RsslUInt64				totalAllocCount;	/* Allocations since the arena was created. */
+	RsslUInt64				blockAllocCount;	/* Heap allocations made by the arena, including the first block. */
+} RsslDispatchArena;
+
+/* Initializes an arena with one block of blockSize bytes. */
+RsslRet rsslDispatchArenaInit(RsslDispatchArena *pArena, RsslUInt32 blockSize);
+
+/* Frees all memory held by the arena. */
+void rsslDispatchArenaCleanup(RsslDispatchArena *pArena);
+
+/* Returns length bytes, aligned for any type, or NULL if a needed block could not be allocated. */
+void *rsslDispatchArenaAlloc(RsslDispatchArena *pArena, RsslUInt32 length);
+
+/* Sets pBuffer to the free space in the current block, for use with functions that fill
+ * an RsslBuffer such as the RDM encoders and decoders. Call rsslDispatchArenaCommit
+ * afterwards to keep what was used. */
+void rsslDispatchArenaGetBuffer(RsslDispatchArena *pArena, RsslBuffer *pBuffer);
+
+/* Keeps the first length bytes of the space returned by rsslDispatchArenaGetBuffer. */
+void rsslDispatchArenaCommit(RsslDispatchArena *pArena, RsslUInt32 length);
+
+/* Starts a new block with at least length free bytes. Used when rsslDispatchArenaGetBuffer
+ * did not return enough space. */
+RsslRet rsslDispatchArenaGrow(RsslDispatchArena *pArena, RsslUInt32 length);
+
+/* Gives back everything allocated since the last reset and records the counts for it. */
+void rsslDispatchArenaReset(RsslDispatchArena *pArena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -14,6 +14,7 @@ extern "C" {
 
 #include "rtr/rsslTransport.h"
 #include "rtr/rsslMsg.h"
+#include "rtr/rsslReactor.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -84,6 +85,8 @@ RTR_C_INLINE RsslUInt32 rsslGetEstimatedEncodedLength(RsslMsg *pRsslMsg)
 	return msgSize;
 }
 
+/* Returns how many messages the reactor has sent by reusing its cached RWF-to-JSON conversion. */
+RsslUInt64 _reactorGetJsonConversionCacheHits(RsslReactor *pReactor);
 
 
 
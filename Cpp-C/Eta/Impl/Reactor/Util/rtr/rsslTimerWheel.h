@@ -0,0 +1,111 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#ifndef _RSSL_TIMER_WHEEL_H
+#define _RSSL_TIMER_WHEEL_H
+
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Hierarchical timer wheel used by the watchlist and the reactor worker.
+ * Time is measured in milliseconds; each level has RSSL_TW_LEVEL_SLOTS slots, and each slot
+ * of a level covers RSSL_TW_LEVEL_SLOTS slots of the level below it. Arming and cancelling a timer
+ * are O(1). Timers that fall due are moved in batches to an expired list, from which the owner pops them.
+ * Timers further out than the top level can cover wait in an overflow list and are re-placed
+ * each time the top level wraps.
+ *
+ * A timer wheel is not thread-safe; it should only be used by the thread that owns it. */
+
+#define RSSL_TW_LEVEL_BITS	6
+#define RSSL_TW_LEVEL_SLOTS	(1 << RSSL_TW_LEVEL_BITS)
+#define RSSL_TW_LEVEL_MASK	(RSSL_TW_LEVEL_SLOTS - 1)
+#define RSSL_TW_LEVELS		4
+
+static const RsslInt64 RSSL_TW_TIME_UNSET = 0x7fffffffffffffffLL;
+
+/* A timer. Embed this in the object that needs the timeout. */
+typedef struct
+{
+	RsslQueueLink	qlTimer;		/* Link for the slot (or expired list) holding this timer. */
+	RsslQueue		*pQueue;		/* Slot or list currently holding this timer; NULL if not armed. */
+	RsslInt64		expireTime;		/* Time at which this timer expires, in milliseconds. */
+} RsslTimerWheelTimer;
+
+/* Clears an RsslTimerWheelTimer. */
+RTR_C_INLINE void rsslClearTimerWheelTimer(RsslTimerWheelTimer *pTimer)
+{
+	rsslInitQueueLink(&pTimer->qlTimer);
+	pTimer->pQueue = NULL;
+	pTimer->expireTime = RSSL_TW_TIME_UNSET;
+}
+
+/* Indicates whether the timer is armed (including if it has expired but not yet been popped). */
+RTR_C_INLINE RsslBool rsslTimerWheelTimerIsArmed(RsslTimerWheelTimer *pTimer)
+{
+	return pTimer->pQueue != NULL ? RSSL_TRUE : RSSL_FALSE;
+}
+
+typedef struct
+{
+	RsslQueue	slots[RSSL_TW_LEVELS][RSSL_TW_LEVEL_SLOTS];	/* Timer slots, per level. */
+	RsslUInt64	occupied[RSSL_TW_LEVELS];						/* Bitmap of non-empty slots, per level. */
+	RsslInt64	slotExpireTimes[RSSL_TW_LEVELS][RSSL_TW_LEVEL_SLOTS];	/* Earliest expire time placed in each upper-level slot. May be
+																		 * earlier than any timer in the slot once that timer is cancelled. */
+	RsslQueue	overflow;			/* Timers beyond the range of the top level. */
+	RsslQueue	expired;			/* Timers that have expired and not yet been popped. */
+	RsslInt64	currentTick;		/* Next millisecond the wheel has yet to process. */
+	RsslUInt32	timerCount;			/* Number of timers in the wheel, not counting expired timers. */
+} RsslTimerWheel;
+
+/* Initializes a timer wheel, starting at the given time. */
+void rsslTimerWheelInit(RsslTimerWheel *pWheel, RsslInt64 currentTime);
+
+/* Arms a timer to expire at the given time. If the timer is already armed, it is re-armed. */
+void rsslTimerWheelSchedule(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer, RsslInt64 expireTime);
+
+/* Cancels a timer, if it is armed. */
+void rsslTimerWheelCancel(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer);
+
+/* Advances the wheel to the given time, moving all timers with an expire time at or before it
+ * to the expired list. Returns the number of timers waiting on the expired list. */
+RsslUInt32 rsslTimerWheelAdvance(RsslTimerWheel *pWheel, RsslInt64 currentTime);
+
+/* Removes and returns the next expired timer, or NULL if there are none. */
+RTR_C_INLINE RsslTimerWheelTimer *rsslTimerWheelPopExpired(RsslTimerWheel *pWheel)
+{
+	RsslQueueLink *pLink;
+	RsslTimerWheelTimer *pTimer;
+
+	if (!(pLink = rsslQueueRemoveFirstLink(&pWheel->expired)))
+		return NULL;
+
+	pTimer = RSSL_QUEUE_LINK_TO_OBJECT(RsslTimerWheelTimer, qlTimer, pLink);
+	pTimer->pQueue = NULL;
+	return pTimer;
+}
+
+/* Returns the earliest time at which the wheel may have a timer to expire. This is never later than
+ * the expire time of the next timer, and only earlier if the earliest timer placed in an upper-level slot
+ * was cancelled; the slot is rescanned once that time has passed. Timers in the overflow list are reported
+ * at the time the top level wraps. Returns RSSL_TW_TIME_UNSET if the wheel is empty. */
+RsslInt64 rsslTimerWheelGetNextExpireTime(RsslTimerWheel *pWheel);
+
+/* Returns the number of armed timers, including expired timers not yet popped. */
+RTR_C_INLINE RsslUInt32 rsslTimerWheelGetTimerCount(RsslTimerWheel *pWheel)
+{
+	return pWheel->timerCount + rsslQueueGetElementCount(&pWheel->expired);
+}
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -45,6 +45,8 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	baseInitOpts.ticksPerMsec = pCreateOptions->ticksPerMsec;
 	baseInitOpts.maxOutstandingPosts = pCreateOptions->maxOutstandingPosts;
 	baseInitOpts.postAckTimeout = pCreateOptions->postAckTimeout;
+	baseInitOpts.recoveryRequestRate = pCreateOptions->recoveryRequestRate;
+	baseInitOpts.maxOutstandingRecoveryRefreshes = pCreateOptions->maxOutstandingRecoveryRefreshes;
 
 	if ((ret = wlBaseInit(&pWatchlistImpl->base, &baseInitOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
@@ -520,6 +522,9 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 		}
 	}
 
+	/* Release any recovering streams the pacer now allows. */
+	wlItemStreamProcessRecovery(&pWatchlistImpl->base);
+
 	/* Send any item requests. */
 	RSSL_QUEUE_FOR_EACH_LINK(&pWatchlistImpl->base.streamsPendingRequest,
 			pLink)
@@ -550,13 +555,12 @@ RsslInt64 rsslWatchlistGetNextTimeout(RsslWatchlist *pWatchlist)
 	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
 	RsslQueueLink *pLink;
 	RsslInt64 time = WL_TIME_UNSET;
+	RsslInt64 recoveryTime;
 	
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
-	{
-		WlStreamBase *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStreamBase, qlStreamsPendingResponse, 
-				pLink);
-		time = pStream->requestExpireTime;
-	}
+	time = rsslTimerWheelGetNextExpireTime(&pWatchlistImpl->base.streamsPendingResponse);
+
+	recoveryTime = wlItemStreamGetRecoveryTimeout(&pWatchlistImpl->base);
+	if (recoveryTime < time) time = recoveryTime;
 
 	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.ftGroupTimerQueue)))
 	{
@@ -580,15 +584,17 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 {
 	RsslWatchlistImpl		*pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
 	RsslQueueLink			*pLink;
+	RsslTimerWheelTimer		*pTimer;
 	RsslStatusMsg			statusMsg;
 	RsslAckMsg				ackMsg;
 	RsslWatchlistMsgEvent	msgEvent;
 	RsslRet					ret;
 
-	if (!rsslQueueGetElementCount(&pWatchlistImpl->base.streamsPendingResponse)
+	if (!rsslTimerWheelGetTimerCount(&pWatchlistImpl->base.streamsPendingResponse)
 			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.ftGroupTimerQueue)
 			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.gapStreamQueue)
 			&& !rsslQueueGetElementCount(&pWatchlistImpl->base.postTable.timeoutQueue)
+			&& !pWatchlistImpl->base.recoveryPacer.queuedCount
 			)
 		return RSSL_RET_SUCCESS;
 
@@ -605,23 +611,23 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 
 	pWatchlistImpl->base.watchlist.state &= ~RSSLWL_STF_NEED_TIMER;
 
+	/* Release recovering streams. Any that are released are sent on the next dispatch. */
+	pWatchlistImpl->base.currentTime = currentTime;
+	wlItemStreamProcessRecovery(&pWatchlistImpl->base);
+
 	/* Check stream timeouts. */
 	rssl_set_buffer_to_string(statusMsg.state.text, "Request timed out.");
 	statusMsg.state.code = RSSL_SC_TIMEOUT;
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
+	rsslTimerWheelAdvance(&pWatchlistImpl->base.streamsPendingResponse, currentTime);
+	while ((pTimer = rsslTimerWheelPopExpired(&pWatchlistImpl->base.streamsPendingResponse)))
 	{
 		WlStream *pStream = (WlStream*)RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
-				base.qlStreamsPendingResponse, pLink);
+				base.requestTimer, pTimer);
 
 		statusMsg.msgBase.domainType = pStream->base.domainType;
 
-		/* Next timeout in queue has not expired yet. */
-		if (pStream->base.requestExpireTime > currentTime)
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
-		
+		/* Timer has already been removed from the wheel. */
+		pStream->base.requestState &= ~WL_STRS_PENDING_RESPONSE;
 		wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pStream->base);
 
 		switch(pStream->base.domainType)
@@ -707,6 +713,9 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 		}
 	}
 
+	if (rsslTimerWheelGetTimerCount(&pWatchlistImpl->base.streamsPendingResponse))
+		pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
+
 	/* Check FTGroups. */
 	rssl_set_buffer_to_string(statusMsg.state.text, "Fault-tolerant Group timeout.");
 	statusMsg.state.code = RSSL_SC_TIMEOUT;
@@ -909,6 +918,30 @@ void rsslWatchlistResetGapTimer(RsslWatchlist *pWatchlist)
 	pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
 }
 
+void rsslWatchlistGetRecoveryStats(RsslWatchlist *pWatchlist, RsslWatchlistRecoveryStats *pStats)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+	WlRecoveryPacer *pPacer = &pWatchlistImpl->base.recoveryPacer;
+	int priorityClass;
+
+	memset(pStats, 0, sizeof(RsslWatchlistRecoveryStats));
+	pStats->queuedCount = pPacer->queuedCount;
+	pStats->outstandingCount = pPacer->outstandingCount;
+	pStats->recoveredCount = pPacer->recoveredCount;
+	pStats->startTime = pPacer->startTime;
+	pStats->lastRecoveredTime = pPacer->lastRecoveredTime;
+
+	for (priorityClass = WL_RECOVERY_PRIORITY_CLASSES - 1; priorityClass >= 0; --priorityClass)
+	{
+		if (pPacer->classCounts[priorityClass])
+		{
+			pStats->topPriorityClass = (RsslUInt8)priorityClass;
+			pStats->topPriorityClassCount = pPacer->classCounts[priorityClass];
+			break;
+		}
+	}
+}
+
 /*** Supporting implementation functions. ***/
 
 static RsslRet wlServiceUpdateCallback(WlServiceCache *pServiceCache,
@@ -2721,6 +2754,7 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 		   )
 		{
 			/* Recoverable item. Change state before fanning out. */
+			pItemRequest->flags |= WL_IRQF_RECOVERING;
 
 			if (pItemRequest->pRequestedService->pMatchingService)
 			{
@@ -3694,8 +3728,7 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 	/* Calls JSON converter when the protocol type is simplified JSON. */
 	if (pWatchlistImpl->base.pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE)
 	{
-		RsslDecodeIterator dIter;
-		RsslMsg rsslMsg;
+		RsslBuffer jsonBuffer;
 
 		/* Added checking to ensure that the JSON converter is initialized properly.*/
 		if (pReactorImpl->pJsonConverter == 0)
@@ -3704,44 +3737,10 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 			return RSSL_RET_FAILURE;
 		}
 
-		rsslClearMsg(&rsslMsg);
-		rsslClearDecodeIterator(&dIter);
-		rsslSetDecodeIteratorRWFVersion(&dIter, pWatchlistImpl->base.pRsslChannel->majorVersion,
-			pWatchlistImpl->base.pRsslChannel->minorVersion);
-
-		rsslSetDecodeIteratorBuffer(&dIter, pOutputBuffer);
-
-		ret = rsslDecodeMsg(&dIter, &rsslMsg);
+		ret = _reactorConvertRwfToJson(pReactorImpl, pWatchlistImpl->base.pRsslChannel, pOutputBuffer, &jsonBuffer, pError);
 
 		if (ret == RSSL_RET_SUCCESS)
 		{
-			RsslConvertRsslMsgToJsonOptions rjcOptions;
-			RsslGetJsonMsgOptions getJsonMsgOptions;
-			RsslJsonConverterError rjcError;
-			RsslBuffer jsonBuffer;
-
-			rsslClearConvertRsslMsgToJsonOptions(&rjcOptions);
-			rjcOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-			if ((rsslConvertRsslMsgToJson(pReactorImpl->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
-			{
-				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
-					"Failed to convert RWF to JSON protocol. Error text: %s", rjcError.text);
-				return RSSL_RET_FAILURE;
-			}
-
-			rsslClearGetJsonMsgOptions(&getJsonMsgOptions);
-			getJsonMsgOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-			getJsonMsgOptions.streamId = rsslMsg.msgBase.streamId;
-			getJsonMsgOptions.isCloseMsg = (rsslMsg.msgBase.msgClass == RSSL_MC_CLOSE) ? RSSL_TRUE : RSSL_FALSE;
-
-			if ((ret = rsslGetConverterJsonMsg(pReactorImpl->pJsonConverter, &getJsonMsgOptions,
-				&jsonBuffer, &rjcError)) != RSSL_RET_SUCCESS)
-			{
-				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
-					"Failed to get converted JSON message. Error text: %s", rjcError.text);
-				return RSSL_RET_FAILURE;
-			}
-
 			/* Copies JSON data format to the buffer that belongs to RsslChannel */
 			pMsgBuffer = rsslReactorGetBuffer(&pReactorChannelImpl->reactorChannel, jsonBuffer.length, RSSL_FALSE, pError);
 
@@ -3763,11 +3762,7 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 			pOutputBuffer = pMsgBuffer;
 		}
 		else
-		{
-			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
-				"rsslDecodeMsg() failed to decode the passed in buffer as RWF messages.");
 			return ret;
-		}
 	}
 
 	if ((ret = rsslWrite(pWatchlistImpl->base.pRsslChannel, pOutputBuffer, RSSL_HIGH_PRIORITY, 0, &bytes, &uncompBytes,
@@ -102,6 +102,8 @@ typedef struct
 	RsslUInt32					postAckTimeout;
 	RsslInt64					ticksPerMsec;
 	RsslInt32					loginRequestCount;
+	RsslUInt32					recoveryRequestRate;
+	RsslUInt32					maxOutstandingRecoveryRefreshes;
 } RsslWatchlistCreateOptions;
 
 /* Reactor-facing watchlist structure. */
@@ -157,6 +159,22 @@ RTR_C_INLINE void rsslWatchlistClearProcessMsgOptions(RsslWatchlistProcessMsgOpt
 	memset(pOptions, 0, sizeof(RsslWatchlistProcessMsgOptions));
 }
 
+/* Progress of item recovery. Counts are for the current round of recovery, which starts when 
+ * an item begins recovering while no others are. */
+typedef struct
+{
+	RsslUInt32	queuedCount;				/* Items waiting to send their recovery request. */
+	RsslUInt32	outstandingCount;			/* Items waiting for the refresh to their recovery request. */
+	RsslUInt	recoveredCount;				/* Items that have completed recovery. */
+	RsslUInt8	topPriorityClass;			/* Highest priority class with items still recovering. */
+	RsslUInt32	topPriorityClassCount;		/* Number of items still recovering in topPriorityClass. */
+	RsslInt64	startTime;					/* Time the current round of recovery started, in milliseconds. */
+	RsslInt64	lastRecoveredTime;			/* Time an item last completed recovery, in milliseconds. */
+} RsslWatchlistRecoveryStats;
+
+/* Retrieves the progress of item recovery. */
+void rsslWatchlistGetRecoveryStats(RsslWatchlist *pWatchlist, RsslWatchlistRecoveryStats *pStats);
+
 /* Reads a message from the provider. */
 RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist, 
 		RsslWatchlistProcessMsgOptions *pOptions, RsslInt64 currentTime, RsslErrorInfo *pErrorInfo);
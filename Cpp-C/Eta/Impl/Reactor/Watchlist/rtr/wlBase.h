@@ -17,6 +17,7 @@
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslTypes.h"
 #include "rtr/wlPostIdTable.h"
+#include "rtr/rsslTimerWheel.h"
 #include <assert.h>
 
 static const RsslInt64 WL_TIME_UNSET = 0x7fffffffffffffffLL;
@@ -91,10 +92,9 @@ struct WlStreamBase
 	RsslHashLink	hlStreamId;
 	RsslQueueLink	qlStreamsList;
 	RsslQueueLink	qlStreamsPendingRequest;
-	RsslQueueLink	qlStreamsPendingResponse;
+	RsslTimerWheelTimer	requestTimer;		/* Timer for request timeout, while waiting for a response. */
 	RsslInt32		streamId;
 	RsslUInt8		domainType;
-	RsslInt64		requestExpireTime;			/* Time at which the request is considered timed out. */
 	RsslBool		isClosing;
 	RsslBool		tempStream;
 	RsslUInt8		requestState;
@@ -104,6 +104,7 @@ struct WlStreamBase
 RTR_C_INLINE void wlStreamBaseInit(WlStreamBase *pBase, RsslInt32 streamId, RsslUInt8 domainType)
 {
 	memset(pBase, 0, sizeof(WlStreamBase));
+	rsslClearTimerWheelTimer(&pBase->requestTimer);
 	pBase->streamId = streamId;
 	pBase->domainType = domainType;
 }
@@ -131,6 +132,32 @@ typedef enum
 									  * or directory stream receiving a CLOSED state). */
 } WlChannelState;
 
+#define WL_RECOVERY_PRIORITY_CLASSES 256
+
+/* Paces the refresh requests of recovering item streams. Streams are released highest
+ * priority class first, limited by a token bucket of requests per second and by the number
+ * of recovery refreshes outstanding. */
+typedef struct
+{
+	RsslUInt32	requestRate;			/* Recovery requests allowed per second. 0 for no limit. */
+	RsslUInt32	maxOutstanding;			/* Recovery refreshes allowed outstanding. 0 for no limit. */
+	RsslInt64	tokens;					/* Requests available, in thousandths of a request. */
+	RsslInt64	lastRefillTime;			/* Time at which tokens were last added. */
+	RsslQueue	queues[WL_RECOVERY_PRIORITY_CLASSES];		/* Streams waiting to request, by priority class. */
+	RsslUInt32	classCounts[WL_RECOVERY_PRIORITY_CLASSES];	/* Streams queued or outstanding, by priority class. */
+	RsslUInt32	queuedCount;			/* Number of streams waiting to request. */
+	RsslUInt32	outstandingCount;		/* Number of recovery requests waiting for a complete refresh. */
+	RsslUInt	recoveredCount;			/* Number of streams that completed recovery. */
+	RsslInt64	startTime;				/* Time the current round of recovery started. */
+	RsslInt64	lastRecoveredTime;		/* Time a stream last completed recovery. */
+} WlRecoveryPacer;
+
+/* Indicates whether recovering streams should be paced. */
+RTR_C_INLINE RsslBool wlRecoveryPacerIsEnabled(WlRecoveryPacer *pPacer)
+{
+	return (pPacer->requestRate || pPacer->maxOutstanding) ? RSSL_TRUE : RSSL_FALSE;
+}
+
 /* Watchlist base structure.
  * Contains elements commonly operated on by the different domain handlers. */
 typedef struct WlBase
@@ -154,7 +181,7 @@ typedef struct WlBase
 	RsslBuffer			*pWriteCallAgainBuffer;	/* Used to handle RSSL_RET_WRITE_CALL_AGAIN codes from rsslWrite. */
 	WlServiceCache		*pServiceCache;			/* Serivce cache. */
 	RsslQueue			streamsPendingRequest;	/* Streams that need to send a request. */
-	RsslQueue			streamsPendingResponse;	/* Streams opened but waiting for a response. */
+	RsslTimerWheel		streamsPendingResponse;	/* Request timers of streams opened but waiting for a response. */
 	RsslMemoryPool		requestPool;			/* Pool of WlRequest structures. */
 	RsslMemoryPool		streamPool;				/* Pool of WlStream structures. */
 	RsslInt64			currentTime;			/* Latest timestamp set by caller, in milliseconds. */
@@ -167,6 +194,7 @@ typedef struct WlBase
 	WlPostTable			postTable;				/* Table of posts waiting for acknowledgement. */
 	RsslUInt32 			maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32 			postAckTimeout;			/* Timeout for acks of posts. */
+	WlRecoveryPacer		recoveryPacer;			/* Paces requests of recovering item streams. */
 } WlBase;
 
 /* Options for initializing the base structure. */
@@ -183,6 +211,8 @@ typedef struct
 	RsslInt64						ticksPerMsec;			/* Ticks per millisecond. Used when getting current time (windows only) */
 	RsslUInt32						maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32						postAckTimeout;			/* Timeout for acks of onstream posts. */
+	RsslUInt32						recoveryRequestRate;	/* Recovery requests allowed per second. */
+	RsslUInt32						maxOutstandingRecoveryRefreshes;	/* Recovery refreshes allowed outstanding. */
 } WlBaseInitOptions;
 
 /* Initializes a WlBase structure. */
@@ -36,7 +36,9 @@ typedef enum
 												 * but currently in excess of service OpenWindow. */
 	WL_ISRS_REQUEST_REFRESH				= 2,	/* Need to request a refresh. */
 	WL_ISRS_PENDING_REFRESH				= 3,	/* Currently waiting for a refresh .*/
-	WL_ISRS_PENDING_REFRESH_COMPLETE	= 4		/* Recevied partial refresh, need the rest. */
+	WL_ISRS_PENDING_REFRESH_COMPLETE	= 4,	/* Recevied partial refresh, need the rest. */
+	WL_ISRS_PENDING_RECOVERY			= 5		/* Need to request a refresh,
+												 * but waiting for the recovery pacer. */
 } WlItemStreamRefreshState;
 
 /* Indicates current status of the stream. */
@@ -58,7 +60,9 @@ typedef enum
 	WL_IOSF_BC_BEHIND_UC				= 0x1000,	/* Broadcast stream is behind unicast stream. */
 	WL_IOSF_HAS_BC_SYNCH_SEQ_NUM		= 0x2000,	/* WlItemStream::bcSynchSeqNum contains the sequence number of a broadcast message that was used to syncrhonize. */
 	WL_IOSF_CLOSED						= 0x4000,	/* If closing this stream, do we need to send a close upstream? */
-	WL_IOSF_QUALIFIED					= 0x8000	/* Stream is qualified. */
+	WL_IOSF_QUALIFIED					= 0x8000,	/* Stream is qualified. */
+	WL_IOSF_RECOVERING					= 0x10000,	/* Stream's next refresh request recovers an item and should be paced. */
+	WL_IOSF_RECOVERY_SENT				= 0x20000	/* Stream was released by the recovery pacer and is waiting for its refresh. */
 } WlItemStreamFlags;
 
 /* Maintains information about a stream open on the network. */
@@ -76,6 +80,7 @@ struct WlItemStream
 	WlStreamAttributes	streamAttributes;			/* Stream attributes. */
 	RsslUInt8			priorityClass;				/* Stream's current priority class. */
 	RsslUInt16			priorityCount;				/* Stream's current priority count. */
+	RsslUInt8			recoveryPriorityClass;		/* Priority class the stream was queued under by the recovery pacer. */
 	RsslQueue			requestsRecovering;			/* Requests waiting to send a request message. */
 	RsslQueue			requestsPendingRefresh;		/* Requests waiting for a refresh. */
 	RsslQueue			requestsOpen;				/* Requests that have received their complete refresh. */
@@ -125,7 +130,8 @@ typedef enum
 	WL_IRQF_BATCH			= 0x10,	/* Request is a batch request and needs acknowledgement. */
 	WL_IRQF_HAS_PROV_KEY	= 0x20,	/* Request is provider driven but has received a message with 
 									 * a key. */
-	WL_IRQF_QUALIFIED		= 0x40	/* Request is for a qualified stream. */
+	WL_IRQF_QUALIFIED		= 0x40,	/* Request is for a qualified stream. */
+	WL_IRQF_RECOVERING		= 0x80	/* Request is recovering after its stream was closed. */
 } WlItemRequestFlags;
 
 struct WlItemRequest
@@ -325,6 +331,13 @@ RsslRet wlItemRequestSendMsg(WlBase *pBase,
 /* Sets an item stream to request a message. */
 void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBool requestRefresh);
 
+/* Releases streams waiting for the recovery pacer, as tokens and outstanding refreshes allow. */
+void wlItemStreamProcessRecovery(WlBase *pBase);
+
+/* Returns the time at which the recovery pacer can next release a stream, or WL_TIME_UNSET if
+ * it has nothing to release or is waiting for outstanding refreshes. */
+RsslInt64 wlItemStreamGetRecoveryTimeout(WlBase *pBase);
+
 /* Removes an item stream from the message pending queue. */
 void wlItemStreamUnsetMsgPending(WlBase *pBase, WlItemStream *pItemStream);
 
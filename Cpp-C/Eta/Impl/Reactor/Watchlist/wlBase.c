@@ -76,6 +76,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	WlServiceCacheCreateOptions		serviceCacheOpts;
 	WlServiceCache					*pServiceCache;
 	RsslRet ret;
+	int i;
 
 	wlServiceCacheClearCreateOptions(&serviceCacheOpts);
 	serviceCacheOpts.serviceUpdateCallback = pOpts->updateCallback;
@@ -157,7 +158,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	rsslInitQueue(&pBase->requestedServices);
 	rsslInitQueue(&pBase->streamsPendingRequest);
 
-	rsslInitQueue(&pBase->streamsPendingResponse);
+	rsslTimerWheelInit(&pBase->streamsPendingResponse, getCurrentTimeMs(pOpts->ticksPerMsec));
 	rsslInitQueue(&pBase->openStreams);
 
 	if ((ret = rsslMemoryPoolInit(&pBase->streamPool, pOpts->streamPoolBlockSize, 
@@ -184,6 +185,12 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 
 	pBase->maxOutstandingPosts = pOpts->maxOutstandingPosts;
 	pBase->postAckTimeout = pOpts->postAckTimeout;
+
+	for (i = 0; i < WL_RECOVERY_PRIORITY_CLASSES; ++i)
+		rsslInitQueue(&pBase->recoveryPacer.queues[i]);
+	pBase->recoveryPacer.requestRate = pOpts->recoveryRequestRate;
+	pBase->recoveryPacer.maxOutstanding = pOpts->maxOutstandingRecoveryRefreshes;
+	pBase->recoveryPacer.tokens = (RsslInt64)pOpts->recoveryRequestRate * 1000;
 	
 	return RSSL_RET_SUCCESS;
 }
@@ -239,11 +246,10 @@ void wlSetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (!(pStreamBase->requestState & WL_STRS_PENDING_RESPONSE))
 	{
-		rsslQueueAddLinkToBack(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
+		rsslTimerWheelSchedule(&pBase->streamsPendingResponse, &pStreamBase->requestTimer,
+				pBase->currentTime + pBase->config.requestTimeout);
 		pStreamBase->requestState |= WL_STRS_PENDING_RESPONSE;
 
-		pStreamBase->requestExpireTime = pBase->currentTime + pBase->config.requestTimeout;
 		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 	}
 }
@@ -261,8 +267,7 @@ void wlUnsetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (pStreamBase->requestState & WL_STRS_PENDING_RESPONSE)
 	{
-		rsslQueueRemoveLink(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
+		rsslTimerWheelCancel(&pBase->streamsPendingResponse, &pStreamBase->requestTimer);
 		pStreamBase->requestState &= ~WL_STRS_PENDING_RESPONSE;
 	}
 }
@@ -361,6 +361,9 @@ RsslRet wlItemStreamInit(WlItemStream *pItemStream, WlStreamAttributes *pStreamA
 
 void wlItemStreamResetState(WlItemStream *pItemStream)
 {
+	/* Streams waiting on the recovery pacer have not requested anything yet. */
+	assert(pItemStream->refreshState != WL_ISRS_PENDING_RECOVERY);
+
 	if (pItemStream->refreshState != WL_ISRS_NONE)
 	{
 		if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
@@ -374,7 +377,7 @@ void wlItemStreamResetState(WlItemStream *pItemStream)
 	}
 
 	/* Reset flags(set view change flag so that view gets re-checked). */
-	pItemStream->flags = WL_IOSF_PENDING_VIEW_CHANGE;
+	pItemStream->flags = WL_IOSF_PENDING_VIEW_CHANGE | (pItemStream->flags & (WL_IOSF_RECOVERING | WL_IOSF_RECOVERY_SENT));
 	pItemStream->priorityClass = 1;
 	pItemStream->priorityCount = 1;
 }
@@ -466,6 +469,53 @@ RsslBool wlItemStreamMergePriority(WlItemStream *pItemStream, RsslUInt8 *pPriori
 	return (*pPriorityClass != origPriorityClass || *pPriorityCount != origPriorityCount);
 }
 
+/* Queues a stream to wait for the recovery pacer, under its merged priority class. */
+static void wlItemStreamAddRecovery(WlBase *pBase, WlItemStream *pItemStream)
+{
+	WlRecoveryPacer *pPacer = &pBase->recoveryPacer;
+	RsslUInt8 priorityClass = pItemStream->priorityClass;
+	RsslUInt16 priorityCount;
+
+	wlItemStreamMergePriority(pItemStream, &priorityClass, &priorityCount);
+
+	if (!pPacer->queuedCount && !pPacer->outstandingCount)
+	{
+		/* Pacer was idle; this starts a new round of recovery. */
+		pPacer->startTime = pBase->currentTime;
+		pPacer->recoveredCount = 0;
+	}
+
+	pItemStream->refreshState = WL_ISRS_PENDING_RECOVERY;
+	pItemStream->recoveryPriorityClass = priorityClass;
+	rsslQueueAddLinkToBack(&pPacer->queues[priorityClass], &pItemStream->qlOpenWindow);
+	++pPacer->classCounts[priorityClass];
+	++pPacer->queuedCount;
+
+	pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+}
+
+/* Removes a stream from the recovery pacer, whether it is still queued or its request
+ * is outstanding. */
+static void wlItemStreamRemoveRecovery(WlBase *pBase, WlItemStream *pItemStream)
+{
+	WlRecoveryPacer *pPacer = &pBase->recoveryPacer;
+
+	if (pItemStream->refreshState == WL_ISRS_PENDING_RECOVERY)
+	{
+		rsslQueueRemoveLink(&pPacer->queues[pItemStream->recoveryPriorityClass], 
+				&pItemStream->qlOpenWindow);
+		--pPacer->queuedCount;
+	}
+	else
+	{
+		assert(pItemStream->flags & WL_IOSF_RECOVERY_SENT);
+		pItemStream->flags &= ~WL_IOSF_RECOVERY_SENT;
+		--pPacer->outstandingCount;
+	}
+
+	--pPacer->classCounts[pItemStream->recoveryPriorityClass];
+}
+
 RsslRet wlItemStreamAddRequestView(WlItemStream *pItemStream, WlItemRequest *pItemRequest, 
 		RsslErrorInfo *pErrorInfo)
 {
@@ -1294,6 +1344,9 @@ RsslRet wlItemStreamAddRequest(WlBase *pBase, WlItems *pItems, WlItemStream *pIt
 
 	if (!pItemRequest->base.pStateQueue)
 	{
+		RsslBool isRecovering = (pItemRequest->flags & WL_IRQF_RECOVERING) ? RSSL_TRUE : RSSL_FALSE;
+		pItemRequest->flags &= ~WL_IRQF_RECOVERING;
+
 		if (
 				/* Partial refresh has been received. */
 				pItemStream->refreshState == WL_ISRS_PENDING_REFRESH_COMPLETE
@@ -1323,6 +1376,8 @@ RsslRet wlItemStreamAddRequest(WlBase *pBase, WlItems *pItems, WlItemStream *pIt
 			/* No requests pending. Send request. */
 			rsslQueueAddLinkToBack(&pItemStream->requestsRecovering, &pItemRequest->base.qlStateQueue);
 			pItemRequest->base.pStateQueue = &pItemStream->requestsRecovering;
+			if (isRecovering && !(pItemStream->flags & WL_IOSF_RECOVERY_SENT))
+				pItemStream->flags |= WL_IOSF_RECOVERING;
 			wlItemStreamSetMsgPending(pBase, pItemStream, RSSL_TRUE);
 		}
 	}
@@ -1719,6 +1774,8 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 		if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingWindow,
 					&pItemStream->qlOpenWindow);
+		else if (pItemStream->refreshState == WL_ISRS_PENDING_RECOVERY)
+			wlItemStreamRemoveRecovery(pBase, pItemStream);
 		else
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingRefresh,
 					&pItemStream->qlOpenWindow);
@@ -1726,7 +1783,11 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 		pItemStream->refreshState = WL_ISRS_NONE;
 	}
 
+	if (pItemStream->flags & WL_IOSF_RECOVERY_SENT)
+		wlItemStreamRemoveRecovery(pBase, pItemStream);
+
 	wlItemStreamCheckOpenWindow(pBase, pItemStream->pWlService);
+	wlItemStreamProcessRecovery(pBase);
 
 	wlUnsetStreamPendingResponse(pBase, &pItemStream->base);
 
@@ -1744,6 +1805,13 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 	return RSSL_RET_SUCCESS;
 }
 
+/* Indicates whether a stream is waiting to request a refresh, and so should not send anything yet. */
+RTR_C_INLINE RsslBool wlItemStreamIsWaitingToRequest(WlItemStream *pItemStream)
+{
+	return (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW
+			|| pItemStream->refreshState == WL_ISRS_PENDING_RECOVERY) ? RSSL_TRUE : RSSL_FALSE;
+}
+
 void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBool requestRefresh)
 {
 	if (requestRefresh)
@@ -1753,7 +1821,13 @@ void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBoo
 			/* Check service open window before requesting. */
 			WlService *pWlService = pItemStream->pWlService;
 
-			if ( pBase->config.obeyOpenWindow && pWlService->pService->rdm.flags & RDM_SVCF_HAS_LOAD
+			if (pItemStream->flags & WL_IOSF_RECOVERING
+					&& wlRecoveryPacerIsEnabled(&pBase->recoveryPacer))
+			{
+				/* Recovering stream; wait for the recovery pacer to release it. */
+				wlItemStreamAddRecovery(pBase, pItemStream);
+			}
+			else if ( pBase->config.obeyOpenWindow && pWlService->pService->rdm.flags & RDM_SVCF_HAS_LOAD
 					&& pWlService->pService->rdm.load.flags & RDM_SVC_LDF_HAS_OPEN_WINDOW
 					&& (pWlService->streamsPendingRefresh.count 
 						>= pWlService->pService->rdm.load.openWindow))
@@ -1771,13 +1845,90 @@ void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBoo
 						&pItemStream->qlOpenWindow);
 			}
 		}
-		else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW)
+		else if (!wlItemStreamIsWaitingToRequest(pItemStream))
 			wlSetStreamMsgPending(pBase, &pItemStream->base);
 	}
-	else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW)
+	else if (!wlItemStreamIsWaitingToRequest(pItemStream))
 		wlSetStreamMsgPending(pBase, &pItemStream->base);
 }
 
+void wlItemStreamProcessRecovery(WlBase *pBase)
+{
+	WlRecoveryPacer *pPacer = &pBase->recoveryPacer;
+	int priorityClass;
+
+	if (!pPacer->queuedCount)
+		return;
+
+	if (pPacer->requestRate)
+	{
+		/* Refill the token bucket. It holds up to one second's worth of requests. */
+		RsslInt64 maxTokens = (RsslInt64)pPacer->requestRate * 1000;
+
+		if (pBase->currentTime > pPacer->lastRefillTime)
+		{
+			pPacer->tokens += (pBase->currentTime - pPacer->lastRefillTime) * pPacer->requestRate;
+			if (pPacer->tokens > maxTokens)
+				pPacer->tokens = maxTokens;
+		}
+
+		pPacer->lastRefillTime = pBase->currentTime;
+	}
+
+	/* Release streams, highest priority class first. */
+	for (priorityClass = WL_RECOVERY_PRIORITY_CLASSES - 1; 
+			priorityClass >= 0 && pPacer->queuedCount; --priorityClass)
+	{
+		RsslQueueLink *pLink;
+
+		while ((pLink = rsslQueuePeekFront(&pPacer->queues[priorityClass])))
+		{
+			WlItemStream *pItemStream;
+
+			if (pPacer->maxOutstanding && pPacer->outstandingCount >= pPacer->maxOutstanding)
+				return; /* Resumes when a recovery refresh completes. */
+
+			if (pPacer->requestRate && pPacer->tokens < 1000)
+			{
+				pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+				return;
+			}
+
+			rsslQueueRemoveFirstLink(&pPacer->queues[priorityClass]);
+			pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlOpenWindow, pLink);
+
+			if (pPacer->requestRate)
+				pPacer->tokens -= 1000;
+
+			--pPacer->queuedCount;
+			++pPacer->outstandingCount;
+
+			assert(pItemStream->refreshState == WL_ISRS_PENDING_RECOVERY);
+			pItemStream->refreshState = WL_ISRS_NONE;
+			pItemStream->flags &= ~WL_IOSF_RECOVERING;
+			pItemStream->flags |= WL_IOSF_RECOVERY_SENT;
+
+			/* Request as usual (this still obeys the service's OpenWindow). */
+			wlItemStreamSetMsgPending(pBase, pItemStream, RSSL_TRUE);
+		}
+	}
+}
+
+RsslInt64 wlItemStreamGetRecoveryTimeout(WlBase *pBase)
+{
+	WlRecoveryPacer *pPacer = &pBase->recoveryPacer;
+
+	if (!pPacer->queuedCount
+			|| (pPacer->maxOutstanding && pPacer->outstandingCount >= pPacer->maxOutstanding))
+		return WL_TIME_UNSET;
+
+	if (!pPacer->requestRate || pPacer->tokens >= 1000)
+		return pBase->currentTime;
+
+	return pPacer->lastRefillTime 
+		+ (1000 - pPacer->tokens + pPacer->requestRate - 1) / pPacer->requestRate;
+}
+
 void wlItemStreamUnsetMsgPending(WlBase *pBase, WlItemStream *pItemStream)
 {
 	assert(pItemStream->pWlService);
@@ -1837,6 +1988,14 @@ void wlItemStreamProcessRefreshComplete(WlBase *pBase, WlItemStream *pItemStream
 	pItemStream->refreshState = WL_ISRS_NONE;
 
 	wlItemStreamCheckOpenWindow(pBase, pWlService);
+
+	if (pItemStream->flags & WL_IOSF_RECOVERY_SENT)
+	{
+		wlItemStreamRemoveRecovery(pBase, pItemStream);
+		++pBase->recoveryPacer.recoveredCount;
+		pBase->recoveryPacer.lastRecoveredTime = pBase->currentTime;
+		wlItemStreamProcessRecovery(pBase);
+	}
 }
 
 static RsslRet _wlItemRequestSaveExtraInfo(WlItemRequest *pItemRequest, RsslRequestMsg *pRequestMsg,
@@ -10,6 +10,7 @@
 #include "rtr/rsslWatchlist.h"
 #include "rtr/tunnelStreamImpl.h"
 #include "rtr/msgQueueEncDec.h"
+#include "rtr/rsslLatencyTrace.h"
 
 #include <assert.h>
 #include <stdint.h>
@@ -25,6 +26,9 @@
 
 #define RSSL_REACTOR_WORKER_ERROR_INFO_MAX_POOL_SIZE 10
 #define RSSL_REACTOR_MAX_JSON_ERROR_MSG_SIZE 1101
+/* Position of the stream ID in an encoded RWF message: header size (2), msgClass (1), domainType (1). */
+#define RSSL_REACTOR_RWF_STREAMID_POS 4
+#define RSSL_REACTOR_RWF_STREAMID_END (RSSL_REACTOR_RWF_STREAMID_POS + 4)
 
 RsslBuffer PONG_MESSAGE = { 15, (char*)"{\"Type\":\"Pong\"}" };
 
@@ -569,6 +573,7 @@ FailedToInitJsonConverter:
 	rsslJsonUninitialize();
 	rsslDestroyRsslJsonConverter(pReactorImpl->pJsonConverter, &rjcError);
 	free(pReactorImpl->pDictionaryList);
+	_reactorCleanupJsonConversionCache(pReactorImpl);
 
 	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 }
@@ -577,7 +582,6 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 {
 	RsslReactorImpl *pReactorImpl;
 	RsslInt32 i;
-	char *memBuf;
 
 #ifdef WIN32
 	LARGE_INTEGER	perfFrequency;
@@ -815,16 +819,13 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		return NULL;
 	}
 
-	/* Initialize memory block for decoding RDM structures */
-	memBuf = (char*)malloc(pReactorImpl->dispatchDecodeMemoryBufferSize);
-	if (!memBuf)
+	/* Initialize memory for decoding RDM structures; it is reclaimed at the start of each dispatch. */
+	if (rsslDispatchArenaInit(&pReactorImpl->dispatchArena, (RsslUInt32)pReactorImpl->dispatchDecodeMemoryBufferSize) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor memory buffer.");
 		return NULL;
 	}
-	pReactorImpl->memoryBuffer.data = memBuf;
-	pReactorImpl->memoryBuffer.length = pReactorImpl->dispatchDecodeMemoryBufferSize;
 
 	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, pError) != RSSL_RET_SUCCESS)
 	{
@@ -834,6 +835,15 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 
 	pReactorImpl->rsslWorkerStarted = RSSL_TRUE; /* Indicates the worker thread is started */
 
+	/* Bound from here rather than by the worker itself, so that a bad CPU id fails the creation. */
+	if (pReactorOpts->workerCpuId >= 0 && RSSL_THREAD_BIND(&pReactorImpl->reactorWorker.thread, pReactorOpts->workerCpuId) < 0)
+	{
+		rsslDestroyReactor((RsslReactor*)pReactorImpl, pError);
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Failed to bind reactorWorker to CPU %d.", pReactorOpts->workerCpuId);
+		return NULL;
+	}
+
 	return (RsslReactor*)pReactorImpl;
 }
 
@@ -1575,6 +1585,8 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		watchlistCreateOpts.maxOutstandingPosts = pRole->ommConsumerRole.watchlistOptions.maxOutstandingPosts;
 		watchlistCreateOpts.postAckTimeout = pRole->ommConsumerRole.watchlistOptions.postAckTimeout;
 		watchlistCreateOpts.requestTimeout = pRole->ommConsumerRole.watchlistOptions.requestTimeout;
+		watchlistCreateOpts.recoveryRequestRate = pRole->ommConsumerRole.watchlistOptions.recoveryRequestRate;
+		watchlistCreateOpts.maxOutstandingRecoveryRefreshes = pRole->ommConsumerRole.watchlistOptions.maxOutstandingRecoveryRefreshes;
 		watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
 		watchlistCreateOpts.loginRequestCount = pReactorChannel->supportSessionMgnt ? pReactorChannel->connectionListCount : 1;
 		pWatchlist = rsslWatchlistCreate(&watchlistCreateOpts, pError);
@@ -1637,6 +1649,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	pReactorChannel->pWatchlist = pWatchlist;
 	pReactorChannel->readRet = 0;
 	pReactorChannel->connectionDebugFlags = pOpts->connectionDebugFlags;
+	pReactorChannel->writeCoalesceBudget = pOpts->writeCoalesceBudget;
 
 	/* Set reconnection info here, this should be zeroed out provider bound connections */
 	pReactorChannel->reconnectAttemptLimit = pOpts->reconnectAttemptLimit;
@@ -1858,6 +1871,7 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	pReactorChannel->reactorChannel.userSpecPtr = pOpts->rsslAcceptOptions.userSpecPtr;
 	pReactorChannel->initializationTimeout = pOpts->initializationTimeout;
 	pReactorChannel->connectionDebugFlags = pOpts->connectionDebugFlags;
+	pReactorChannel->writeCoalesceBudget = pOpts->writeCoalesceBudget;
 
 	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen(pReactor, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
 	{
@@ -1899,6 +1913,9 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_FALSE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
+	/* Nothing decoded by an earlier pass can still be referenced now that its callbacks have returned. */
+	rsslDispatchArenaReset(&pReactorImpl->dispatchArena);
+
 	/* Record current time. */
 	pReactorImpl->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
 
@@ -2161,6 +2178,108 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 	}
 }
 
+/* Checks whether an RWF message is the one the converter last converted, apart from its stream ID. */
+static RsslBool _reactorJsonConversionCacheMatches(RsslReactorJsonConversionCache *pCache, RsslChannel *pRsslChannel, RsslBuffer *pRwfBuffer)
+{
+	return pCache->isValid
+		&& pCache->rwfMsg.length == pRwfBuffer->length
+		&& pCache->majorVersion == pRsslChannel->majorVersion
+		&& pCache->minorVersion == pRsslChannel->minorVersion
+		&& memcmp(pCache->rwfMsg.data, pRwfBuffer->data, RSSL_REACTOR_RWF_STREAMID_POS) == 0
+		&& memcmp(pCache->rwfMsg.data + RSSL_REACTOR_RWF_STREAMID_END, pRwfBuffer->data + RSSL_REACTOR_RWF_STREAMID_END,
+			pRwfBuffer->length - RSSL_REACTOR_RWF_STREAMID_END) == 0;
+}
+
+RsslUInt64 _reactorGetJsonConversionCacheHits(RsslReactor *pReactor)
+{
+	return ((RsslReactorImpl*)pReactor)->jsonConversionCache.hitCount;
+}
+
+RsslRet _reactorConvertRwfToJson(RsslReactorImpl *pReactorImpl, RsslChannel *pRsslChannel, RsslBuffer *pRwfBuffer, RsslBuffer *pJsonBuffer, RsslErrorInfo *pError)
+{
+	RsslReactorJsonConversionCache *pCache = &pReactorImpl->jsonConversionCache;
+	RsslGetJsonMsgOptions getJsonMsgOptions;
+	RsslJsonConverterError rjcError;
+	RsslDecodeIterator dIter;
+	RsslMsg rsslMsg;
+	RsslRet ret;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, pRsslChannel->majorVersion, pRsslChannel->minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, pRwfBuffer);
+
+	rsslClearGetJsonMsgOptions(&getJsonMsgOptions);
+	getJsonMsgOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
+
+	if (_reactorJsonConversionCacheMatches(pCache, pRsslChannel, pRwfBuffer))
+	{
+		/* Same message on another stream; only the stream ID needs to change. */
+		getJsonMsgOptions.streamId = rsslExtractStreamId(&dIter);
+		++pCache->hitCount;
+	}
+	else
+	{
+		RsslConvertRsslMsgToJsonOptions rjcOptions;
+
+		pCache->isValid = RSSL_FALSE;
+
+		rsslClearMsg(&rsslMsg);
+		if ((ret = rsslDecodeMsg(&dIter, &rsslMsg)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
+				"rsslDecodeMsg() failed to decode the passed in buffer as RWF messages.");
+			return ret;
+		}
+
+		rsslClearConvertRsslMsgToJsonOptions(&rjcOptions);
+		rjcOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
+		if ((rsslConvertRsslMsgToJson(pReactorImpl->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to convert RWF to JSON protocol. Error text: %s", rjcError.text);
+			return RSSL_RET_FAILURE;
+		}
+
+		getJsonMsgOptions.streamId = rsslMsg.msgBase.streamId;
+		getJsonMsgOptions.isCloseMsg = (rsslMsg.msgBase.msgClass == RSSL_MC_CLOSE) ? RSSL_TRUE : RSSL_FALSE;
+
+		/* Remember the message for reuse. A converted CloseMsg already contains its stream IDs, so it is not kept.
+		 * If memory for the copy is not available, the message is simply not cached. */
+		if (!getJsonMsgOptions.isCloseMsg && pRwfBuffer->length >= RSSL_REACTOR_RWF_STREAMID_END)
+		{
+			if (pRwfBuffer->length > pCache->rwfMsgCapacity)
+			{
+				char *pData = (char*)realloc(pCache->rwfMsg.data, pRwfBuffer->length);
+
+				if (pData != NULL)
+				{
+					pCache->rwfMsg.data = pData;
+					pCache->rwfMsgCapacity = pRwfBuffer->length;
+				}
+			}
+
+			if (pRwfBuffer->length <= pCache->rwfMsgCapacity)
+			{
+				memcpy(pCache->rwfMsg.data, pRwfBuffer->data, pRwfBuffer->length);
+				pCache->rwfMsg.length = pRwfBuffer->length;
+				pCache->majorVersion = pRsslChannel->majorVersion;
+				pCache->minorVersion = pRsslChannel->minorVersion;
+				pCache->isValid = RSSL_TRUE;
+			}
+		}
+	}
+
+	if ((ret = rsslGetConverterJsonMsg(pReactorImpl->pJsonConverter, &getJsonMsgOptions,
+		pJsonBuffer, &rjcError)) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+			"Failed to get converted JSON message. Error text: %s", rjcError.text);
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer *buffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError)
 {
 	RsslRet ret;
@@ -2212,11 +2331,10 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 	
 	if ( (pReactorChannel->reactorChannel.pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE) && (pPackedBufferImpl == NULL) )
 	{
-		RsslDecodeIterator dIter;
-		RsslMsg rsslMsg;
-
 		if (pReactorChannel->pWriteCallAgainUserBuffer == NULL)
 		{
+			RsslBuffer jsonBuffer;
+
 			/* Added checking to ensure that the JSON converter is initialized properly.*/
 			if (pReactorImpl->pJsonConverter == 0)
 			{
@@ -2224,44 +2342,10 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 				return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
 			}
 
-			rsslClearMsg(&rsslMsg);
-			rsslClearDecodeIterator(&dIter);
-			rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.pRsslChannel->majorVersion,
-				pReactorChannel->reactorChannel.pRsslChannel->minorVersion);
-
-			rsslSetDecodeIteratorBuffer(&dIter, buffer);
-
-			ret = rsslDecodeMsg(&dIter, &rsslMsg);
+			ret = _reactorConvertRwfToJson(pReactorImpl, pReactorChannel->reactorChannel.pRsslChannel, buffer, &jsonBuffer, pError);
 
 			if (ret == RSSL_RET_SUCCESS)
 			{
-				RsslConvertRsslMsgToJsonOptions rjcOptions;
-				RsslGetJsonMsgOptions getJsonMsgOptions;
-				RsslJsonConverterError rjcError;
-				RsslBuffer jsonBuffer;
-
-				rsslClearConvertRsslMsgToJsonOptions(&rjcOptions);
-				rjcOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-				if ((rsslConvertRsslMsgToJson(pReactorImpl->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
-				{
-					rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
-						"Failed to convert RWF to JSON protocol. Error text: %s", rjcError.text);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
-				}
-
-				rsslClearGetJsonMsgOptions(&getJsonMsgOptions);
-				getJsonMsgOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-				getJsonMsgOptions.streamId = rsslMsg.msgBase.streamId;
-				getJsonMsgOptions.isCloseMsg = (rsslMsg.msgBase.msgClass == RSSL_MC_CLOSE) ? RSSL_TRUE : RSSL_FALSE;
-
-				if ((ret = rsslGetConverterJsonMsg(pReactorImpl->pJsonConverter, &getJsonMsgOptions,
-					&jsonBuffer, &rjcError)) != RSSL_RET_SUCCESS)
-				{
-					rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
-						"Failed to get converted JSON message. Error text: %s", rjcError.text);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
-				}
-
 				/* Copies JSON data format to the buffer that belongs to RsslChannel */
 				pMsgBuffer = rsslReactorGetBuffer(&pReactorChannel->reactorChannel, jsonBuffer.length, RSSL_FALSE, pError);
 
@@ -2288,11 +2372,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 					&pError->rsslError);
 			}
 			else
-			{
-				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
-					"rsslDecodeMsg() failed to decode the passed in buffer as RWF messages.");
 				return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
-			}
 		}
 		else
 		{
@@ -3582,6 +3662,54 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 	}
 }
 
+/* Decodes the payload of pMsg into an RDM structure of the message's domain. Memory the structure
+ * refers to comes from the reactor's dispatch arena and remains valid until the next dispatch pass;
+ * if the current block is too small, a larger one is added and the decode is retried. */
+static RsslRet _reactorDecodeRDMMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslDecodeIterator *pIter,
+		RsslMsg *pMsg, RsslRDMMsg *pRdmMsg, RsslErrorInfo *pError)
+{
+	RsslUInt32 growLength = 0;
+
+	for(;;)
+	{
+		RsslBuffer memoryBuffer;
+		char *pStart;
+		RsslRet ret;
+
+		rsslDispatchArenaGetBuffer(&pReactorImpl->dispatchArena, &memoryBuffer);
+		pStart = memoryBuffer.data;
+
+		rsslClearDecodeIterator(pIter);
+		rsslSetDecodeIteratorRWFVersion(pIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
+		rsslSetDecodeIteratorBuffer(pIter, &pMsg->msgBase.encDataBody);
+
+		switch(pMsg->msgBase.domainType)
+		{
+			case RSSL_DMT_LOGIN: ret = rsslDecodeRDMLoginMsg(pIter, pMsg, (RsslRDMLoginMsg*)pRdmMsg, &memoryBuffer, pError); break;
+			case RSSL_DMT_SOURCE: ret = rsslDecodeRDMDirectoryMsg(pIter, pMsg, (RsslRDMDirectoryMsg*)pRdmMsg, &memoryBuffer, pError); break;
+			case RSSL_DMT_DICTIONARY: ret = rsslDecodeRDMDictionaryMsg(pIter, pMsg, (RsslRDMDictionaryMsg*)pRdmMsg, &memoryBuffer, pError); break;
+			default:
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Unexpected domain type %u.", pMsg->msgBase.domainType);
+				return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL || growLength >= 0x40000000)
+		{
+			if (ret == RSSL_RET_SUCCESS)
+				rsslDispatchArenaCommit(&pReactorImpl->dispatchArena, (RsslUInt32)(memoryBuffer.data - pStart));
+			return ret;
+		}
+
+		/* Try a fresh block first, then keep doubling. */
+		growLength = growLength ? growLength * 2 : pReactorImpl->dispatchArena.blockSize;
+		if (rsslDispatchArenaGrow(&pReactorImpl->dispatchArena, growLength) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to grow reactor decode memory.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+}
+
 static RsslRet _reactorEncodeRDMAsRsslMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslRDMMsg *pRdmMsg, RsslMsg *pRsslMsg,
 		RsslErrorInfo *pErrorInfo)
 {
@@ -3589,18 +3717,34 @@ static RsslRet _reactorEncodeRDMAsRsslMsg(RsslReactorImpl *pReactorImpl, RsslRea
 	RsslDecodeIterator	decodeIter;
 	RsslRet				ret;
 	RsslBuffer			memBuffer;
+	RsslUInt32			growLength = 0;
 
 	/* Encode message to a buffer. */
-	rsslClearEncodeIterator(&encodeIter);
-	rsslSetEncodeIteratorRWFVersion(&encodeIter, pReactorChannel->reactorChannel.majorVersion,
-			pReactorChannel->reactorChannel.minorVersion);
+	for(;;)
+	{
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, pReactorChannel->reactorChannel.majorVersion,
+				pReactorChannel->reactorChannel.minorVersion);
 
-	memBuffer = pReactorImpl->memoryBuffer;
-	rsslSetEncodeIteratorBuffer(&encodeIter, &memBuffer);
+		rsslDispatchArenaGetBuffer(&pReactorImpl->dispatchArena, &memBuffer);
+		rsslSetEncodeIteratorBuffer(&encodeIter, &memBuffer);
 
-	if ((ret = rsslEncodeRDMMsg(&encodeIter, pRdmMsg, &memBuffer.length, pErrorInfo))
-			!= RSSL_RET_SUCCESS)
-		return ret;
+		if ((ret = rsslEncodeRDMMsg(&encodeIter, pRdmMsg, &memBuffer.length, pErrorInfo))
+				== RSSL_RET_SUCCESS)
+			break;
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL || growLength >= 0x40000000)
+			return ret;
+
+		growLength = growLength ? growLength * 2 : pReactorImpl->dispatchArena.blockSize;
+		if (rsslDispatchArenaGrow(&pReactorImpl->dispatchArena, growLength) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to grow reactor encode memory.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	rsslDispatchArenaCommit(&pReactorImpl->dispatchArena, memBuffer.length);
 
 	/* Decode as RsslMsg. */
 	rsslClearDecodeIterator(&decodeIter);
@@ -3626,6 +3770,8 @@ static void _reactorCallDefaultCallback(RsslReactorImpl *pReactorImpl, RsslReact
 	msgEvent.pFTGroupId = pOpts->pFTGroupId;
 	msgEvent.pSeqNum = pOpts->pSeqNum;
 
+	rsslLatencyTraceStamp(RSSL_LT_USER_CALLBACK);
+
 	_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
 	*pOpts->pCret = (*pReactorChannel->channelRole.base.defaultMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &msgEvent);
 	_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
@@ -3702,7 +3848,6 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMLoginMsg loginResponse, *pLoginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
@@ -3711,10 +3856,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 						if (!pRdmMsg)
 						{
-							rsslClearDecodeIterator(&dIter);
-							rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-							rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-							ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+							ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, &dIter, pMsg, (RsslRDMMsg*)&loginResponse, pError);
 							pLoginResponse = &loginResponse;
 						}
 						else
@@ -3875,13 +4017,9 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 					{
 						if (!pRdmMsg)
 						{
-							RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 							rsslClearRDMDirectoryMsg(&directoryResponse);
 
-							rsslClearDecodeIterator(&dIter);
-							rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-							rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-							ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &directoryResponse, &memoryBuffer, pError);
+							ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, &dIter, pMsg, (RsslRDMMsg*)&directoryResponse, pError);
 							pDirectoryResponse = &directoryResponse;
 						}
 						else
@@ -4084,16 +4222,12 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
 						rsslClearRDMDictionaryMsg(&dictionaryResponse);
 						rsslClearRDMDictionaryMsgEvent(&dictionaryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &dictionaryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, &dIter, pMsg, (RsslRDMMsg*)&dictionaryResponse, pError);
 
 						/* Avoid passing these when the watchlist is enabled; the message may be modified from what was sent by the provider. */
 						if (!pConsumerRole->watchlistOptions.enableWatchlist)
@@ -4194,17 +4328,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pNIProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
 						rsslClearRDMLoginMsg(&loginResponse);
 						rsslClearRDMLoginMsgEvent(&loginEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, &dIter, pMsg, (RsslRDMMsg*)&loginResponse, pError);
 
 						loginEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						loginEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -4315,17 +4445,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
 						rsslClearRDMLoginMsg(&loginResponse);
 						rsslClearRDMLoginMsgEvent(&loginEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, &dIter, pMsg, (RsslRDMMsg*)&loginResponse, pError);
 
 						loginEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						loginEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -4352,17 +4478,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->directoryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMDirectoryMsg directoryResponse;
 						RsslRDMDirectoryMsgEvent directoryEvent;
 
 						rsslClearRDMDirectoryMsg(&directoryResponse);
 						rsslClearRDMDirectoryMsgEvent(&directoryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &directoryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, &dIter, pMsg, (RsslRDMMsg*)&directoryResponse, pError);
 
 						directoryEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						directoryEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -4389,17 +4511,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
 
 						rsslClearRDMDictionaryMsg(&dictionaryResponse);
 						rsslClearRDMDictionaryMsgEvent(&dictionaryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &dictionaryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, &dIter, pMsg, (RsslRDMMsg*)&dictionaryResponse, pError);
 
 						dictionaryEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						dictionaryEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -4445,6 +4563,8 @@ static RsslRet _reactorWatchlistMsgCallback(RsslWatchlist *pWatchlist, RsslWatch
 	RsslReactorCallbackRet cret;
 	ReactorProcessMsgOptions processOpts;
 
+	rsslLatencyTraceStamp(RSSL_LT_WATCHLIST_FANOUT);
+
 	processOpts.pMsgBuf = NULL;
 	processOpts.pStreamInfo = (RsslStreamInfo*)pEvent->pStreamInfo;
 	processOpts.pCret = &cret;
@@ -4475,6 +4595,8 @@ static RsslRet _processRsslRwfMessage(RsslReactorImpl *pReactorImpl, RsslReactor
 	RsslDecodeIterator dIter;
 	RsslMsg msg;
 
+	rsslLatencyTraceStamp(RSSL_LT_REACTOR_EVENT);
+
 	/* Decode the message header. Call the appropriate callback function based on the domainType. */
 	rsslClearMsg(&msg);
 	rsslClearDecodeIterator(&dIter);
@@ -4541,6 +4663,7 @@ static RsslRet _processRsslRwfMessage(RsslReactorImpl *pReactorImpl, RsslReactor
 		msgEvent.pErrorInfo = pError;
 
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "rsslDecodeMsg() failed: %d", ret);
+		rsslLatencyTraceStamp(RSSL_LT_USER_CALLBACK);
 		cret = (*pReactorChannel->channelRole.base.defaultMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &msgEvent);
 	}
 
@@ -4695,6 +4818,9 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 						&rjcError, &errorParams, pMsgBuf, jsonMsg.jsonRsslMsg.rsslMsg.msgBase.streamId)) == RSSL_RET_SUCCESS )
 					{
 						RsslBuffer *pBuffer = NULL;
+
+						/* The error message is built by the same converter, replacing its last RWF to JSON conversion. */
+						_reactorInvalidateJsonConversionCache(pReactorImpl);
 						rsslJsonGetErrorMessage(pReactorImpl->pJsonConverter, &errorParams, &outputBuffer);
 
 						pBuffer = rsslReactorGetBuffer(&pReactorChannel->reactorChannel, outputBuffer.length, RSSL_FALSE, pError);
@@ -5315,6 +5441,107 @@ RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, R
 	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 }
 
+RSSL_VA_API RsslRet rsslReactorGetWatchlistRecoveryStats(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
+	RsslReactorWatchlistRecoveryStats *pStats, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannelImpl = (RsslReactorChannelImpl*)pReactorChannel;
+	RsslWatchlistRecoveryStats watchlistStats;
+
+	if (!pError)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (!pReactor)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactor not provided.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pReactorChannel)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel not provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pStats)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorWatchlistRecoveryStats not provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pReactorChannelImpl->pWatchlist)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel does not have the watchlist enabled.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	rsslWatchlistGetRecoveryStats(pReactorChannelImpl->pWatchlist, &watchlistStats);
+
+	rsslClearReactorWatchlistRecoveryStats(pStats);
+	pStats->queuedCount = watchlistStats.queuedCount;
+	pStats->outstandingCount = watchlistStats.outstandingCount;
+	pStats->recoveredCount = watchlistStats.recoveredCount;
+	pStats->topPriorityClass = watchlistStats.topPriorityClass;
+	pStats->topPriorityClassCount = watchlistStats.topPriorityClassCount;
+	pStats->startTime = watchlistStats.startTime;
+	pStats->lastRecoveredTime = watchlistStats.lastRecoveredTime;
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
+
+RSSL_VA_API RsslRet rsslReactorGetDispatchStats(RsslReactor *pReactor, RsslReactorDispatchStats *pStats, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslDispatchArena *pArena;
+
+	if (!pError)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (!pReactor)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactor not provided.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pStats)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorDispatchStats not provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	pArena = &pReactorImpl->dispatchArena;
+
+	rsslClearReactorDispatchStats(pStats);
+	pStats->lastDispatchAllocCount = pArena->lastAllocCount;
+	pStats->lastDispatchAllocBytes = pArena->lastAllocBytes;
+	pStats->maxDispatchAllocBytes = pArena->maxAllocBytes;
+	pStats->totalAllocCount = pArena->totalAllocCount;
+	pStats->blockAllocCount = pArena->blockAllocCount;
+	pStats->blockSize = pArena->blockSize;
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
+
 RsslUInt32 packedBufferHashU64Sum(void* pReactorPackedBufferImpl)
 {
 	return (RsslUInt32)((RsslUInt64)pReactorPackedBufferImpl);
@@ -5440,8 +5667,7 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 	if (pChannel->pRsslChannel && pChannel->pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE)
 	{
 		RsslRet ret;
-		RsslDecodeIterator dIter;
-		RsslMsg rsslMsg;
+		RsslBuffer jsonBuffer;
 		RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 		RsslReactorImpl *pReactorImpl = pReactorChannel->pParentReactor;
 		RsslReactorPackedBufferImpl *pPackedBufferImpl = NULL;
@@ -5485,45 +5711,12 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
 		}
 
-		rsslClearMsg(&rsslMsg);
-		rsslClearDecodeIterator(&dIter);
-		rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.pRsslChannel->majorVersion,
-			pReactorChannel->reactorChannel.pRsslChannel->minorVersion);
-
-		rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
-
-		ret = rsslDecodeMsg(&dIter, &rsslMsg);
+		ret = _reactorConvertRwfToJson(pReactorImpl, pReactorChannel->reactorChannel.pRsslChannel, pBuffer, &jsonBuffer, pError);
 
 		if (ret == RSSL_RET_SUCCESS)
 		{
-			RsslConvertRsslMsgToJsonOptions rjcOptions;
-			RsslGetJsonMsgOptions getJsonMsgOptions;
-			RsslJsonConverterError rjcError;
-			RsslBuffer jsonBuffer;
 			RsslUInt32 neededSize;
 
-			rsslClearConvertRsslMsgToJsonOptions(&rjcOptions);
-			rjcOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-			if ((rsslConvertRsslMsgToJson(pReactorImpl->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
-			{
-				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
-					"Failed to convert RWF to JSON protocol. Error text: %s", rjcError.text);
-				return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
-			}
-
-			rsslClearGetJsonMsgOptions(&getJsonMsgOptions);
-			getJsonMsgOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-			getJsonMsgOptions.streamId = rsslMsg.msgBase.streamId;
-			getJsonMsgOptions.isCloseMsg = (rsslMsg.msgBase.msgClass == RSSL_MC_CLOSE) ? RSSL_TRUE : RSSL_FALSE;
-
-			if ((ret = rsslGetConverterJsonMsg(pReactorImpl->pJsonConverter, &getJsonMsgOptions,
-				&jsonBuffer, &rjcError)) != RSSL_RET_SUCCESS)
-			{
-				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
-					"Failed to get converted JSON message. Error text: %s", rjcError.text);
-				return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
-			}
-
 			if (pPackedBufferImpl->totalSize == pPackedBufferImpl->remainingSize)
 			{
 				neededSize = jsonBuffer.length;
@@ -5550,11 +5743,7 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 			}
 		}
 		else
-		{
-			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
-				"rsslDecodeMsg() failed to decode the passed in buffer as RWF messages.");
 			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
-		}
 
 		return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
 	}
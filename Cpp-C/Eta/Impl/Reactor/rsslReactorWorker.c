@@ -48,6 +48,12 @@ static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, Rs
 
 static void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel);
 
+/* Returns the interval at which pings are sent on an active channel, in milliseconds. */
+RTR_C_INLINE RsslInt64 _reactorWorkerGetPingIntervalMs(RsslReactorChannelImpl *pReactorChannel)
+{
+	return (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor);
+}
+
 /* Shutdown the worker due to some error. Sends a request to the reactor and waits for response, then shuts down. */
 void _reactorWorkerShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErrorInfo);
 
@@ -289,8 +295,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 	if (pReactorWorker->pQueueNotifierEvent)
 		rsslDestroyNotifierEvent(pReactorWorker->pQueueNotifierEvent);
 
-	if (pReactorImpl->memoryBuffer.data)
-		free(pReactorImpl->memoryBuffer.data);
+	rsslDispatchArenaCleanup(&pReactorImpl->dispatchArena);
 
 	RSSL_MUTEX_DESTROY(&pReactorImpl->interfaceLock);
 
@@ -364,6 +369,8 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			pReactorImpl->pJsonConverter = NULL;
 		}
 
+		_reactorCleanupJsonConversionCache(pReactorImpl);
+
 		if (pReactorImpl->pDictionaryList)
 		{
 			free(pReactorImpl->pDictionaryList);
@@ -429,6 +436,18 @@ RsslRet _reactorWorkerProcessChannelUp(RsslReactorImpl *pReactorImpl, RsslReacto
 		}
 	}
 
+	/* Let the transport enforce the write coalescing budget on writes queued while a deferred flush is pending. */
+	if (pReactorChannel->writeCoalesceBudget != 0)
+	{
+		RsslInt32 writeCoalesceBudget = (RsslInt32)pReactorChannel->writeCoalesceBudget;
+
+		if (rsslIoctl(pReactorChannel->reactorChannel.pRsslChannel, RSSL_WRITE_COALESCE_BUDGET, (void*)&writeCoalesceBudget, &pReactorChannel->channelWorkerCerr.rsslError) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
+			return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
+		}
+	}
+
 	pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorChannel->eventQueue);
 
 	/* Initialization succeeded. Send channel up event. */
@@ -441,6 +460,12 @@ RsslRet _reactorWorkerProcessChannelUp(RsslReactorImpl *pReactorImpl, RsslReacto
 	_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor));
 	pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
 
+	rsslTimerWheelSchedule(&pReactorWorker->pingTimerWheel, &pReactorChannel->workerPingTimer,
+			pReactorChannel->lastPingSentMs + _reactorWorkerGetPingIntervalMs(pReactorChannel) + 1);
+	if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
+		rsslTimerWheelSchedule(&pReactorWorker->expireTimerWheel, &pReactorChannel->workerExpireTimer,
+				pReactorChannel->nextExpireTime);
+
 	/* Copy RsslChannel parameters */
 	pReactorChannel->reactorChannel.socketId = pReactorChannel->reactorChannel.pRsslChannel->socketId;
 	pReactorChannel->reactorChannel.oldSocketId = pReactorChannel->reactorChannel.pRsslChannel->oldSocketId;
@@ -537,12 +562,22 @@ static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, Rs
 
 void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel)
 { 
+	RsslReactorWorker *pReactorWorker = &pReactorChannel->pParentReactor->reactorWorker;
+
 	if (pReactorChannel->workerParentList)
 	{
 		rsslQueueRemoveLink(pReactorChannel->workerParentList, &pReactorChannel->workerLink);
 		rsslInitQueueLink(&pReactorChannel->workerLink);
 	}
 
+	/* Timers only run while the channel is active. */
+	if (pNewList != &pReactorWorker->activeChannels)
+	{
+		rsslTimerWheelCancel(&pReactorWorker->pingTimerWheel, &pReactorChannel->workerPingTimer);
+		rsslTimerWheelCancel(&pReactorWorker->expireTimerWheel, &pReactorChannel->workerExpireTimer);
+		rsslTimerWheelCancel(&pReactorWorker->flushTimerWheel, &pReactorChannel->workerFlushTimer);
+	}
+
 	pReactorChannel->workerParentList = pNewList; 
 
 	if (pNewList)
@@ -557,12 +592,19 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 
 	pReactorWorker->sleepTimeMs = 3000;
 
+	pReactorWorker->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
+	rsslTimerWheelInit(&pReactorWorker->pingTimerWheel, pReactorWorker->lastRecordedTimeMs);
+	rsslTimerWheelInit(&pReactorWorker->expireTimerWheel, pReactorWorker->lastRecordedTimeMs);
+	rsslTimerWheelInit(&pReactorWorker->flushTimerWheel, pReactorWorker->lastRecordedTimeMs);
+
 	while (1)
 	{
 		RsslRet ret;
 		RsslReactorChannelImpl *pReactorChannel;
 		RsslRestHandle *pRestHandle;
 		RsslQueueLink *pLink;
+		RsslTimerWheelTimer *pTimer;
+		RsslInt64 nextExpireTime;
 
 		ret = rsslNotifierWait(pReactorWorker->pNotifier, pReactorWorker->sleepTimeMs * 1000);
 
@@ -786,7 +828,13 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 											pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
 											if (pReactorChannel->reactorChannel.pRsslChannel != NULL && pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET)
 											{
-												if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
+												/* Let later writes coalesce with this one; the flush starts when the budget expires (rounded up to the timer resolution). */
+												if (pReactorChannel->writeCoalesceBudget != 0 && pReactorChannel->workerParentList == &pReactorWorker->activeChannels)
+												{
+													rsslTimerWheelSchedule(&pReactorWorker->flushTimerWheel, &pReactorChannel->workerFlushTimer,
+															pReactorWorker->lastRecordedTimeMs + (pReactorChannel->writeCoalesceBudget + 999) / 1000);
+												}
+												else if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
 												{
 													rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 															"Failed to register write notification for flushing channel.");
@@ -805,7 +853,13 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 							case RSSL_RCIMPL_ET_TIMER:
 								{
 									RsslReactorTimerEvent *pTimerEvent = &pEvent->timerEvent;
-									((RsslReactorChannelImpl*)pTimerEvent->pReactorChannel)->nextExpireTime = pTimerEvent->expireTime;
+									pReactorChannel = (RsslReactorChannelImpl*)pTimerEvent->pReactorChannel;
+									pReactorChannel->nextExpireTime = pTimerEvent->expireTime;
+
+									/* If the channel is not active yet, the timer is started when it becomes active. */
+									if (pReactorChannel->workerParentList == &pReactorWorker->activeChannels)
+										rsslTimerWheelSchedule(&pReactorWorker->expireTimerWheel, &pReactorChannel->workerExpireTimer,
+												pTimerEvent->expireTime);
 									break;
 								}
 
@@ -1318,10 +1372,14 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 			}
 		}
 
-		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
+		/* Send pings on active channels whose ping timers have expired. */
+		rsslTimerWheelAdvance(&pReactorWorker->pingTimerWheel, pReactorWorker->lastRecordedTimeMs);
+		while ((pTimer = rsslTimerWheelPopExpired(&pReactorWorker->pingTimerWheel)))
 		{
 			RsslBool sendPingMessage = RSSL_TRUE;
-			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+			RsslInt64 pingIntervalMs;
+			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerPingTimer, pTimer);
+			pingIntervalMs = _reactorWorkerGetPingIntervalMs(pReactorChannel);
 
 			/* Checks whether to send a ping message for the JSON protocol. */
 			if (pReactorChannel->reactorChannel.pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE)
@@ -1329,60 +1387,87 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 				sendPingMessage = pReactorChannel->sendWSPingMessage; 
 			}
 
-			if (sendPingMessage)
+			if (!sendPingMessage)
 			{
-				/* Check if the elapsed time is greater than our ping-send interval. */
-				if ((pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastPingSentMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor)
-				{
+				/* Check again later, in case this changes. */
+				rsslTimerWheelSchedule(&pReactorWorker->pingTimerWheel, &pReactorChannel->workerPingTimer,
+						pReactorWorker->lastRecordedTimeMs + pingIntervalMs + 1);
+				continue;
+			}
 
-					/* If so, send a ping. */
-					ret = rsslPing(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
-					if (ret < 0)
-					{
-						rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
-						if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-					}
-					else
+			/* Check if the elapsed time is greater than our ping-send interval (flushing may have
+			 * pushed the next ping back since this timer was started). */
+			if ((pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastPingSentMs) > pingIntervalMs)
+			{
+
+				/* If so, send a ping. */
+				ret = rsslPing(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
+				if (ret < 0)
+				{
+					rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
+					if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+						return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+					continue;
+				}
+				else
+				{
+					if ((pReactorChannel->statisticFlags & RSSL_RC_ST_PING) && pReactorChannel->pChannelStatistic)
 					{
-						if ((pReactorChannel->statisticFlags & RSSL_RC_ST_PING) && pReactorChannel->pChannelStatistic)
-						{
-							RsslReactorChannelPingEvent *pEvent = (RsslReactorChannelPingEvent*)rsslReactorEventQueueGetFromPool(&pReactorChannel->pParentReactor->reactorEventQueue);
-							rsslClearReactorChannelPingEvent(pEvent);
+						RsslReactorChannelPingEvent *pEvent = (RsslReactorChannelPingEvent*)rsslReactorEventQueueGetFromPool(&pReactorChannel->pParentReactor->reactorEventQueue);
+						rsslClearReactorChannelPingEvent(pEvent);
 
-							pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannel;
+						pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannel;
 
-							if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->pParentReactor->reactorEventQueue, (RsslReactorEventImpl*)pEvent)
-								== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-							{
-								return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-							}
+						if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->pParentReactor->reactorEventQueue, (RsslReactorEventImpl*)pEvent)
+							== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+						{
+							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 						}
-
-						pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
-						_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor));
 					}
-				}
-				else
-				{
-					/* Otherwise, figure out when to wake up again. (Ping interval - (current time - time of last ping). */
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastPingSentMs + (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor) - pReactorWorker->lastRecordedTimeMs));
+
+					pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
 				}
 			}
 
-			/* Process any channels that are waiting for a timeout. */
-			if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
+			rsslTimerWheelSchedule(&pReactorWorker->pingTimerWheel, &pReactorChannel->workerPingTimer,
+					pReactorChannel->lastPingSentMs + pingIntervalMs + 1);
+		}
+
+		/* Process any channels whose timeout has expired. */
+		rsslTimerWheelAdvance(&pReactorWorker->expireTimerWheel, pReactorWorker->lastRecordedTimeMs);
+		while ((pTimer = rsslTimerWheelPopExpired(&pReactorWorker->expireTimerWheel)))
+		{
+			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerExpireTimer, pTimer);
+
+			/* Timer expired for this channel, send event back. */
+			_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, pReactorWorker->lastRecordedTimeMs);
+		}
+
+		/* Start flushing channels whose write coalescing budget has expired. */
+		rsslTimerWheelAdvance(&pReactorWorker->flushTimerWheel, pReactorWorker->lastRecordedTimeMs);
+		while ((pTimer = rsslTimerWheelPopExpired(&pReactorWorker->flushTimerWheel)))
+		{
+			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerFlushTimer, pTimer);
+
+			if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
 			{
-				if (pReactorChannel->nextExpireTime < pReactorWorker->lastRecordedTimeMs)
-				{
-					/* Timer expired for this channel, send event back. */
-					_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, pReactorWorker->lastRecordedTimeMs);
-				}
-				else
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->nextExpireTime - pReactorWorker->lastRecordedTimeMs));
+				rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Failed to register write notification for flushing channel.");
+				return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 			}
 		}
 
+		/* Figure out when to wake up again for the next timer. */
+		nextExpireTime = rsslTimerWheelGetNextExpireTime(&pReactorWorker->pingTimerWheel);
+		if (rsslTimerWheelGetNextExpireTime(&pReactorWorker->expireTimerWheel) < nextExpireTime)
+			nextExpireTime = rsslTimerWheelGetNextExpireTime(&pReactorWorker->expireTimerWheel);
+		if (rsslTimerWheelGetNextExpireTime(&pReactorWorker->flushTimerWheel) < nextExpireTime)
+			nextExpireTime = rsslTimerWheelGetNextExpireTime(&pReactorWorker->flushTimerWheel);
+
+		if (nextExpireTime != RSSL_TW_TIME_UNSET)
+			_reactorWorkerCalculateNextTimeout(pReactorImpl, nextExpireTime > pReactorWorker->lastRecordedTimeMs ?
+					(RsslUInt32)(nextExpireTime - pReactorWorker->lastRecordedTimeMs) : 0);
+
 		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->reconnectingChannels, pLink)
 		{
 			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
@@ -25,6 +25,8 @@
 #include "rtr/rsslReactorTokenMgntImpl.h"
 #include "rtr/rsslJsonConverter.h"
 #include "rtr/rsslHashTable.h"
+#include "rtr/rsslTimerWheel.h"
+#include "rtr/rsslDispatchArena.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -146,6 +148,9 @@ typedef struct
 	RsslErrorInfo channelWorkerCerr;
 	RsslInt64 lastRequestedExpireTime;
 	RsslInt64 nextExpireTime;
+	RsslTimerWheelTimer workerPingTimer;	/* Timer for sending the next ping. */
+	RsslTimerWheelTimer workerExpireTimer;	/* Timer for nextExpireTime. */
+	RsslTimerWheelTimer workerFlushTimer;	/* Timer for a flush deferred by writeCoalesceBudget. */
 	RsslNotifierEvent *pWorkerNotifierEvent;
 
 	/* Reconnection logic */
@@ -172,6 +177,7 @@ typedef struct
 	RsslUInt8				userNameType;
 
 	RsslUInt32 connectionDebugFlags; /*!< Set of RsslDebugFlags for calling the user-set debug callbacks */
+	RsslUInt32 writeCoalesceBudget; /*!< Latency budget(in microseconds) for coalescing writes before flushing; 0 flushes as soon as possible */
 
 	/* Keeps aggregated values of connection statistics */
 	RsslReactorChannelStatistic		*pChannelStatistic;
@@ -198,6 +204,9 @@ RTR_C_INLINE void rsslClearReactorChannelImpl(RsslReactorImpl *pReactorImpl, Rss
 	pInfo->pParentReactor = pReactorImpl;
 	pInfo->nextExpireTime = RCIMPL_TIMER_UNSET;
 	pInfo->lastRequestedExpireTime = RCIMPL_TIMER_UNSET;
+	rsslClearTimerWheelTimer(&pInfo->workerPingTimer);
+	rsslClearTimerWheelTimer(&pInfo->workerExpireTimer);
+	rsslClearTimerWheelTimer(&pInfo->workerFlushTimer);
 }
 
 RTR_C_INLINE RsslRet _rsslChannelCopyConnectionList(RsslReactorChannelImpl *pReactorChannel, RsslReactorConnectOptions *pOpts, 
@@ -421,6 +430,7 @@ RTR_C_INLINE void rsslResetReactorChannel(RsslReactorImpl *pReactorImpl, RsslRea
 	pReactorChannel->connectionListIter = 0;
 	pReactorChannel->connectionOptList = NULL;
 	pReactorChannel->connectionDebugFlags = 0;
+	pReactorChannel->writeCoalesceBudget = 0;
 	pReactorChannel->reactorChannel.socketId = (RsslSocket)REACTOR_INVALID_SOCKET;
 	pReactorChannel->reactorChannel.oldSocketId = (RsslSocket)REACTOR_INVALID_SOCKET;
 
@@ -463,6 +473,19 @@ RsslRet reactorLockInterface(RsslReactorImpl *pReactorImpl, RsslBool allowedInCa
 /* Unlocks reactor */
 RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl);
 
+/* Remembers the last RWF message converted to JSON by the reactor's converter. The converter keeps
+ * the converted message body and rsslGetConverterJsonMsg writes the stream ID in front of it, so
+ * the same message submitted on several JSON channels (differing only in stream ID) is converted once. */
+typedef struct
+{
+	RsslBool	isValid;		/* The converter holds the conversion of rwfMsg. */
+	RsslUInt8	majorVersion;	/* RWF version rwfMsg was decoded with. */
+	RsslUInt8	minorVersion;
+	RsslBuffer	rwfMsg;			/* Copy of the converted message. */
+	RsslUInt32	rwfMsgCapacity;	/* Allocated size of rwfMsg.data. */
+	RsslUInt64	hitCount;		/* Messages sent without converting them again. */
+} RsslReactorJsonConversionCache;
+
 /* RsslReactorWorker
  * The reactorWorker handles when to send pings and flushing.
  * Primary responsiblities include:
@@ -487,6 +510,9 @@ typedef struct
 	RsslThreadId thread;
 	RsslReactorEventQueue workerQueue;
 	RsslUInt32 sleepTimeMs; /* Time to sleep when not flushing; should be equivalent to 1/3 of smallest ping timeout. */
+	RsslTimerWheel pingTimerWheel; /* Ping timers of active channels. */
+	RsslTimerWheel expireTimerWheel; /* Timers requested by the reactor for active channels (watchlist and tunnel stream timeouts). */
+	RsslTimerWheel flushTimerWheel; /* Flushes of active channels deferred by their write coalescing budget. */
 
 	RsslErrorInfo workerCerr;
 	RsslReactorEventQueueGroup activeEventQueueGroup;
@@ -498,6 +524,7 @@ typedef struct
 	RsslQueue errorInfoInUsedPool; /* Keeps a pool of RsslErrorInfo in used */
 	RsslMutex errorInfoPoolLock; /* The Mutual exclusive lock for the pool */
 
+
 } RsslReactorWorker;
 
 typedef enum
@@ -535,7 +562,7 @@ struct _RsslReactorImpl
 	RsslNotifier *pNotifier; /* Notifier for reactorEventQueue and channels */
 	RsslNotifierEvent *pQueueNotifierEvent; /* Notification for reactorEventQueue */
 
-	RsslBuffer memoryBuffer;
+	RsslDispatchArena dispatchArena; /* Memory for RDM structures decoded during a dispatch pass; reset when the next pass begins */
 
 	RsslInt64 lastRecordedTimeMs;
 
@@ -580,6 +607,7 @@ struct _RsslReactorImpl
 	
 	RsslBool			jsonConverterInitialized; 	/* This is used to indicate whether the RsslJsonConverter is initialized */
 	RsslJsonConverter	*pJsonConverter; 
+	RsslReactorJsonConversionCache	jsonConversionCache; /* Last RWF message converted by pJsonConverter */
 	RsslDataDictionary	**pDictionaryList; /* Creates a list of pointer to pointer with the size of 1. */
 	RsslReactorServiceNameToIdCallback	*pServiceNameToIdCallback; /* Sets a callback specified by users */
 	RsslReactorJsonConversionEventCallback	*pJsonConversionEventCallback; /* Sets a callback specified by users to receive JSON error message. */
@@ -627,6 +655,23 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg);
 /* Estimate encoded message size. */
 RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg);
 
+/* Converts an encoded RWF message to simplified JSON for a channel. pJsonBuffer is set to memory owned by the converter,
+ * valid until its next use. A message that differs from the previous one only in stream ID reuses the previous conversion. */
+RsslRet _reactorConvertRwfToJson(RsslReactorImpl *pReactorImpl, RsslChannel *pRsslChannel, RsslBuffer *pRwfBuffer, RsslBuffer *pJsonBuffer, RsslErrorInfo *pError);
+
+/* Discards the cached conversion; used when the converter's RWF-to-JSON state is changed by other calls. */
+RTR_C_INLINE void _reactorInvalidateJsonConversionCache(RsslReactorImpl *pReactorImpl)
+{
+	pReactorImpl->jsonConversionCache.isValid = RSSL_FALSE;
+}
+
+/* Releases memory held by the conversion cache. */
+RTR_C_INLINE void _reactorCleanupJsonConversionCache(RsslReactorImpl *pReactorImpl)
+{
+	free(pReactorImpl->jsonConversionCache.rwfMsg.data);
+	memset(&pReactorImpl->jsonConversionCache, 0, sizeof(RsslReactorJsonConversionCache));
+}
+
 #ifdef __cplusplus
 };
 #endif
@@ -8,6 +8,7 @@
 
 
 #include <stdio.h>
+#include <string.h>
 #include "rtr/rsslAlloc.h"
 #include "rtr/rsslErrors.h"
 #include "rtr/rsslSocketTransportImpl.h"
@@ -290,4 +291,222 @@ int ripcInitLz4Comp()
 	return(ipcSetCompFunc(RSSL_COMP_LZ4,&funcs));
 }
 
+//
+//	LZ4 streaming compression routines start here.
+//	Each message is compressed with the previous 64KB of the stream as its dictionary, so small
+//	messages that repeat the same field names and values compress well.  Both sides keep that
+//	history, so messages must be decompressed in the order they were compressed; as with zlib,
+//	this holds because compression is only done on one priority queue.
+//
+#define RIPC_LZ4_STREAM_HISTORY (64 * 1024)
+
+typedef struct {
+	char	*buffer;
+	int		length;
+	int		maxLength;
+} lz4StreamHistory;
+
+typedef struct {
+	LZ4_stream_t		*stream;
+	lz4StreamHistory	history;	/* input is copied here first, so the dictionary outlives the caller's buffer */
+} lz4StreamCompCtx;
+
+static int lz4StreamHistoryInit(lz4StreamHistory *history)
+{
+	history->length = 0;
+	history->maxLength = 2 * RIPC_LZ4_STREAM_HISTORY;
+	history->buffer = (char*)_rsslMalloc(history->maxLength);
+
+	return (history->buffer != 0);
+}
+
+/* Makes room for len more bytes, keeping only the last RIPC_LZ4_STREAM_HISTORY bytes once the
+ * buffer fills up.  Returns 1 if the history moved, 0 if it did not, and -1 on allocation failure. */
+static int lz4StreamHistoryReserve(lz4StreamHistory *history, int len)
+{
+	if (history->length + len <= history->maxLength)
+		return 0;
+
+	if (history->length > RIPC_LZ4_STREAM_HISTORY)
+	{
+		memmove(history->buffer, history->buffer + history->length - RIPC_LZ4_STREAM_HISTORY, RIPC_LZ4_STREAM_HISTORY);
+		history->length = RIPC_LZ4_STREAM_HISTORY;
+	}
+
+	if (history->length + len > history->maxLength)
+	{
+		int newMaxLength = RIPC_LZ4_STREAM_HISTORY + (len > RIPC_LZ4_STREAM_HISTORY ? len : RIPC_LZ4_STREAM_HISTORY);
+		char *newBuffer = (char*)_rsslMalloc(newMaxLength);
+
+		if (newBuffer == 0)
+			return -1;
+
+		if (history->length)
+			memcpy(newBuffer, history->buffer, history->length);
+		_rsslFree(history->buffer);
+		history->buffer = newBuffer;
+		history->maxLength = newMaxLength;
+	}
+
+	return 1;
+}
+
+static void *lz4StreamCompInit(RsslInt32 compressionLevel, int notUsed, RsslError *error)
+{
+	lz4StreamCompCtx *ctx = (lz4StreamCompCtx*)_rsslMalloc(sizeof(lz4StreamCompCtx));
+
+	if (ctx == 0)
+		return 0;
+
+	if ((ctx->stream = LZ4_createStream()) == 0)
+	{
+		_rsslFree(ctx);
+		return 0;
+	}
+
+	if (!lz4StreamHistoryInit(&ctx->history))
+	{
+		LZ4_freeStream(ctx->stream);
+		_rsslFree(ctx);
+		return 0;
+	}
+
+	return ctx;
+}
+
+static void *lz4StreamDecompInit(int notUsed, RsslError *error)
+{
+	lz4StreamHistory *history = (lz4StreamHistory*)_rsslMalloc(sizeof(lz4StreamHistory));
+
+	if (history == 0)
+		return 0;
+
+	if (!lz4StreamHistoryInit(history))
+	{
+		_rsslFree(history);
+		return 0;
+	}
+
+	return history;
+}
+
+static void lz4StreamCompEnd(void *zstream)
+{
+	lz4StreamCompCtx *ctx = (lz4StreamCompCtx*)zstream;
+	if (ctx)
+	{
+		LZ4_freeStream(ctx->stream);
+		_rsslFree(ctx->history.buffer);
+		_rsslFree(ctx);
+	}
+}
+
+static void lz4StreamDecompEnd(void *zstream)
+{
+	lz4StreamHistory *history = (lz4StreamHistory*)zstream;
+	if (history)
+	{
+		_rsslFree(history->buffer);
+		_rsslFree(history);
+	}
+}
+
+static RsslRet lz4StreamComp(void* stream, ripcCompBuffer *buf, int notUsed, RsslError *error)
+{
+	lz4StreamCompCtx *ctx = (lz4StreamCompCtx*)stream;
+	char *src;
+	RsslInt32 err;
+
+	switch (lz4StreamHistoryReserve(&ctx->history, (int)buf->avail_in))
+	{
+		case -1:
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 Could not allocate space for the LZ4 stream history.\n", __FILE__, __LINE__);
+			return -1;
+		case 1:
+			/* the history was moved, so point the stream at its new location */
+			LZ4_loadDict(ctx->stream, ctx->history.buffer, ctx->history.length);
+			break;
+		default:
+			break;
+	}
+
+	src = ctx->history.buffer + ctx->history.length;
+	memcpy(src, buf->next_in, buf->avail_in);
+
+	err = LZ4_compress_fast_continue(ctx->stream, src, buf->next_out, buf->avail_in, buf->avail_out, 1);
+
+	if(err <= 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 LZ4_compress_fast_continue failed. LZ4 error: %d\n", __FILE__, __LINE__, err);
+		return -1;
+	}
+
+	ctx->history.length += buf->avail_in;
+
+	_DEBUG_TRACE_COMPRESSION("LZ4 stream Compressed %u inbytes to %d outbytes (max = %d)\n", buf->avail_in, err, LZ4_compressBound((int)buf->avail_in))
+
+	buf->bytes_in_used = buf->avail_in;
+	buf->bytes_out_used = err;
+
+	buf->next_in = buf->next_in + buf->bytes_in_used;
+	buf->avail_in = buf->avail_in - buf->bytes_in_used;
+	buf->next_out = buf->next_out + buf->bytes_out_used;
+	buf->avail_out = buf->avail_out - buf->bytes_out_used;
+
+	return 1;
+}
+
+static RsslRet lz4StreamDecomp(void* stream, ripcCompBuffer *buf, int notUsed, RsslError *error)
+{
+	lz4StreamHistory *history = (lz4StreamHistory*)stream;
+	int dictLen = (history->length < RIPC_LZ4_STREAM_HISTORY ? history->length : RIPC_LZ4_STREAM_HISTORY);
+	RsslInt32 err;
+
+	err = LZ4_decompress_safe_usingDict(buf->next_in, buf->next_out, buf->avail_in, buf->avail_out,
+		history->buffer + history->length - dictLen, dictLen);
+
+	if(err < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 LZ4_decompress_safe_usingDict failed. LZ4 error: %d\n", __FILE__, __LINE__, err);
+		return -1;
+	}
+
+	if (lz4StreamHistoryReserve(history, err) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 Could not allocate space for the LZ4 stream history.\n", __FILE__, __LINE__);
+		return -1;
+	}
+	memcpy(history->buffer + history->length, buf->next_out, err);
+	history->length += err;
+
+	_DEBUG_TRACE_COMPRESSION("LZ4 stream Decompressed %u inbytes to %d outbytes\n", buf->avail_in, err)
+
+	buf->bytes_in_used = buf->avail_in;
+	buf->bytes_out_used = err;
+
+	buf->avail_in = 0;
+	buf->next_in = buf->next_in + buf->bytes_in_used;
+	buf->next_out = buf->next_out + err;
+	buf->avail_out = buf->avail_out - buf->bytes_out_used;
+
+	return 1;
+}
+
+int ripcInitLz4StreamComp()
+{
+	ripcCompFuncs funcs;
+	funcs.compressInit = lz4StreamCompInit;
+	funcs.decompressInit = lz4StreamDecompInit;
+	funcs.compressEnd = lz4StreamCompEnd;
+	funcs.decompressEnd = lz4StreamDecompEnd;
+	funcs.compress = lz4StreamComp;
+	funcs.decompress = lz4StreamDecomp;
+
+	return(ipcSetCompFunc(RSSL_COMP_LZ4_STREAM,&funcs));
+}
+
 #endif
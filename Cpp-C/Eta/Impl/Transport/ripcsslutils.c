@@ -312,6 +312,12 @@ RsslInt32 ripcInitializeSSL(char* libsslName, char* libcryptoName)
 		if (dlErr = RSSL_LI_CHK_DLERROR(sslFuncs.ctx_set_options, dlErr))
 			return ripcSSLInitError();
 
+		/* BIO_ctrl is only used to query kernel TLS, so a library without it just never turns kTLS on */
+		RSSL_LI_RESET_DLERROR;
+		cryptoFuncs.bio_ctrl = (long(*)(OPENSSL_BIO*, int, long, void*))RSSL_LI_DLSYM(cryptoHandle, "BIO_ctrl");
+		if (dlErr = RSSL_LI_CHK_DLERROR(cryptoFuncs.bio_ctrl, dlErr))
+			cryptoFuncs.bio_ctrl = 0;
+
 		RSSL_LI_RESET_DLERROR;
 		sslFuncs.TLS_client_method = (const OPENSSL_SSL_METHOD* (*)())RSSL_LI_DLSYM(sslHandle, "TLS_client_method");
 		if (dlErr = RSSL_LI_CHK_DLERROR(sslFuncs.TLS_client_method, dlErr))
@@ -1096,6 +1102,8 @@ ripcSSLSession *ripcSSLNewSession(RsslSocket fd, RsslSocketChannel* chnl, ripcSS
 	session->connection = 0;
 	session->blocking = chnl->blocking;
 	session->clientConnState = SSL_INITIALIZING;
+	session->kTLSRequested = (server ? server->chnl->enableKTLS : chnl->sslEnableKTLS);
+	session->kTLSSend = RSSL_FALSE;
 	
 	return session;
 }
@@ -1635,6 +1643,48 @@ RsslInt32 ripcSSLWrite( void *sslSess, char *buf, RsslInt32 len, ripcRWFlags fla
 	return totalOut;
 }
 
+RsslInt32 ripcKTLSWrite( void *sslSess, char *buf, RsslInt32 len, ripcRWFlags flags, RsslError *error)
+{
+	ripcSSLSession *sess = (ripcSSLSession*)sslSess;
+
+	return ipcWrite((void*)(intptr_t)sess->socket, buf, len, flags, error);
+}
+
+RsslInt32 ripcKTLSWriteV( void *sslSess, ripcIovType *iov, RsslInt32 iovcnt, RsslInt32 outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcSSLSession *sess = (ripcSSLSession*)sslSess;
+
+	return ipcWriteV((void*)(intptr_t)sess->socket, iov, iovcnt, outLen, flags, error);
+}
+
+/* Asks OpenSSL to install the session keys into the kernel when the handshake completes.
+ * This has to be set on the SSL object before the handshake starts. */
+static void ripcSSLRequestKTLS(ripcSSLSession *sess)
+{
+#ifdef LINUX
+	if (sess->kTLSRequested && openSSLAPI == RSSL_OPENSSL_V1_1 && cryptoFuncs.bio_ctrl != 0 &&
+		(*(sslFuncs.ssl_11_version))() >= RSSL_30_VERSION)
+		(*(sslFuncs.set_options))(sess->connection, RSSL_30_SSL_OP_ENABLE_KTLS);
+#endif
+}
+
+/* Called once the handshake completes.  If the kernel, library or negotiated cipher does not
+ * support kTLS, OpenSSL keeps encrypting and the session carries on as before. */
+static void ripcSSLCheckKTLS(ripcSSLSession *sess)
+{
+#ifdef LINUX
+	if (sess->kTLSRequested && openSSLAPI == RSSL_OPENSSL_V1_1 && cryptoFuncs.bio_ctrl != 0)
+		sess->kTLSSend = ((*(cryptoFuncs.bio_ctrl))(sess->bio, RSSL_30_BIO_CTRL_GET_KTLS_SEND, 0, NULL) > 0) ? RSSL_TRUE : RSSL_FALSE;
+#endif
+}
+
+RsslBool ripcSSLKTLSSendActive(void *session)
+{
+	ripcSSLSession *sess = (ripcSSLSession*)session;
+
+	return (sess != NULL && sess->kTLSSend) ? RSSL_TRUE : RSSL_FALSE;
+}
+
 RsslInt32 ripcCloseSSLSocket(void *session)
 {
 	ripcSSLSession *sess = (ripcSSLSession*)session;
@@ -1705,6 +1755,7 @@ RsslInt32 ripcSSLInit(void *session, ripcSessInProg *inPr, RsslError *error)
 		{
 			if ((*(sslFuncs.ssl_state))(sess->connection) == RSSL_10_SSL_ST_OK)
 			{
+				ripcSSLCheckKTLS(sess);
 				return 1;
 			}
 			else
@@ -1718,6 +1769,7 @@ RsslInt32 ripcSSLInit(void *session, ripcSessInProg *inPr, RsslError *error)
 		{
 			if ((*(sslFuncs.ssl_get_state))(sess->connection) == RSSL_TLS_ST_OK)
 			{
+				ripcSSLCheckKTLS(sess);
 				return 1;
 			}
 			else
@@ -1790,6 +1842,7 @@ RsslInt32 ripcSSLInit(void *session, ripcSessInProg *inPr, RsslError *error)
 				}
 				sess->clientConnState = SSL_ACTIVE;
 				inPr->intConnState = (sess->clientConnState << 8);  
+				ripcSSLCheckKTLS(sess);
 				return 1;
 			}
 		}
@@ -1851,6 +1904,7 @@ void *ripcSSLConnectInt(RsslSocket fd, RsslInt32 SSLProtocolVersion, RsslInt32 *
 	
 	(*(sslFuncs.set_bio))(sess->connection, sess->bio, sess->bio);
 	(*(sslFuncs.set_connect_state))(sess->connection);
+	ripcSSLRequestKTLS(sess);
 
 	(*(sslFuncs.set_ex_data))(sess->connection, 0, userSpecPtr);  // Set the rsslSocketChannel for this connection.  This contains information for certificate verification
 
@@ -2036,6 +2090,7 @@ void *ripcNewSSLSocket(void *server, RsslSocket fd, RsslInt32 *initComplete, voi
 
 	(*(sslFuncs.set_bio))(newsess->connection, newsess->bio, newsess->bio);
 	(*(sslFuncs.set_accept_state))(newsess->connection);
+	ripcSSLRequestKTLS(newsess);
 
 	*initComplete = RSSL_FALSE;
 
@@ -40,9 +40,11 @@
 #include "curl/curl.h"
 
 #include "rtr/rsslErrors.h"
+#include "rtr/rsslLatencyTraceImpl.h"
 
 #ifdef Linux
 #include <asm/ioctls.h>
+#include <linux/net_tstamp.h>
 #endif /* Linux */
 
 static rtr_atomic_val rtr_SocketInits = 0;
@@ -590,6 +592,38 @@ int ipcSockOpts(RsslSocket fd, ripcSocketOption *option)
 		}
 #endif
 
+#if defined(Linux)
+		case RIPC_SOPT_BUSY_POLL:
+		{
+#if defined(SO_BUSY_POLL)
+			int busyPoll = option->options.busy_poll_usec;
+			if (setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, (char *)&busyPoll,
+				(int)sizeof(busyPoll)) < 0)
+				ret = -1;
+#else
+			ret = -1;
+#endif
+			break;
+		}
+#endif
+
+#if defined(Linux)
+		case RIPC_SOPT_RX_TIMESTAMPING:
+		{
+#if defined(SO_TIMESTAMPING)
+			int tsFlags = (option->options.turn_on ?
+				(SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+				 SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE) : 0);
+			if (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, (char *)&tsFlags,
+				(int)sizeof(tsFlags)) < 0)
+				ret = -1;
+#else
+			ret = -1;
+#endif
+			break;
+		}
+#endif
+
 #if defined(_WIN32) && defined(SO_EXCLUSIVEADDRUSE)
 		case RIPC_SOPT_EXCLUSIVEADDRUSE:
 		{
@@ -765,6 +799,48 @@ int ipcInitTrans(void *transport, ripcSessInProg *inPr, RsslError *error)
 	return(1);
 }
 
+#if defined(Linux) && defined(SO_TIMESTAMPING)
+/* recv() that also passes the SO_TIMESTAMPING receive time of the data to the latency trace.
+ * The software time is used when present; the raw hardware time otherwise. */
+static ssize_t ipcRecvTimestamped(RsslSocket fd, char *buf, size_t len)
+{
+	struct msghdr msg;
+	struct iovec iov;
+	char control[256];
+	struct cmsghdr *cmsg;
+	ssize_t numBytes;
+
+	iov.iov_base = buf;
+	iov.iov_len = len;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	if ((numBytes = recvmsg(fd, &msg, 0)) <= 0)
+		return numBytes;
+
+	for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+	{
+		if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING)
+		{
+			/* ts[0] is software, ts[2] is raw hardware */
+			struct timespec ts[3];
+			struct timespec *pTs;
+
+			memcpy(ts, CMSG_DATA(cmsg), sizeof(ts));
+			pTs = (ts[0].tv_sec || ts[0].tv_nsec) ? &ts[0] : &ts[2];
+			if (pTs->tv_sec || pTs->tv_nsec)
+				_rsslLatencyTraceSetRecvTime((RsslUInt64)pTs->tv_sec * 1000000000ULL + (RsslUInt64)pTs->tv_nsec);
+			break;
+		}
+	}
+
+	return numBytes;
+}
+#endif
+
 int ipcRead( void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error)
 {
 #ifdef _WIN32WSA
@@ -821,6 +897,11 @@ int ipcRead( void *transport, char *buf, int max_len, ripcRWFlags flags, RsslErr
 		else
 			totalBytes += numBytes;
 #else
+#if defined(Linux) && defined(SO_TIMESTAMPING)
+		if (rtrUnlikely(rsslLatencyTraceSocketTimestamps))
+			numBytes = ipcRecvTimestamped((RsslSocket)(intptr_t)transport, (buf + totalBytes), (size_t)(max_len - totalBytes));
+		else
+#endif
 		numBytes = SOCK_RECV((RsslSocket)(intptr_t)transport, (buf + totalBytes), (size_t)(max_len - totalBytes), 0);
 
 		if (numBytes > 0)
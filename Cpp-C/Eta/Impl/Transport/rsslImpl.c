@@ -39,6 +39,7 @@
 
 /* Include other transport type headers */
 #include "rtr/rsslChanManagement.h"
+#include "rtr/rsslLatencyTraceImpl.h"
 #include "rtr/rsslSeqMcastTransportImpl.h"
 #include "rtr/rsslSocketTransportImpl.h"
 #include "rtr/rsslUniShMemTransportImpl.h"
@@ -161,6 +162,7 @@ RTR_C_ALWAYS_INLINE rsslChannelImpl *_rsslCreateChannel()
 	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
 	{
 	  (void) RSSL_MUTEX_INIT_RTSDK( &chnl->chanMutex );
+	  (void) RSSL_MUTEX_INIT_RTSDK( &chnl->queuedWriteMutex );
 	}
 	(void) RSSL_MUTEX_INIT_RTSDK( &chnl->traceMutex );
 
@@ -431,7 +433,10 @@ void _rsslCleanUp()
 
 		/* destroy the mutex */
 		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		{
 		  (void) RSSL_MUTEX_DESTROY(&chnl->chanMutex);
+		  (void) RSSL_MUTEX_DESTROY(&chnl->queuedWriteMutex);
+		}
 
 		(void) RSSL_MUTEX_DESTROY(&chnl->traceMutex);
 		/* since its on the free list, its list of buffers should be empty */
@@ -1598,6 +1603,23 @@ RsslRet rsslIoctl(RsslChannel *chnl, RsslIoctlCodes code, void *value, RsslError
 	}
 }	
 
+/* Traces an incoming ping, if pings are being traced */
+static void _rsslTraceReadPing(rsslChannelImpl *rsslChnlImpl)
+{
+	if (rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & RSSL_TRACE_PING)	/* are we tracing pings? */
+	{
+		char message[128];
+
+		snprintf(message, sizeof(message), "Incoming Ping (Channel IPC descriptor = "SOCKET_PRINT_TYPE")", rsslChnlImpl->Channel.socketId);
+		(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->traceMutex);
+		_rsslXMLDumpComment(rsslChnlImpl, message, RSSL_TRUE, RSSL_FALSE);
+
+		snprintf(message, sizeof(message), "End Message (Channel IPC descriptor = "SOCKET_PRINT_TYPE")", rsslChnlImpl->Channel.socketId);
+		_rsslXMLDumpComment(rsslChnlImpl, message, RSSL_FALSE, RSSL_TRUE);
+		(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->traceMutex);
+	}
+}
+
 /* Read from socket */
 RSSL_API RsslBuffer* rsslRead(RsslChannel *chnl, RsslRet *readRet, RsslError *error)
 {
@@ -1660,6 +1682,9 @@ RSSL_API RsslBuffer* rsslReadEx(RsslChannel *chnl, RsslReadInArgs *readInArgs, R
 
 	retBuf = (*(rsslChnlImpl->channelFuncs->channelRead))(rsslChnlImpl, readOutArgs, readRet, error);
 
+	if (rtrUnlikely(rsslLatencyTraceActive) && retBuf != NULL)
+		_rsslLatencyTraceBeginMsg();
+
 	if (rtrUnlikely(rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & (RSSL_TRACE_TO_FILE_ENABLE | RSSL_TRACE_TO_STDOUT)))
 	{
 		if ((retBuf != NULL) && (rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & RSSL_TRACE_READ))
@@ -1669,24 +1694,93 @@ RSSL_API RsslBuffer* rsslReadEx(RsslChannel *chnl, RsslReadInArgs *readInArgs, R
 		}
 		/* check if we read a ping */
 		else if ((*readRet == RSSL_RET_READ_PING) && (rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & RSSL_TRACE_READ))
-		{	
-			if (rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & RSSL_TRACE_PING)	/* are we tracing pings? */
-			{
-				char message[128];
+			_rsslTraceReadPing(rsslChnlImpl);
+		_rsslTraceClosed(rsslChnlImpl, readRet);
+	}
 
-				snprintf(message, sizeof(message), "Incoming Ping (Channel IPC descriptor = "SOCKET_PRINT_TYPE")", rsslChnlImpl->Channel.socketId);
-				(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->traceMutex);
-				_rsslXMLDumpComment(rsslChnlImpl, message, RSSL_TRUE, RSSL_FALSE);
+	return retBuf;
+}
 
-				snprintf(message, sizeof(message), "End Message (Channel IPC descriptor = "SOCKET_PRINT_TYPE")", rsslChnlImpl->Channel.socketId);
-				_rsslXMLDumpComment(rsslChnlImpl, message, RSSL_FALSE, RSSL_TRUE);
-				(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->traceMutex);
+/* Read a batch of messages from socket */
+RSSL_API RsslRet rsslReadBatch(RsslChannel *chnl, RsslReadBatchArgs *readBatchArgs, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl=0;
+	RsslRet readRet;
+	RsslUInt32 i;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadBatch() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslReadBatch", "chnl", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(readBatchArgs, "rsslReadBatch", "readBatchArgs", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(readBatchArgs->msgs, "rsslReadBatch", "readBatchArgs->msgs", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(readBatchArgs->maxMsgs == 0))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INVALID_ARGUMENT, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadBatch() Error: 0002 readBatchArgs->maxMsgs must be greater than 0.\n", __FILE__, __LINE__);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (rtrUnlikely(chnl->state != RSSL_CH_STATE_ACTIVE))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadBatch() Error: 0007 Only Channels in RSSL_CH_STATE_ACTIVE state can get read.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	readBatchArgs->msgCount = 0;
+	readBatchArgs->bytesRead = 0;
+	readBatchArgs->uncompressedBytesRead = 0;
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+
+	if (rsslChnlImpl->channelFuncs->channelReadBatch)
+		readRet = (*(rsslChnlImpl->channelFuncs->channelReadBatch))(rsslChnlImpl, readBatchArgs, error);
+	else
+	{
+		/* transport reads one message at a time */
+		RsslReadOutArgs readOutArgs = RSSL_INIT_READ_OUT_ARGS;
+		RsslBuffer *retBuf;
+
+		if ((retBuf = (*(rsslChnlImpl->channelFuncs->channelRead))(rsslChnlImpl, &readOutArgs, &readRet, error)) != NULL)
+			readBatchArgs->msgs[readBatchArgs->msgCount++] = *retBuf;
+
+		readBatchArgs->bytesRead = readOutArgs.bytesRead;
+		readBatchArgs->uncompressedBytesRead = readOutArgs.uncompressedBytesRead;
+	}
+
+	/* the batch is traced as one message */
+	if (rtrUnlikely(rsslLatencyTraceActive) && readBatchArgs->msgCount > 0)
+		_rsslLatencyTraceBeginMsg();
+
+	if (rtrUnlikely(rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & (RSSL_TRACE_TO_FILE_ENABLE | RSSL_TRACE_TO_STDOUT)))
+	{
+		if (rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & RSSL_TRACE_READ)
+		{
+			for (i = 0; i < readBatchArgs->msgCount; ++i)
+			{
+				_rsslTraceStartMsg(rsslChnlImpl, rsslChnlImpl->Channel.protocolType, &readBatchArgs->msgs[i], &readRet, traceRead, error);
+				_rsslTraceEndMsg(rsslChnlImpl, &readRet, RSSL_TRUE);
 			}
+
+			/* check if we read a ping */
+			if ((readBatchArgs->msgCount == 0) && (readRet == RSSL_RET_READ_PING))
+				_rsslTraceReadPing(rsslChnlImpl);
 		}
-		_rsslTraceClosed(rsslChnlImpl, readRet);
+		_rsslTraceClosed(rsslChnlImpl, &readRet);
 	}
 
-	return retBuf;
+	return readRet;
 }
 
 /* Write */
@@ -1898,6 +1992,146 @@ RsslRet rsslWriteEx(RsslChannel *chnl, RsslBuffer *buffer, RsslWriteInArgs *writ
 	}
 }
 
+/* Queue a buffer for the flushing thread */
+RSSL_API RsslRet rsslQueueWrite(RsslChannel *chnl, RsslBuffer *buffer, RsslWritePriorities rsslPriority, RsslUInt8 writeFlags, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl=0;
+	rsslBufferImpl *rsslBufImpl=0;
+	void *head;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslQueueWrite() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslQueueWrite", "chnl", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(buffer, "rsslQueueWrite", "buffer", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(chnl->state != RSSL_CH_STATE_ACTIVE))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslQueueWrite() Error: 0007 Only Channels in RSSL_CH_STATE_ACTIVE state can write.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+	rsslBufImpl = (rsslBufferImpl*)buffer;
+
+	if (rtrUnlikely((buffer->length == 0) && (rsslBufImpl->packingOffset == 0)))
+	{
+		/* trying to write empty buffer */
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslQueueWrite() Error: 0009 Buffer of length zero cannot be written\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* make sure the integrity checks out */
+	if (rtrUnlikely(rsslBufImpl->integrity != 69))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_BUFFER_TOO_SMALL, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslQueueWrite() Error: 0008 Data has overflowed the allocated buffer length or RSSL is not owner.\n", __FILE__, __LINE__);
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	if (rtrUnlikely(rsslBufImpl->RsslChannel != rsslChnlImpl))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslQueueWrite() Error: 0018 Channel is not owner of buffer.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rsslBufImpl->priority < 0)
+	{
+		if (rtrUnlikely((rsslPriority < RSSL_HIGH_PRIORITY) || (rsslPriority > RSSL_LOW_PRIORITY)))
+			rsslBufImpl->priority = RSSL_MEDIUM_PRIORITY;
+		else
+			rsslBufImpl->priority = rsslPriority;
+	}
+	rsslBufImpl->queuedWriteFlags = writeFlags;
+
+	/* push onto the front of the queued list; rsslFlush takes the whole list at once,
+	   so a compare and swap on the head is all that is needed here */
+	do
+	{
+		head = rsslChnlImpl->queuedWriteHead;
+		rsslBufImpl->nextQueuedWrite = head;
+	}
+	while (RTR_ATOMIC_COMPARE_AND_SWAPPTR(rsslChnlImpl->queuedWriteHead, head, rsslBufImpl) != head);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes the buffers queued by rsslQueueWrite in the order they were queued.
+   Must be called with the queued write mutex held when channel locking is on. */
+static RsslRet _rsslWriteQueuedBuffers(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	rsslBufferImpl *rsslBufImpl=0;
+	rsslBufferImpl *nextBufImpl=0;
+	rsslBufferImpl *queued=0;
+	void *head;
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslError releaseError;
+	RsslRet ret;
+
+	/* take everything queued so far */
+	do
+		head = rsslChnlImpl->queuedWriteHead;
+	while (RTR_ATOMIC_COMPARE_AND_SWAPPTR(rsslChnlImpl->queuedWriteHead, head, NULL) != head);
+
+	/* the list is newest first - reverse it and add it behind any buffers left from the last flush */
+	while (head)
+	{
+		rsslBufImpl = (rsslBufferImpl*)head;
+		head = rsslBufImpl->nextQueuedWrite;
+		rsslBufImpl->nextQueuedWrite = queued;
+		queued = rsslBufImpl;
+	}
+
+	if (rsslChnlImpl->pendingWriteHead == NULL)
+		rsslChnlImpl->pendingWriteHead = queued;
+	else if (queued)
+	{
+		rsslBufImpl = (rsslBufferImpl*)rsslChnlImpl->pendingWriteHead;
+		while (rsslBufImpl->nextQueuedWrite)
+			rsslBufImpl = (rsslBufferImpl*)rsslBufImpl->nextQueuedWrite;
+		rsslBufImpl->nextQueuedWrite = queued;
+	}
+
+	while ((rsslBufImpl = (rsslBufferImpl*)rsslChnlImpl->pendingWriteHead) != NULL)
+	{
+		/* the buffer is cleaned once it is written, so remember what follows it */
+		nextBufImpl = (rsslBufferImpl*)rsslBufImpl->nextQueuedWrite;
+
+		rsslClearWriteInArgs(&writeInArgs);
+		writeInArgs.writeInFlags = rsslBufImpl->queuedWriteFlags;
+		writeInArgs.rsslPriority = (RsslWritePriorities)rsslBufImpl->priority;
+
+		ret = rsslWriteEx(&rsslChnlImpl->Channel, &rsslBufImpl->buffer, &writeInArgs, &writeOutArgs, error);
+
+		/* still fragmenting - leave the buffer at the front so the next flush continues it */
+		if (ret == RSSL_RET_WRITE_CALL_AGAIN)
+			return ret;
+
+		rsslChnlImpl->pendingWriteHead = nextBufImpl;
+
+		if (rtrUnlikely(ret < RSSL_RET_SUCCESS && ret != RSSL_RET_WRITE_FLUSH_FAILED))
+		{
+			/* the caller gave up the buffer when it was queued, so it is released here */
+			rsslBufImpl->nextQueuedWrite = NULL;
+			rsslReleaseBuffer(&rsslBufImpl->buffer, &releaseError);
+			return ret;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 /* Flush socket */
 RSSL_API RsslRet rsslFlush(RsslChannel *chnl, RsslError *error)
 {
@@ -1923,7 +2157,30 @@ RSSL_API RsslRet rsslFlush(RsslChannel *chnl, RsslError *error)
 
 	rsslChnlImpl = (rsslChannelImpl*)chnl;
 
-	ret =  ((*(rsslChnlImpl->channelFuncs->channelFlush))(rsslChnlImpl, error));
+	if (rsslChnlImpl->queuedWriteHead || rsslChnlImpl->pendingWriteHead)
+	{
+		RsslBool morePending;
+
+		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->queuedWriteMutex);
+
+		ret = _rsslWriteQueuedBuffers(rsslChnlImpl, error);
+		morePending = (rsslChnlImpl->pendingWriteHead != NULL);
+
+		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->queuedWriteMutex);
+
+		if (rtrUnlikely(ret < RSSL_RET_SUCCESS && ret != RSSL_RET_WRITE_CALL_AGAIN))
+			return ret;
+
+		ret =  ((*(rsslChnlImpl->channelFuncs->channelFlush))(rsslChnlImpl, error));
+
+		/* a fragmented buffer is still waiting, so tell the caller to flush again */
+		if (morePending && ret == RSSL_RET_SUCCESS)
+			ret = 1;
+	}
+	else
+		ret =  ((*(rsslChnlImpl->channelFuncs->channelFlush))(rsslChnlImpl, error));
 	
 	if (rtrUnlikely(rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & (RSSL_TRACE_TO_FILE_ENABLE | RSSL_TRACE_TO_STDOUT)))
 		_rsslTraceClosed(rsslChnlImpl, &ret);
@@ -2307,6 +2564,78 @@ RSSL_API RsslBuffer* rsslGetBuffer(RsslChannel *chnl, RsslUInt32 size, RsslBool
 	return (&(rsslBufImpl->buffer));
 }
 
+RSSL_API RsslInt32 rsslGetBuffers(RsslChannel *chnl, RsslUInt32 size, RsslBuffer **buffers, RsslUInt32 count, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl=0;
+	rsslBufferImpl *rsslBufImpl = 0;
+	RsslInt32 numBuffers = 0;
+	RsslInt32 i;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffers() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslGetBuffers", "chnl", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(buffers, "rsslGetBuffers", "buffers", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(chnl->state != RSSL_CH_STATE_ACTIVE))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffers() Error: 0007 Only Channels in RSSL_CH_STATE_ACTIVE state can get buffers.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rtrUnlikely(size <= 0 || count == 0 || count > 0x7FFFFFFF))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffers() Error: 0010 Invaid buffer size or count specified.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+
+	if (rsslChnlImpl->channelFuncs->channelGetBuffers)
+		numBuffers = (*(rsslChnlImpl->channelFuncs->channelGetBuffers))(rsslChnlImpl, size, (rsslBufferImpl**)buffers, count, error);
+	else
+	{
+		while ((RsslUInt32)numBuffers < count)
+		{
+			if ((rsslBufImpl = (*(rsslChnlImpl->channelFuncs->channelGetBuffer))(rsslChnlImpl, size, RSSL_FALSE, error)) == NULL)
+				break;
+			buffers[numBuffers++] = (RsslBuffer*)rsslBufImpl;
+		}
+	}
+
+	/* common work done for all transport types, with one pass over the channel mutex */
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+	for (i = 0; i < numBuffers; i++)
+	{
+		rsslBufImpl = (rsslBufferImpl*)buffers[i];
+		rsslBufImpl->RsslChannel = rsslChnlImpl;
+		rsslBufImpl->integrity = 69;
+		rsslInitQueueLink(&(rsslBufImpl->link1));
+		rsslQueueAddLinkToBack(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+		buffers[i] = &(rsslBufImpl->buffer);
+	}
+	if (rtrUnlikely(memoryDebug)) printf("adding %d to activeBufferList\n", numBuffers);
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	/* error is already set from within the transport if the first buffer could not be obtained */
+	if (rtrUnlikely(numBuffers == 0))
+		return (error->rsslErrorId < 0) ? error->rsslErrorId : RSSL_RET_BUFFER_NO_BUFFERS;
+
+	return numBuffers;
+}
+
 RSSL_API RsslRet rsslReleaseBuffer(RsslBuffer *buffer, RsslError *error)
 {
 	rsslChannelImpl *rsslChnlImpl=0;
@@ -1344,6 +1344,8 @@ RsslRet rsslSeqMcastSetChannelFunctions()
 	funcs.channelPackBuffer = rsslSeqMcastPackBuffer;
 	funcs.channelPing = rsslSeqMcastPing;
 	funcs.channelRead = rsslSeqMcastRead;
+	funcs.channelReadBatch = NULL;
+	funcs.channelGetBuffers = NULL;
 	funcs.channelReconnect = rsslSeqMcastReconnect;
 	funcs.channelReleaseBuffer = rsslSeqMcastReleaseBuffer;
 	funcs.channelWrite = rsslSeqMcastWrite;
@@ -16,6 +16,8 @@
 #include "rtr/ripcutils.h"
 #include "rtr/rtratomic.h"
 #include "rtr/rsslQueue.h"
+#include "rtr/rsslGetTime.h"
+#include "rtr/rsslLatencyTraceImpl.h"
 #include "lz4.h"
  /* OpenSSL tunneling */
 #include "rtr/ripcsslutils.h"
@@ -45,6 +47,7 @@
 #include <setjmp.h>
 #include <ctype.h>
 #include <stdint.h>
+#include <limits.h>
 
 #include "rtr/ripchttp.h"
 #include "rtr/rsslCurlJIT.h"
@@ -106,6 +109,7 @@ static RsslRet ipcGetSocketRow(RsslSocketChannel *rsslSocketChannel, RsslError *
 
 RsslRet ripcInitZlibComp();
 RsslRet ripcInitLz4Comp();
+RsslRet ripcInitLz4StreamComp();
 
 // used to assign global sessionID's for each session. Will need to optimize to reuse session ID
 static RsslUInt32					g_sessionID = 0;
@@ -144,6 +148,7 @@ static ripcCompFuncs	compressFuncs[RSSL_COMP_MAX_TYPE + 1];
 
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_ZLIB = 30;
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_LZ4 = 300;
+static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM = 30;	/* the stream history lets small messages compress, as with zlib */
 
 static RsslInitializeExOpts  transOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
 
@@ -160,7 +165,9 @@ static rtr_atomic_val		gblmutexinit = 0;
 
 static u8 ripccompressions[][3]	=	{	{ 0, 0x00, RSSL_COMP_NONE  },	/* no compression	*/
 										{ 0, 0x01, RSSL_COMP_ZLIB  },	/* zlib compression	*/
-										{ 0, 0x02, RSSL_COMP_LZ4 } };	/* LZ4 compression	*/
+										{ 0, 0x02, RSSL_COMP_LZ4 },		/* LZ4 compression	*/
+										{ 0, 0x00, RSSL_COMP_NONE  },	/* unused			*/
+										{ 0, 0x04, RSSL_COMP_LZ4_STREAM } };	/* LZ4 stream compression */
 
 /* winInet tunneling */
 #include "rtr/ripcinetutils.h"
@@ -1096,7 +1103,7 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 
 		/* header has been set up, need to determine if we have to decompress or not */
 		/* if this was a compression type that was not good at decompression, we may need to copy off content and decompress when next part comes */
-		if ((rsslSocketChannel->inDecompress == RSSL_COMP_LZ4) && ((rsslSocketChannel->tempDecompressBuf->length) || (ipcOpcode & IPC_COMP_FRAG)))
+		if (RSSL_COMP_IS_LZ4(rsslSocketChannel->inDecompress) && ((rsslSocketChannel->tempDecompressBuf->length) || (ipcOpcode & IPC_COMP_FRAG)))
 		{
 			/* need to come in here if this is LZ and its the first part of compression, or need to know its the second part */
 			if (ipcOpcode & IPC_COMP_FRAG)
@@ -1135,6 +1142,9 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 
 				/* reset temp buffer length for next use */
 				rsslSocketChannel->tempDecompressBuf->length = 0;
+
+				if (rtrUnlikely(rsslLatencyTraceActive))
+					_rsslLatencyTraceSetDecompressTime();
 			}
 		}
 		else
@@ -1156,6 +1166,9 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 			/*the number of bytes decompressed and the number of header bytes associated with the message*/
 			if (uncompBytesRead != NULL)
 				*uncompBytesRead += (compBuf.bytes_out_used + cHdrLen + rsslSocketChannel->inBufProtOffset);
+
+			if (rtrUnlikely(rsslLatencyTraceActive))
+				_rsslLatencyTraceSetDecompressTime();
 		}
 
 		/* We should always be able to decompress all the data into a single
@@ -2172,7 +2185,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					}
 
 					/* if doing a compression that does not grow across buffers, and it is over the threshold that will grow, use the intermediate buffer to compress into */
-					if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
+					if (RSSL_COMP_IS_LZ4(rsslSocketChannel->outCompression) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
 					{
 						compBuf.next_out = rsslSocketChannel->tempCompressBuf->buffer;
 						compBuf.avail_out = (unsigned long)rsslSocketChannel->tempCompressBuf->maxLength;
@@ -2203,7 +2216,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 
 
 					/* if we have to split content, now do it */
-					if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
+					if (RSSL_COMP_IS_LZ4(rsslSocketChannel->outCompression) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
 					{
 						/* save length of content in the buffer */
 						rsslSocketChannel->tempCompressBuf->length = compLen1;
@@ -2489,7 +2502,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 						headerLength = IPC_header_size;
 
 
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4) /* we should not be here with LZ4 unless it was over the comp threshold && (tempLen >= sess->upperCompressionThreshold) */
+						if (RSSL_COMP_IS_LZ4(rsslSocketChannel->outCompression)) /* we should not be here with LZ4 unless it was over the comp threshold && (tempLen >= sess->upperCompressionThreshold) */
 						{
 							/* compression was already done above, just need to continue copy */
 							/* compLen2 should be whatever is left that we didnt copy into the buffer */
@@ -2889,10 +2902,23 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 
 	if (retval != RSSL_RET_FAILURE)
 	{
+		RsslBool budgetExpired = RSSL_FALSE;
+
 		for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
 			retval += rsslSocketChannel->priorityQueues[i].queueLength;
 
-		if ((forceFlush == RSSL_WRITE_DIRECT_SOCKET_WRITE) || (retval >(RsslInt32)rsslSocketChannel->high_water_mark))
+		/* With a coalescing budget, queued data is also flushed once the oldest unflushed write has waited longer than the budget. */
+		if (rsslSocketChannel->writeCoalesceBudget && retval > 0)
+		{
+			RsslUInt64 nowUsec = rsslGetTimeMicro();
+
+			if (rsslSocketChannel->writeCoalesceStartUsec == 0)
+				rsslSocketChannel->writeCoalesceStartUsec = nowUsec;
+			else if (nowUsec - rsslSocketChannel->writeCoalesceStartUsec >= rsslSocketChannel->writeCoalesceBudget)
+				budgetExpired = RSSL_TRUE;
+		}
+
+		if ((forceFlush == RSSL_WRITE_DIRECT_SOCKET_WRITE) || (retval >(RsslInt32)rsslSocketChannel->high_water_mark) || budgetExpired)
 		{
 			retval = ipcFlushSession(rsslSocketChannel, error);
 		}
@@ -2903,6 +2929,38 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 	return(retval);
 }
 
+/* Returns the write coalescing histogram bucket for a sample, which is the number of significant bits in it. */
+static RsslUInt32 ipcWriteCoalesceBucket(RsslUInt64 value)
+{
+	RsslUInt32 bucket = 0;
+
+	while (value && bucket < RSSL_WRITE_COALESCE_HIST_SIZE - 1)
+	{
+		value >>= 1;
+		bucket++;
+	}
+
+	return bucket;
+}
+
+/* Records the size and queueing delay of the batch that is about to be flushed. */
+static void ipcRecordWriteCoalesceFlush(RsslSocketChannel *rsslSocketChannel)
+{
+	RsslWriteCoalesceStats *stats = &rsslSocketChannel->writeCoalesceStats;
+	RsslUInt64 queuedBytes = 0;
+	RsslInt32 i;
+
+	for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
+		queuedBytes += rsslSocketChannel->priorityQueues[i].queueLength;
+
+	stats->flushCount++;
+	stats->batchBytes[ipcWriteCoalesceBucket(queuedBytes)]++;
+	stats->queueDelayUsec[ipcWriteCoalesceBucket(rsslGetTimeMicro() - rsslSocketChannel->writeCoalesceStartUsec)]++;
+
+	/* Anything left after this flush starts a new batch with the next write. */
+	rsslSocketChannel->writeCoalesceStartUsec = 0;
+}
+
 RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 {
 	rtr_msgb_t			*curmsgb = 0;
@@ -2930,6 +2988,9 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 		return RSSL_RET_FAILURE;
 	}
 
+	if (rsslSocketChannel->writeCoalesceStartUsec)
+		ipcRecordWriteCoalesceFlush(rsslSocketChannel);
+
 	rwflags |= (rsslSocketChannel->blocking ? RIPC_RW_BLOCKING : 0);
 
 	/* keep track of this so we know if we went though the entire out list */
@@ -3645,6 +3706,20 @@ ripcSessInit ipcIntSessInit(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 	return(ret);
 }
 
+/* Once the kernel owns the TLS send path of an OpenSSL channel, write straight to the socket.  This also lets
+ * flushes use vectored writes, which SSL_write cannot do.  Reads stay on OpenSSL. */
+static void ipcSelectKTLSTransFuncs(RsslSocketChannel *rsslSocketChannel)
+{
+	if (rsslSocketChannel->connType != RSSL_CONN_TYPE_ENCRYPTED || rsslSocketChannel->usingWinInet || rsslSocketChannel->httpHeaders ||
+		!ripcSSLKTLSSendActive(rsslSocketChannel->transportInfo))
+		return;
+
+	rsslSocketChannel->kTLSTransportFuncs = *rsslSocketChannel->transportFuncs;
+	rsslSocketChannel->kTLSTransportFuncs.writeTransport = ripcKTLSWrite;
+	rsslSocketChannel->kTLSTransportFuncs.writeVTransport = ripcKTLSWriteV;
+	rsslSocketChannel->transportFuncs = &rsslSocketChannel->kTLSTransportFuncs;
+}
+
 static ripcSessInit ipcInitTransport(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *inProg, RsslError *error)
 {
 	RsslInt32 cc;
@@ -3662,6 +3737,7 @@ static ripcSessInit ipcInitTransport(RsslSocketChannel *rsslSocketChannel, ripcS
 	}
 	else if (cc > 0)
 	{
+		ipcSelectKTLSTransFuncs(rsslSocketChannel);
 		rsslSocketChannel->intState = RIPC_INT_ST_READ_HDR;
 	}
 
@@ -3701,6 +3777,7 @@ static ripcSessInit ipcInitClientTransport(RsslSocketChannel *rsslSocketChannel,
 	}
 	else if (cc > 0)
 	{
+		ipcSelectKTLSTransFuncs(rsslSocketChannel);
 		if (rsslSocketChannel->sslEncryptedProtocolType != RSSL_CONN_TYPE_WEBSOCKET)
 		{
 			rsslSocketChannel->intState = RIPC_INT_ST_CONNECTING;
@@ -4258,7 +4335,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						* so we wont compress buffers that are so full that they might compress past the end of the buffer
 						* so we need to calculate the largest buffer that we will compress
 						*/
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4)
+						if (RSSL_COMP_IS_LZ4(rsslSocketChannel->outCompression))
 						{
 							RsslInt32 i = rsslSocketChannel->maxUserMsgSize;
 
@@ -4407,7 +4484,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						* so we wont compress buffers that are so full that they might compress past the end of the buffer
 						* so we need to calculate the largest buffer that we will compress
 						*/
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4)
+						if (RSSL_COMP_IS_LZ4(rsslSocketChannel->outCompression))
 						{
 							RsslInt32 i = rsslSocketChannel->maxUserMsgSize;
 							while (LZ4_compressBound(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
@@ -5683,6 +5760,9 @@ static ripcSessInit ipcFinishSess(RsslSocketChannel *rsslSocketChannel, ripcSess
 			case RSSL_COMP_LZ4:
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 				break;
+			case RSSL_COMP_LZ4_STREAM:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM;
+				break;
 			default:
 				break;
 			}
@@ -5967,6 +6047,9 @@ static ripcSessInit ipcWaitClientKey(RsslSocketChannel *rsslSocketChannel, ripcS
 		case RSSL_COMP_LZ4:
 			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 			break;
+		case RSSL_COMP_LZ4_STREAM:
+			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM;
+			break;
 		default:
 			break;
 		}
@@ -6029,6 +6112,37 @@ RsslInt32 ipcSessSetMode(RsslSocket sock_fd, RsslInt32 blocking, RsslInt32 tcp_n
 	return(0);
 }
 
+/* Best effort: raising SO_BUSY_POLL usually needs CAP_NET_ADMIN, and the channel works the same without it. */
+static void ipcSetBusyPoll(RsslSocket sock_fd, RsslUInt32 busyPollUsec)
+{
+	ripcSocketOption	opts;
+
+	if (busyPollUsec == 0)
+		return;
+
+	opts.code = RIPC_SOPT_BUSY_POLL;
+	opts.options.busy_poll_usec = (busyPollUsec > INT_MAX ? INT_MAX : (int)busyPollUsec);
+	if (ipcSockOpts(sock_fd, &opts) < 0)
+	{
+		_DEBUG_TRACE_CONN("could not set SO_BUSY_POLL(%u) on fd "SOCKET_PRINT_TYPE", errno %d\n", busyPollUsec, sock_fd, errno)
+	}
+}
+
+static void ipcSetRxTimestamping(RsslSocket sock_fd)
+{
+	ripcSocketOption	opts;
+
+	if (!rsslLatencyTraceSocketTimestamps)
+		return;
+
+	opts.code = RIPC_SOPT_RX_TIMESTAMPING;
+	opts.options.turn_on = 1;
+	if (ipcSockOpts(sock_fd, &opts) < 0)
+	{
+		_DEBUG_TRACE_CONN("could not set SO_TIMESTAMPING on fd "SOCKET_PRINT_TYPE", errno %d\n", sock_fd, errno)
+	}
+}
+
 static ripcSessInit ipcProxyConnecting(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *inPr, RsslError *error)
 {
 	ripcRWFlags		rwflags = RIPC_RW_WAITALL;
@@ -7081,7 +7195,7 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			* We want to know where the threshold for this is, and when it can grow we want to compress
 			* into a larger buffer and then split it across two buffers.
 			*/
-			if (comp == RSSL_COMP_LZ4)
+			if (RSSL_COMP_IS_LZ4(comp))
 			{
 				RsslInt32 i = maxMsgSize;
 
@@ -7302,6 +7416,9 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			case RSSL_COMP_LZ4:
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 				break;
+			case RSSL_COMP_LZ4_STREAM:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM;
+				break;
 			default:
 				break;
 			}
@@ -7459,6 +7576,8 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 	else
 		rsslServerSocketChannel->tcp_nodelay = 0;
 
+	rsslServerSocketChannel->busyPollUsec = opts->tcpOpts.busyPollUsec;
+
 	if (opts->maxOutputBuffers < opts->guaranteedOutputBuffers)
 		rsslServerSocketChannel->maxNumMsgs = opts->guaranteedOutputBuffers;
 	else
@@ -7590,6 +7709,7 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 			}
 		}
 
+		rsslServerSocketChannel->enableKTLS = opts->encryptionOpts.enableKTLS;
 	}
 
 	tempLen = (RsslInt32)(strlen(opts->serviceName) + 1);
@@ -7938,10 +8058,13 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	else
 		rsslSocketChannel->tcp_nodelay = 0;
 
+	rsslSocketChannel->busyPollUsec = opts->tcpOpts.busyPollUsec;
+
 	rsslSocketChannel->numInputBufs = opts->numInputBuffers;
 
 	rsslSocketChannel->encryptionProtocolFlags = opts->encryptionOpts.encryptionProtocolFlags;
 	rsslSocketChannel->sslEncryptedProtocolType = opts->encryptionOpts.encryptedProtocol;
+	rsslSocketChannel->sslEnableKTLS = opts->encryptionOpts.enableKTLS;
 
 	//additional initializing
 	rsslSocketChannel->clientHostname = 0;
@@ -8351,6 +8474,8 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	}
 
 	rsslSocketChannel->stream = sock_fd;
+	ipcSetBusyPoll(sock_fd, rsslSocketChannel->busyPollUsec);
+	ipcSetRxTimestamping(sock_fd);
 	
 	rsslSocketChannel->state = RSSL_CH_STATE_INITIALIZING;
 
@@ -8623,6 +8748,7 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 
 	rsslSocketChannel->blocking = (rsslServerSocketChannel->session_blocking ? 1 : 0);
 	rsslSocketChannel->tcp_nodelay = (rsslServerSocketChannel->tcp_nodelay ? 1 : 0);
+	rsslSocketChannel->busyPollUsec = rsslServerSocketChannel->busyPollUsec;
 	rsslSocketChannel->maxMsgSize = rsslServerSocketChannel->maxMsgSize;
 	rsslSocketChannel->maxUserMsgSize = rsslServerSocketChannel->maxUserMsgSize;
 	rsslSocketChannel->srvrcomp = rsslServerSocketChannel->compressionSupported;
@@ -8693,6 +8819,8 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 	rsslSocketChannel->mountNak = rsslServerSocketChannel->mountNak;
 
 	rsslSocketChannel->stream = fdtemp;
+	ipcSetBusyPoll(fdtemp, rsslSocketChannel->busyPollUsec);
+	ipcSetRxTimestamping(fdtemp);
 
 	rsslSocketChannel->bytesOutLastMsg = 0;
 
@@ -9552,6 +9680,61 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 	return NULL;
 }
 
+/* Checks whether another read leaves the messages already returned by rsslSocketReadBatch() in place. */
+static RsslBool rsslSocketReadBatchCanContinue(rsslChannelImpl* rsslChnlImpl, RsslSocketChannel *rsslSocketChannel, RsslBuffer *pLastMsg)
+{
+	rtr_msgb_t *decompressBuf = rsslSocketChannel->decompressBuf;
+
+	/* the rest of a packed buffer is unpacked in place */
+	if (rsslChnlImpl->packedBuffer)
+		return RSSL_TRUE;
+
+	/* a reassembled message is released by the next read */
+	if (rsslChnlImpl->returnBufferOwner == 1)
+		return RSSL_FALSE;
+
+	/* an empty input buffer is refilled from the start */
+	if (rsslSocketChannel->inputBuffer->length == 0)
+		return RSSL_FALSE;
+
+	/* the decompression buffer is reused by the next compressed message */
+	if (decompressBuf && (pLastMsg->data >= decompressBuf->buffer) && (pLastMsg->data < decompressBuf->buffer + decompressBuf->maxLength))
+		return RSSL_FALSE;
+
+	return RSSL_TRUE;
+}
+
+/* rssl Socket Read Batch */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketReadBatch(rsslChannelImpl* rsslChnlImpl, RsslReadBatchArgs *readBatchArgs, RsslError *error)
+{
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+	RsslReadOutArgs readOutArgs;
+	RsslBuffer *pMsg;
+	RsslRet readRet = RSSL_RET_SUCCESS;
+
+	/* Messages returned by ipcReadSession point into the input buffer, which is only refilled from the
+	 * start once all of it is consumed. Keep reading until the next read would overwrite a message
+	 * already returned, so one network read can deliver all of the complete messages it received. */
+	do
+	{
+		if ((readBatchArgs->msgCount > 0) &&
+			!rsslSocketReadBatchCanContinue(rsslChnlImpl, rsslSocketChannel, &readBatchArgs->msgs[readBatchArgs->msgCount - 1]))
+			break;
+
+		rsslClearReadOutArgs(&readOutArgs);
+		pMsg = rsslSocketRead(rsslChnlImpl, &readOutArgs, &readRet, error);
+
+		readBatchArgs->bytesRead += readOutArgs.bytesRead;
+		readBatchArgs->uncompressedBytesRead += readOutArgs.uncompressedBytesRead;
+
+		if (pMsg)
+			readBatchArgs->msgs[readBatchArgs->msgCount++] = *pMsg;
+
+	} while ((readRet > RSSL_RET_SUCCESS) && (readBatchArgs->msgCount < readBatchArgs->maxMsgs));
+
+	return readRet;
+}
+
 /* rssl Socket Write */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs,
 	RsslWriteOutArgs *writeOutArgs, RsslError *error)
@@ -9974,6 +10157,80 @@ RSSL_RSSL_SOCKET_IMPL_FAST(rsslBufferImpl*) rsslSocketGetBuffer(rsslChannelImpl
 	return rsslBufImpl;
 }
 
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslInt32) rsslSocketGetBuffers(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, rsslBufferImpl **buffers, RsslUInt32 count, RsslError *error)
+{
+	RsslSocketChannel*	rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+	rtr_msgb_t *ipcBuf = 0;
+	rsslBufferImpl *rsslBufImpl = 0;
+	RsslQueueLink *pLink = 0;
+	RsslInt32 headerLength;
+	RsslUInt32 numBuffers = 0;
+
+	/* fragmented buffers are obtained one at a time */
+	if (size > rsslChnlImpl->maxMsgSize)
+	{
+		while (numBuffers < count)
+		{
+			if ((buffers[numBuffers] = rsslSocketGetBuffer(rsslChnlImpl, size, RSSL_FALSE, error)) == NULL)
+				break;
+			++numBuffers;
+		}
+		return (RsslInt32)numBuffers;
+	}
+
+	headerLength = rsslSocketChannel->version->dataHeaderLen + rsslSocketChannel->version->footerLen;
+
+	/* With channel locking the ripc mutex is the channel mutex, so one acquisition
+	   covers both the output pool and the channel's free buffer list */
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+
+	while (numBuffers < count)
+	{
+		ipcBuf = (*(rsslSocketChannel->protocolFuncs->getPoolBuffer))(&(rsslSocketChannel->guarBufPool->bufpool), size + headerLength);
+		if ((ipcBuf == 0) && (numBuffers == 0))
+		{
+			if (ipcFlushSession(rsslSocketChannel, error) >= 0)
+				ipcBuf = (*(rsslSocketChannel->protocolFuncs->getPoolBuffer))(&(rsslSocketChannel->guarBufPool->bufpool), size + headerLength);
+		}
+
+		if (ipcBuf == 0)
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1009 rsslSocketGetBuffers() failed, out of output buffers. The output buffer may need to be flushed.\n",
+				__FILE__, __LINE__);
+			break;
+		}
+
+		ipcBuf->buffer += rsslSocketChannel->version->dataHeaderLen;
+		ipcBuf->maxLength -= headerLength;
+
+		if ((pLink = rsslQueueRemoveFirstLink(&(rsslChnlImpl->freeBufferList))) != 0)
+			rsslBufImpl = RSSL_QUEUE_LINK_TO_OBJECT(rsslBufferImpl, link1, pLink);
+		else if ((rsslBufImpl = _rsslCreateBuffer(rsslChnlImpl)) == NULL)
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 0016 rsslSocketGetBuffers() Cannot allocate memory of size %d for buffer.\n", __FILE__, __LINE__, size);
+			/* put the pool buffer back the way ipcDataBuffer would have handed it out */
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			ipcReleaseDataBuffer(rsslSocketChannel, ipcBuf, error);
+			return (RsslInt32)numBuffers;
+		}
+
+		_rsslBufferMap(rsslBufImpl, ipcBuf);
+		rsslBufImpl->packingOffset = 0;
+		rsslBufImpl->buffer.length = size;
+		rsslBufImpl->totalLength = size;
+
+		buffers[numBuffers++] = rsslBufImpl;
+	}
+
+	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+	return (RsslInt32)numBuffers;
+}
+
 /* rssl Socket ReleaseBuffer */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error)
 {
@@ -10262,6 +10519,8 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketGetChannelStats(rsslChannelImpl *r
 		return RSSL_RET_FAILURE;
 	}
 
+	stats->writeCoalesceStats = rsslSocketChannel->writeCoalesceStats;
+
 #ifdef Linux
 	len = sizeof(struct tcp_info);
 	if (getsockopt(rsslSocketChannel->stream, IPPROTO_TCP, TCP_INFO, (char*)&value, &len) != 0)
@@ -10581,6 +10840,25 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 		}
 		break;
 
+	case RSSL_WRITE_COALESCE_BUDGET:
+		if(iValue >= 0)
+		{
+			rsslSocketChannel->writeCoalesceBudget = iValue;
+			if (iValue == 0)
+				rsslSocketChannel->writeCoalesceStartUsec = 0;
+		}
+		else
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, could not set the write coalescing budget to <%d>, must not be a negative number.\n",
+					__FILE__, __LINE__, iValue);
+
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+		break;
+
 	case RSSL_SYSTEM_READ_BUFFERS:
 		opts.code = RIPC_SOPT_RD_BUF_SIZE;
 		opts.options.buffer_size = iValue;
@@ -10646,8 +10924,18 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 	    if (rsslSocketChannel->outCompression == RSSL_COMP_NONE)
 		  break;
 
-		lowerThreshold = (rsslSocketChannel->outCompression == RSSL_COMP_ZLIB ?
-									RSSL_COMP_DFLT_THRESHOLD_ZLIB : RSSL_COMP_DFLT_THRESHOLD_LZ4);
+		switch (rsslSocketChannel->outCompression)
+		{
+		case RSSL_COMP_ZLIB:
+			lowerThreshold = RSSL_COMP_DFLT_THRESHOLD_ZLIB;
+			break;
+		case RSSL_COMP_LZ4_STREAM:
+			lowerThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM;
+			break;
+		default:
+			lowerThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
+			break;
+		}
 		if(iValue >= lowerThreshold)
 			rsslSocketChannel->lowerCompressionThreshold = iValue;
 		else
@@ -10992,6 +11280,7 @@ RsslInt32 ipcInitialize(RsslInt32 numServers, RsslInt32 numClients, RsslInitiali
 
 		ripcInitZlibComp();
 		ripcInitLz4Comp();
+		ripcInitLz4StreamComp();
 
 		/* initialize open SSL library */
 		/* Copy the ssl and crypto lib name config */
@@ -11357,11 +11646,13 @@ RsslRet rsslSocketSetChannelFunctions()
 	funcs.channelConnect = rsslSocketConnect;
 	funcs.channelFlush = rsslSocketFlush;
 	funcs.channelGetBuffer = rsslSocketGetBuffer;
+	funcs.channelGetBuffers = rsslSocketGetBuffers;
 	funcs.channelGetInfo = rsslSocketGetChannelInfo;
 	funcs.channelIoctl = rsslSocketIoctl;
 	funcs.channelPackBuffer = rsslSocketPackBuffer;
 	funcs.channelPing = rsslSocketPing;
 	funcs.channelRead = rsslSocketRead;
+	funcs.channelReadBatch = rsslSocketReadBatch;
 	funcs.channelReconnect = rsslSocketReconnect;
 	funcs.channelReleaseBuffer = rsslSocketReleaseBuffer;
 	funcs.channelWrite = rsslSocketWrite;
@@ -11381,11 +11672,13 @@ RsslRet rsslWebSocketSetChannelFunctions()
 	funcs.channelConnect = rsslSocketConnect;
 	funcs.channelFlush = rsslSocketFlush;
 	funcs.channelGetBuffer = rsslWebSocketGetBuffer;
+	funcs.channelGetBuffers = NULL;
 	funcs.channelGetInfo = rsslSocketGetChannelInfo;
 	funcs.channelIoctl = rsslSocketIoctl;
 	funcs.channelPackBuffer = rsslWebSocketPackBuffer;
 	funcs.channelPing = rsslWebSocketPing;
 	funcs.channelRead = rsslWebSocketRead;
+	funcs.channelReadBatch = NULL;
 	funcs.channelReconnect = rsslSocketReconnect;
 	funcs.channelReleaseBuffer = rsslSocketReleaseBuffer;
 	funcs.channelWrite = rsslWebSocketWrite;
@@ -981,6 +981,8 @@ RsslRet rsslUniShMemSetChannelFunctions()
 	funcs.channelPackBuffer = rsslUniShMemPackBuffer;
 	funcs.channelPing = rsslUniShMemPing;
 	funcs.channelRead = rsslUniShMemRead;
+	funcs.channelReadBatch = NULL;
+	funcs.channelGetBuffers = NULL;
 	funcs.channelReconnect = rsslUniShMemReconnect;
 	funcs.channelReleaseBuffer = rsslUniShMemReleaseBuffer;
 	funcs.channelWrite = rsslUniShMemWrite;
@@ -62,6 +62,10 @@
 
 #define RSSL_11_SSL_OP_ALL 0x80000854U // Combination of flags from SSL_OP_ALL in 1.1.0	
 
+#define RSSL_30_VERSION 0x30000000L // OPENSSL_VERSION_NUMBER of 3.0.0; kernel TLS is only driven by OpenSSL 3 and later
+#define RSSL_30_SSL_OP_ENABLE_KTLS 0x00000008L // SSL_OP_ENABLE_KTLS in 3.0
+#define RSSL_30_BIO_CTRL_GET_KTLS_SEND 73 // BIO_CTRL_GET_KTLS_SEND in 3.0
+
 #define RSSL_NID_subject_alt_name 85 //NID_subject_alt_name
 #define RSSL_NID_commonName 13 // NID_commonName
 
@@ -347,6 +351,7 @@ typedef struct
 	void*(*sk_value)(const OPENSSL_STACK*, int); /* sk_value */
 	void*(*sk_free)(OPENSSL_STACK*);			/* sk_free for 1.0.X */
 	OPENSSL_EC_KEY* (*EC_KEY_new_by_curve_name)(int); /* EC_KEY_new_by_curve_name */
+	long (*bio_ctrl)(OPENSSL_BIO*, int, long, void*);	/* BIO_ctrl; optional, only used to query the kernel TLS state */
 }ripcCryptoApiFuncs;
 
 
@@ -60,6 +60,8 @@ typedef struct {
 	OPENSSL_BIO				*bio;
 	char					clientConnState;
 	RsslBool				blocking;
+	RsslBool				kTLSRequested;	// the channel asked for kernel TLS
+	RsslBool				kTLSSend;		// the kernel encrypts everything written to the socket
 } ripcSSLSession;
 
 ripcSSLProtocolFlags ripcGetSupportedProtocolFlags();
@@ -72,6 +74,14 @@ RsslInt32 ripcSSLRead( void *sslSess, char *buf, RsslInt32 max_len, ripcRWFlags
    this will write to the network using SSL and return the appropriate value to the ripc layer */
 RsslInt32 ripcSSLWrite( void *sslSess, char *buf, RsslInt32 len, ripcRWFlags flags, RsslError *error);
 
+/* our kernel TLS write functions -
+   once the kernel owns the TLS send path these write the plaintext straight to the socket */
+RsslInt32 ripcKTLSWrite( void *sslSess, char *buf, RsslInt32 len, ripcRWFlags flags, RsslError *error);
+RsslInt32 ripcKTLSWriteV( void *sslSess, ripcIovType *iov, RsslInt32 iovcnt, RsslInt32 outLen, ripcRWFlags flags, RsslError *error);
+
+/* returns RSSL_TRUE if the kernel took over the TLS send path of this session after the handshake */
+RsslBool ripcSSLKTLSSendActive(void *session);
+
 /* shutdown the SSL and the socket with shutdown() */
 RsslInt32 ripcShutdownSSLSocket(void *session);
 
@@ -84,7 +84,9 @@ typedef enum {
 	RIPC_SOPT_TCP_NODELAY	= 7,	/* Use turn_on */
 	RIPC_SOPT_EXCLUSIVEADDRUSE = 8,	/* Use Exclusive Address Reuse (WIN) */
 	RIPC_SOPT_KEEPALIVE		= 9,
-	RIPC_SOPT_REUSEPORT		= 10	/* Use turn_on. Share server socket (Linux). Under Win should set REUSEADDR and remove EXCLUSIVEADDRUSE */
+	RIPC_SOPT_REUSEPORT		= 10,	/* Use turn_on. Share server socket (Linux). Under Win should set REUSEADDR and remove EXCLUSIVEADDRUSE */
+	RIPC_SOPT_BUSY_POLL		= 11,	/* Use busy_poll_usec. Busy poll the device queue on reads (Linux) */
+	RIPC_SOPT_RX_TIMESTAMPING = 12	/* Use turn_on. Report software and hardware receive timestamps (Linux) */
 } ripcSocketOptionsCode;
 
 typedef struct {
@@ -93,6 +95,7 @@ typedef struct {
 		int			turn_on;		/* turn the option on */
 		int			linger_time;	/* linger_time == 0 turns off */
 		int			buffer_size;	/* set to buffer size */
+		int			busy_poll_usec;	/* microseconds to busy poll; 0 turns off */
 	} options;
 } ripcSocketOption;
 
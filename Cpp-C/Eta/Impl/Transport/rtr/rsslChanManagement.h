@@ -125,6 +125,9 @@ typedef struct {
 	RsslUInt64		shared_key;				/* shared key for encryption/decryption.  If 0 this is not present */
 	RsslBool			ownConnOptCompVer;	/* if true, we created memory for connn opts component version.  false otherwise */
 	RsslComponentInfo	connOptsCompVer;	/* the component version string passed in by the user through the connectOpts */
+	void*			queuedWriteHead;		/* buffers added by rsslQueueWrite, newest first; pushed and taken with compare and swap */
+	void*			pendingWriteHead;		/* queued buffers taken by rsslFlush but not yet written, oldest first; protected by queuedWriteMutex */
+	RsslMutex		queuedWriteMutex;		/* serializes threads writing out queued buffers; separate from chanMutex, which the writes take */
 } rsslChannelImpl;	
 
 typedef struct {
@@ -181,6 +184,8 @@ typedef struct {
 	int	priority;					/* which priority queue to write to */
 	void			*bufferInfo;		/* The new type to abstract the underlying transport's buffer type*/	
 	RsslUInt8		fragmentationFlag; /* indicate whether the buffer is used for fragmentation*/
+	void			*nextQueuedWrite;	/* next buffer while this one is on the channel's queued write list */
+	RsslUInt8		queuedWriteFlags;	/* write flags passed to rsslQueueWrite */
 } rsslBufferImpl;
 
 /**
@@ -245,12 +250,16 @@ typedef struct RsslTransChannelFuncs {
 	RsslRet   (*channelClose)( rsslChannelImpl* rsslChnlImpl, RsslError *error );
 	/* Reads from the transport, returns buffer  */
 	RsslBuffer*  (RTR_FASTCALL *channelRead)( rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error );
+	/* Reads the messages available from the transport into an array; NULL if the transport reads one message at a time */
+	RsslRet  (RTR_FASTCALL *channelReadBatch)( rsslChannelImpl* rsslChnlImpl, RsslReadBatchArgs *readBatchArgs, RsslError *error );
 	/* Writes to the transport */
 	RsslRet     (RTR_FASTCALL *channelWrite)( rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error );
 	/* Flush data written to transport */
 	RsslRet   (RTR_FASTCALL *channelFlush)( rsslChannelImpl *rsslChnlImpl, RsslError *error );					
 	/* Gets buffer used for writing to transport */
 	rsslBufferImpl*  (RTR_FASTCALL *channelGetBuffer)( rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error );
+	/* Gets several buffers under one lock acquisition, returns the number obtained; NULL if the transport gets one buffer at a time */
+	RsslInt32  (RTR_FASTCALL *channelGetBuffers)( rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, rsslBufferImpl **buffers, RsslUInt32 count, RsslError *error );
 	/* Releases buffer used for failed write or unused buffer to transport */
 	RsslRet  (RTR_FASTCALL *channelReleaseBuffer)( rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error );
 	/* Returns current number of used buffers */
@@ -324,6 +333,8 @@ RTR_C_ALWAYS_INLINE void _rsslCleanBuffer(rsslBufferImpl *buffer)
 	buffer->priority = -1;
 
 	buffer->fragmentationFlag = BUFFER_IMPL_NONE;
+	buffer->nextQueuedWrite = NULL;
+	buffer->queuedWriteFlags = 0;
 }
 
 /* does memory allocation and initialization of buffer */
@@ -433,6 +444,9 @@ RTR_C_ALWAYS_INLINE void _rsslCleanChan(rsslChannelImpl *chnl)
 
 	chnl->transportInfo = NULL;
 	chnl->transportServerInfo = NULL;
+
+	chnl->queuedWriteHead = NULL;
+	chnl->pendingWriteHead = NULL;
 	chnl->transportClientInfo = NULL;
 
 	chnl->channelFuncs = 0;
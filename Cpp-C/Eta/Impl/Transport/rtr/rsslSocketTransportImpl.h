@@ -303,6 +303,7 @@ typedef struct {
 	RsslBool	server_blocking;	/* Perform server blocking operations */
 	RsslBool	session_blocking;	/* Perform session blocking operations */
 	RsslBool	tcp_nodelay;		/* Disable Nagle Algorithm */
+	RsslUInt32	busyPollUsec;		/* SO_BUSY_POLL time for accepted sockets; 0 leaves it unset */
 	RsslInt32	connType;			/* Controls the connection type */
 	RsslUInt32	rsslFlags;			/* this flag keeps track of client to server and server to client ping*/
 	RsslUInt8	pingTimeout; 		/* ping timeout */
@@ -331,6 +332,7 @@ typedef struct {
 	char*			serverPrivateKey;
 	RsslHttpCallback *httpCallback;
 	RsslUserCookies	cookies;
+	RsslBool		enableKTLS;		/* ask OpenSSL for kernel TLS on accepted encrypted connections */
 } RsslServerSocketChannel;
 
 #define RSSL_INIT_SERVER_SOCKET_Bind { 0, 0, 0, 0, 0, 0, 0, RSSL_COMP_NONE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, RSSL_ENC_TLSV1_2, 0, 0 };
@@ -418,6 +420,7 @@ typedef struct
 	char				*curlOptProxyDomain;	/* domain used for tunneling connection */
 	RsslBool			blocking : 1;			/* Perform blocking operations */
 	RsslBool			tcp_nodelay : 1;		/* Disable Nagle Algorithm */
+	RsslUInt32			busyPollUsec;			/* SO_BUSY_POLL time for the socket; 0 leaves it unset */
 	RsslUInt32			compression;			/* Use compression defined by server, otherwise none */
 	RsslUInt32			numConnections;			/* Number of concurrent connections for an extended line connection */
 	RsslUInt32			numGuarOutputBufs;		/* Number of guaranteed output buffers */
@@ -444,6 +447,7 @@ typedef struct
 	RsslUInt32 sslCurrentProtocol;	/* This is the current TLS protocol */
 	RsslInt32			 sslEncryptedProtocolType;	/* Encrypted protocol type.  Currently either RSSL_CONN_TYPE_SOCKET or RSSL_CONN_TYPE_HTTP */
 	char				 *sslCAStore;
+	RsslBool			 sslEnableKTLS;	/* ask OpenSSL to hand the TLS send path to the kernel after the handshake */
 
 
 	RsslInt32			ripcVersion;
@@ -472,10 +476,15 @@ typedef struct
 	RsslUInt32			lowerCompressionThreshold;			/* dont compress any buffers smaller than this */
 	RsslUInt32			upperCompressionThreshold;			/* dont compress any buffers larger than this */
 	RsslUInt32			high_water_mark;		/* used for the upper buffer usage threshold for this channel */
+	RsslUInt32			writeCoalesceBudget;	/* latency budget in microseconds for queued writes; 0 disables it */
+	RsslUInt64			writeCoalesceStartUsec;	/* when the oldest unflushed write was queued; 0 if not tracked */
+	RsslWriteCoalesceStats	writeCoalesceStats;	/* batch size and queueing delay histograms */
 	RsslUInt32			safeLZ4 : 1;			/* limits LZ4 compression to only packets that wont span multiple buffers */
 
 	ripcTransportFuncs	*transportFuncs; /* The transport functions to use */
 
+	ripcTransportFuncs	kTLSTransportFuncs; /* Encrypted transport functions with the writes going straight to the socket; used once kTLS is active */
+
 	ripcProtocolFuncs	*protocolFuncs; /* The protocol Hdr functions to use */
 
 	RsslUInt32			keyExchange : 1; /* indicates whether we should be exchanging encryption keys on the handshake */
@@ -577,6 +586,9 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->lowerCompressionThreshold = 0;
 	rsslSocketChannel->upperCompressionThreshold = 10000000;
 	rsslSocketChannel->high_water_mark = 6000;
+	rsslSocketChannel->writeCoalesceBudget = 0;
+	rsslSocketChannel->writeCoalesceStartUsec = 0;
+	memset(&rsslSocketChannel->writeCoalesceStats, 0, sizeof(RsslWriteCoalesceStats));
 	rsslSocketChannel->safeLZ4 = 0;
 	rsslSocketChannel->keyExchange = 0;
 	rsslSocketChannel->transportFuncs = 0; 
@@ -679,6 +691,8 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->sslProtocolBitmap = RSSL_ENC_NONE;
 	rsslSocketChannel->sslEncryptedProtocolType = 0;
 	rsslSocketChannel->sslCAStore = 0;
+	rsslSocketChannel->sslEnableKTLS = RSSL_FALSE;
+	rsslSocketChannel->busyPollUsec = 0;
 
 	rsslSocketChannel->rwsSession = 0;
 	rsslSocketChannel->rwsLargeMsgBufferList = 0;
@@ -716,6 +730,9 @@ RsslRet rsslSocketCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error);
 /* Contains code necessary to read from a socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error);
 
+/* Contains code necessary to read the available messages from a socket connection into an array (client or server side) */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketReadBatch(rsslChannelImpl* rsslChnlImpl, RsslReadBatchArgs *readBatchArgs, RsslError *error);
+
 /* Contains code necessary to write/queue data going to a socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error);
 
@@ -725,6 +742,9 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImp
 /* Contains code necessary to obtain a buffer to put data in for writing to socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(rsslBufferImpl*) rsslSocketGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error);
 
+/* Obtains several buffers for writing under a single acquisition of the channel's lock */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslInt32) rsslSocketGetBuffers(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, rsslBufferImpl **buffers, RsslUInt32 count, RsslError *error);
+
 /* Contains code necessary to release an unused/unsuccessfully written buffer to socket connection (client or server) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error);
 
@@ -0,0 +1,40 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef _RSSL_LATENCY_TRACE_IMPL_H
+#define _RSSL_LATENCY_TRACE_IMPL_H
+
+#include "rtr/rsslLatencyTrace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Checked by the transport before calling into the tracing code, so the read path
+ * costs one load when tracing is off. */
+extern RsslBool rsslLatencyTraceActive;
+
+/* Set when socket channels should request SO_TIMESTAMPING receive timestamps. */
+extern RsslBool rsslLatencyTraceSocketTimestamps;
+
+/* Remembers the receive time of the data most recently read from a socket on this thread.
+ * It is attached to the next message returned; messages served from the same data after that have none. */
+void _rsslLatencyTraceSetRecvTime(RsslUInt64 timeNsec);
+
+/* Remembers that data was just decompressed on this thread.  It is attached to the next message returned. */
+void _rsslLatencyTraceSetDecompressTime();
+
+/* Starts a new message on this thread and stamps it at RSSL_LT_TRANSPORT_READ, along with
+ * any receive and decompress times recorded since the last message. */
+void _rsslLatencyTraceBeginMsg();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,214 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslLatencyTraceImpl.h"
+#include "rtr/platform.h"
+#include "rtr/rtratomic.h"
+
+#include <stdlib.h>
+
+#ifdef WIN32
+#include <windows.h>
+#define LATENCY_TRACE_BARRIER() MemoryBarrier()
+#else
+#include <time.h>
+#include <sys/time.h>
+#define LATENCY_TRACE_BARRIER() __sync_synchronize()
+#endif
+
+/* Samples recorded by one thread.  Only the owning thread advances head and only the
+ * draining thread advances tail, so neither side needs a lock. */
+typedef struct LatencyTraceRing
+{
+	struct LatencyTraceRing	*next;			/* all rings, newest first */
+	RsslUInt32				threadIndex;
+	RsslUInt32				mask;
+	volatile RsslUInt32		head;
+	volatile RsslUInt32		tail;
+	volatile RsslUInt64		dropped;
+	RsslLatencyTraceSample	*samples;
+} LatencyTraceRing;
+
+RsslBool rsslLatencyTraceActive = RSSL_FALSE;
+RsslBool rsslLatencyTraceSocketTimestamps = RSSL_FALSE;
+
+static RsslUInt32 latencyTraceRingSize = 65536;
+static void *latencyTraceRings = NULL;
+
+static DEV_THREAD_LOCAL LatencyTraceRing *tlsRing = NULL;
+static DEV_THREAD_LOCAL RsslUInt64 tlsNextMsgId = 0;
+static DEV_THREAD_LOCAL RsslUInt64 tlsMsgId = 0;
+static DEV_THREAD_LOCAL RsslUInt64 tlsRecvTime = 0;
+static DEV_THREAD_LOCAL RsslUInt64 tlsDecompressTime = 0;
+
+static RsslUInt64 _latencyTraceNow()
+{
+#ifdef WIN32
+	FILETIME ft;
+	ULARGE_INTEGER time;
+
+	GetSystemTimePreciseAsFileTime(&ft);
+	time.LowPart = ft.dwLowDateTime;
+	time.HighPart = ft.dwHighDateTime;
+	/* 100ns intervals since 1601 */
+	return (time.QuadPart - 116444736000000000ULL) * 100ULL;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (RsslUInt64)ts.tv_sec * 1000000000ULL + (RsslUInt64)ts.tv_nsec;
+#endif
+}
+
+static LatencyTraceRing *_latencyTraceCreateRing()
+{
+	LatencyTraceRing *pRing;
+	void *head;
+
+	if ((pRing = (LatencyTraceRing*)calloc(1, sizeof(LatencyTraceRing))) == NULL)
+		return NULL;
+
+	if ((pRing->samples = (RsslLatencyTraceSample*)malloc(latencyTraceRingSize * sizeof(RsslLatencyTraceSample))) == NULL)
+	{
+		free(pRing);
+		return NULL;
+	}
+	pRing->mask = latencyTraceRingSize - 1;
+
+	do
+	{
+		head = latencyTraceRings;
+		pRing->next = (LatencyTraceRing*)head;
+		pRing->threadIndex = head ? ((LatencyTraceRing*)head)->threadIndex + 1 : 0;
+	}
+	while (RTR_ATOMIC_COMPARE_AND_SWAPPTR(latencyTraceRings, head, pRing) != head);
+
+	tlsRing = pRing;
+	return pRing;
+}
+
+static void _latencyTraceRecord(RsslUInt8 stage, RsslUInt64 timeNsec)
+{
+	LatencyTraceRing *pRing = tlsRing;
+	RsslLatencyTraceSample *pSample;
+
+	if (rtrUnlikely(pRing == NULL) && (pRing = _latencyTraceCreateRing()) == NULL)
+		return;
+
+	if (pRing->head - pRing->tail > pRing->mask)
+	{
+		++pRing->dropped;
+		return;
+	}
+
+	pSample = &pRing->samples[pRing->head & pRing->mask];
+	pSample->msgId = tlsMsgId;
+	pSample->timeNsec = timeNsec;
+	pSample->threadIndex = pRing->threadIndex;
+	pSample->stage = stage;
+
+	/* publish the sample before the drainer can see the new head */
+	LATENCY_TRACE_BARRIER();
+	++pRing->head;
+}
+
+RSSL_API RsslRet rsslLatencyTraceEnable(RsslLatencyTraceOpts *pOpts)
+{
+	RsslUInt32 ringSize = 1;
+
+	if (pOpts == NULL)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* rings that already exist keep their size */
+	while (ringSize < pOpts->ringSize && ringSize < 0x80000000)
+		ringSize <<= 1;
+	latencyTraceRingSize = ringSize;
+
+	rsslLatencyTraceSocketTimestamps = pOpts->socketTimestamps;
+	rsslLatencyTraceActive = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API void rsslLatencyTraceDisable()
+{
+	rsslLatencyTraceActive = RSSL_FALSE;
+	rsslLatencyTraceSocketTimestamps = RSSL_FALSE;
+}
+
+RSSL_API void rsslLatencyTraceStamp(RsslLatencyTraceStages stage)
+{
+	if (!rsslLatencyTraceActive || tlsMsgId == 0)
+		return;
+
+	_latencyTraceRecord((RsslUInt8)stage, _latencyTraceNow());
+}
+
+RSSL_API RsslUInt32 rsslLatencyTraceDrain(RsslLatencyTraceSample *pSamples, RsslUInt32 maxSamples)
+{
+	LatencyTraceRing *pRing;
+	RsslUInt32 count = 0;
+
+	for (pRing = (LatencyTraceRing*)latencyTraceRings; pRing != NULL && count < maxSamples; pRing = pRing->next)
+	{
+		RsslUInt32 head = pRing->head;
+		RsslUInt32 tail = pRing->tail;
+
+		/* read the samples only after seeing the head that published them */
+		LATENCY_TRACE_BARRIER();
+
+		while (tail != head && count < maxSamples)
+			pSamples[count++] = pRing->samples[tail++ & pRing->mask];
+
+		/* finish copying before the slots are handed back to the writer */
+		LATENCY_TRACE_BARRIER();
+		pRing->tail = tail;
+	}
+
+	return count;
+}
+
+RSSL_API RsslUInt64 rsslLatencyTraceDroppedCount()
+{
+	LatencyTraceRing *pRing;
+	RsslUInt64 dropped = 0;
+
+	for (pRing = (LatencyTraceRing*)latencyTraceRings; pRing != NULL; pRing = pRing->next)
+		dropped += pRing->dropped;
+
+	return dropped;
+}
+
+void _rsslLatencyTraceSetRecvTime(RsslUInt64 timeNsec)
+{
+	tlsRecvTime = timeNsec;
+}
+
+void _rsslLatencyTraceSetDecompressTime()
+{
+	tlsDecompressTime = _latencyTraceNow();
+}
+
+void _rsslLatencyTraceBeginMsg()
+{
+	tlsMsgId = ++tlsNextMsgId;
+
+	/* a receive timestamp belongs only to the first message read after it, so later
+	 * messages served from already buffered data do not report a stale time */
+	if (tlsRecvTime)
+	{
+		_latencyTraceRecord(RSSL_LT_SOCKET_RECV, tlsRecvTime);
+		tlsRecvTime = 0;
+	}
+
+	if (tlsDecompressTime)
+	{
+		_latencyTraceRecord(RSSL_LT_DECOMPRESS, tlsDecompressTime);
+		tlsDecompressTime = 0;
+	}
+
+	_latencyTraceRecord(RSSL_LT_TRANSPORT_READ, _latencyTraceNow());
+}
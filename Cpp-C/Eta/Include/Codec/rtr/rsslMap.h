@@ -16,6 +16,7 @@ extern "C" {
 
 #include "rtr/rsslDataTypeEnums.h"
 #include "rtr/rsslIterators.h"
+#include "rtr/rsslSetData.h"
 
 /**
  * @addtogroup MStruct 
@@ -407,6 +408,70 @@ RSSL_API RsslRet rsslDecodeMapEntry(
 							RsslMapEntry		*pMapEntry,
 							void				*pKeyData );
 
+/**
+ * @brief Status of one value in an RsslMapFieldColumn (MCVS = Map Column Value Status)
+ * @see RsslMapFieldColumn, rsslDecodeMapEntryColumns
+ */
+typedef enum
+{
+	RSSL_MCVS_NOT_PRESENT		= 0,	/*!< (0) The field was not in the entry, or the entry has no payload (e.g. ::RSSL_MPEA_DELETE_ENTRY).  The value is left unchanged. */
+	RSSL_MCVS_PRESENT			= 1,	/*!< (1) The field was in the entry and its value was decoded. */
+	RSSL_MCVS_BLANK				= 2		/*!< (2) The field was in the entry and is blank. */
+} RsslMapColumnValueStatus;
+
+/**
+ * @brief One field to collect from every RsslMapEntry decoded by rsslDecodeMapEntryColumns().
+ * @see RsslMapColumns, rsslDecodeMapEntryColumns
+ */
+typedef struct
+{
+	RsslFieldId			fieldId;	/*!< @brief Field to collect from the field list of each entry. */
+	RsslPrimitiveType	dataType;	/*!< @brief Primitive type of the field, typically RsslDictionaryEntry::rwfType.  Buffer types are returned in place. */
+	void				*values;	/*!< @brief Array of RsslMapColumns::capacity values of the type that represents dataType (e.g. RsslReal for ::RSSL_DT_REAL, RsslBuffer for ::RSSL_DT_ASCII_STRING).  Element i holds the field of entry i. */
+	RsslUInt8			*status;	/*!< @brief Array of RsslMapColumns::capacity RsslMapColumnValueStatus values, one per entry. */
+} RsslMapFieldColumn;
+
+/**
+ * @brief Caller provided storage for the entries of an RsslMap of field lists, laid out as one array per entry member.
+ * @see RsslMapFieldColumn, rsslDecodeMapEntryColumns
+ */
+typedef struct
+{
+	RsslUInt32			capacity;		/*!< @brief Number of entries each array below can hold. */
+	RsslUInt32			count;			/*!< @brief Set by rsslDecodeMapEntryColumns() to the number of entries decoded. */
+	RsslUInt8			*actions;		/*!< @brief Array of RsslMapEntryActions, one per entry. */
+	RsslBuffer			*encKeys;		/*!< @brief Optional array of encoded keys (RsslMapEntry::encKey), one per entry.  May be NULL. */
+	void				*keys;			/*!< @brief Optional array of decoded keys of the type that represents RsslMap::keyPrimitiveType, one per entry.  May be NULL. */
+	RsslMapFieldColumn	*columns;		/*!< @brief Fields to collect from each entry. */
+	RsslUInt32			columnCount;	/*!< @brief Number of elements in columns. */
+} RsslMapColumns;
+
+/**
+ * @brief Decodes consecutive RsslMapEntry elements of an RsslMap of field lists into caller provided arrays
+ * 
+ * Decodes up to RsslMapColumns::capacity entries in one call, collecting the action, key and the fields named by
+ * RsslMapColumns::columns of each entry.  Fields that are not requested are skipped without being decoded, and the
+ * rest of an entry is skipped once all requested fields have been found.  This is intended for large, homogeneous
+ * maps such as order book refreshes, where calling rsslDecodeMapEntry(), rsslDecodeFieldList() and 
+ * rsslDecodeFieldEntry() per entry dominates the cost of building the book.
+ *
+ * Typical use:<BR>
+ *  1. Call rsslDecodeMap(), then decode set definitions and summary data if present<BR>
+ *  2. Call rsslDecodeMapEntryColumns() and process RsslMapColumns::count entries until error or ::RSSL_RET_END_OF_CONTAINER is returned.<BR>
+ *
+ * @param pIter Decode iterator positioned on the entries of an RsslMap with an RsslMap::containerType of ::RSSL_DT_FIELD_LIST
+ * @param pColumns Arrays to decode entries into.  RsslMapColumns::count is set to the number of entries decoded.
+ * @param pLocalSetDb Local set definitions for field lists that contain set data, as with rsslDecodeFieldList().  May be NULL.
+ * @see rsslDecodeMap, rsslDecodeMapEntry, RsslMapColumns
+ * @return ::RSSL_RET_SUCCESS if RsslMapColumns::capacity entries were decoded and more may remain, ::RSSL_RET_END_OF_CONTAINER 
+ * if the map has no more entries (RsslMapColumns::count entries were still decoded), ::RSSL_RET_UNSUPPORTED_DATA_TYPE if the map 
+ * does not contain field lists or a column or key type has no primitive representation, or any failure code from the entry decoders
+ */
+RSSL_API RsslRet rsslDecodeMapEntryColumns(
+							RsslDecodeIterator		*pIter,
+							RsslMapColumns			*pColumns,
+							RsslLocalFieldSetDefDb	*pLocalSetDb );
+
 /**
  * @}
  */
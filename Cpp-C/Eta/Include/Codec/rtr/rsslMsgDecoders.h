@@ -144,6 +144,82 @@ RSSL_API RsslRet rsslExtractPostId( const RsslDecodeIterator *pIter, RsslUInt32
 
 
 
+/**
+ * @addtogroup MsgDecoders
+ * @{
+ */
+
+/**
+ * @brief A partially decoded view of an encoded \ref RsslMsg header.
+ *
+ * rsslDecodeMsgHeaderView() decodes only the fixed part of the header (class, domain, stream Id, flags and container type) in a single pass.
+ * The remaining members are located on first access through the rsslMsgHeaderView* accessors; the offsets found by that walk are kept on the view so further accessors do not parse the header again.
+ * This is intended for routing code that only needs a handful of header members and would otherwise pay for the full rsslDecodeMsg(), or for several rsslExtract* calls that each re-parse from the start of the buffer.
+ * @note The view points into the encoded buffer and is only valid while that buffer is.
+ * @see rsslDecodeMsgHeaderView, rsslDecodeMsg
+ */
+typedef struct
+{
+	RsslUInt8		msgClass;		/*!< Class of the message. Populated by \ref RsslMsgClasses */
+	RsslUInt8		domainType;		/*!< Domain type of the message. Populated by \ref RsslDomainTypes */
+	RsslInt32		streamId;		/*!< Stream Id of the message */
+	RsslUInt16		flags;			/*!< Class-specific message flags, e.g. \ref RsslUpdateFlags for an \ref RsslUpdateMsg. Zero for an \ref RsslCloseMsg with no flags set. */
+	RsslUInt8		containerType;	/*!< Container type of the message payload */
+	RsslBuffer		encMsgBuffer;	/*!< The entire encoded message */
+	RsslBuffer		encDataBody;	/*!< The encoded payload, if any */
+
+	char			*_pClassHeader;	/*!< @private Start of the class-specific header members */
+	char			*_pHeaderEnd;	/*!< @private End of the encoded header */
+	char			*_pSeqNum;		/*!< @private Position of the sequence number, if present */
+	char			*_pGroupId;		/*!< @private Position of the group Id, if present */
+	char			*_pMsgKey;		/*!< @private Position of the message key length, if present */
+	RsslBool		_resolved;		/*!< @private RSSL_TRUE once the class-specific members have been located */
+} RsslMsgHeaderView;
+
+/**
+ * @brief Decodes the fixed part of an encoded message header into an \ref RsslMsgHeaderView.
+ *
+ * The iterator is not moved; rsslDecodeMsg() may still be called with it afterwards to decode the full message.
+ * @param pIter \ref RsslDecodeIterator positioned at the start of an encoded \ref RsslMsg
+ * @param pView \ref RsslMsgHeaderView to populate
+ * @return RSSL_RET_SUCCESS, RSSL_RET_INCOMPLETE_DATA if the buffer is shorter than the encoded header, or RSSL_RET_FAILURE for an unknown message class.
+ * @see RsslMsgHeaderView
+ */
+RSSL_API RsslRet rsslDecodeMsgHeaderView(const RsslDecodeIterator *pIter, RsslMsgHeaderView *pView);
+
+/**
+ * @brief Gets the sequence number from an \ref RsslMsgHeaderView.
+ *
+ * @param[in] pView \ref RsslMsgHeaderView populated by rsslDecodeMsgHeaderView()
+ * @param[out] pSeqNum Sequence number of the message
+ * @return RSSL_RET_SUCCESS if the message carries a sequence number, RSSL_RET_FAILURE if it does not, or RSSL_RET_INCOMPLETE_DATA if the header is malformed.
+ */
+RSSL_API RsslRet rsslMsgHeaderViewGetSeqNum(RsslMsgHeaderView *pView, RsslUInt32 *pSeqNum);
+
+/**
+ * @brief Gets the group Id from an \ref RsslMsgHeaderView. This operation does not copy the data out of the encoded buffer.
+ *
+ * @param[in] pView \ref RsslMsgHeaderView populated by rsslDecodeMsgHeaderView()
+ * @param[out] pGroupId Group Id of the message
+ * @return RSSL_RET_SUCCESS if the message carries a group Id, RSSL_RET_FAILURE if it does not, or RSSL_RET_INCOMPLETE_DATA if the header is malformed.
+ */
+RSSL_API RsslRet rsslMsgHeaderViewGetGroupId(RsslMsgHeaderView *pView, RsslBuffer *pGroupId);
+
+/**
+ * @brief Gets the message key from an \ref RsslMsgHeaderView. Key name and attribute buffers point into the encoded buffer.
+ *
+ * @param[in] pView \ref RsslMsgHeaderView populated by rsslDecodeMsgHeaderView()
+ * @param[out] pKey Message key of the message
+ * @return RSSL_RET_SUCCESS if the message carries a key, RSSL_RET_FAILURE if it does not, or RSSL_RET_INCOMPLETE_DATA if the header is malformed.
+ */
+RSSL_API RsslRet rsslMsgHeaderViewGetMsgKey(RsslMsgHeaderView *pView, RsslMsgKey *pKey);
+
+/**
+ * @}
+ */
+
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -71,6 +71,7 @@ typedef struct
 	RsslUInt	type;					/*!< The type of guarantee to use. See RDMClassOfServiceGuaranteeType. */
 	RsslBool	persistLocally;			/*!< Consumers only. Indicates whether messages are persisted to a local file. */
 	char		*persistenceFilePath;   /*!< Consumers only. Path for storing persistence files, if local persistence is enabled. */
+	RsslInt		persistenceCommitInterval;	/*!< Consumers only. Controls how often the persistence file is committed to disk, if local persistence is enabled. 0 commits every change before it is used (default). A positive value commits pending changes at most once per that many milliseconds, and a negative value commits them once per dispatch of the tunnel stream. Deferred changes survive a failure of the application, but may be lost on a failure of the system. */
 } RsslClassOfServiceGuarantee;
 
 
@@ -106,6 +107,7 @@ RTR_C_INLINE void rsslClearClassOfService(RsslClassOfService *pClass)
 	pClass->guarantee.type = RDM_COS_GU_NONE;
 	pClass->guarantee.persistLocally = RSSL_TRUE;
 	pClass->guarantee.persistenceFilePath = NULL;
+	pClass->guarantee.persistenceCommitInterval = 0;
 }
 
 #ifdef __cplusplus
@@ -146,6 +146,8 @@ typedef struct
 	RsslUInt32						maxOutstandingPosts;	/*!< Sets the maximum number of post acknowledgments that may be outstanding for the channel. */
 	RsslUInt32						postAckTimeout;			/*!< Time a stream will wait for acknowledgment of a post message, in milliseconds. */
 	RsslUInt32						requestTimeout;			/*!< Time a requested stream will wait for a response from the provider, in milliseconds. */
+	RsslUInt32						recoveryRequestRate;	/*!< Maximum number of item recovery requests sent per second. Recovering items are requested highest priority class first. 0 means no limit. */
+	RsslUInt32						maxOutstandingRecoveryRefreshes;	/*!< Maximum number of item recovery requests that may be waiting for their refresh. 0 means no limit. */
 } RsslConsumerWatchlistOptions;
 
 /**
@@ -289,7 +291,7 @@ RTR_C_INLINE void rsslClearReactorChannelRole(RsslReactorChannelRole *pRole)
  * @see rsslCreateReactor
  */
 typedef struct {
-	RsslInt32	dispatchDecodeMemoryBufferSize;	/*!< Size of the memory buffer(in bytes) that the RsslReactor will use when decoding RsslRDMMsgs to pass to callback functions. */
+	RsslInt32	dispatchDecodeMemoryBufferSize;	/*!< Initial size of the memory buffer(in bytes) that the RsslReactor will use when decoding RsslRDMMsgs to pass to callback functions. The buffer grows if a single dispatch needs more. */
     RsslInt32   maxEventsInPool;				/*!< Specifies maximum amount of the events in the RsslReactor pool. The default value -1 the maximum is not specified.>*/
     void		*userSpecPtr; 					/*!< user-specified pointer which will be set on the Reactor. */
 	RsslBuffer	serviceDiscoveryURL;			/*!< Specifies a URL for the EDP-RT service discovery. The service discovery is used when the connection arguments is not specified
@@ -304,6 +306,9 @@ typedef struct {
 	int			port;							/*!< @deprecated DEPRECATED: This parameter no longer has any effect. It was a port used for creating the eventFd descriptor on the RsslReactor. It was never used on Linux or Solaris platforms. */
 	RsslBool	restEnableLog;					/*!< Enable REST interaction debug messages> */
 	FILE		*restLogOutputStream;			/*!< Set output stream for REST debug message (by default is stdout)> */
+	RsslInt32	workerCpuId;					/*!< CPU core that the RsslReactor's worker thread is bound to. Applications that spread channels across several RsslReactors can use this
+												 * to keep each reactor's pinging and flushing on its own core. The default value -1 leaves the thread unbound.
+												 * rsslCreateReactor() fails if the thread cannot be bound to this core. */
 } RsslCreateReactorOptions;
 
 /**
@@ -326,6 +331,7 @@ RTR_C_INLINE void rsslClearCreateReactorOptions(RsslCreateReactorOptions *pReact
 	pReactorOpts->restRequestTimeOut = 90;
 	pReactorOpts->restEnableLog = RSSL_FALSE;
 	pReactorOpts->restLogOutputStream = NULL;
+	pReactorOpts->workerCpuId = -1;
 }
 
 /**
@@ -478,6 +484,10 @@ typedef struct
 
 	RsslUInt32				connectionDebugFlags;	/*!< Set of RsslDebugFlags for calling the user-set debug callbacks.  These callbacks should be set with rsslSetDebugFunctions.  If set to 0, the debug callbacks will not be used. */
 
+	RsslUInt32				writeCoalesceBudget;	/*!< Time(in microseconds) written messages may wait to be coalesced with later ones before the RsslReactor flushes them. 
+													 * Messages are still flushed sooner once more than the high water mark is queued. If set to 0, flushing is requested as soon as messages are written.
+													 * Applies to socket, encrypted, HTTP and WebSocket connections. @see RSSL_WRITE_COALESCE_BUDGET */
+
 	RsslUInt32				statisticFlags;			/* Specifies interests for the channel statistics defined in RsslReactorChannelStatisticFlags */
 
 } RsslReactorConnectOptions;
@@ -496,6 +506,7 @@ RTR_C_INLINE void rsslClearReactorConnectOptions(RsslReactorConnectOptions *pOpt
 	pOpts->reactorConnectionList = NULL;
 	pOpts->connectionCount = 0;
 	pOpts->connectionDebugFlags = 0;
+	pOpts->writeCoalesceBudget = 0;
 	pOpts->statisticFlags = RSSL_RC_ST_NONE;
 }
 
@@ -528,6 +539,7 @@ typedef struct
 	RsslUInt32			initializationTimeout;	/*!< Time(in seconds) to wait for successful initialization of a channel. 
 												 * If initialization does not complete in time, a RsslReactorChannelEvent will be sent indicating that the channel is down. */
 	RsslUInt32			connectionDebugFlags;	/*!< Set of RsslDebugFlags for calling the user-set debug callbacks.  These callbacks should be set with rsslSetDebugFunctions.  If set to 0, the debug callbacks will not be used. */
+	RsslUInt32			writeCoalesceBudget;	/*!< Time(in microseconds) written messages may wait to be coalesced with later ones before the RsslReactor flushes them. If set to 0, flushing is requested as soon as messages are written. @see RsslReactorConnectOptions.writeCoalesceBudget */
 
 	RsslReactorWSocketAcceptOptions   wsocketAcceptOptions; /*!< This is additional accept options for WebSocket connection. */
 
@@ -542,6 +554,7 @@ RTR_C_INLINE void rsslClearReactorAcceptOptions(RsslReactorAcceptOptions *pOpts)
 	rsslClearAcceptOpts(&pOpts->rsslAcceptOptions);
 	pOpts->initializationTimeout = 60;
 	pOpts->connectionDebugFlags = 0;
+	pOpts->writeCoalesceBudget = 0;
 	pOpts->wsocketAcceptOptions.sendPingMessage = RSSL_TRUE;
 }
 
@@ -893,6 +906,78 @@ RTR_C_INLINE void rsslClearReactorChannelStatistic(RsslReactorChannelStatistic *
 RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
 	RsslReactorChannelStatistic *pRsslReactorChannelStatistic, RsslErrorInfo *pError);
 
+/**
+ * @brief Progress of the watchlist's item recovery on a channel. Counts cover the current round of recovery,
+ * which starts when an item begins recovering while no other items are recovering.
+ * @see rsslReactorGetWatchlistRecoveryStats, RsslConsumerWatchlistOptions
+ */
+typedef struct
+{
+	RsslUInt32		queuedCount;			/*!< Number of items waiting to send their recovery request. */
+	RsslUInt32		outstandingCount;		/*!< Number of items waiting for the refresh to their recovery request. */
+	RsslUInt		recoveredCount;			/*!< Number of items that have completed recovery. */
+	RsslUInt8		topPriorityClass;		/*!< Highest priority class that still has items recovering. */
+	RsslUInt32		topPriorityClassCount;	/*!< Number of items still recovering in topPriorityClass. */
+	RsslInt64		startTime;				/*!< Time at which the current round of recovery started, in milliseconds. */
+	RsslInt64		lastRecoveredTime;		/*!< Time at which an item last completed recovery, in milliseconds. */
+} RsslReactorWatchlistRecoveryStats;
+
+/**
+ * @brief Clears an RsslReactorWatchlistRecoveryStats object.
+ * @see RsslReactorWatchlistRecoveryStats
+ */
+RTR_C_INLINE void rsslClearReactorWatchlistRecoveryStats(RsslReactorWatchlistRecoveryStats *pStats)
+{
+	memset(pStats, 0, sizeof(RsslReactorWatchlistRecoveryStats));
+}
+
+/**
+ * @brief Retrieves the progress of item recovery for the specified RsslReactorChannel. The channel must have the watchlist enabled.
+ * @param pReactor The reactor handling the RsslReactorChannel.
+ * @param pReactorChannel The channel to retrieve recovery progress for.
+ * @param pStats The passed in RsslReactorWatchlistRecoveryStats to populate.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return failure codes, if specified invalid arguments or the RsslReactor was shut down due to a failure.
+ * @see RsslReactor, RsslReactorWatchlistRecoveryStats
+ */
+RSSL_VA_API RsslRet rsslReactorGetWatchlistRecoveryStats(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
+	RsslReactorWatchlistRecoveryStats *pStats, RsslErrorInfo *pError);
+
+/**
+ * @brief Use of the memory the RsslReactor decodes RsslRDMMsgs into for callback functions. This memory is
+ * reclaimed at the start of each call to rsslReactorDispatch, so counts for the last pass cover everything
+ * decoded since the previous call.
+ * @see rsslReactorGetDispatchStats, RsslCreateReactorOptions::dispatchDecodeMemoryBufferSize
+ */
+typedef struct
+{
+	RsslUInt32		lastDispatchAllocCount;	/*!< Number of allocations made during the last dispatch pass. */
+	RsslUInt32		lastDispatchAllocBytes;	/*!< Bytes allocated during the last dispatch pass. */
+	RsslUInt32		maxDispatchAllocBytes;	/*!< Largest number of bytes allocated during any dispatch pass. */
+	RsslUInt64		totalAllocCount;		/*!< Number of allocations made during all completed dispatch passes. */
+	RsslUInt64		blockAllocCount;		/*!< Number of times the reactor had to allocate heap memory for decoding, including its initial block. */
+	RsslUInt32		blockSize;				/*!< Size of the memory block currently kept between dispatch passes. Grows to fit a pass that overflows it, and shrinks back when later passes use little of it. */
+} RsslReactorDispatchStats;
+
+/**
+ * @brief Clears an RsslReactorDispatchStats object.
+ * @see RsslReactorDispatchStats
+ */
+RTR_C_INLINE void rsslClearReactorDispatchStats(RsslReactorDispatchStats *pStats)
+{
+	memset(pStats, 0, sizeof(RsslReactorDispatchStats));
+}
+
+/**
+ * @brief Retrieves statistics about the memory used to decode messages during rsslReactorDispatch.
+ * @param pReactor The reactor to retrieve statistics for.
+ * @param pStats The passed in RsslReactorDispatchStats to populate.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return failure codes, if specified invalid arguments or the RsslReactor was shut down due to a failure.
+ * @see RsslReactor, RsslReactorDispatchStats
+ */
+RSSL_VA_API RsslRet rsslReactorGetDispatchStats(RsslReactor *pReactor, RsslReactorDispatchStats *pStats, RsslErrorInfo *pError);
+
 /**
  * @brief Configuration options for initializing JSON converter.
  * @see rsslReactorInitJsonConverter
@@ -60,7 +60,8 @@ typedef enum {
 typedef enum {
 	RSSL_COMP_NONE	= 0x00,  /*!< (0) No compression will be negotiated. */
 	RSSL_COMP_ZLIB	= 0x01,	 /*!< (1) RSSL will attempt to use Zlib compression. */
-	RSSL_COMP_LZ4	= 0x02	 /*!< (2) RSSL will attempt to use LZ4 compression */
+	RSSL_COMP_LZ4	= 0x02,	 /*!< (2) RSSL will attempt to use LZ4 compression */
+	RSSL_COMP_LZ4_STREAM = 0x04	 /*!< (4) RSSL will attempt to use LZ4 compression that keeps the last 64KB of the stream as a dictionary, so small messages compress well. Peers that do not support it negotiate no compression. */
 } RsslCompTypes;
 
 /**
@@ -83,7 +84,8 @@ typedef enum {
 										 /*!< (12) Reserved */
 										 /*!< (13) Reserved */
 	RSSL_REGISTER_HASH_ID			= 14, /*!< (14) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Registers a hash so that a filtering-enabled channel allows it. */
-	RSSL_UNREGISTER_HASH_ID			= 15 /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_UNREGISTER_HASH_ID			= 15, /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_WRITE_COALESCE_BUDGET		= 16 /*!< (16) Channel: Used to set the latency budget, in microseconds, for coalescing queued writes on this channel. Queued data is flushed once it exceeds the ::RSSL_HIGH_WATER_MARK or has been queued for longer than the budget. The budget bounds the delay only between back-to-back rsslWrite calls: it is checked by rsslWrite and no timer is started, so data on a channel that stops writing stays queued, with no bound, until the next rsslWrite, rsslFlush or rsslPing. Applications that set a budget should keep calling rsslFlush while rsslWrite returns a positive value, or use the RsslReactor, which flushes on its own timer. 0 disables the budget (default). */
 } RsslIoctlCodes;
 
 /**
@@ -321,6 +323,26 @@ typedef struct {
 	RsslInt64 tcpRetransmitCount;			/*!< @brief This is number of TCP retransmissions for the current TCP connection. */
 } RsslTCPStats;
 
+/**
+* @brief Number of buckets in each RsslWriteCoalesceStats histogram.
+* @see RsslWriteCoalesceStats
+*/
+#define RSSL_WRITE_COALESCE_HIST_SIZE 16
+
+/**
+* @brief RSSL write coalescing statistics returned by the rsslGetChannelStats call.
+*
+* A sample is taken each time queued data is flushed while a budget is set with ::RSSL_WRITE_COALESCE_BUDGET.
+* Bucket 0 counts samples of 0, bucket N counts samples from 2^(N-1) up to 2^N - 1, and the last bucket also counts every larger sample.
+* @see rsslGetChannelStats
+* @see RsslChannelStats
+*/
+typedef struct {
+	RsslUInt64 flushCount;										/*!< @brief Number of samples taken. */
+	RsslUInt64 batchBytes[RSSL_WRITE_COALESCE_HIST_SIZE];		/*!< @brief Histogram of the number of bytes queued when each flush started. */
+	RsslUInt64 queueDelayUsec[RSSL_WRITE_COALESCE_HIST_SIZE];	/*!< @brief Histogram of the time, in microseconds, the oldest queued write waited before each flush. */
+} RsslWriteCoalesceStats;
+
 /**
 * @brief RSSL TCP channel statistics Statistics returned by the rsslGetChannelStats call.
 * @see rsslGetChannelStats
@@ -329,6 +351,7 @@ typedef struct {
 typedef struct {
 	RsslMCastStats multicastStats;			/*!< @brief  When using a multicast connection type, this will be populated with information about the multicast protocol. */
 	RsslTCPStats tcpStats;					/*!< @brief  When using a multicast connection type, this will be populated with information about the current TCP channel's statistics. */
+	RsslWriteCoalesceStats writeCoalesceStats;	/*!< @brief  When using a socket, encrypted or WebSocket connection type, this will be populated with write coalescing statistics. */
 } RsslChannelStats;
 
 
@@ -454,9 +477,10 @@ RSSL_API RsslInt32 rsslBufferUsage(RsslChannel *chnl,
  */
 typedef struct {
 	RsslBool			tcp_nodelay;			/*!< @brief Only used with connectionType of ::RSSL_CONN_TYPE_SOCKET.  If RSSL_TRUE, disables Nagle's Algorithm. */
+	RsslUInt32			busyPollUsec;			/*!< @brief If non-zero, sets SO_BUSY_POLL on the socket so reads poll the device queue for up to this many microseconds instead of waiting for an interrupt. Linux only; this usually requires CAP_NET_ADMIN, and the connection proceeds without it if the option cannot be set. */
 } RsslTcpOpts;
 
-#define RSSL_INIT_TCP_OPTS { RSSL_FALSE }
+#define RSSL_INIT_TCP_OPTS { RSSL_FALSE, 0 }
 
 typedef enum {
 	RSSL_MCAST_NO_FLAGS				= 0x00, /*!< @brief None. */
@@ -610,12 +634,14 @@ typedef struct {
 														A NULL input will result in the following behavior:<BR>
 															Windows: RSSL will load Windows Root Certificate store.<BR>
 															Linux: Load the default CA Store path based on the OpenSSL library's default behavior. This may be distribution specific, please see vendor documentation for more information */
+	RsslBool			enableKTLS;					/*!< @brief Linux with OpenSSL 3 only. If RSSL_TRUE, asks OpenSSL to hand the TLS send path to the kernel (kTLS) once the handshake completes, so writes go straight to the socket.<BR>
+														If the kernel, OpenSSL library or negotiated cipher does not support kTLS, the connection silently keeps using OpenSSL for encryption. */
 } RsslEncryptionOpts;
 
 #ifdef _WIN32
-#define RSSL_INIT_ENCRYPTION_OPTS { RSSL_ENC_TLSV1_2, RSSL_CONN_TYPE_HTTP, NULL}
+#define RSSL_INIT_ENCRYPTION_OPTS { RSSL_ENC_TLSV1_2, RSSL_CONN_TYPE_HTTP, NULL, RSSL_FALSE }
 #else
-#define RSSL_INIT_ENCRYPTION_OPTS { RSSL_ENC_TLSV1_2, RSSL_CONN_TYPE_SOCKET, NULL}
+#define RSSL_INIT_ENCRYPTION_OPTS { RSSL_ENC_TLSV1_2, RSSL_CONN_TYPE_SOCKET, NULL, RSSL_FALSE }
 #endif
 
 
@@ -747,6 +773,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.busyPollUsec = 0;
 	opts->multicastOpts.flags = RSSL_MCAST_NO_FLAGS;
 	opts->multicastOpts.disconnectOnGaps = RSSL_FALSE;
 	opts->multicastOpts.packetTTL = 5;
@@ -783,6 +810,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 #endif
 	opts->extLineOptions.numConnections = 20;
 	opts->encryptionOpts.openSSLCAStore = NULL;
+	opts->encryptionOpts.enableKTLS = RSSL_FALSE;
 	opts->proxyOpts.proxyHostName = NULL;
 	opts->proxyOpts.proxyPort = NULL;
 	opts->proxyOpts.proxyUserName = NULL;
@@ -937,10 +965,12 @@ typedef struct {
 	char*				cipherSuite;				/*!< Optional OpenSSL formatted cipher suite string.  ETA's default configuration is OWASP's "B" tier recommendations, which are the following:
 														DHE-RSA-AES256-GCM-SHA384:DHE-RSA-AES128-GCM-SHA256:ECDHE-RSA-AES256-GCM-SHA384:ECDHE-RSA-AES128-GCM-SHA256:DHE-RSA-AES256-SHA256:DHE-RSA-AES128-SHA256:ECDHE-RSA-AES256-SHA384:ECDHE-RSA-AES128-SHA256:!aNULL:!eNULL:!LOW:!3DES:!MD5:!EXP:!PSK:!DSS:!RC4:!SEED:!ECDSA:!ADH:!IDEA:!3DES */
 	char*				dhParams;					/*!< Optional Diffie-Hellman parameter file.  If this is not present, RSSL will load it's default DH parameters */
+	RsslBool			enableKTLS;					/*!< @brief Linux with OpenSSL 3 only. If RSSL_TRUE, accepted connections ask OpenSSL to hand the TLS send path to the kernel (kTLS) once the handshake completes. 
+														Connections silently keep using OpenSSL for encryption when kTLS is not available. */
 } RsslBindEncryptionOpts;
 
 
-#define RSSL_INIT_BIND_ENCRYPTION_OPTS { RSSL_ENC_TLSV1_2, NULL, NULL, NULL, NULL}
+#define RSSL_INIT_BIND_ENCRYPTION_OPTS { RSSL_ENC_TLSV1_2, NULL, NULL, NULL, NULL, RSSL_FALSE }
  
 /**
  * @brief RSSL Bind Options used in the rsslBind call.
@@ -1022,6 +1052,7 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.busyPollUsec = 0;
 	opts->sysSendBufSize = 0;
 	opts->sysRecvBufSize = 0;
 	opts->componentVersion = NULL;
@@ -1035,6 +1066,7 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->encryptionOpts.encryptionProtocolFlags = RSSL_ENC_TLSV1_2;
 	opts->encryptionOpts.serverCert = NULL;
 	opts->encryptionOpts.serverPrivateKey = NULL;
+	opts->encryptionOpts.enableKTLS = RSSL_FALSE;
 }
 
 /**
@@ -1371,6 +1403,64 @@ RSSL_API RsslBuffer* rsslReadEx(	RsslChannel *chnl,
 											RsslRet *readRet,
 											RsslError *error);
 
+/**
+ * @brief rsslReadBatch arguments
+ * @see rsslReadBatch
+ */
+typedef struct {
+		RsslBuffer				*msgs;					/*!< Array the read messages are returned in. Set by the application. */
+		RsslUInt32				maxMsgs;				/*!< Number of entries available in msgs. Set by the application. */
+		RsslUInt32				msgCount;				/*!< Returns the number of messages placed in msgs. */
+		RsslUInt32				bytesRead;				/*!< Returns the number of bytes read on this call to rsslReadBatch(). */
+		RsslUInt32				uncompressedBytesRead;	/*!< Returns number of bytes read after decompression. */
+} RsslReadBatchArgs;
+
+/**
+ * @brief RsslReadBatchArgs static initialization
+ */
+#define RSSL_INIT_READ_BATCH_ARGS { 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Clears the RsslReadBatchArgs structure passed in
+ * @param readBatchArgs a pointer to the RsslReadBatchArgs structure to be cleared
+ */
+RTR_C_INLINE void rsslClearReadBatchArgs(RsslReadBatchArgs *readBatchArgs)
+{
+	readBatchArgs->msgs = 0;
+	readBatchArgs->maxMsgs = 0;
+	readBatchArgs->msgCount = 0;
+	readBatchArgs->bytesRead = 0;
+	readBatchArgs->uncompressedBytesRead = 0;
+}
+
+/**
+ * @brief Reads a batch of messages on a given channel
+ *
+ * Typical use:<BR>
+ * rsslReadBatch is called with an array of RsslBuffer and returns as many
+ * messages as are available from the data already read from the channels socketId,
+ * up to maxMsgs. On socket connections, the messages of a packed buffer and all
+ * complete messages received by one read from the network are returned by a single call;
+ * the returned buffers point into the channel's input buffer, so no copy is made.
+ * Other connection types return at most one message per call.
+ * The returned buffers are only good until the next time rsslRead, rsslReadEx or
+ * rsslReadBatch is called on the channel.
+ *
+ * The return value is the same as the readRet of rsslRead: a positive value if there is
+ * more data to read, ::RSSL_RET_SUCCESS, ::RSSL_RET_READ_WOULD_BLOCK, ::RSSL_RET_READ_PING,
+ * ::RSSL_RET_READ_FD_CHANGE or a failure code. Messages may be returned with any of these
+ * values, so msgCount should always be checked.
+ *
+ * @param chnl RSSL Channel to read from
+ * @param readBatchArgs array to return messages in, and various output values from the read
+ * @param error RSSL Error, to be populated in event of an error
+ * @return RsslRet value or RsslReturnCodes value which is the return value of read
+ * @see RsslReturnCodes, rsslRead
+ */
+RSSL_API RsslRet rsslReadBatch(	RsslChannel *chnl,
+											RsslReadBatchArgs *readBatchArgs,
+											RsslError *error);
+
 /**
  *	@}
  */
@@ -1400,6 +1490,31 @@ RSSL_API RsslBuffer* rsslGetBuffer(	RsslChannel *chnl,
 									RsslBool  packedBuffer,
 									RsslError *error);
 
+/**
+ * @brief Retrieves several RsslBuffers of the same size for use
+ *
+ * Typical use: <BR>
+ * This is called by a thread that encodes many messages for the same channel,
+ * to reserve a set of buffers in one call rather than calling rsslGetBuffer for each.
+ * The channel and buffer pool locks are taken once for the whole batch.  The buffers
+ * are used and released exactly as if each had come from rsslGetBuffer.
+ * Fewer buffers than requested may be returned if the channel runs out; in that case
+ * error is populated with the reason the last buffer could not be obtained.
+ *
+ * @param chnl RSSL Channel who requests the buffers
+ * @param size Size of each requested buffer
+ * @param buffers Array of count entries which is populated with the buffers obtained
+ * @param count Number of buffers requested
+ * @param error RSSL Error, to be populated in event of an error
+ * @return The number of buffers placed in buffers, or a negative RsslReturnCodes value on failure
+ * @see rsslGetBuffer, RsslReturnCodes
+ */
+RSSL_API RsslInt32 rsslGetBuffers(	RsslChannel *chnl,
+									RsslUInt32 size,
+									RsslBuffer **buffers,
+									RsslUInt32 count,
+									RsslError *error);
+
 
 /**
  * @brief Releases a RsslBuffer after use
@@ -1589,6 +1704,35 @@ RSSL_API RsslRet rsslWriteEx(RsslChannel *chnl,
 									 RsslWriteOutArgs *writeOutArgs,
 									 RsslError	*error);
 
+/**
+ * @brief Queues a buffer to be written by the next rsslFlush on the channel
+ *
+ * Typical use:<BR>
+ * rsslQueueWrite is used instead of rsslWrite when several threads encode messages
+ * for the same channel while one thread is responsible for flushing it.  The buffer
+ * is appended to a per-channel queue without taking the channel lock; the next call to
+ * rsslFlush on the channel writes all queued buffers, in the order they were queued,
+ * with the priority and flags given here and then flushes them to the network.
+ * Once queued, the buffer belongs to the channel and must not be used or released by
+ * the caller.  If a queued buffer cannot be written because of an error, rsslFlush
+ * releases it and returns the error.
+ *
+ * @note Nothing is written to the channel until rsslFlush is called.
+ *
+ * @param chnl RSSL Channel to write to
+ * @param buffer Buffer obtained from rsslGetBuffer or rsslGetBuffers on this channel
+ * @param rsslPriority Priority to flush the message (high, medium, or low)
+ * @param writeFlags Flags for writing the buffer (RsslWriteFlags)
+ * @param error RSSL Error, to be populated in event of an error
+ * @return RsslRet RSSL return value or RsslReturnCodes value
+ * @see rsslWrite, rsslFlush, RsslReturnCodes, RsslWriteFlags
+ */
+RSSL_API RsslRet rsslQueueWrite(RsslChannel *chnl,
+								 	 RsslBuffer *buffer,
+									 RsslWritePriorities rsslPriority,
+									 RsslUInt8	writeFlags,
+									 RsslError	*error);
+
 
 /**
  * @brief Flushes data waiting to be written on a given channel
@@ -1597,6 +1741,7 @@ RSSL_API RsslRet rsslWriteEx(RsslChannel *chnl,
  * rsslFlush pushes the data in the write buffer out to the network.  
  * This should be called when write returns that there is data to flush.
  * Under certain circumstances, write will automatically flush data.
+ * Any buffers queued with rsslQueueWrite are written before the flush.
  *
  * @param chnl RSSL Channel to attempt flush on
  * @param error RSSL Error, to be populated in event of an error
@@ -0,0 +1,118 @@
+/*|-----------------------------------------------------------------------------
+*|            This source code is provided under the Apache 2.0 license      --
+*|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+*|                See the project's LICENSE.md for details.                  --
+*|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+*|-----------------------------------------------------------------------------
+*/
+
+/**
+* @addtogroup RSSLLatencyTrace
+* @{
+*/
+
+/* Opt-in per-message latency tracing.  When enabled, each message read from a channel is given
+ * an identifier on the reading thread and stamped as it passes the transport, the reactor, the
+ * watchlist and the application callback.  Samples are kept in a ring per thread and are collected
+ * with rsslLatencyTraceDrain.  All times are taken from the system realtime clock so they can be
+ * compared with the receive timestamps reported by the kernel or the network card. */
+
+#ifndef _RSSL_LATENCY_TRACE_H
+#define _RSSL_LATENCY_TRACE_H
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslRetCodes.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @brief Points at which a message is stamped, in the order a message normally passes them
+ */
+typedef enum {
+	RSSL_LT_SOCKET_RECV			= 0,	/*!< Data carrying the message was received by the kernel or network card (Linux SO_TIMESTAMPING) */
+	RSSL_LT_DECOMPRESS			= 1,	/*!< Compressed data carrying the message was decompressed */
+	RSSL_LT_TRANSPORT_READ		= 2,	/*!< The message was returned from rsslRead or rsslReadEx; all messages returned by one rsslReadBatch call are traced as one */
+	RSSL_LT_REACTOR_EVENT		= 3,	/*!< The reactor started processing the message */
+	RSSL_LT_WATCHLIST_FANOUT	= 4,	/*!< The watchlist delivered the message to one of its streams */
+	RSSL_LT_USER_CALLBACK		= 5,	/*!< The application's message callback is about to be called */
+	RSSL_LT_STAGE_COUNT			= 6		/*!< Number of stages */
+} RsslLatencyTraceStages;
+
+/**
+ * @brief A single stamp of a message at one stage
+ */
+typedef struct {
+	RsslUInt64	msgId;			/*!< Identifies the message; unique within the thread that read it */
+	RsslUInt64	timeNsec;		/*!< Realtime clock, in nanoseconds since the epoch */
+	RsslUInt32	threadIndex;	/*!< Identifies the thread that recorded the sample */
+	RsslUInt8	stage;			/*!< RsslLatencyTraceStages value */
+} RsslLatencyTraceSample;
+
+/**
+ * @brief Options for rsslLatencyTraceEnable
+ */
+typedef struct {
+	RsslUInt32	ringSize;			/*!< Number of samples each thread can hold between drains; rounded up to a power of two */
+	RsslBool	socketTimestamps;	/*!< Request kernel and hardware receive timestamps on socket channels connected or accepted after this call (Linux only) */
+} RsslLatencyTraceOpts;
+
+#define RSSL_INIT_LATENCY_TRACE_OPTS { 65536, RSSL_FALSE }
+
+/**
+ * @brief Clears an RsslLatencyTraceOpts
+ */
+RTR_C_INLINE void rsslClearLatencyTraceOpts(RsslLatencyTraceOpts *pOpts)
+{
+	pOpts->ringSize = 65536;
+	pOpts->socketTimestamps = RSSL_FALSE;
+}
+
+/**
+ * @brief Turns on latency tracing for the process
+ *
+ * A ring of ringSize samples is created for each thread the first time it records a sample and is
+ * kept until the process exits.  When a ring is full, further samples on that thread are dropped
+ * and counted until the ring is drained.
+ * @param pOpts tracing options
+ * @return RSSL_RET_SUCCESS, or RSSL_RET_INVALID_ARGUMENT if pOpts is NULL
+ */
+RSSL_API RsslRet rsslLatencyTraceEnable(RsslLatencyTraceOpts *pOpts);
+
+/**
+ * @brief Turns off latency tracing.  Samples already recorded can still be drained.
+ */
+RSSL_API void rsslLatencyTraceDisable();
+
+/**
+ * @brief Stamps the message the calling thread is currently processing at the given stage.
+ * Does nothing if tracing is off or no message has been read on this thread.
+ */
+RSSL_API void rsslLatencyTraceStamp(RsslLatencyTraceStages stage);
+
+/**
+ * @brief Moves recorded samples from every thread's ring into pSamples
+ *
+ * Can be called from any thread, but only one thread should drain at a time.  Samples of one thread
+ * are returned in the order they were recorded.
+ * @param pSamples array to fill
+ * @param maxSamples size of pSamples
+ * @return number of samples placed in pSamples
+ */
+RSSL_API RsslUInt32 rsslLatencyTraceDrain(RsslLatencyTraceSample *pSamples, RsslUInt32 maxSamples);
+
+/**
+ * @brief Returns the number of samples dropped so far because a ring was full
+ */
+RSSL_API RsslUInt64 rsslLatencyTraceDroppedCount();
+
+#if defined(__cplusplus)
+}
+#endif
+
+/**
+ *	@}
+ */
+
+#endif
@@ -39,6 +39,19 @@ typedef struct
 
 #define RSSL_THREAD_KILL(__pThreadId) TerminateThread((__pThreadId)->handle, 0)
 
+/* Binds the calling thread to a single CPU core. Returns 0 on success, -1 on failure. */
+#define RSSL_THREAD_BIND_CURRENT(__cpuId) \
+	( \
+		(SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << (__cpuId)) != 0) ? 0 : -1 \
+	)
+
+/* Binds a started thread to a single CPU core. Returns 0 on success, -1 on failure. */
+#define RSSL_THREAD_BIND(__pThreadId, __cpuId) \
+	( \
+		((__cpuId) >= 0 && (__cpuId) < (int)(sizeof(DWORD_PTR) * 8) \
+			&& SetThreadAffinityMask((__pThreadId)->handle, (DWORD_PTR)1 << (__cpuId)) != 0) ? 0 : -1 \
+	)
+
 typedef CRITICAL_SECTION RsslMutex;
 #define RSSL_MUTEX_INIT(__pMutex) (InitializeCriticalSection(__pMutex), 0)
 #define RSSL_MUTEX_INIT_RTSDK(__pMutex) (InitializeCriticalSectionAndSpinCount((__pMutex), 512), 0)
@@ -76,6 +89,31 @@ typedef pthread_t RsslThreadId;
 #define RSSL_THREAD_JOIN(__threadId) pthread_join((__threadId), NULL)
 #define RSSL_THREAD_KILL(__pThreadId) pthread_cancel(*(__pThreadId))
 
+#ifdef CPU_SET /* Requires _GNU_SOURCE */
+/* Binds the calling thread to a single CPU core. Returns 0 on success, -1 on failure. */
+RTR_C_INLINE int RSSL_THREAD_BIND_CURRENT(int cpuId)
+{
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(cpuId, &cpuSet);
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0 ? 0 : -1;
+}
+
+/* Binds a started thread to a single CPU core. Returns 0 on success, -1 on failure. */
+RTR_C_INLINE int RSSL_THREAD_BIND(RsslThreadId *pThreadId, int cpuId)
+{
+	cpu_set_t cpuSet;
+	if (cpuId < 0 || cpuId >= CPU_SETSIZE)
+		return -1;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(cpuId, &cpuSet);
+	return pthread_setaffinity_np(*pThreadId, sizeof(cpu_set_t), &cpuSet) == 0 ? 0 : -1;
+}
+#else
+#define RSSL_THREAD_BIND_CURRENT(__cpuId) (-1)
+#define RSSL_THREAD_BIND(__pThreadId, __cpuId) (-1)
+#endif
+
 typedef pthread_mutex_t RsslMutex;
 RTR_C_INLINE int RSSL_MUTEX_INIT(RsslMutex *pMutex)
 {
@@ -232,8 +232,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 	if (pReactorWorker->pQueueNotifierEvent)
 		rsslDestroyNotifierEvent(pReactorWorker->pQueueNotifierEvent);
 
-	if (pReactorImpl->memoryBuffer.data)
-		free(pReactorImpl->memoryBuffer.data);
+	rsslDispatchArenaCleanup(&pReactorImpl->dispatchArena);
 
 	RSSL_MUTEX_DESTROY(&pReactorImpl->interfaceLock);
 
@@ -0,0 +1,199 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+
+/* Tests the precompiled field list templates of the perf tools (Applications/PerfTools/Common).
+ * Run from a directory holding MsgData.xml, RDMFieldDictionary and enumtype.def; the build
+ * copies them next to the test. */
+#include "xmlMsgDataParser.h"	/* Before marketPriceEncoder.h, which includes it, and so libxml, inside extern "C". */
+#include "fieldListTemplate.h"
+#include "marketPriceEncoder.h"
+
+#include <string.h>
+#include <vector>
+
+using namespace std;
+
+static char msgDataFileName[] = "MsgData.xml";
+
+/* Timestamps whose encoded width differs from the one-byte placeholder compiled into the latency templates. */
+static const RsslUInt latencyTimes[] = { 1, 0xFF, 0x1234, 0x123456, 0x12345678, 0x123456789AULL, 0x0005A3C1D2E3F4A5ULL, 0xFFFFFFFFFFFFFFFFULL };
+
+static void encodeDataBody(MarketPriceMsg *pMpMsg, RsslMsgClasses msgClass, RsslUInt encodeStartTime, vector<char> &out)
+{
+	RsslEncodeIterator eIter;
+	RsslBuffer buffer;
+	char data[65536];
+
+	buffer.data = data;
+	buffer.length = sizeof(data);
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, encodeMarketPriceDataBody(&eIter, pMpMsg, msgClass, encodeStartTime));
+	out.assign(data, data + rsslGetEncodedBufferLength(&eIter));
+}
+
+/* Encodes the message through its templates, then again with the templates removed so that
+ * encodeMarketPriceDataBody() falls back to the field-by-field encoder, and compares the bytes. */
+static void compareTemplateAndFieldEncoding(MarketPriceMsg *pMpMsg, RsslMsgClasses msgClass, RsslUInt encodeStartTime)
+{
+	FieldListTemplate dataTemplate = pMpMsg->dataTemplate, latencyTemplate = pMpMsg->latencyTemplate;
+	vector<char> templateEncoding, fieldEncoding;
+
+	ASSERT_TRUE(dataTemplate.encodedList.data != NULL);
+	if (msgClass != RSSL_MC_REFRESH)
+	{
+		ASSERT_TRUE(latencyTemplate.encodedList.data != NULL);
+	}
+
+	encodeDataBody(pMpMsg, msgClass, encodeStartTime, templateEncoding);
+
+	clearFieldListTemplate(&pMpMsg->dataTemplate);
+	clearFieldListTemplate(&pMpMsg->latencyTemplate);
+	encodeDataBody(pMpMsg, msgClass, encodeStartTime, fieldEncoding);
+	pMpMsg->dataTemplate = dataTemplate;
+	pMpMsg->latencyTemplate = latencyTemplate;
+
+	EXPECT_TRUE(templateEncoding == fieldEncoding) << "msgClass " << (int)msgClass << ", encodeStartTime " << encodeStartTime;
+}
+
+static void compareMsgList(MarketPriceMsg *pMpMsgs, RsslInt32 count, RsslMsgClasses msgClass)
+{
+	for (RsslInt32 i = 0; i < count; ++i)
+	{
+		compareTemplateAndFieldEncoding(&pMpMsgs[i], msgClass, 0);
+		for (size_t j = 0; j < sizeof(latencyTimes) / sizeof(RsslUInt); ++j)
+			compareTemplateAndFieldEncoding(&pMpMsgs[i], msgClass, latencyTimes[j]);
+	}
+}
+
+static void compareMsgData(RsslBool useGlobalSetDefs)
+{
+	ASSERT_EQ(RSSL_RET_SUCCESS, xmlMsgDataInit(msgDataFileName, useGlobalSetDefs));
+	ASSERT_TRUE(xmlMsgDataHasMarketPrice);
+	ASSERT_GT(xmlMarketPriceMsgs.updateMsgCount, 0);
+
+	compareTemplateAndFieldEncoding(&xmlMarketPriceMsgs.refreshMsg, RSSL_MC_REFRESH, 0);
+	compareMsgList(xmlMarketPriceMsgs.updateMsgs, xmlMarketPriceMsgs.updateMsgCount, RSSL_MC_UPDATE);
+	compareMsgList(xmlMarketPriceMsgs.postMsgs, xmlMarketPriceMsgs.postMsgCount, RSSL_MC_POST);
+	compareMsgList(xmlMarketPriceMsgs.genMsgs, xmlMarketPriceMsgs.genMsgCount, RSSL_MC_GENERIC);
+
+	xmlMsgDataCleanup();
+}
+
+TEST(FieldListTemplateTest, MsgDataMatchesFieldEncoding)
+{
+	compareMsgData(RSSL_FALSE);
+}
+
+TEST(FieldListTemplateTest, MsgDataWithGlobalSetDefsMatchesFieldEncoding)
+{
+	compareMsgData(RSSL_TRUE);
+}
+
+/* Encodes a field list of a UINT, a REAL and a DATE, with the given REAL value or a blank. */
+static void encodeFieldList(RsslReal *pReal, vector<char> &out)
+{
+	RsslEncodeIterator eIter;
+	RsslBuffer buffer;
+	RsslFieldList fList;
+	RsslFieldEntry fEntry;
+	RsslUInt uintValue = 12;
+	RsslDate dateValue = { 19, 10, 2020 };
+	char data[256];
+
+	buffer.data = data;
+	buffer.length = sizeof(data);
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+
+	rsslClearFieldList(&fList);
+	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListInit(&eIter, &fList, 0, 0));
+
+	rsslClearFieldEntry(&fEntry);
+	fEntry.fieldId = 1;
+	fEntry.dataType = RSSL_DT_UINT;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(&eIter, &fEntry, &uintValue));
+
+	fEntry.fieldId = 22;
+	fEntry.dataType = RSSL_DT_REAL;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(&eIter, &fEntry, pReal));
+
+	fEntry.fieldId = 16;
+	fEntry.dataType = RSSL_DT_DATE;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(&eIter, &fEntry, &dateValue));
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListComplete(&eIter, RSSL_TRUE));
+	out.assign(data, data + rsslGetEncodedBufferLength(&eIter));
+}
+
+static RsslRet encodeTemplate(FieldListTemplate *pTemplate, RsslReal *pReal, RsslUInt32 bufferLength, vector<char> &out)
+{
+	RsslEncodeIterator eIter;
+	RsslBuffer buffer;
+	FieldListTemplatePatch patch;
+	char data[256];
+	RsslRet ret;
+
+	buffer.data = data;
+	buffer.length = bufferLength;
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+
+	patch.entryIndex = 1;
+	patch.dataType = RSSL_DT_REAL;
+	patch.pValue = pReal;
+
+	if ((ret = fieldListTemplateEncode(&eIter, pTemplate, &patch, 1)) == RSSL_RET_SUCCESS)
+		out.assign(data, data + rsslGetEncodedBufferLength(&eIter));
+	return ret;
+}
+
+TEST(FieldListTemplateTest, PatchedValueChangesWidth)
+{
+	FieldListTemplate fieldListTemplate;
+	RsslReal compiledReal, realValues[3];
+	RsslBuffer encodedList;
+	vector<char> compiled, templateEncoding, fieldEncoding;
+
+	/* Compile from a two-byte REAL in the middle of the list. */
+	rsslClearReal(&compiledReal);
+	compiledReal.hint = RSSL_RH_EXPONENT_2;
+	compiledReal.value = 5;
+	encodeFieldList(&compiledReal, compiled);
+
+	encodedList.data = &compiled[0];
+	encodedList.length = (RsslUInt32)compiled.size();
+	ASSERT_EQ(RSSL_RET_SUCCESS, fieldListTemplateCompile(&fieldListTemplate, &encodedList, NULL));
+	ASSERT_EQ(3, fieldListTemplate.entryCount);
+
+	/* A wider value, a value of the same width and a narrower, blank one. The entries after
+	 * the patched one must move with it. */
+	rsslClearReal(&realValues[0]);
+	realValues[0].hint = RSSL_RH_EXPONENT_4;
+	realValues[0].value = 123456789012LL;
+	rsslClearReal(&realValues[1]);
+	realValues[1].hint = RSSL_RH_EXPONENT_2;
+	realValues[1].value = 7;
+	rsslBlankReal(&realValues[2]);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		encodeFieldList(&realValues[i], fieldEncoding);
+		ASSERT_EQ(RSSL_RET_SUCCESS, encodeTemplate(&fieldListTemplate, &realValues[i], 256, templateEncoding));
+		EXPECT_TRUE(templateEncoding == fieldEncoding) << "value " << i;
+	}
+
+	/* A buffer that fits the compiled list but not the widened one is reported as too small. */
+	EXPECT_EQ(RSSL_RET_BUFFER_TOO_SMALL, encodeTemplate(&fieldListTemplate, &realValues[0], (RsslUInt32)compiled.size(), templateEncoding));
+
+	fieldListTemplateCleanup(&fieldListTemplate);
+}
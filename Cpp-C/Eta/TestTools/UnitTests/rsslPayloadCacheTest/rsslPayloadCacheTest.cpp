@@ -0,0 +1,747 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+
+/* Tests the in-tree payload cache (Impl/Cache). */
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMsgDecoders.h"
+#include "rtr/rsslMsgEncoders.h"
+#include "rtr/rsslThread.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static const char dictionaryFileName[] = "payloadCacheTestDictionary.txt";
+
+static const char dictionaryText[] =
+	"!tag Filename  RWF.DAT\n"
+	"!tag Desc      Payload cache test dictionary\n"
+	"!tag Type      1\n"
+	"!tag Version   4.20.15\n"
+	"!tag Build     001\n"
+	"!tag Date      14-Jan-2015\n"
+	"DSPLY_NAME \"DISPLAY NAME\" 3 NULL ALPHANUMERIC 16 RMTES_STRING 16\n"
+	"BID \"BID\" 22 NULL PRICE 17 REAL64 7\n"
+	"ASK \"ASK\" 25 NULL PRICE 17 REAL64 7\n"
+	"NEWS \"NEWS\" 28 NULL ALPHANUMERIC 4 ASCII_STRING 4\n"
+	"LONG_TEXT \"LONG TEXT\" 1000 NULL ALPHANUMERIC 80 ASCII_STRING 80\n"
+	"ORDER_PRC \"ORDER PRICE\" 3427 NULL PRICE 17 REAL64 7\n"
+	"ORDER_SIZE \"ORDER SIZE\" 3428 NULL PRICE 17 REAL64 7\n";
+
+/* A field to encode: a real, a string, or blank. */
+typedef struct
+{
+	RsslFieldId		fieldId;
+	RsslDataType	dataType;
+	RsslInt			realValue;
+	const char		*stringValue;
+} TestField;
+
+typedef struct
+{
+	RsslMapEntryActions	action;
+	const char			*key;
+	const TestField		*fields;
+	int					fieldCount;
+} TestMapEntry;
+
+class PayloadCacheTest : public ::testing::Test
+{
+protected:
+
+	RsslDataDictionary dictionary;
+	RsslPayloadCacheHandle cache;
+	RsslCacheError error;
+	char msgMemory[65536];
+	char retrieveMemory[65536];
+
+	virtual void SetUp()
+	{
+		RsslPayloadCacheConfigOptions config;
+		char errorMemory[256];
+		RsslBuffer errorText = { sizeof(errorMemory), errorMemory };
+		FILE *pFile;
+
+		ASSERT_TRUE((pFile = fopen(dictionaryFileName, "w")) != NULL);
+		fputs(dictionaryText, pFile);
+		fclose(pFile);
+
+		rsslClearDataDictionary(&dictionary);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslLoadFieldDictionary(dictionaryFileName, &dictionary, &errorText));
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheInitialize());
+		config.maxItems = 0;
+		ASSERT_TRUE((cache = rsslPayloadCacheCreate(&config, &error)) != NULL);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetDictionary(cache, &dictionary, "testDictionary", &error));
+	}
+
+	virtual void TearDown()
+	{
+		rsslPayloadCacheDestroy(cache);
+		rsslPayloadCacheUninitialize();
+		rsslDeleteDataDictionary(&dictionary);
+		remove(dictionaryFileName);
+	}
+
+	static void encodeFields(RsslEncodeIterator *pIter, const TestField *fields, int fieldCount)
+	{
+		RsslFieldList fieldList;
+		RsslFieldEntry fieldEntry;
+		int i;
+
+		rsslClearFieldList(&fieldList);
+		fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0));
+
+		for (i = 0; i < fieldCount; ++i)
+		{
+			rsslClearFieldEntry(&fieldEntry);
+			fieldEntry.fieldId = fields[i].fieldId;
+			fieldEntry.dataType = fields[i].dataType;
+
+			if (fields[i].dataType == RSSL_DT_REAL)
+			{
+				RsslReal real;
+				rsslClearReal(&real);
+				real.hint = RSSL_RH_EXPONENT_2;
+				real.value = fields[i].realValue;
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, &real));
+			}
+			else if (fields[i].stringValue)
+			{
+				RsslBuffer buffer;
+				buffer.data = (char*)fields[i].stringValue;
+				buffer.length = (RsslUInt32)strlen(fields[i].stringValue);
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, &buffer));
+			}
+			else
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, NULL));
+		}
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListComplete(pIter, RSSL_TRUE));
+	}
+
+	static void encodeMsgInit(RsslEncodeIterator *pIter, RsslBuffer *pBuffer, RsslMsg *pMsg, RsslUInt8 msgClass,
+			RsslContainerType containerType, RsslBool clearCache)
+	{
+		rsslClearMsg(pMsg);
+		pMsg->msgBase.msgClass = msgClass;
+		pMsg->msgBase.streamId = 5;
+		pMsg->msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		pMsg->msgBase.containerType = containerType;
+		if (msgClass == RSSL_MC_REFRESH)
+		{
+			pMsg->refreshMsg.flags = RSSL_RFMF_REFRESH_COMPLETE | (clearCache ? RSSL_RFMF_CLEAR_CACHE : 0);
+			pMsg->refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+			pMsg->refreshMsg.state.dataState = RSSL_DATA_OK;
+		}
+
+		rsslClearEncodeIterator(pIter);
+		rsslSetEncodeIteratorBuffer(pIter, pBuffer);
+		ASSERT_EQ(RSSL_RET_ENCODE_CONTAINER, rsslEncodeMsgInit(pIter, pMsg, 0));
+	}
+
+	void encodeFieldListMsg(RsslBuffer *pBuffer, RsslUInt8 msgClass, RsslBool clearCache,
+			const TestField *fields, int fieldCount)
+	{
+		RsslEncodeIterator eIter;
+		RsslMsg msg;
+
+		pBuffer->data = msgMemory;
+		pBuffer->length = sizeof(msgMemory);
+		encodeMsgInit(&eIter, pBuffer, &msg, msgClass, RSSL_DT_FIELD_LIST, clearCache);
+		encodeFields(&eIter, fields, fieldCount);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMsgComplete(&eIter, RSSL_TRUE));
+		pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+	}
+
+	void encodeMapMsg(RsslBuffer *pBuffer, RsslUInt8 msgClass, const TestField *summaryFields, int summaryCount,
+			const TestMapEntry *entries, int entryCount)
+	{
+		RsslEncodeIterator eIter;
+		RsslMsg msg;
+		RsslMap map;
+		RsslMapEntry mapEntry;
+		int i;
+
+		pBuffer->data = msgMemory;
+		pBuffer->length = sizeof(msgMemory);
+		encodeMsgInit(&eIter, pBuffer, &msg, msgClass, RSSL_DT_MAP, RSSL_FALSE);
+
+		rsslClearMap(&map);
+		map.keyPrimitiveType = RSSL_DT_BUFFER;
+		map.containerType = RSSL_DT_FIELD_LIST;
+		if (summaryFields)
+		{
+			map.flags |= RSSL_MPF_HAS_SUMMARY_DATA;
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapInit(&eIter, &map, 0, 0));
+			encodeFields(&eIter, summaryFields, summaryCount);
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapSummaryDataComplete(&eIter, RSSL_TRUE));
+		}
+		else
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapInit(&eIter, &map, 0, 0));
+
+		for (i = 0; i < entryCount; ++i)
+		{
+			RsslBuffer key;
+
+			key.data = (char*)entries[i].key;
+			key.length = (RsslUInt32)strlen(entries[i].key);
+			rsslClearMapEntry(&mapEntry);
+			mapEntry.action = entries[i].action;
+
+			if (entries[i].action == RSSL_MPEA_DELETE_ENTRY)
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntry(&eIter, &mapEntry, &key));
+			else
+			{
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntryInit(&eIter, &mapEntry, &key, 0));
+				encodeFields(&eIter, entries[i].fields, entries[i].fieldCount);
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntryComplete(&eIter, RSSL_TRUE));
+			}
+		}
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapComplete(&eIter, RSSL_TRUE));
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMsgComplete(&eIter, RSSL_TRUE));
+		pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+	}
+
+	RsslRet apply(RsslPayloadEntryHandle entry, RsslBuffer *pBuffer)
+	{
+		RsslDecodeIterator dIter;
+		RsslMsg msg;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslDecodeMsg(&dIter, &msg));
+		return rsslPayloadEntryApply(entry, &dIter, &msg, &error);
+	}
+
+	RsslRet retrieve(RsslPayloadEntryHandle entry, RsslUInt32 bufferSize, RsslPayloadCursorHandle cursor, RsslBuffer *pBuffer)
+	{
+		RsslEncodeIterator eIter;
+		RsslRet ret;
+
+		pBuffer->data = retrieveMemory;
+		pBuffer->length = bufferSize;
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+
+		if ((ret = rsslPayloadEntryRetrieve(entry, &eIter, cursor, &error)) == RSSL_RET_SUCCESS)
+			pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+		return ret;
+	}
+
+	/* Finds a field in the field list the iterator is positioned at. Returns RSSL_FALSE if it is not there. */
+	static RsslBool findField(RsslDecodeIterator *pIter, RsslFieldId fieldId, RsslBuffer *pEncData)
+	{
+		RsslFieldList fieldList;
+		RsslFieldEntry fieldEntry;
+		RsslBool found = RSSL_FALSE;
+		RsslRet ret;
+
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslDecodeFieldList(pIter, &fieldList, NULL));
+		while ((ret = rsslDecodeFieldEntry(pIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			EXPECT_EQ(RSSL_RET_SUCCESS, ret);
+			if (fieldEntry.fieldId == fieldId)
+			{
+				*pEncData = fieldEntry.encData;
+				found = RSSL_TRUE;
+			}
+		}
+
+		return found;
+	}
+
+	static RsslBool findField(RsslBuffer *pFieldList, RsslFieldId fieldId, RsslBuffer *pEncData)
+	{
+		RsslDecodeIterator dIter;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, pFieldList);
+		return findField(&dIter, fieldId, pEncData);
+	}
+
+	static RsslInt realValue(RsslBuffer *pEncData)
+	{
+		RsslDecodeIterator dIter;
+		RsslReal real;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, pEncData);
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslDecodeReal(&dIter, &real));
+		return real.value;
+	}
+};
+
+TEST_F(PayloadCacheTest, FieldListRefreshAndRetrieve)
+{
+	TestField refreshFields[] =
+	{
+		{ 22, RSSL_DT_REAL, 1234, NULL },
+		{ 25, RSSL_DT_REAL, 1235, NULL },
+		{ 3, RSSL_DT_RMTES_STRING, 0, "A DISPLAY NAME LONGER THAN ITS SLOT" },
+		{ 28, RSSL_DT_ASCII_STRING, 0, NULL }
+	};
+	RsslPayloadEntryHandle entry;
+	RsslBuffer buffer, encData;
+
+	ASSERT_TRUE((entry = rsslPayloadEntryCreate(cache, &error)) != NULL);
+	ASSERT_EQ(RSSL_DT_UNKNOWN, rsslPayloadEntryGetDataType(entry));
+	ASSERT_EQ(1u, rsslPayloadCacheGetEntryCount(cache));
+
+	encodeFieldListMsg(&buffer, RSSL_MC_REFRESH, RSSL_TRUE, refreshFields, 4);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+	ASSERT_EQ(RSSL_DT_FIELD_LIST, rsslPayloadEntryGetDataType(entry));
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, sizeof(retrieveMemory), NULL, &buffer));
+
+	ASSERT_TRUE(findField(&buffer, 22, &encData));
+	ASSERT_EQ(1234, realValue(&encData));
+	ASSERT_TRUE(findField(&buffer, 25, &encData));
+	ASSERT_EQ(1235, realValue(&encData));
+	ASSERT_TRUE(findField(&buffer, 3, &encData));
+	ASSERT_EQ(strlen(refreshFields[2].stringValue), encData.length);
+	ASSERT_EQ(0, memcmp(refreshFields[2].stringValue, encData.data, encData.length));
+	ASSERT_TRUE(findField(&buffer, 28, &encData));
+	ASSERT_EQ(0u, encData.length);
+
+	/* Too small for the field list. */
+	ASSERT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(entry, 10, NULL, &buffer));
+
+	rsslPayloadEntryClear(entry);
+	ASSERT_EQ(RSSL_DT_UNKNOWN, rsslPayloadEntryGetDataType(entry));
+
+	rsslPayloadEntryDestroy(entry);
+	ASSERT_EQ(0u, rsslPayloadCacheGetEntryCount(cache));
+}
+
+TEST_F(PayloadCacheTest, FieldListUpdate)
+{
+	TestField refreshFields[] =
+	{
+		{ 22, RSSL_DT_REAL, 1234, NULL },
+		{ 1000, RSSL_DT_ASCII_STRING, 0, "short" }
+	};
+	TestField updateFields[] =
+	{
+		{ 22, RSSL_DT_REAL, 1300, NULL },
+		{ 25, RSSL_DT_REAL, 1301, NULL }
+	};
+	RsslPayloadEntryHandle entry;
+	RsslBuffer buffer, encData;
+
+	ASSERT_TRUE((entry = rsslPayloadEntryCreate(cache, &error)) != NULL);
+
+	encodeFieldListMsg(&buffer, RSSL_MC_REFRESH, RSSL_TRUE, refreshFields, 2);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+
+	/* Field 25 was not in the refresh; the update to it is a warning. */
+	encodeFieldListMsg(&buffer, RSSL_MC_UPDATE, RSSL_FALSE, updateFields, 2);
+	ASSERT_GT(RSSL_RET_SUCCESS, apply(entry, &buffer));
+	ASSERT_EQ(RSSL_RET_SUCCESS, error.rsslErrorId);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, sizeof(retrieveMemory), NULL, &buffer));
+	ASSERT_TRUE(findField(&buffer, 22, &encData));
+	ASSERT_EQ(1300, realValue(&encData));
+	ASSERT_FALSE(findField(&buffer, 25, &encData));
+
+	/* A refresh without clear-cache adds fields. */
+	encodeFieldListMsg(&buffer, RSSL_MC_REFRESH, RSSL_FALSE, updateFields, 2);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, sizeof(retrieveMemory), NULL, &buffer));
+	ASSERT_TRUE(findField(&buffer, 25, &encData));
+	ASSERT_EQ(1301, realValue(&encData));
+	ASSERT_TRUE(findField(&buffer, 1000, &encData));
+
+	/* A clear-cache refresh replaces them. */
+	encodeFieldListMsg(&buffer, RSSL_MC_REFRESH, RSSL_TRUE, updateFields, 1);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, sizeof(retrieveMemory), NULL, &buffer));
+	ASSERT_TRUE(findField(&buffer, 22, &encData));
+	ASSERT_FALSE(findField(&buffer, 1000, &encData));
+
+	rsslPayloadEntryDestroy(entry);
+}
+
+TEST_F(PayloadCacheTest, FieldNotInDictionary)
+{
+	TestField refreshFields[] =
+	{
+		{ 22, RSSL_DT_REAL, 1234, NULL },
+		{ 9999, RSSL_DT_REAL, 1, NULL }
+	};
+	RsslPayloadEntryHandle entry;
+	RsslBuffer buffer, encData;
+
+	ASSERT_TRUE((entry = rsslPayloadEntryCreate(cache, &error)) != NULL);
+
+	encodeFieldListMsg(&buffer, RSSL_MC_REFRESH, RSSL_TRUE, refreshFields, 2);
+	ASSERT_GT(RSSL_RET_SUCCESS, apply(entry, &buffer));
+	ASSERT_EQ(RSSL_RET_SUCCESS, error.rsslErrorId);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, sizeof(retrieveMemory), NULL, &buffer));
+	ASSERT_TRUE(findField(&buffer, 22, &encData));
+	ASSERT_FALSE(findField(&buffer, 9999, &encData));
+
+	rsslPayloadEntryDestroy(entry);
+}
+
+TEST_F(PayloadCacheTest, FieldValueGrowth)
+{
+	char text[200];
+	TestField fields[] = { { 1000, RSSL_DT_ASCII_STRING, 0, text } };
+	RsslPayloadEntryHandle entry;
+	RsslBuffer buffer, encData;
+	int i;
+
+	ASSERT_TRUE((entry = rsslPayloadEntryCreate(cache, &error)) != NULL);
+
+	memset(text, 0, sizeof(text));
+	memset(text, 'a', 10);
+	encodeFieldListMsg(&buffer, RSSL_MC_REFRESH, RSSL_TRUE, fields, 1);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+
+	/* Values longer than the dictionary length move the field to new arena space; the old space
+	 * is reclaimed when the arena is compacted. */
+	for (i = 0; i < 2000; ++i)
+	{
+		int length = 10 + (i % 190);
+
+		memset(text, 0, sizeof(text));
+		memset(text, 'a' + (i % 26), length);
+		encodeFieldListMsg(&buffer, RSSL_MC_UPDATE, RSSL_FALSE, fields, 1);
+		ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, sizeof(retrieveMemory), NULL, &buffer));
+		ASSERT_TRUE(findField(&buffer, 1000, &encData));
+		ASSERT_EQ((RsslUInt32)length, encData.length);
+		ASSERT_EQ(0, memcmp(text, encData.data, length));
+	}
+
+	rsslPayloadEntryDestroy(entry);
+}
+
+TEST_F(PayloadCacheTest, MapAddUpdateDelete)
+{
+	TestField summaryFields[] = { { 3, RSSL_DT_RMTES_STRING, 0, "BOOK" } };
+	TestField orderFields[] =
+	{
+		{ 3427, RSSL_DT_REAL, 10000, NULL },
+		{ 3428, RSSL_DT_REAL, 500, NULL }
+	};
+	TestField orderUpdateFields[] = { { 3428, RSSL_DT_REAL, 700, NULL } };
+	TestMapEntry refreshEntries[] =
+	{
+		{ RSSL_MPEA_ADD_ENTRY, "ORDER1", orderFields, 2 },
+		{ RSSL_MPEA_ADD_ENTRY, "ORDER2", orderFields, 2 },
+		{ RSSL_MPEA_ADD_ENTRY, "ORDER3", orderFields, 2 }
+	};
+	TestMapEntry updateEntries[] =
+	{
+		{ RSSL_MPEA_UPDATE_ENTRY, "ORDER1", orderUpdateFields, 1 },
+		{ RSSL_MPEA_DELETE_ENTRY, "ORDER2", NULL, 0 },
+		{ RSSL_MPEA_ADD_ENTRY, "ORDER4", orderUpdateFields, 1 }
+	};
+	RsslPayloadEntryHandle entry;
+	RsslBuffer buffer, encData;
+	RsslDecodeIterator dIter;
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslRet ret;
+	int entryCount = 0;
+
+	ASSERT_TRUE((entry = rsslPayloadEntryCreate(cache, &error)) != NULL);
+
+	encodeMapMsg(&buffer, RSSL_MC_REFRESH, summaryFields, 1, refreshEntries, 3);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+	ASSERT_EQ(RSSL_DT_MAP, rsslPayloadEntryGetDataType(entry));
+
+	encodeMapMsg(&buffer, RSSL_MC_UPDATE, NULL, 0, updateEntries, 3);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, sizeof(retrieveMemory), NULL, &buffer));
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeMap(&dIter, &map));
+	ASSERT_TRUE(rsslMapCheckHasSummaryData(&map));
+	ASSERT_TRUE(findField(&map.encSummaryData, 3, &encData));
+	ASSERT_EQ(0, memcmp("BOOK", encData.data, 4));
+
+	while ((ret = rsslDecodeMapEntry(&dIter, &mapEntry, NULL)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+		ASSERT_EQ(RSSL_MPEA_ADD_ENTRY, mapEntry.action);
+
+		if (mapEntry.encKey.length == 6 && memcmp(mapEntry.encKey.data, "ORDER1", 6) == 0)
+		{
+			ASSERT_TRUE(findField(&mapEntry.encData, 3428, &encData));
+			ASSERT_EQ(700, realValue(&encData));
+			ASSERT_TRUE(findField(&mapEntry.encData, 3427, &encData));
+		}
+		else if (mapEntry.encKey.length == 6 && memcmp(mapEntry.encKey.data, "ORDER4", 6) == 0)
+			ASSERT_FALSE(findField(&mapEntry.encData, 3427, &encData));
+		else
+			ASSERT_TRUE(mapEntry.encKey.length == 6 && memcmp(mapEntry.encKey.data, "ORDER3", 6) == 0);
+
+		++entryCount;
+	}
+
+	ASSERT_EQ(3, entryCount);
+
+	rsslPayloadEntryDestroy(entry);
+}
+
+TEST_F(PayloadCacheTest, MapMultiPartRetrieve)
+{
+	TestField orderFields[] =
+	{
+		{ 3427, RSSL_DT_REAL, 10000, NULL },
+		{ 3428, RSSL_DT_REAL, 500, NULL }
+	};
+	TestMapEntry entries[50];
+	char keys[50][16];
+	RsslPayloadEntryHandle entry;
+	RsslPayloadCursorHandle cursor;
+	RsslBuffer buffer;
+	int i, partCount = 0, entryCount = 0;
+
+	for (i = 0; i < 50; ++i)
+	{
+		snprintf(keys[i], sizeof(keys[i]), "ORDER%d", i);
+		entries[i].action = RSSL_MPEA_ADD_ENTRY;
+		entries[i].key = keys[i];
+		entries[i].fields = orderFields;
+		entries[i].fieldCount = 2;
+	}
+
+	ASSERT_TRUE((entry = rsslPayloadEntryCreate(cache, &error)) != NULL);
+	encodeMapMsg(&buffer, RSSL_MC_REFRESH, NULL, 0, entries, 50);
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(entry, &buffer));
+
+	/* Without a cursor, the whole map must fit. */
+	ASSERT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(entry, 200, NULL, &buffer));
+
+	ASSERT_TRUE((cursor = rsslPayloadCursorCreate()) != NULL);
+	rsslPayloadCursorClear(cursor);
+
+	while (!rsslPayloadCursorIsComplete(cursor))
+	{
+		RsslDecodeIterator dIter;
+		RsslMap map;
+		RsslMapEntry mapEntry;
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entry, 200, cursor, &buffer));
+		++partCount;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeMap(&dIter, &map));
+		ASSERT_EQ(partCount == 1, rsslMapCheckHasTotalCountHint(&map) ? true : false);
+
+		while (rsslDecodeMapEntry(&dIter, &mapEntry, NULL) == RSSL_RET_SUCCESS)
+		{
+			ASSERT_EQ(strlen(keys[entryCount]), mapEntry.encKey.length);
+			ASSERT_EQ(0, memcmp(keys[entryCount], mapEntry.encKey.data, mapEntry.encKey.length));
+			++entryCount;
+		}
+	}
+
+	ASSERT_GT(partCount, 1);
+	ASSERT_EQ(50, entryCount);
+
+	/* Too small for even one entry. */
+	rsslPayloadCursorClear(cursor);
+	ASSERT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(entry, 12, cursor, &buffer));
+
+	rsslPayloadCursorDestroy(cursor);
+	rsslPayloadEntryDestroy(entry);
+}
+
+TEST_F(PayloadCacheTest, MaxItemsAndEntryList)
+{
+	RsslPayloadCacheConfigOptions config;
+	RsslPayloadCacheHandle limitedCache;
+	RsslPayloadEntryHandle entries[3];
+
+	config.maxItems = 2;
+	ASSERT_TRUE((limitedCache = rsslPayloadCacheCreate(&config, &error)) != NULL);
+
+	/* No dictionary yet. */
+	ASSERT_TRUE(rsslPayloadEntryCreate(limitedCache, &error) == NULL);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetSharedDictionaryKey(limitedCache, "testDictionary", &error));
+	ASSERT_TRUE((entries[0] = rsslPayloadEntryCreate(limitedCache, &error)) != NULL);
+	ASSERT_TRUE((entries[1] = rsslPayloadEntryCreate(limitedCache, &error)) != NULL);
+	ASSERT_TRUE(rsslPayloadEntryCreate(limitedCache, &error) == NULL);
+
+	ASSERT_EQ(2u, rsslPayloadCacheGetEntryList(limitedCache, entries, 3));
+	ASSERT_EQ(1u, rsslPayloadCacheGetEntryList(limitedCache, entries, 1));
+
+	rsslPayloadCacheClearAll(limitedCache);
+	ASSERT_EQ(0u, rsslPayloadCacheGetEntryCount(limitedCache));
+
+	rsslPayloadCacheDestroy(limitedCache);
+}
+
+TEST_F(PayloadCacheTest, DictionaryKeys)
+{
+	RsslPayloadCacheConfigOptions config;
+	RsslPayloadCacheHandle otherCache;
+	RsslDataDictionary changedDictionary;
+	char errorMemory[256];
+	RsslBuffer errorText = { sizeof(errorMemory), errorMemory };
+	FILE *pFile;
+
+	config.maxItems = 0;
+	ASSERT_TRUE((otherCache = rsslPayloadCacheCreate(&config, &error)) != NULL);
+	ASSERT_NE(RSSL_RET_SUCCESS, rsslPayloadCacheSetSharedDictionaryKey(otherCache, "unknownDictionary", &error));
+
+	/* Extending the dictionary with the same fields succeeds. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetDictionary(cache, &dictionary, "testDictionary", &error));
+
+	/* Changing a field does not. */
+	ASSERT_TRUE((pFile = fopen(dictionaryFileName, "w")) != NULL);
+	fputs("BID \"BID\" 22 NULL PRICE 17 UINT64 8\n", pFile);
+	fclose(pFile);
+	rsslClearDataDictionary(&changedDictionary);
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslLoadFieldDictionary(dictionaryFileName, &changedDictionary, &errorText));
+	ASSERT_NE(RSSL_RET_SUCCESS, rsslPayloadCacheSetDictionary(otherCache, &changedDictionary, "testDictionary", &error));
+	rsslDeleteDataDictionary(&changedDictionary);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetSharedDictionaryKey(otherCache, "testDictionary", &error));
+	rsslPayloadCacheDestroy(otherCache);
+}
+
+/* Applies a message to an entry until told to stop, counting the applies that failed or did not cache BID. */
+typedef struct
+{
+	RsslPayloadEntryHandle	entry;
+	RsslBuffer				msgBuffer;
+	volatile RsslBool		stop;
+	int						applyCount;
+	int						failureCount;
+} ApplyThreadArgs;
+
+static RSSL_THREAD_DECLARE(applyThread, pArg)
+{
+	ApplyThreadArgs *pArgs = (ApplyThreadArgs*)pArg;
+	RsslCacheError applyError;
+	char retrieveMemory[4096];
+
+	while (!pArgs->stop)
+	{
+		RsslDecodeIterator dIter;
+		RsslEncodeIterator eIter;
+		RsslMsg msg;
+		RsslBuffer buffer = { sizeof(retrieveMemory), retrieveMemory };
+		RsslFieldList fieldList;
+		RsslFieldEntry fieldEntry;
+		RsslBool foundBid = RSSL_FALSE;
+
+		/* The apply warns about field 2049 until the extension adding it is published. */
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, &pArgs->msgBuffer);
+		if (rsslDecodeMsg(&dIter, &msg) != RSSL_RET_SUCCESS)
+		{
+			++pArgs->failureCount;
+			continue;
+		}
+		rsslPayloadEntryApply(pArgs->entry, &dIter, &msg, &applyError);
+
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+		if (rsslPayloadEntryRetrieve(pArgs->entry, &eIter, NULL, &applyError) != RSSL_RET_SUCCESS)
+		{
+			++pArgs->failureCount;
+			continue;
+		}
+
+		buffer.length = rsslGetEncodedBufferLength(&eIter);
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+		if (rsslDecodeFieldList(&dIter, &fieldList, NULL) == RSSL_RET_SUCCESS)
+		{
+			while (rsslDecodeFieldEntry(&dIter, &fieldEntry) == RSSL_RET_SUCCESS)
+			{
+				if (fieldEntry.fieldId == 22)
+					foundBid = RSSL_TRUE;
+			}
+		}
+
+		if (!foundBid)
+			++pArgs->failureCount;
+		++pArgs->applyCount;
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+TEST_F(PayloadCacheTest, DictionaryExtendWhileApplying)
+{
+	/* Field 2049 is only in the last extension. */
+	TestField refreshFields[] =
+	{
+		{ 22, RSSL_DT_REAL, 1234, NULL },
+		{ 25, RSSL_DT_REAL, 1235, NULL },
+		{ 2049, RSSL_DT_REAL, 1236, NULL }
+	};
+	RsslPayloadCacheConfigOptions config;
+	RsslPayloadCacheHandle otherCache;
+	RsslDataDictionary extension;
+	ApplyThreadArgs args;
+	RsslThreadId threadId;
+	char errorMemory[256];
+	RsslBuffer errorText = { sizeof(errorMemory), errorMemory };
+	RsslBuffer buffer, encData;
+	RsslFieldId fid;
+	FILE *pFile;
+
+	/* Two caches on one dictionary; one applies entries while the other extends the dictionary. */
+	config.maxItems = 0;
+	ASSERT_TRUE((otherCache = rsslPayloadCacheCreate(&config, &error)) != NULL);
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetSharedDictionaryKey(otherCache, "testDictionary", &error));
+
+	memset(&args, 0, sizeof(args));
+	ASSERT_TRUE((args.entry = rsslPayloadEntryCreate(otherCache, &error)) != NULL);
+	encodeFieldListMsg(&args.msgBuffer, RSSL_MC_REFRESH, RSSL_TRUE, refreshFields, 3);
+
+	ASSERT_EQ(0, RSSL_THREAD_START(&threadId, applyThread, &args));
+
+	/* Each extension raises the highest FID, so each one replaces the field table. */
+	for (fid = 2000; fid < 2050; ++fid)
+	{
+		ASSERT_TRUE((pFile = fopen(dictionaryFileName, "w")) != NULL);
+		fprintf(pFile, "EXTENSION \"EXTENSION\" %d NULL PRICE 17 REAL64 7\n", fid);
+		fclose(pFile);
+
+		rsslClearDataDictionary(&extension);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslLoadFieldDictionary(dictionaryFileName, &extension, &errorText));
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetDictionary(cache, &extension, "testDictionary", &error));
+		rsslDeleteDataDictionary(&extension);
+	}
+
+	args.stop = RSSL_TRUE;
+	RSSL_THREAD_JOIN(threadId);
+
+	EXPECT_GT(args.applyCount, 0);
+	EXPECT_EQ(0, args.failureCount);
+
+	/* The extension is shared, so the other cache now caches the new field. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, apply(args.entry, &args.msgBuffer));
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(args.entry, sizeof(retrieveMemory), NULL, &buffer));
+	ASSERT_TRUE(findField(&buffer, 2049, &encData));
+	ASSERT_EQ(1236, realValue(&encData));
+
+	rsslPayloadCacheDestroy(otherCache);
+}
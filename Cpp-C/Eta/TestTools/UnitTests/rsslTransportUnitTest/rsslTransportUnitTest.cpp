@@ -27,6 +27,7 @@
 #include "rtr/ripcutils.h"
 #include "rtr/rsslEventSignal.h"
 #include "rtr/ripcsslutils.h"
+#include "rtr/rsslLatencyTrace.h"
 
 #include "TransportUnitTest.h"
 
@@ -283,11 +284,13 @@ class ClientChannel
 public:
 	RsslThreadId* pThreadId;		/* Current Thread Id.  Useful for debugging */
 	RsslChannel* pChnl;				/* Channel to be created.  This should be NULL when calling startServerChannel */
+	RsslCompTypes compressionType;	/* Compression type requested by the client */
 
 	ClientChannel()
 	{
 		pThreadId = NULL;
 		pChnl = NULL;
+		compressionType = RSSL_COMP_NONE;
 	}
 
 	/* If blocking is set to RSSL_TRUE, attempt to connect using rsslConnect.  This will either return an active channel or error out.
@@ -307,6 +310,7 @@ public:
 		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
 		connectOpts.tcp_nodelay = true;
 		connectOpts.blocking = blocking;
+		connectOpts.compressionType = compressionType;
 
 		pClientChnl = rsslConnect(&connectOpts, &err);
 
@@ -782,7 +786,7 @@ public:
 };
 
 /* This function starts up the RsslServer. */
-RsslServer* startupServer(RsslBool blocking)
+RsslServer* startupServer(RsslBool blocking, RsslCompTypes compressionType = RSSL_COMP_NONE)
 {
 	RsslError err;
 	RsslBindOptions bindOpts;
@@ -793,6 +797,7 @@ RsslServer* startupServer(RsslBool blocking)
 	bindOpts.protocolType = TEST_PROTOCOL_TYPE;  /* These tests are just sending a pre-set string across the wire, so protocol type should not be RWF */
 	bindOpts.channelsBlocking = blocking;
 	bindOpts.serverBlocking = blocking;
+	bindOpts.compressionType = compressionType;
 
 	server = rsslBind(&bindOpts, &err);
 
@@ -859,6 +864,68 @@ void clearTUConfig(TUServerConfig* serverConfig)
 }
 
 
+/* Encodes messages for a channel that is flushed by another thread.  Buffers are reserved
+	in batches with rsslGetBuffers and handed over with rsslQueueWrite.  Each message carries
+	the writer id and its sequence number so the reader can check ordering per writer. */
+class QueueWriteChannel
+{
+public:
+	RsslThreadId* pThreadId;
+	RsslChannel* pChnl;
+	int writerId;
+	int msgCount;
+
+	QueueWriteChannel()
+	{
+		pThreadId = NULL;
+		pChnl = NULL;
+		writerId = 0;
+		msgCount = MAX_MSG_WRITE_COUNT;
+	}
+
+	void queueWriteLoop()
+	{
+		RsslBuffer* buffers[10];
+		RsslInt32 reserved;
+		RsslRet ret;
+		RsslError err;
+		int writeCount = 0;
+
+		while (!shutdownTest && writeCount < msgCount)
+		{
+			reserved = rsslGetBuffers(pChnl, 64, buffers, sizeof(buffers) / sizeof(RsslBuffer*), &err);
+
+			if (reserved == RSSL_RET_BUFFER_NO_BUFFERS)
+			{
+				/* the flushing thread has not caught up yet */
+				time_sleep(1);
+				continue;
+			}
+			else if (reserved < 0)
+			{
+				failTest = true;
+				ASSERT_TRUE(false) << "rsslGetBuffers failed. Error: " << err.text;
+			}
+
+			for (RsslInt32 i = 0; i < reserved; ++i)
+			{
+				if (writeCount == msgCount)
+				{
+					rsslReleaseBuffer(buffers[i], &err);
+					continue;
+				}
+
+				buffers[i]->length = snprintf(buffers[i]->data, 64, "%d %d", writerId, writeCount++);
+				if ((ret = rsslQueueWrite(pChnl, buffers[i], RSSL_HIGH_PRIORITY, 0, &err)) != RSSL_RET_SUCCESS)
+				{
+					failTest = true;
+					ASSERT_TRUE(false) << "rsslQueueWrite failed. Error: " << err.text;
+				}
+			}
+		}
+	}
+};
+
 /* Google Test requires that all functions that have test usage(i.e. using the ASSERT or EXPECT macros) have a void return type.
 	Since RSSL_THREAD declaration functions require a void* return type, they will need to wrap the actual tested functionality in another function. */
 
@@ -944,6 +1011,12 @@ RSSL_THREAD_DECLARE(blockingManyChannelReadThread, pArg)
 	return 0;
 }
 
+RSSL_THREAD_DECLARE(queueWriteThread, pArg)
+{
+	((QueueWriteChannel*)pArg)->queueWriteLoop();
+	return 0;
+}
+
 class GlobalLockTests : public ::testing::Test {
 protected:
 	RsslChannel* serverChannel;
@@ -981,15 +1054,16 @@ protected:
 		resetDeadlockTimer();
 	}
 
-	void startupServerAndConections(RsslBool blocking)
+	void startupServerAndConections(RsslBool blocking, RsslCompTypes compressionType = RSSL_COMP_NONE)
 	{
 		RsslThreadId serverThread, clientThread;
 		ClientChannel clientOpts;
 		ServerChannel serverChnl;
 		serverChnl.pThreadId = &serverThread;
 		clientOpts.pThreadId = &clientThread;
+		clientOpts.compressionType = compressionType;
 
-		server = startupServer(blocking);
+		server = startupServer(blocking, compressionType);
 		
 		ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
 
@@ -1128,6 +1202,393 @@ TEST_F(GlobalLockTests, BlockingTwoWayClientServer)
 
 }
 
+/*	Test writes numbered messages from the client, alternating between packed and unpacked
+	buffers and including messages large enough to be fragmented, and reads them on the server
+	with rsslReadBatch.  Verifies that every message arrives once, in order, with its content
+	intact, and that a packed buffer is returned by a single call. */
+TEST_F(GlobalLockTests, NonBlockingReadBatch)
+{
+	const int totalMsgs = 10000;
+	const int packedPerBuffer = 10;
+	const RsslUInt32 largeMsgSize = 20000;
+	RsslBuffer msgs[32];
+	RsslReadBatchArgs readBatchArgs;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslRet ret;
+	RsslError err;
+	int written = 0, received = 0;
+	RsslUInt32 largestBatch = 0;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	while (written < totalMsgs)
+	{
+		bool packed = ((written / 100) % 2) == 1;
+		bool large = !packed && (written % 1000 == 7);
+		RsslBuffer* pBuffer = rsslGetBuffer(clientChannel, large ? largeMsgSize : 1000, packed ? RSSL_TRUE : RSSL_FALSE, &err);
+
+		if (pBuffer == NULL)
+		{
+			rsslFlush(clientChannel, &err);
+			continue;
+		}
+
+		if (packed)
+		{
+			for (int i = 0; i < packedPerBuffer && written < totalMsgs; ++i, ++written)
+			{
+				pBuffer->length = snprintf(pBuffer->data, 32, "msg %d", written);
+				pBuffer = rsslPackBuffer(clientChannel, pBuffer, &err);
+				ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslPackBuffer failed. Error info: " << err.text;
+			}
+			pBuffer->length = 0;
+		}
+		else
+		{
+			pBuffer->length = snprintf(pBuffer->data, 32, "msg %d", written++);
+			if (large)
+			{
+				memset(pBuffer->data + pBuffer->length, 'x', largeMsgSize - pBuffer->length);
+				pBuffer->length = largeMsgSize;
+			}
+		}
+
+		ret = rsslWrite(clientChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err);
+		ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_WRITE_CALL_AGAIN) << "rsslWrite failed. Return code:" << ret << " Error info: " << err.text;
+		while (ret > RSSL_RET_SUCCESS || ret == RSSL_RET_WRITE_CALL_AGAIN)
+			ret = rsslFlush(clientChannel, &err);
+
+		if ((written % 500) != 0 && written < totalMsgs)
+			continue;
+
+		/* drain everything written so far */
+		do
+		{
+			rsslClearReadBatchArgs(&readBatchArgs);
+			readBatchArgs.msgs = msgs;
+			readBatchArgs.maxMsgs = sizeof(msgs) / sizeof(RsslBuffer);
+
+			ret = rsslReadBatch(serverChannel, &readBatchArgs, &err);
+			ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING) << "rsslReadBatch failed. Return code:" << ret << " Error info: " << err.text;
+
+			if (readBatchArgs.msgCount > largestBatch)
+				largestBatch = readBatchArgs.msgCount;
+
+			for (RsslUInt32 i = 0; i < readBatchArgs.msgCount; ++i, ++received)
+			{
+				char expected[32];
+				RsslUInt32 expectedLength = snprintf(expected, sizeof(expected), "msg %d", received);
+
+				ASSERT_GE(msgs[i].length, expectedLength);
+				ASSERT_EQ(memcmp(msgs[i].data, expected, expectedLength), 0) << "Expected " << expected;
+				if (msgs[i].length > expectedLength)
+				{
+					EXPECT_EQ(msgs[i].length, largeMsgSize);
+					EXPECT_EQ(msgs[i].data[msgs[i].length - 1], 'x');
+				}
+			}
+		} while (ret > RSSL_RET_SUCCESS || received < written);
+	}
+
+	EXPECT_EQ(received, totalMsgs);
+	EXPECT_GE(largestBatch, (RsslUInt32)packedPerBuffer);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+TEST_F(GlobalLockTests, WriteCoalesceBudget)
+{
+	RsslInt32 budgetUsec = 200000;
+	RsslChannelStats stats;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslUInt64 batchSamples = 0;
+	RsslBuffer* pBuffer;
+	RsslRet ret;
+	RsslError err;
+	int i;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	ASSERT_EQ(rsslIoctl(clientChannel, RSSL_WRITE_COALESCE_BUDGET, &budgetUsec, &err), RSSL_RET_SUCCESS) << "rsslIoctl failed. Error info: " << err.text;
+
+	/* Writes within the budget stay queued */
+	for (i = 0; i < 2; ++i)
+	{
+		pBuffer = rsslGetBuffer(clientChannel, 100, RSSL_FALSE, &err);
+		ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error info: " << err.text;
+		memset(pBuffer->data, 'a', 100);
+		pBuffer->length = 100;
+
+		ret = rsslWrite(clientChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err);
+		ASSERT_GT(ret, RSSL_RET_SUCCESS) << "rsslWrite did not queue the message. Return code:" << ret << " Error info: " << err.text;
+	}
+
+	/* The first write after the budget expires flushes the batch */
+	time_sleep(250);
+
+	pBuffer = rsslGetBuffer(clientChannel, 100, RSSL_FALSE, &err);
+	ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error info: " << err.text;
+	memset(pBuffer->data, 'a', 100);
+	pBuffer->length = 100;
+
+	ret = rsslWrite(clientChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err);
+	ASSERT_EQ(ret, RSSL_RET_SUCCESS) << "rsslWrite did not flush the batch. Return code:" << ret << " Error info: " << err.text;
+
+	ASSERT_EQ(rsslGetChannelStats(clientChannel, &stats, &err), RSSL_RET_SUCCESS) << "rsslGetChannelStats failed. Error info: " << err.text;
+	EXPECT_EQ(stats.writeCoalesceStats.flushCount, 1u);
+	EXPECT_EQ(stats.writeCoalesceStats.queueDelayUsec[RSSL_WRITE_COALESCE_HIST_SIZE - 1], 1u);
+	EXPECT_EQ(stats.writeCoalesceStats.batchBytes[0], 0u);
+	for (i = 0; i < RSSL_WRITE_COALESCE_HIST_SIZE; ++i)
+		batchSamples += stats.writeCoalesceStats.batchBytes[i];
+	EXPECT_EQ(batchSamples, 1u);
+
+	/* Without a budget nothing more is sampled */
+	budgetUsec = 0;
+	ASSERT_EQ(rsslIoctl(clientChannel, RSSL_WRITE_COALESCE_BUDGET, &budgetUsec, &err), RSSL_RET_SUCCESS) << "rsslIoctl failed. Error info: " << err.text;
+
+	pBuffer = rsslGetBuffer(clientChannel, 100, RSSL_FALSE, &err);
+	ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error info: " << err.text;
+	memset(pBuffer->data, 'a', 100);
+	pBuffer->length = 100;
+
+	ret = rsslWrite(clientChannel, pBuffer, RSSL_HIGH_PRIORITY, RSSL_WRITE_DIRECT_SOCKET_WRITE, &bytesWritten, &uncompBytesWritten, &err);
+	ASSERT_EQ(ret, RSSL_RET_SUCCESS) << "rsslWrite failed. Return code:" << ret << " Error info: " << err.text;
+
+	ASSERT_EQ(rsslGetChannelStats(clientChannel, &stats, &err), RSSL_RET_SUCCESS) << "rsslGetChannelStats failed. Error info: " << err.text;
+	EXPECT_EQ(stats.writeCoalesceStats.flushCount, 1u);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*	Test negotiates LZ4 stream compression, then writes similar messages from the client, some
+	large enough to be fragmented, across more data than the compression history holds.  Verifies
+	that the server reads every message intact and in order, and that the similar messages compress. */
+TEST_F(GlobalLockTests, LZ4StreamCompression)
+{
+	const int totalMsgs = 3000;
+	const RsslUInt32 largeMsgSize = 20000;
+	RsslChannelInfo channelInfo;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslUInt64 totalBytesWritten = 0, totalUncompBytesWritten = 0;
+	RsslBuffer* pBuffer;
+	RsslRet ret;
+	RsslError err;
+	int written = 0, received = 0;
+
+	startupServerAndConections(RSSL_FALSE, RSSL_COMP_LZ4_STREAM);
+
+	ASSERT_EQ(rsslGetChannelInfo(clientChannel, &channelInfo, &err), RSSL_RET_SUCCESS) << "rsslGetChannelInfo failed. Error info: " << err.text;
+	ASSERT_EQ(channelInfo.compressionType, RSSL_COMP_LZ4_STREAM);
+
+	while (written < totalMsgs)
+	{
+		bool large = (written % 500 == 7);
+		pBuffer = rsslGetBuffer(clientChannel, large ? largeMsgSize : 1000, RSSL_FALSE, &err);
+
+		if (pBuffer == NULL)
+		{
+			rsslFlush(clientChannel, &err);
+			continue;
+		}
+
+		pBuffer->length = snprintf(pBuffer->data, 1000, "msg %d BID=%d.%02d ASK=%d.%02d BIDSIZE=%d ASKSIZE=%d TRDPRC_1=%d.%02d ACVOL_1=%d",
+			written, 100 + written % 7, written % 100, 101 + written % 5, (written * 3) % 100, written % 1000, (written * 7) % 1000, 100 + written % 9, (written * 11) % 100, written * 13);
+		if (large)
+		{
+			for (RsslUInt32 i = pBuffer->length; i < largeMsgSize; ++i)
+				pBuffer->data[i] = (char)('a' + (i * 7 + written) % 26);
+			pBuffer->length = largeMsgSize;
+		}
+
+		ret = rsslWrite(clientChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err);
+		ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_WRITE_CALL_AGAIN) << "rsslWrite failed. Return code:" << ret << " Error info: " << err.text;
+		while (ret > RSSL_RET_SUCCESS || ret == RSSL_RET_WRITE_CALL_AGAIN)
+			ret = rsslFlush(clientChannel, &err);
+		++written;
+		totalBytesWritten += bytesWritten;
+		totalUncompBytesWritten += uncompBytesWritten;
+
+		/* drain everything written so far */
+		while (received < written)
+		{
+			RsslBuffer* pMsg = rsslRead(serverChannel, &ret, &err);
+
+			if (pMsg == NULL)
+			{
+				ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING) << "rsslRead failed. Return code:" << ret << " Error info: " << err.text;
+				continue;
+			}
+
+			char expected[32];
+			RsslUInt32 expectedLength = snprintf(expected, sizeof(expected), "msg %d ", received);
+
+			ASSERT_GE(pMsg->length, expectedLength);
+			ASSERT_EQ(memcmp(pMsg->data, expected, expectedLength), 0) << "Expected " << expected;
+			if (received % 500 == 7)
+			{
+				ASSERT_EQ(pMsg->length, largeMsgSize);
+				EXPECT_EQ(pMsg->data[largeMsgSize - 1], (char)('a' + ((largeMsgSize - 1) * 7 + received) % 26));
+			}
+			++received;
+		}
+	}
+
+	EXPECT_EQ(received, totalMsgs);
+	EXPECT_LT(totalBytesWritten * 2, totalUncompBytesWritten) << "Wrote " << totalBytesWritten << " bytes for " << totalUncompBytesWritten << " uncompressed bytes";
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*	Test enables latency tracing, then reads compressed messages on the server and stamps the
+	last one as if it reached a callback.  Verifies that every message read was stamped, in order,
+	along with its decompression and, on Linux, its socket receive time. */
+TEST_F(GlobalLockTests, LatencyTrace)
+{
+	const int totalMsgs = 100;
+	RsslLatencyTraceOpts traceOpts;
+	RsslLatencyTraceSample samples[1000];
+	RsslUInt32 bytesWritten, uncompBytesWritten, sampleCount, i;
+	RsslUInt32 stageCounts[RSSL_LT_STAGE_COUNT] = { 0 };
+	RsslUInt64 lastMsgId = 0;
+	RsslBuffer* pBuffer;
+	RsslRet ret;
+	RsslError err;
+	int received = 0;
+
+	/* discard anything left by earlier tests */
+	while (rsslLatencyTraceDrain(samples, 1000) == 1000);
+
+	rsslClearLatencyTraceOpts(&traceOpts);
+	traceOpts.socketTimestamps = RSSL_TRUE;
+	ASSERT_EQ(rsslLatencyTraceEnable(&traceOpts), RSSL_RET_SUCCESS);
+
+	startupServerAndConections(RSSL_FALSE, RSSL_COMP_LZ4_STREAM);
+
+	/* the handshake is not traced */
+	while (rsslLatencyTraceDrain(samples, 1000) == 1000);
+
+	for (received = 0; received < totalMsgs; ++received)
+	{
+		RsslBuffer* pMsg = NULL;
+
+		pBuffer = rsslGetBuffer(clientChannel, 200, RSSL_FALSE, &err);
+		ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error info: " << err.text;
+		pBuffer->length = snprintf(pBuffer->data, 200, "msg %d BID=%d.%02d ASK=%d.%02d BIDSIZE=%d ASKSIZE=%d",
+			received, 100 + received % 7, received % 100, 101 + received % 5, (received * 3) % 100, received % 1000, (received * 7) % 1000);
+
+		ret = rsslWrite(clientChannel, pBuffer, RSSL_HIGH_PRIORITY, RSSL_WRITE_DIRECT_SOCKET_WRITE, &bytesWritten, &uncompBytesWritten, &err);
+		ASSERT_EQ(ret, RSSL_RET_SUCCESS) << "rsslWrite failed. Return code:" << ret << " Error info: " << err.text;
+
+		while (pMsg == NULL)
+		{
+			pMsg = rsslRead(serverChannel, &ret, &err);
+			ASSERT_TRUE(pMsg != NULL || ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING) << "rsslRead failed. Return code:" << ret << " Error info: " << err.text;
+		}
+	}
+
+	rsslLatencyTraceStamp(RSSL_LT_USER_CALLBACK);
+	rsslLatencyTraceDisable();
+
+	sampleCount = rsslLatencyTraceDrain(samples, 1000);
+	ASSERT_LT(sampleCount, 1000u);
+
+	for (i = 0; i < sampleCount; ++i)
+	{
+		ASSERT_LT(samples[i].stage, (RsslUInt8)RSSL_LT_STAGE_COUNT);
+		++stageCounts[samples[i].stage];
+
+		/* each message is stamped at the transport read last among the transport stages */
+		if (samples[i].stage == RSSL_LT_TRANSPORT_READ)
+		{
+			EXPECT_GT(samples[i].msgId, lastMsgId);
+			lastMsgId = samples[i].msgId;
+		}
+		else if (samples[i].stage == RSSL_LT_USER_CALLBACK)
+			EXPECT_EQ(samples[i].msgId, lastMsgId);
+		else
+			EXPECT_GT(samples[i].msgId, lastMsgId);
+	}
+
+	EXPECT_EQ(stageCounts[RSSL_LT_TRANSPORT_READ], (RsslUInt32)totalMsgs);
+	EXPECT_EQ(stageCounts[RSSL_LT_DECOMPRESS], (RsslUInt32)totalMsgs);
+	EXPECT_EQ(stageCounts[RSSL_LT_USER_CALLBACK], 1u);
+#if defined(Linux)
+	EXPECT_EQ(stageCounts[RSSL_LT_SOCKET_RECV], (RsslUInt32)totalMsgs);
+#endif
+	EXPECT_EQ(rsslLatencyTraceDroppedCount(), 0u);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*	Test flushes two messages with one send, so the server reads both with one receive.
+	Verifies that only the first message read is given the socket receive time. */
+TEST_F(GlobalLockTests, LatencyTraceRecvTimeNotReused)
+{
+	const int totalMsgs = 2;
+	RsslLatencyTraceOpts traceOpts;
+	RsslLatencyTraceSample samples[1000];
+	RsslUInt32 bytesWritten, uncompBytesWritten, sampleCount, i;
+	RsslUInt32 stageCounts[RSSL_LT_STAGE_COUNT] = { 0 };
+	RsslBuffer* pBuffer;
+	RsslRet ret;
+	RsslError err;
+	int received = 0;
+
+	while (rsslLatencyTraceDrain(samples, 1000) == 1000);
+
+	rsslClearLatencyTraceOpts(&traceOpts);
+	traceOpts.socketTimestamps = RSSL_TRUE;
+	ASSERT_EQ(rsslLatencyTraceEnable(&traceOpts), RSSL_RET_SUCCESS);
+
+	startupServerAndConections(RSSL_FALSE);
+
+	while (rsslLatencyTraceDrain(samples, 1000) == 1000);
+
+	for (i = 0; i < (RsslUInt32)totalMsgs; ++i)
+	{
+		pBuffer = rsslGetBuffer(clientChannel, 100, RSSL_FALSE, &err);
+		ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error info: " << err.text;
+		pBuffer->length = snprintf(pBuffer->data, 100, "msg %u", i);
+
+		ret = rsslWrite(clientChannel, pBuffer, RSSL_HIGH_PRIORITY, RSSL_WRITE_NO_FLAGS, &bytesWritten, &uncompBytesWritten, &err);
+		ASSERT_GT(ret, RSSL_RET_SUCCESS) << "rsslWrite should have queued the message. Error info: " << err.text;
+	}
+
+	while ((ret = rsslFlush(clientChannel, &err)) > RSSL_RET_SUCCESS);
+	ASSERT_EQ(ret, RSSL_RET_SUCCESS) << "rsslFlush failed. Error info: " << err.text;
+
+	while (received < totalMsgs)
+	{
+		RsslBuffer* pMsg = rsslRead(serverChannel, &ret, &err);
+		ASSERT_TRUE(pMsg != NULL || ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING) << "rsslRead failed. Return code:" << ret << " Error info: " << err.text;
+
+		if (pMsg != NULL)
+			++received;
+	}
+
+	rsslLatencyTraceDisable();
+
+	sampleCount = rsslLatencyTraceDrain(samples, 1000);
+
+	for (i = 0; i < sampleCount; ++i)
+	{
+		ASSERT_LT(samples[i].stage, (RsslUInt8)RSSL_LT_STAGE_COUNT);
+		++stageCounts[samples[i].stage];
+	}
+
+	EXPECT_EQ(stageCounts[RSSL_LT_TRANSPORT_READ], (RsslUInt32)totalMsgs);
+#if defined(Linux)
+	EXPECT_EQ(stageCounts[RSSL_LT_SOCKET_RECV], 1u);
+#endif
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
 class AllLockTests : public ::testing::Test {
 protected:
 	RsslChannel* serverChannel;
@@ -2226,6 +2687,73 @@ TEST_F(AllLockTests, BlockingClientWriterServerTwoReaderPing)
 
 }
 
+/*	Several encoder threads reserve buffers with rsslGetBuffers and queue them on the client
+	channel with rsslQueueWrite, while this thread is the only one calling rsslFlush.  Verifies
+	that every message arrives once and that each writer's messages arrive in the order queued. */
+TEST_F(AllLockTests, NonBlockingQueueWriteManyWriters)
+{
+	const int numWriters = 4;
+	const int msgsPerWriter = 10000;
+	RsslThreadId writeThreads[numWriters];
+	QueueWriteChannel writeOpts[numWriters];
+	int nextSeq[numWriters];
+	int received = 0;
+	RsslReadInArgs readInArgs;
+	RsslReadOutArgs readOutArgs;
+	RsslBuffer* readBuf;
+	RsslRet ret;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	for (int i = 0; i < numWriters; ++i)
+	{
+		nextSeq[i] = 0;
+		writeOpts[i].pThreadId = &writeThreads[i];
+		writeOpts[i].pChnl = clientChannel;
+		writeOpts[i].writerId = i;
+		writeOpts[i].msgCount = msgsPerWriter;
+		RSSL_THREAD_START(&writeThreads[i], queueWriteThread, (void*)&writeOpts[i]);
+	}
+
+	while (received < numWriters * msgsPerWriter && !failTest)
+	{
+		ret = rsslFlush(clientChannel, &err);
+		ASSERT_GE(ret, RSSL_RET_SUCCESS) << "rsslFlush failed. Error: " << err.text;
+
+		do
+		{
+			rsslClearReadInArgs(&readInArgs);
+			rsslClearReadOutArgs(&readOutArgs);
+			readBuf = rsslReadEx(serverChannel, &readInArgs, &readOutArgs, &ret, &err);
+			ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING) << "rsslRead failed. Error: " << err.text;
+
+			if (readBuf)
+			{
+				int writerId = -1, seq = -1;
+				char msg[64];
+
+				snprintf(msg, sizeof(msg), "%.*s", (int)readBuf->length, readBuf->data);
+				ASSERT_EQ(sscanf(msg, "%d %d", &writerId, &seq), 2);
+				ASSERT_TRUE(writerId >= 0 && writerId < numWriters);
+				ASSERT_EQ(seq, nextSeq[writerId]) << "Writer " << writerId << " out of order";
+				++nextSeq[writerId];
+				++received;
+			}
+		} while (ret > RSSL_RET_SUCCESS);
+	}
+
+	shutdownTest = true;
+
+	for (int i = 0; i < numWriters; ++i)
+		RSSL_THREAD_JOIN(writeThreads[i]);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+	EXPECT_EQ(received, numWriters * msgsPerWriter);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
 class ManyThreadConnectionTests : public ::testing::Test {
 protected:
 	RsslServer* server;
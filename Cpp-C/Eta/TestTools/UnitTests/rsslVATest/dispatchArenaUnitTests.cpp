@@ -0,0 +1,180 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+
+/* Tests the RsslDispatchArena the reactor decodes RDM messages into. */
+#include "rtr/rsslDispatchArena.h"
+
+#include <string.h>
+
+TEST(DispatchArenaTest, AllocAligned)
+{
+	RsslDispatchArena arena;
+	char *pFirst, *pSecond;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDispatchArenaInit(&arena, 256));
+
+	pFirst = (char*)rsslDispatchArenaAlloc(&arena, 3);
+	pSecond = (char*)rsslDispatchArenaAlloc(&arena, 16);
+	ASSERT_TRUE(pFirst != NULL);
+	ASSERT_TRUE(pSecond != NULL);
+	EXPECT_EQ(0u, (RsslUInt64)pFirst % 8);
+	EXPECT_EQ(0u, (RsslUInt64)pSecond % 8);
+	EXPECT_EQ(8, pSecond - pFirst);
+
+	EXPECT_EQ(2u, arena.allocCount);
+	EXPECT_EQ(24u, arena.allocBytes);
+	EXPECT_EQ(1u, arena.blockAllocCount);
+
+	rsslDispatchArenaCleanup(&arena);
+}
+
+TEST(DispatchArenaTest, ResetReusesMemory)
+{
+	RsslDispatchArena arena;
+	char *pFirst;
+	int i;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDispatchArenaInit(&arena, 256));
+
+	pFirst = (char*)rsslDispatchArenaAlloc(&arena, 100);
+
+	for (i = 0; i < 10; ++i)
+	{
+		rsslDispatchArenaReset(&arena);
+		EXPECT_EQ(pFirst, (char*)rsslDispatchArenaAlloc(&arena, 100));
+	}
+
+	rsslDispatchArenaReset(&arena);
+	EXPECT_EQ(1u, arena.lastAllocCount);
+	EXPECT_EQ(104u, arena.lastAllocBytes);
+	EXPECT_EQ(11u, arena.totalAllocCount);
+	EXPECT_EQ(0u, arena.allocCount);
+
+	/* No block was allocated after the first. */
+	EXPECT_EQ(1u, arena.blockAllocCount);
+
+	rsslDispatchArenaCleanup(&arena);
+}
+
+TEST(DispatchArenaTest, OverflowCoalescesOnReset)
+{
+	RsslDispatchArena arena;
+	int i;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDispatchArenaInit(&arena, 64));
+
+	/* Overflow the first block several times in one pass. */
+	for (i = 0; i < 10; ++i)
+	{
+		char *pMem = (char*)rsslDispatchArenaAlloc(&arena, 40);
+		ASSERT_TRUE(pMem != NULL);
+		memset(pMem, i, 40);
+	}
+	EXPECT_EQ(10u, arena.blockAllocCount);
+
+	/* The next pass gets one block large enough for what was allocated,
+	 * rounded up to a multiple of the initial block size. */
+	rsslDispatchArenaReset(&arena);
+	EXPECT_EQ(448u, arena.blockSize);
+	EXPECT_EQ(11u, arena.blockAllocCount);
+	EXPECT_EQ(400u, arena.maxAllocBytes);
+
+	for (i = 0; i < 10; ++i)
+		ASSERT_TRUE(rsslDispatchArenaAlloc(&arena, 40) != NULL);
+
+	rsslDispatchArenaReset(&arena);
+	EXPECT_EQ(11u, arena.blockAllocCount);
+
+	rsslDispatchArenaCleanup(&arena);
+}
+
+TEST(DispatchArenaTest, GrownBlockShrinks)
+{
+	RsslDispatchArena arena;
+	int i;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDispatchArenaInit(&arena, 64));
+
+	ASSERT_TRUE(rsslDispatchArenaAlloc(&arena, 1000) != NULL);
+	rsslDispatchArenaReset(&arena);
+	EXPECT_EQ(1024u, arena.blockSize);
+
+	/* A pass using over a quarter of the block keeps it at its size. */
+	ASSERT_TRUE(rsslDispatchArenaAlloc(&arena, 300) != NULL);
+	for (i = 0; i < 1024; ++i)
+		rsslDispatchArenaReset(&arena);
+	EXPECT_EQ(1024u, arena.blockSize);
+
+	/* Passes that use little of it halve it, until they use over a quarter of it. */
+	for (i = 0; i < 1024; ++i)
+	{
+		ASSERT_TRUE(rsslDispatchArenaAlloc(&arena, 40) != NULL);
+		rsslDispatchArenaReset(&arena);
+	}
+	EXPECT_EQ(512u, arena.blockSize);
+
+	for (i = 0; i < 1024 * 8; ++i)
+	{
+		ASSERT_TRUE(rsslDispatchArenaAlloc(&arena, 40) != NULL);
+		rsslDispatchArenaReset(&arena);
+	}
+	EXPECT_EQ(128u, arena.blockSize);
+
+	rsslDispatchArenaCleanup(&arena);
+}
+
+TEST(DispatchArenaTest, LargeAlloc)
+{
+	RsslDispatchArena arena;
+	char *pMem;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDispatchArenaInit(&arena, 64));
+
+	pMem = (char*)rsslDispatchArenaAlloc(&arena, 1000);
+	ASSERT_TRUE(pMem != NULL);
+	memset(pMem, 0, 1000);
+	EXPECT_EQ(2u, arena.blockAllocCount);
+
+	rsslDispatchArenaCleanup(&arena);
+}
+
+TEST(DispatchArenaTest, BufferCommitAndGrow)
+{
+	RsslDispatchArena arena;
+	RsslBuffer buffer;
+	char *pStart;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDispatchArenaInit(&arena, 64));
+
+	rsslDispatchArenaGetBuffer(&arena, &buffer);
+	EXPECT_EQ(64u, buffer.length);
+	pStart = buffer.data;
+
+	/* Keep part of the buffer; the next one starts after it. */
+	rsslDispatchArenaCommit(&arena, 10);
+	rsslDispatchArenaGetBuffer(&arena, &buffer);
+	EXPECT_EQ(pStart + 16, buffer.data);
+	EXPECT_EQ(48u, buffer.length);
+
+	/* Grow when the space left is not enough. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDispatchArenaGrow(&arena, 100));
+	rsslDispatchArenaGetBuffer(&arena, &buffer);
+	EXPECT_EQ(128u, buffer.length);
+
+	rsslDispatchArenaCommit(&arena, 128);
+	rsslDispatchArenaGetBuffer(&arena, &buffer);
+	EXPECT_EQ(0u, buffer.length);
+
+	rsslDispatchArenaReset(&arena);
+	EXPECT_EQ(2u, arena.lastAllocCount);
+	EXPECT_EQ(144u, arena.lastAllocBytes);
+
+	rsslDispatchArenaCleanup(&arena);
+}
@@ -7,6 +7,8 @@
  */
 
 #include "rtr/rsslReactor.h"
+#include "rtr/rsslReactorUtils.h"
+#include "rtr/rsslDispatchArena.h"
 #include "testFramework.h"
 #include "gtest/gtest.h"
 #include "rtr/rsslVAUtils.h"
@@ -178,7 +180,7 @@ typedef struct
 	MyReactorEventQueue reactorEventQueue; 
 	RsslNotifier *pNotifier; 
 	RsslNotifierEvent *pQueueNotifierEvent; 
-	RsslBuffer memoryBuffer;
+	RsslDispatchArena dispatchArena;
 	RsslInt64 lastRecordedTimeMs;
 	RsslInt32 channelCount;			
 	RsslInt32 maxEventsInPool; 
@@ -267,6 +269,8 @@ static void reactorUnitTests_InitializationAndPingTimeout(RsslConnectionTypes co
 static void reactorUnitTests_ShortPingInterval(RsslConnectionTypes connectionType);
 static void reactorUnitTests_InvalidArguments(RsslConnectionTypes connectionType);
 static void reactorUnitTests_BigDirectoryMsg(RsslConnectionTypes connectionType);
+static void reactorUnitTests_DispatchDecodeMemoryOverflow(RsslConnectionTypes connectionType);
+static void reactorUnitTests_JsonConversionCache(RsslConnectionTypes connectionType);
 
 static void reactorUnitTests_DisconnectFromCallbacks(RsslConnectionTypes connectionType);
 static void reactorUnitTests_AddConnectionFromCallbacks(RsslConnectionTypes connectionType);
@@ -344,6 +348,17 @@ TEST_P(ReactorUtilTest, BigDirectoryMsg)
 	reactorUnitTests_BigDirectoryMsg(GetParam());
 }
 
+TEST_P(ReactorUtilTest, DispatchDecodeMemoryOverflow)
+{
+	reactorUnitTests_DispatchDecodeMemoryOverflow(GetParam());
+}
+
+TEST_P(ReactorUtilTest, JsonConversionCache)
+{
+	if (GetParam() == RSSL_CONN_TYPE_WEBSOCKET)
+		reactorUnitTests_JsonConversionCache(GetParam());
+}
+
 TEST_P(ReactorUtilTest, DisconnectFromCallbacks)
 {
 	reactorUnitTests_DisconnectFromCallbacks(GetParam());
@@ -3801,6 +3816,18 @@ static void reactorUnitTests_InvalidArguments(RsslConnectionTypes connectionType
 	ommNIProviderRole.pDirectoryRefresh = (RsslRDMDirectoryRefresh*)&directoryRequest;
 	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts[index], (RsslReactorChannelRole*)&ommNIProviderRole, &rsslErrorInfo) == RSSL_RET_INVALID_ARGUMENT);
 	ASSERT_TRUE(rsslReactorAccept(pConsMon->pReactor, NULL, &acceptOpts, (RsslReactorChannelRole*)&ommNIProviderRole, &rsslErrorInfo) == RSSL_RET_INVALID_ARGUMENT);
+
+	/*** rsslCreateReactor() ***/
+
+	/* A worker CPU that cannot be bound fails the creation, rather than leaving a reactor without a worker. */
+	{
+		RsslCreateReactorOptions reactorOpts;
+
+		rsslClearCreateReactorOptions(&reactorOpts);
+		reactorOpts.workerCpuId = 100000;
+		ASSERT_TRUE(rsslCreateReactor(&reactorOpts, &rsslErrorInfo) == NULL);
+		ASSERT_TRUE(rsslErrorInfo.rsslErrorInfoCode == RSSL_EIC_FAILURE);
+	}
 }
 
 void reactorUnitTests_ShortPingInterval(RsslConnectionTypes connectionType)
@@ -4558,6 +4585,398 @@ static void reactorUnitTests_BigDirectoryMsg(RsslConnectionTypes connectionType)
 	}
 }
 
+static void reactorUnitTests_DispatchDecodeMemoryOverflow(RsslConnectionTypes connectionType)
+{
+	/* Test that a directory refresh needing more decode memory than dispatchDecodeMemoryBufferSize
+	 * is still delivered to the callback, and that the dispatch stats report the pass. */
+
+	RsslRDMService serviceList[4];
+	char serviceNames[4][16];
+	RsslReactorDispatchStats dispatchStats;
+	RsslInt32 i;
+	int index = (connectionType == RSSL_CONN_TYPE_WEBSOCKET) ? 1 : 0;
+
+	/* Recreate the reactors with a buffer that cannot hold the decoded service list. */
+	cleanupReactors(RSSL_FALSE);
+	rsslClearCreateReactorOptions(&mOpts);
+	mOpts.dispatchDecodeMemoryBufferSize = 512;
+	initReactors(&mOpts, RSSL_FALSE);
+
+	clearObjects();
+	ommConsumerRole.pLoginRequest = &loginRequest;
+	ommConsumerRole.pDirectoryRequest = &directoryRequest;
+	ommConsumerRole.loginMsgCallback = loginMsgCallback;
+	ommConsumerRole.directoryMsgCallback = directoryMsgCallback;
+	ommProviderRole.loginMsgCallback = loginMsgCallback;
+	ommProviderRole.directoryMsgCallback = directoryMsgCallback;
+
+	for(i = 0; i < 4; ++i)
+	{
+		rsslClearRDMService(&serviceList[i]);
+		serviceList[i].flags |= RDM_SVCF_HAS_INFO;
+		serviceList[i].info.flags |= RDM_SVC_IFF_HAS_DICTS_PROVIDED;
+
+		serviceList[i].info.serviceName.data = serviceNames[i];
+		serviceList[i].info.serviceName.length = snprintf(serviceNames[i], 16, "Service_%d", i);
+
+		serviceList[i].info.dictionariesProvidedList = dictionariesProvidedList;
+		serviceList[i].info.dictionariesProvidedCount = dictionariesProvidedCount;
+		serviceList[i].serviceId = i + 1;
+	}
+
+	directoryRefresh.serviceList = serviceList;
+	directoryRefresh.serviceCount = 4;
+
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts[index], (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(waitForConnection(pServer[index], 100));
+	ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pServer[index], &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Prov: Conn up */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pProvCh[0] = pProvMon->mutMsg.pReactorChannel;
+
+	/* Prov: Conn ready */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Cons: Conn up */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pConsCh[0] = pConsMon->mutMsg.pReactorChannel;
+
+	/* Cons: (flush complete) */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	/* Prov: Receive Login Request */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_RDM && pProvMon->mutMsg.rdmMsg.rdmMsgBase.domainType == RSSL_DMT_LOGIN && pProvMon->mutMsg.rdmMsg.rdmMsgBase.rdmMsgType == RDM_LG_MT_REQUEST );
+
+	/* Prov: Send login refresh (+ flush) */
+	sendRDMMsg(pProvMon->pReactor, pProvMon->mutMsg.pReactorChannel, (RsslRDMMsg*)&loginRefresh, 400);
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	/* Cons: Receive Login Refresh */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_RDM && pConsMon->mutMsg.rdmMsg.rdmMsgBase.domainType == RSSL_DMT_LOGIN && pConsMon->mutMsg.rdmMsg.rdmMsgBase.rdmMsgType == RDM_LG_MT_REFRESH );
+
+	/* Cons: (flush complete) */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	/* Prov: Receive Directory Request */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_RDM && pProvMon->mutMsg.rdmMsg.rdmMsgBase.domainType == RSSL_DMT_SOURCE && pProvMon->mutMsg.rdmMsg.rdmMsgBase.rdmMsgType == RDM_DR_MT_REQUEST );
+
+	/* Prov: Send directory refresh (+ flush) */
+	sendRDMMsg(pProvMon->pReactor, pProvMon->mutMsg.pReactorChannel, (RsslRDMMsg*)&directoryRefresh, 1000);
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	/* Cons: Receive Directory Refresh, decoded past the end of the initial buffer */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_RDM && pConsMon->mutMsg.rdmMsg.rdmMsgBase.domainType == RSSL_DMT_SOURCE && pConsMon->mutMsg.rdmMsg.rdmMsgBase.rdmMsgType == RDM_DR_MT_REFRESH );
+	ASSERT_EQ(4u, pConsMon->mutMsg.rdmMsg.directoryMsg.refresh.serviceCount);
+
+	/* Cons: Conn ready -- this pass records the stats of the one that decoded the refresh */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	ASSERT_TRUE(rsslReactorGetDispatchStats(pConsMon->pReactor, &dispatchStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	EXPECT_GT(dispatchStats.maxDispatchAllocBytes, 512u);
+	EXPECT_GT(dispatchStats.blockAllocCount, 1u);
+	EXPECT_GE(dispatchStats.blockSize, dispatchStats.maxDispatchAllocBytes);
+
+	/* Cons: Close (+ ack) */
+	removeConnection(pConsMon, pConsCh[0]);
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	/* Prov: Conn down */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
+
+	/* Prov: Close(+ ack) */
+	removeConnection(pProvMon, pProvCh[0]);
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	/* Set value back to default */
+	cleanupReactors(RSSL_FALSE);
+	rsslClearCreateReactorOptions(&mOpts);
+	initReactors(&mOpts, RSSL_FALSE);
+}
+
+/* Encodes an update (with a field list) or a close for IBM.N on the given stream and submits it to a JSON channel. */
+static RsslRet submitJsonCacheMsg(RsslReactorChannel *pReactorChannel, RsslUInt8 msgClass, RsslInt32 streamId)
+{
+	RsslBuffer *pBuffer;
+	RsslReactorSubmitOptions submitOpts;
+	RsslMsg rsslMsg;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt prodPerm = 10;
+	RsslEncodeIterator eIter;
+	RsslRet ret;
+
+	rsslClearReactorSubmitOptions(&submitOpts);
+
+	if (!(pBuffer = rsslReactorGetBuffer(pReactorChannel, 256, RSSL_FALSE, &rsslErrorInfo)))
+		return RSSL_RET_FAILURE;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pReactorChannel->majorVersion, pReactorChannel->minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+
+	if (msgClass == RSSL_MC_CLOSE)
+	{
+		rsslClearCloseMsg(&rsslMsg.closeMsg);
+		rsslMsg.msgBase.streamId = streamId;
+		rsslMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		rsslMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		ret = rsslEncodeMsg(&eIter, &rsslMsg);
+	}
+	else
+	{
+		rsslClearUpdateMsg(&rsslMsg.updateMsg);
+		rsslMsg.msgBase.streamId = streamId;
+		rsslMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		rsslMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+		rsslMsg.updateMsg.flags = RSSL_UPMF_HAS_MSG_KEY;
+		rsslMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_NAME;
+		rsslMsg.msgBase.msgKey.name = itemName;
+
+		if ((ret = rsslEncodeMsgInit(&eIter, &rsslMsg, 0)) == RSSL_RET_ENCODE_CONTAINER)
+		{
+			rsslClearFieldList(&fieldList);
+			fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+			rsslEncodeFieldListInit(&eIter, &fieldList, NULL, 0);
+
+			rsslClearFieldEntry(&fieldEntry);
+			fieldEntry.fieldId = 1;
+			fieldEntry.dataType = RSSL_DT_UINT;
+			rsslEncodeFieldEntry(&eIter, &fieldEntry, &prodPerm);
+
+			rsslEncodeFieldListComplete(&eIter, RSSL_TRUE);
+			ret = rsslEncodeMsgComplete(&eIter, RSSL_TRUE);
+		}
+	}
+
+	if (ret != RSSL_RET_SUCCESS)
+	{
+		rsslReactorReleaseBuffer(pReactorChannel, pBuffer, &rsslErrorInfo);
+		return ret;
+	}
+
+	pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+
+	if ((ret = rsslReactorSubmit(pProvMon->pReactor, pReactorChannel, pBuffer, &submitOpts, &rsslErrorInfo)) < RSSL_RET_SUCCESS)
+		rsslReactorReleaseBuffer(pReactorChannel, pBuffer, &rsslErrorInfo);
+
+	return ret;
+}
+
+/* Reads the next JSON message from a WebSocket client, skipping the reactor's pings.
+ * The provider reactor is dispatched while waiting so that it can read and answer the client. */
+static RsslBool readJsonMsg(RsslChannel *pRsslCh, char *pJsonMsg, RsslUInt32 maxLength)
+{
+	RsslBuffer *pBuffer;
+	RsslRet ret;
+	int attempts;
+
+	for (attempts = 0; attempts < 100; ++attempts)
+	{
+		if ((pBuffer = rsslRead(pRsslCh, &ret, &rsslErrorInfo.rsslError)) != NULL)
+		{
+			if (pBuffer->length >= maxLength)
+				return RSSL_FALSE;
+
+			memcpy(pJsonMsg, pBuffer->data, pBuffer->length);
+			pJsonMsg[pBuffer->length] = '\0';
+
+			if (strstr(pJsonMsg, "\"Type\":\"Ping\"") == NULL)
+				return RSSL_TRUE;
+		}
+		else if (ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING)
+			dispatchEvent(pProvMon, 10);
+		else if (ret < RSSL_RET_SUCCESS)
+			return RSSL_FALSE;
+	}
+
+	return RSSL_FALSE;
+}
+
+/* Returns the text following the "ID" member of a JSON message, or NULL if the message has a different ID. */
+static const char *jsonMsgAfterId(const char *pJsonMsg, RsslInt32 streamId)
+{
+	char idText[32];
+	const char *pId;
+
+	snprintf(idText, sizeof(idText), "\"ID\":%d", streamId);
+
+	if ((pId = strstr(pJsonMsg, idText)) == NULL)
+		return NULL;
+
+	return pId + strlen(idText);
+}
+
+/* Returns how many messages the provider reactor sent from its JSON conversion cache. */
+static RsslUInt64 jsonCacheHitCount()
+{
+	return _reactorGetJsonConversionCacheHits(pProvMon->pReactor);
+}
+
+/* Connects a raw JSON WebSocket client to the provider reactor and returns the client channel. */
+static RsslChannel *connectJsonClient(RsslReactorChannel **ppProvCh)
+{
+	RsslChannel *pRsslCh;
+	RsslInProgInfo inProg;
+
+	if (!(pRsslCh = rsslConnect(&connectOpts[1].rsslConnectOptions, &rsslErrorInfo.rsslError)))
+		return NULL;
+
+	EXPECT_TRUE(waitForConnection(pServer[1], 100));
+	EXPECT_TRUE(rsslReactorAccept(pProvMon->pReactor, pServer[1], &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	while(pRsslCh->state == RSSL_CH_STATE_INITIALIZING)
+	{
+		RsslRet ret = rsslInitChannel(pRsslCh, &inProg, &rsslErrorInfo.rsslError);
+		EXPECT_TRUE(ret == RSSL_RET_SUCCESS || ret == RSSL_RET_CHAN_INIT_IN_PROGRESS);
+		if (ret < RSSL_RET_SUCCESS)
+			break;
+	}
+
+	EXPECT_TRUE(pRsslCh->state == RSSL_CH_STATE_ACTIVE);
+
+	/* Prov: Conn up/ready */
+	EXPECT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	EXPECT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	*ppProvCh = pProvMon->mutMsg.pReactorChannel;
+	EXPECT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	EXPECT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	return pRsslCh;
+}
+
+static void reactorUnitTests_JsonConversionCache(RsslConnectionTypes connectionType)
+{
+	/* Test that a message submitted to several JSON channels on different streams is converted once and
+	 * reused with each stream's ID, and that the reuse never hands out a close or a stale conversion. */
+
+	RsslChannel *pClientCh[2];
+	RsslReactorChannel *pJsonProvCh[2];
+	char jsonMsg[2][1024];
+	const char *pAfterId[2];
+	char badJson[] = "{\"ID\":7,\"Type\":\"Bogus\"}";
+	RsslBuffer *pBuffer;
+	RsslReactorSubmitOptions submitOpts;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslUInt64 hitCount;
+	RsslRet ret;
+	int i;
+
+	clearObjects();
+
+	for (i = 0; i < 2; ++i)
+	{
+		ASSERT_TRUE((pClientCh[i] = connectJsonClient(&pJsonProvCh[i])) != NULL);
+		ASSERT_TRUE(pClientCh[i]->state == RSSL_CH_STATE_ACTIVE);
+	}
+
+	/*** The same update on two streams: each gets its own ID and the same body ***/
+
+	hitCount = jsonCacheHitCount();
+	ASSERT_TRUE(submitJsonCacheMsg(pJsonProvCh[0], RSSL_MC_UPDATE, 5) >= RSSL_RET_SUCCESS);
+	ASSERT_EQ(hitCount, jsonCacheHitCount());
+	ASSERT_TRUE(submitJsonCacheMsg(pJsonProvCh[1], RSSL_MC_UPDATE, 6) >= RSSL_RET_SUCCESS);
+	ASSERT_EQ(++hitCount, jsonCacheHitCount()); /* Only the stream ID was rewritten. */
+	dispatchEvent(pProvMon, 100);
+
+	ASSERT_TRUE(readJsonMsg(pClientCh[0], jsonMsg[0], sizeof(jsonMsg[0])));
+	ASSERT_TRUE(readJsonMsg(pClientCh[1], jsonMsg[1], sizeof(jsonMsg[1])));
+	ASSERT_TRUE(strstr(jsonMsg[0], "\"Type\":\"Update\"") != NULL);
+	ASSERT_TRUE(strstr(jsonMsg[0], "IBM.N") != NULL);
+	ASSERT_TRUE((pAfterId[0] = jsonMsgAfterId(jsonMsg[0], 5)) != NULL);
+	ASSERT_TRUE((pAfterId[1] = jsonMsgAfterId(jsonMsg[1], 6)) != NULL);
+	ASSERT_STREQ(pAfterId[0], pAfterId[1]);
+	ASSERT_TRUE(jsonMsgAfterId(jsonMsg[1], 5) == NULL);
+
+	/*** Closes are converted for each stream rather than reused ***/
+
+	ASSERT_TRUE(submitJsonCacheMsg(pJsonProvCh[0], RSSL_MC_CLOSE, 5) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(submitJsonCacheMsg(pJsonProvCh[1], RSSL_MC_CLOSE, 6) >= RSSL_RET_SUCCESS);
+	ASSERT_EQ(hitCount, jsonCacheHitCount());
+	dispatchEvent(pProvMon, 100);
+
+	ASSERT_TRUE(readJsonMsg(pClientCh[0], jsonMsg[0], sizeof(jsonMsg[0])));
+	ASSERT_TRUE(readJsonMsg(pClientCh[1], jsonMsg[1], sizeof(jsonMsg[1])));
+	ASSERT_TRUE(strstr(jsonMsg[0], "\"Type\":\"Close\"") != NULL);
+	ASSERT_TRUE(strstr(jsonMsg[1], "\"Type\":\"Close\"") != NULL);
+	ASSERT_TRUE(jsonMsgAfterId(jsonMsg[0], 5) != NULL);
+	ASSERT_TRUE(jsonMsgAfterId(jsonMsg[1], 6) != NULL);
+	ASSERT_TRUE(jsonMsgAfterId(jsonMsg[1], 5) == NULL);
+
+	/*** An error message built by the converter invalidates the last conversion ***/
+
+	ASSERT_TRUE(submitJsonCacheMsg(pJsonProvCh[0], RSSL_MC_UPDATE, 5) >= RSSL_RET_SUCCESS);
+	dispatchEvent(pProvMon, 100);
+	ASSERT_TRUE(readJsonMsg(pClientCh[0], jsonMsg[0], sizeof(jsonMsg[0])));
+	ASSERT_TRUE((pAfterId[0] = jsonMsgAfterId(jsonMsg[0], 5)) != NULL);
+
+	/* Client: Send a message the provider cannot convert */
+	ASSERT_TRUE((pBuffer = rsslGetBuffer(pClientCh[1], (RsslUInt32)strlen(badJson), RSSL_FALSE, &rsslErrorInfo.rsslError)) != NULL);
+	memcpy(pBuffer->data, badJson, strlen(badJson));
+	pBuffer->length = (RsslUInt32)strlen(badJson);
+	ASSERT_TRUE(rsslWrite(pClientCh[1], pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &rsslErrorInfo.rsslError) >= RSSL_RET_SUCCESS);
+	while ((ret = rsslFlush(pClientCh[1], &rsslErrorInfo.rsslError)) > RSSL_RET_SUCCESS);
+	ASSERT_TRUE(ret == RSSL_RET_SUCCESS);
+
+	/* Prov: Reply with an error message (the channel stays up) */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+	ASSERT_TRUE(readJsonMsg(pClientCh[1], jsonMsg[1], sizeof(jsonMsg[1])));
+	ASSERT_TRUE(strstr(jsonMsg[1], "\"Type\":\"Error\"") != NULL);
+
+	/* The same update on another stream is converted again rather than taken from the error message. */
+	ASSERT_TRUE(submitJsonCacheMsg(pJsonProvCh[1], RSSL_MC_UPDATE, 6) >= RSSL_RET_SUCCESS);
+	ASSERT_EQ(hitCount, jsonCacheHitCount());
+	dispatchEvent(pProvMon, 100);
+	ASSERT_TRUE(readJsonMsg(pClientCh[1], jsonMsg[1], sizeof(jsonMsg[1])));
+	ASSERT_TRUE((pAfterId[1] = jsonMsgAfterId(jsonMsg[1], 6)) != NULL);
+	ASSERT_STREQ(pAfterId[0], pAfterId[1]);
+
+	/*** A buffer that fails to decode is rejected, and the next message is still converted ***/
+
+	ASSERT_TRUE((pBuffer = rsslReactorGetBuffer(pJsonProvCh[0], 256, RSSL_FALSE, &rsslErrorInfo)) != NULL);
+	memset(pBuffer->data, 0, 3);
+	pBuffer->length = 3;
+	rsslClearReactorSubmitOptions(&submitOpts);
+	ASSERT_TRUE(rsslReactorSubmit(pProvMon->pReactor, pJsonProvCh[0], pBuffer, &submitOpts, &rsslErrorInfo) < RSSL_RET_SUCCESS);
+	ASSERT_TRUE(rsslReactorReleaseBuffer(pJsonProvCh[0], pBuffer, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	ASSERT_TRUE(submitJsonCacheMsg(pJsonProvCh[0], RSSL_MC_UPDATE, 7) >= RSSL_RET_SUCCESS);
+	ASSERT_EQ(hitCount, jsonCacheHitCount());
+	dispatchEvent(pProvMon, 100);
+	ASSERT_TRUE(readJsonMsg(pClientCh[0], jsonMsg[0], sizeof(jsonMsg[0])));
+	ASSERT_TRUE((pAfterId[0] = jsonMsgAfterId(jsonMsg[0], 7)) != NULL);
+	ASSERT_STREQ(pAfterId[0], pAfterId[1]);
+
+	for (i = 0; i < 2; ++i)
+	{
+		ASSERT_TRUE(rsslCloseChannel(pClientCh[i], &rsslErrorInfo.rsslError) >= RSSL_RET_SUCCESS);
+
+		/* Prov: Conn down */
+		ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+		ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
+
+		/* Prov: No message(close ack) */
+		ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+		ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+	}
+}
+
 static void reactorUnitTests_AddConnectionFromCallbacksInt_Cons(RsslInt32 reconnectAttempts, RsslConnectionTypes connectionType)
 {
 	RsslReactorChannel *pProvCh;
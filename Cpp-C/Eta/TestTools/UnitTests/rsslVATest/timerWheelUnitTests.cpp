@@ -0,0 +1,180 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+
+/* Tests the RsslTimerWheel used internally by the watchlist and reactor worker. */
+#include "rtr/rsslTimerWheel.h"
+
+#include <stdlib.h>
+
+static const RsslInt64 startTime = 1600000000123LL;
+
+TEST(TimerWheelTest, ExpireInOrder)
+{
+	RsslTimerWheel wheel;
+	RsslTimerWheelTimer timers[3];
+	int i;
+
+	rsslTimerWheelInit(&wheel, startTime);
+	for (i = 0; i < 3; ++i)
+		rsslClearTimerWheelTimer(&timers[i]);
+
+	rsslTimerWheelSchedule(&wheel, &timers[0], startTime + 5);
+	rsslTimerWheelSchedule(&wheel, &timers[1], startTime + 100);
+	rsslTimerWheelSchedule(&wheel, &timers[2], startTime + 100000);
+	ASSERT_EQ(3, rsslTimerWheelGetTimerCount(&wheel));
+	ASSERT_EQ(startTime + 5, rsslTimerWheelGetNextExpireTime(&wheel));
+
+	/* Nothing is due yet. */
+	ASSERT_EQ(0, rsslTimerWheelAdvance(&wheel, startTime + 4));
+	ASSERT_EQ(NULL, rsslTimerWheelPopExpired(&wheel));
+
+	ASSERT_EQ(1, rsslTimerWheelAdvance(&wheel, startTime + 5));
+	ASSERT_EQ(&timers[0], rsslTimerWheelPopExpired(&wheel));
+	ASSERT_FALSE(rsslTimerWheelTimerIsArmed(&timers[0]));
+	ASSERT_EQ(NULL, rsslTimerWheelPopExpired(&wheel));
+
+	/* Timers in upper levels are reported at their own expire time, not when their slot cascades. */
+	ASSERT_EQ(startTime + 100, rsslTimerWheelGetNextExpireTime(&wheel));
+
+	ASSERT_EQ(1, rsslTimerWheelAdvance(&wheel, startTime + 99999));
+	ASSERT_EQ(&timers[1], rsslTimerWheelPopExpired(&wheel));
+	ASSERT_EQ(NULL, rsslTimerWheelPopExpired(&wheel));
+
+	ASSERT_EQ(1, rsslTimerWheelAdvance(&wheel, startTime + 100000));
+	ASSERT_EQ(&timers[2], rsslTimerWheelPopExpired(&wheel));
+	ASSERT_EQ(0, rsslTimerWheelGetTimerCount(&wheel));
+	ASSERT_EQ(RSSL_TW_TIME_UNSET, rsslTimerWheelGetNextExpireTime(&wheel));
+}
+
+TEST(TimerWheelTest, CancelAndReschedule)
+{
+	RsslTimerWheel wheel;
+	RsslTimerWheelTimer timer1, timer2;
+
+	rsslTimerWheelInit(&wheel, startTime);
+	rsslClearTimerWheelTimer(&timer1);
+	rsslClearTimerWheelTimer(&timer2);
+
+	rsslTimerWheelSchedule(&wheel, &timer1, startTime + 10);
+	rsslTimerWheelSchedule(&wheel, &timer2, startTime + 10);
+	rsslTimerWheelCancel(&wheel, &timer1);
+	ASSERT_FALSE(rsslTimerWheelTimerIsArmed(&timer1));
+	ASSERT_EQ(1, rsslTimerWheelGetTimerCount(&wheel));
+
+	/* Cancelling a timer that is not armed does nothing. */
+	rsslTimerWheelCancel(&wheel, &timer1);
+	ASSERT_EQ(1, rsslTimerWheelGetTimerCount(&wheel));
+
+	/* Rescheduling moves the timer. */
+	rsslTimerWheelSchedule(&wheel, &timer2, startTime + 5000);
+	ASSERT_EQ(0, rsslTimerWheelAdvance(&wheel, startTime + 10));
+
+	/* Expired timers can be cancelled before they are popped. */
+	ASSERT_EQ(1, rsslTimerWheelAdvance(&wheel, startTime + 6000));
+	rsslTimerWheelCancel(&wheel, &timer2);
+	ASSERT_EQ(NULL, rsslTimerWheelPopExpired(&wheel));
+	ASSERT_EQ(0, rsslTimerWheelGetTimerCount(&wheel));
+
+	/* Timers scheduled in the past expire on the next advance. */
+	rsslTimerWheelSchedule(&wheel, &timer1, startTime);
+	ASSERT_EQ(1, rsslTimerWheelAdvance(&wheel, startTime + 6000));
+	ASSERT_EQ(&timer1, rsslTimerWheelPopExpired(&wheel));
+}
+
+TEST(TimerWheelTest, CancelEarliestUpperLevelTimer)
+{
+	RsslTimerWheel wheel;
+	RsslTimerWheelTimer timer1, timer2;
+
+	rsslTimerWheelInit(&wheel, startTime);
+	rsslClearTimerWheelTimer(&timer1);
+	rsslClearTimerWheelTimer(&timer2);
+
+	/* Both timers share a level 1 slot. */
+	rsslTimerWheelSchedule(&wheel, &timer1, startTime + 1000);
+	rsslTimerWheelSchedule(&wheel, &timer2, startTime + 1010);
+	EXPECT_EQ(startTime + 1000, rsslTimerWheelGetNextExpireTime(&wheel));
+
+	/* The slot keeps the cancelled timer's time until it passes, which is early but never late. */
+	rsslTimerWheelCancel(&wheel, &timer1);
+	EXPECT_EQ(startTime + 1000, rsslTimerWheelGetNextExpireTime(&wheel));
+	EXPECT_EQ(0, rsslTimerWheelAdvance(&wheel, startTime + 1000));
+
+	/* Once it has passed, the slot is rescanned. */
+	EXPECT_EQ(startTime + 1010, rsslTimerWheelGetNextExpireTime(&wheel));
+	EXPECT_EQ(1, rsslTimerWheelAdvance(&wheel, startTime + 1010));
+	EXPECT_EQ(&timer2, rsslTimerWheelPopExpired(&wheel));
+	EXPECT_EQ(RSSL_TW_TIME_UNSET, rsslTimerWheelGetNextExpireTime(&wheel));
+}
+
+class TimerWheelRandomTest : public ::testing::Test
+{
+protected:
+	static const int timerCount = 1000;
+	RsslTimerWheelTimer *timers;
+
+	virtual void SetUp()
+	{
+		timers = (RsslTimerWheelTimer*)malloc(timerCount * sizeof(RsslTimerWheelTimer));
+	}
+
+	virtual void TearDown()
+	{
+		free(timers);
+	}
+};
+
+TEST_F(TimerWheelRandomTest, RandomSchedule)
+{
+	RsslTimerWheel wheel;
+	RsslInt64 currentTime = startTime;
+	int i, j;
+
+	ASSERT_TRUE(timers != NULL);
+
+	srand(12345);
+	rsslTimerWheelInit(&wheel, startTime);
+	for (i = 0; i < timerCount; ++i)
+		rsslClearTimerWheelTimer(&timers[i]);
+
+	for (i = 0; i < 20000; ++i)
+	{
+		RsslTimerWheelTimer *pTimer;
+		RsslInt64 earliest = RSSL_TW_TIME_UNSET;
+
+		/* Spread timers across all levels, including the overflow list. */
+		switch (rand() % 5)
+		{
+			case 0: rsslTimerWheelSchedule(&wheel, &timers[rand() % timerCount], currentTime + rand() % 64); break;
+			case 1: rsslTimerWheelSchedule(&wheel, &timers[rand() % timerCount], currentTime + rand() % 300000); break;
+			case 2: rsslTimerWheelSchedule(&wheel, &timers[rand() % timerCount], currentTime + (RsslInt64)(rand() % 1000) * 100000); break;
+			case 3: rsslTimerWheelCancel(&wheel, &timers[rand() % timerCount]); break;
+			default:
+				for (j = 0; j < timerCount; ++j)
+					if (rsslTimerWheelTimerIsArmed(&timers[j]) && timers[j].expireTime < earliest)
+						earliest = timers[j].expireTime;
+				ASSERT_LE(rsslTimerWheelGetNextExpireTime(&wheel), earliest);
+
+				currentTime += (rand() % 4 == 0) ? rand() % 5000000 : rand() % 200;
+				rsslTimerWheelAdvance(&wheel, currentTime);
+				while ((pTimer = rsslTimerWheelPopExpired(&wheel)))
+					ASSERT_LE(pTimer->expireTime, currentTime);
+
+				for (j = 0; j < timerCount; ++j)
+				{
+					if (rsslTimerWheelTimerIsArmed(&timers[j]))
+					{
+						ASSERT_GT(timers[j].expireTime, currentTime);
+					}
+				}
+				break;
+		}
+	}
+}
@@ -23,6 +23,7 @@ void watchlistRecoveryTest_PrivateStreamWithPayloadAndExtHeader(RsslConnectionTy
 void watchlistRecoveryTest_OneItem_AllowSuspectDataOff(RsslConnectionTypes connetionType);
 void watchlistRecoveryTest_OneItem_GroupMerge(RsslConnectionTypes connetionType);
 void watchlistRecoveryTest_TwoItems_ClosedRecoverFromServiceState(RsslConnectionTypes connetionType);
+void watchlistRecoveryTest_TwoItems_PacedRecoveryByPriority(RsslConnectionTypes connetionType);
 void watchlistRecoveryTest_OneItem_ClosedRecoverFromGroupState(RsslConnectionTypes connetionType);
 void watchlistRecoveryTest_OneItem_LoginClosedRecover(RsslBool singleOpen, RsslConnectionTypes connetionType);
 void watchlistRecoveryTest_OneItem_LoginClosed(RsslConnectionTypes connetionType);
@@ -154,6 +155,11 @@ TEST_P(WatchlistRecoveryTest, TwoItems_ClosedRecoverFromServiceState)
 	watchlistRecoveryTest_TwoItems_ClosedRecoverFromServiceState(GetParam());
 }
 
+TEST_P(WatchlistRecoveryTest, TwoItems_PacedRecoveryByPriority)
+{
+	watchlistRecoveryTest_TwoItems_PacedRecoveryByPriority(GetParam());
+}
+
 TEST_P(WatchlistRecoveryTest, OneItem_GroupMerge)
 {
 	watchlistRecoveryTest_OneItem_GroupMerge(GetParam());
@@ -4833,3 +4839,183 @@ void watchlistRecoveryTest_OneItem_Disconnect(RsslBool singleOpen, RsslConnectio
 
 	wtfFinishTest();
 }
+
+void watchlistRecoveryTest_TwoItems_PacedRecoveryByPriority(RsslConnectionTypes connetionType)
+{
+	/* Test that recovering items are re-requested highest priority class first, 
+	 * no more than maxOutstandingRecoveryRefreshes at a time. */
+
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslRefreshMsg	refreshMsg, *pRefreshMsg;
+	RsslStatusMsg	*pStatusMsg;
+	RsslInt32		providerItemStream;
+	RsslRDMDirectoryUpdate directoryUpdate;
+	RsslRDMService service1;
+	RsslReactorSubmitMsgOptions opts;
+	RsslReactorWatchlistRecoveryStats recoveryStats;
+	WtfSetupConnectionOpts csOpts;
+	RsslBuffer		itemNames[] = { { 3, const_cast<char*>("TRI") }, { 4, const_cast<char*>("GOOG") } };
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&csOpts);
+	csOpts.maxOutstandingRecoveryRefreshes = 1;
+	wtfSetupConnection(&csOpts, connetionType);
+
+	/* Request first item, with default priority. */
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = 2;
+	requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_HAS_QOS;
+	requestMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+	requestMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+	requestMsg.msgBase.msgKey.flags |= RSSL_MKF_HAS_NAME;
+	requestMsg.msgBase.msgKey.name = itemNames[0];
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_FALSE);
+
+	/* Request second item, with a higher priority class. */
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = 3;
+	requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_HAS_QOS | RSSL_RQMF_HAS_PRIORITY;
+	requestMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+	requestMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+	requestMsg.priorityClass = 5;
+	requestMsg.priorityCount = 1;
+	requestMsg.msgBase.msgKey.flags |= RSSL_MKF_HAS_NAME;
+	requestMsg.msgBase.msgKey.name = itemNames[1];
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider receives both requests (new requests are not paced). */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(rsslBufferIsEqual(&itemNames[0], &pRequestMsg->msgBase.msgKey.name));
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(rsslBufferIsEqual(&itemNames[1], &pRequestMsg->msgBase.msgKey.name));
+
+	/* Provider sends closed-recover via directory. */
+	rsslClearRDMDirectoryUpdate(&directoryUpdate);
+	directoryUpdate.rdmMsgBase.streamId = wtfGetProviderDirectoryStream();
+	directoryUpdate.filter = wtfGetProviderDirectoryFilter();
+	rsslClearRDMService(&service1);
+	service1.serviceId = service1Id;
+	service1.flags = RDM_SVCF_HAS_STATE; 
+	service1.state.flags |= RDM_SVC_STF_HAS_STATUS;
+	service1.state.status.streamState = RSSL_STREAM_CLOSED_RECOVER;
+	service1.state.status.dataState = RSSL_DATA_SUSPECT;
+	service1.state.status.text.data = const_cast<char*>("All items closed-recover.");
+	service1.state.status.text.length = (RsslUInt32)strlen(service1.state.status.text.data);
+	directoryUpdate.serviceCount = 1;
+	directoryUpdate.serviceList = &service1;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRDMMsg = (RsslRDMMsg*)&directoryUpdate;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Consumer receives Open/Suspect status for both items. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pStatusMsg = (RsslStatusMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pStatusMsg->msgBase.msgClass == RSSL_MC_STATUS);
+	ASSERT_TRUE(pStatusMsg->msgBase.streamId == 2);
+	ASSERT_TRUE(pStatusMsg->state.streamState == RSSL_STREAM_OPEN);
+	ASSERT_TRUE(pStatusMsg->state.dataState == RSSL_DATA_SUSPECT);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pStatusMsg = (RsslStatusMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pStatusMsg->msgBase.msgClass == RSSL_MC_STATUS);
+	ASSERT_TRUE(pStatusMsg->msgBase.streamId == 3);
+	ASSERT_TRUE(pStatusMsg->state.streamState == RSSL_STREAM_OPEN);
+	ASSERT_TRUE(pStatusMsg->state.dataState == RSSL_DATA_SUSPECT);
+
+	/* Provider receives only the higher-priority item's request. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH));
+	ASSERT_TRUE(pRequestMsg->flags & RSSL_RQMF_STREAMING);
+	ASSERT_TRUE(rsslBufferIsEqual(&itemNames[1], &pRequestMsg->msgBase.msgKey.name));
+	providerItemStream = pRequestMsg->msgBase.streamId;
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	rsslClearReactorWatchlistRecoveryStats(&recoveryStats);
+	ASSERT_TRUE(wtfGetWatchlistRecoveryStats(&recoveryStats) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(recoveryStats.queuedCount == 1);
+	ASSERT_TRUE(recoveryStats.outstandingCount == 1);
+	ASSERT_TRUE(recoveryStats.recoveredCount == 0);
+	ASSERT_TRUE(recoveryStats.topPriorityClass == 5);
+	ASSERT_TRUE(recoveryStats.topPriorityClassCount == 1);
+
+	/* Provider sends refresh. */
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.flags = RSSL_RFMF_HAS_MSG_KEY | RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_HAS_QOS
+		| RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE;
+	refreshMsg.msgBase.streamId = providerItemStream;
+	refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	refreshMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	refreshMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME;
+	refreshMsg.msgBase.msgKey.serviceId = service1Id;
+	refreshMsg.msgBase.msgKey.name = itemNames[1];
+	refreshMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+	refreshMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+	refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+	refreshMsg.state.dataState = RSSL_DATA_OK;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Consumer receives refresh. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+	ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 3);
+	ASSERT_TRUE(pRefreshMsg->state.streamState == RSSL_STREAM_OPEN);
+	ASSERT_TRUE(pRefreshMsg->state.dataState == RSSL_DATA_OK);
+
+	/* Provider now receives the other item's request. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH));
+	ASSERT_TRUE(pRequestMsg->flags & RSSL_RQMF_STREAMING);
+	ASSERT_TRUE(rsslBufferIsEqual(&itemNames[0], &pRequestMsg->msgBase.msgKey.name));
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	rsslClearReactorWatchlistRecoveryStats(&recoveryStats);
+	ASSERT_TRUE(wtfGetWatchlistRecoveryStats(&recoveryStats) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(recoveryStats.queuedCount == 0);
+	ASSERT_TRUE(recoveryStats.outstandingCount == 1);
+	ASSERT_TRUE(recoveryStats.recoveredCount == 1);
+	ASSERT_TRUE(recoveryStats.topPriorityClass == 1);
+
+	wtfFinishTest();
+}
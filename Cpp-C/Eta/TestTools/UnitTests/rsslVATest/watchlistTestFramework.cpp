@@ -1039,6 +1039,8 @@ void wtfSetupConnection(WtfSetupConnectionOpts *pOpts, RsslConnectionTypes conne
 	wtf.ommConsumerRole.watchlistOptions.channelOpenCallback = channelEventCallback;
 	wtf.ommConsumerRole.watchlistOptions.requestTimeout = pOpts->requestTimeout;
 	wtf.ommConsumerRole.watchlistOptions.postAckTimeout = pOpts->postAckTimeout;
+	wtf.ommConsumerRole.watchlistOptions.recoveryRequestRate = pOpts->recoveryRequestRate;
+	wtf.ommConsumerRole.watchlistOptions.maxOutstandingRecoveryRefreshes = pOpts->maxOutstandingRecoveryRefreshes;
 
 	/* wtfDispatch() multiplies times less than 1 second. So set
 	 * requestTimeout/postAckTimeout accordingly. */
@@ -1517,6 +1519,13 @@ RsslRet wtfGetChannelInfo(WtfComponent component, RsslReactorChannelInfo *pChann
 	return rsslReactorGetChannelInfo(pReactorChannel, pChannelInfo, &rsslErrorInfo);
 }
 
+RsslRet wtfGetWatchlistRecoveryStats(RsslReactorWatchlistRecoveryStats *pStats)
+{
+	RsslErrorInfo rsslErrorInfo;
+
+	return rsslReactorGetWatchlistRecoveryStats(wtf.pConsReactor, wtf.pConsReactorChannel, pStats, &rsslErrorInfo);
+}
+
 static void wtfConsumerEncodeSLBehaviorsElement(RsslEncodeIterator *pIter, RsslUInt slDataStreamFlags)
 {
 	RsslElementList behaviorsEList;
@@ -303,6 +303,8 @@ typedef struct
 	WtfCallbackAction	providerDictionaryCallback;		/* Enables provider dictionaryMsgCallback. */
 	RsslUInt32	postAckTimeout;					/* Sets watchlist post ack timeout. */
 	RsslUInt32	requestTimeout;					/* Sets watchlist request timeout. */
+	RsslUInt32	recoveryRequestRate;			/* Sets watchlist recovery request rate. */
+	RsslUInt32	maxOutstandingRecoveryRefreshes;	/* Sets watchlist outstanding recovery refresh limit. */
 	RsslBool	multicastGapRecovery;			/* Provider's login response indicates
 												 * whether watchlist should recover from gaps. */
 } WtfSetupConnectionOpts;
@@ -325,6 +327,8 @@ static void wtfClearSetupConnectionOpts(WtfSetupConnectionOpts *pOpts)
 	pOpts->providerDictionaryCallback = WTF_CB_USE_DOMAIN_CB;
 	pOpts->postAckTimeout = 15000;
 	pOpts->requestTimeout = 15000;
+	pOpts->recoveryRequestRate = 0;
+	pOpts->maxOutstandingRecoveryRefreshes = 0;
 	pOpts->multicastGapRecovery = RSSL_TRUE;
 }
 
@@ -344,6 +348,9 @@ void wtfAcceptWithTime(time_t timeoutMsec);
 /* Gets channel information (wraps around rsslReactorGetChannelInfo). */
 RsslRet wtfGetChannelInfo(WtfComponent component, RsslReactorChannelInfo *pChannelInfo);
 
+/* Gets the consumer's item recovery progress (wraps around rsslReactorGetWatchlistRecoveryStats). */
+RsslRet wtfGetWatchlistRecoveryStats(RsslReactorWatchlistRecoveryStats *pStats);
+
 /* Returns the currently-used connection type for the test. */
 RsslConnectionTypes wtfGetConnectionType();
 